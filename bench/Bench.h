@@ -0,0 +1,37 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+
+namespace mud
+{
+	template <class T_Function>
+	double bench_ms(T_Function func)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		func();
+		auto end = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double, std::milli>(end - start).count();
+	}
+
+	inline int& bench_failures()
+	{
+		static int failures = 0;
+		return failures;
+	}
+
+	// the timings are only printed, but the results they measure are checked : a failed check makes the bench exit with an error
+	inline bool bench_check(bool condition, const char* what)
+	{
+		if(!condition)
+		{
+			printf("  FAILED : %s\n", what);
+			bench_failures()++;
+		}
+		return condition;
+	}
+}
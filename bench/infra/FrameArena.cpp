@@ -0,0 +1,35 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#include <infra/FrameArena.h>
+
+#include <Bench.h>
+
+#include <cstdio>
+
+using namespace mud;
+
+// per frame allocations from an arena with two shared blocks : the heap blocks of a busy frame serve the next frames
+void bench_frame_arena(uint32_t frames)
+{
+	FrameArena arena = { 2, 1 };
+
+	auto frame = [&](size_t blocks)
+	{
+		for(size_t i = 0; i < blocks; ++i)
+			arena.thread(0).alloc(FrameBlock::Size - 16, 16);
+		arena.next_frame();
+		return arena.m_last_frame.m_num_heap_allocs;
+	};
+
+	bench_check(frame(4) == 2, "blocks missing from the shared arena come from the heap");
+	bench_check(frame(1) == 0 && frame(4) == 0, "heap blocks are kept through a quiet frame");
+
+	const double ms = bench_ms([&] {
+		for(uint32_t i = 0; i < frames; ++i)
+			frame(i % 4 + 1);
+	});
+	printf("frame arena : %u frames %.2f ms, %zu heap allocations last frame\n", frames, ms, arena.m_last_frame.m_num_heap_allocs);
+	bench_check(arena.m_last_frame.m_num_heap_allocs == 0, "steady frames don't allocate from the heap");
+}
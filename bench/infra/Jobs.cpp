@@ -0,0 +1,99 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#include <infra/Config.h>
+#include <infra/Job.h>
+#include <infra/JobLoop.h>
+
+#include <Bench.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace mud;
+
+// fork/join overhead of the job system : count jobs forked from one parent per frame, then split recursively by the parallel loop
+// jobs beyond the storage capacity make it grow, and jobs beyond the queue size are run inline
+void bench_jobs(uint32_t count, uint32_t frames)
+{
+	JobSystem js;
+	js.adopt();
+
+	std::atomic<uint32_t> done = { 0 };
+	printf("jobs bench : %u jobs per frame, %u threads\n", count, js.threads());
+
+	for(uint32_t frame = 0; frame < frames; ++frame)
+	{
+		done = 0;
+		const double fork = bench_ms([&]
+		{
+			Job* parent = js.job();
+			for(uint32_t i = 0; i < count; ++i)
+			{
+				Job* job = js.job(parent, [&done](JobSystem&, Job*) { done.fetch_add(1, std::memory_order_relaxed); });
+				js.run(job);
+			}
+			js.complete(parent);
+		});
+		bench_check(done == count, "every forked job ran before its parent completed");
+
+		done = 0;
+		const double split = bench_ms([&]
+		{
+			auto loop = [&done](JobSystem&, Job*, size_t start, size_t count) { UNUSED(start); done.fetch_add(uint32_t(count), std::memory_order_relaxed); };
+			Job* job = jobs(js, nullptr, 0, count, loop, CountSplitter<1, 24>());
+			js.complete(job);
+		});
+		bench_check(done == count, "the split jobs cover the whole range");
+
+		printf("  frame %u : fork %.2f ms (%.1f ns per job), split %.2f ms (%.1f ns per job), capacity %zu\n",
+			   frame, fork, fork * 1e6 / count, split, split * 1e6 / count, js.capacity());
+	}
+
+	js.emancipate();
+}
+
+// frame jobs while long background jobs are queued : with the background budget, frame time should stay close to the idle one
+void bench_job_lanes(uint32_t count, uint32_t background, double background_ms)
+{
+	JobSystem js;
+	js.adopt();
+
+	std::atomic<uint32_t> done = { 0 };
+	std::atomic<uint32_t> decoded = { 0 };
+	printf("job lanes bench : %u frame jobs, %u background jobs of %.1f ms, budget %u\n", count, background, background_ms, js.background_budget());
+
+	auto frame = [&]
+	{
+		Job* parent = js.job();
+		for(uint32_t i = 0; i < count; ++i)
+			js.run(js.job(parent, [&done](JobSystem&, Job*) { done.fetch_add(1, std::memory_order_relaxed); }));
+		js.complete(parent);
+	};
+
+	const double idle = bench_ms(frame);
+
+	for(uint32_t i = 0; i < background; ++i)
+	{
+		Job* job = js.job(nullptr, [&decoded, background_ms](JobSystem&, Job*)
+		{
+			auto start = std::chrono::high_resolution_clock::now();
+			while(std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() < background_ms)
+				;
+			decoded.fetch_add(1, std::memory_order_relaxed);
+		});
+		js.run(job, JobSystem::BACKGROUND);
+	}
+
+	const double loaded = bench_ms(frame);
+	bench_check(done == 2 * count, "every frame job ran before the frame completed");
+
+	const double drained = bench_ms([&] { while(decoded.load() < background) if(!js.yield()) std::this_thread::yield(); });
+	bench_check(decoded == background, "every background job ran");
+
+	printf("  frame idle %.2f ms, frame with background %.2f ms, background drained in %.2f ms\n", idle, loaded, drained);
+
+	js.emancipate();
+}
@@ -0,0 +1,23 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#include <Bench.h>
+
+#include <cstdint>
+
+void bench_jobs(uint32_t count, uint32_t frames);
+void bench_job_lanes(uint32_t count, uint32_t background, double background_ms);
+void bench_parallel(uint32_t max_count);
+void bench_name_lookup(uint32_t count, uint32_t lookups);
+void bench_frame_arena(uint32_t frames);
+
+int main()
+{
+	bench_jobs(1 << 20, 4);
+	bench_job_lanes(1 << 16, 64, 2.0);
+	bench_parallel(1 << 22);
+	bench_name_lookup(2000, 1 << 18);
+	bench_frame_arena(1 << 12);
+	return mud::bench_failures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,54 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#include <infra/NameTable.h>
+
+#include <Bench.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace mud;
+
+// finding names among as many as a few loaded modules declare, linearly like the reflection used to, and in a NameTable
+void bench_name_lookup(uint32_t count, uint32_t lookups)
+{
+	std::vector<std::string> names;
+	for(uint32_t i = 0; i < count; ++i)
+		names.push_back("mud::Type" + std::to_string(i * 7919 % 100003));
+
+	NameTable table;
+	for(uint32_t i = 0; i < count; ++i)
+		table.insert(names[i].c_str(), i);
+
+	bool found = true;
+	for(uint32_t i = 0; i < count; ++i)
+		found &= table.find(names[i].c_str()) == i;
+	bench_check(found, "every name is found at its index");
+	bench_check(table.find("mud::Missing") == NameTable::NotFound, "a missing name is not found");
+
+	std::vector<std::string> queries;
+	for(uint32_t i = 0; i < 256; ++i)
+		queries.push_back(names[(i * 31) % count]);
+
+	uint32_t linear_found = 0;
+	uint32_t table_found = 0;
+	const double linear = bench_ms([&] {
+		for(uint32_t i = 0; i < lookups; ++i)
+		{
+			cstring name = queries[i & 255].c_str();
+			for(uint32_t j = 0; j < count; ++j)
+				if(strcmp(names[j].c_str(), name) == 0) { linear_found += j; break; }
+		}
+	});
+	const double hashed = bench_ms([&] {
+		for(uint32_t i = 0; i < lookups; ++i)
+			table_found += table.find(queries[i & 255].c_str());
+	});
+
+	printf("name lookup bench : %u names, %u lookups\n", count, lookups);
+	printf("  linear %.1f ns, hashed %.1f ns\n", linear * 1e6 / lookups, hashed * 1e6 / lookups);
+	bench_check(linear_found == table_found, "hashed lookups match the linear ones");
+}
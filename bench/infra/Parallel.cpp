@@ -0,0 +1,69 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#include <infra/Parallel.h>
+
+#include <Bench.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+
+using namespace mud;
+
+// parallel algorithms against their serial equivalents, at growing sizes
+void bench_parallel(uint32_t max_count)
+{
+	JobSystem js;
+	js.adopt();
+
+	printf("parallel bench : %u threads\n", js.threads());
+
+	std::mt19937 rng(7);
+	for(uint32_t count = 1 << 10; count <= max_count; count <<= 4)
+	{
+		std::vector<float> values(count);
+		for(float& value : values)
+			value = float(rng() % 1000);
+
+		std::vector<float> output(count);
+		auto transform = [&](uint32_t start, uint32_t count) { for(uint32_t i = start; i < start + count; ++i) output[i] = std::sqrt(values[i]) * 0.5f + 1.f; };
+		const double for_serial = bench_ms([&] { transform(0, count); });
+		const std::vector<float> transformed = output;
+		std::fill(output.begin(), output.end(), 0.f);
+		const double for_parallel = bench_ms([&] { parallel_for(js, 0, count, transform, 1024); });
+		bench_check(output == transformed, "parallel_for matches the serial loop");
+
+		double serial_sum = 0.0;
+		double parallel_sum = 0.0;
+		auto accumulate = [&](double& sum, uint32_t start, uint32_t count) { for(uint32_t i = start; i < start + count; ++i) sum += values[i]; };
+		const double reduce_serial = bench_ms([&] { accumulate(serial_sum, 0, count); });
+		const double reduce_parallel = bench_ms([&] { parallel_sum = parallel_reduce(js, 0, count, 0.0, accumulate, [](double a, double b) { return a + b; }, 1024); });
+		bench_check(parallel_sum == serial_sum, "parallel_reduce matches the serial sum");
+
+		std::vector<float> sorted = values;
+		const double sort_serial = bench_ms([&] { std::sort(sorted.begin(), sorted.end()); });
+		const std::vector<float> serial_sorted = sorted;
+		sorted = values;
+		const double sort_parallel = bench_ms([&] { parallel_sort(js, sorted.data(), count); });
+		bench_check(sorted == serial_sorted, "parallel_sort matches std::sort");
+
+		const double scan_serial = bench_ms([&] { std::partial_sum(values.begin(), values.end(), output.begin()); });
+		const double scan_parallel = bench_ms([&] { parallel_scan(js, values.data(), output.data(), count); });
+
+		// float sums depend on the order of the additions : the scan is checked on integers, which add up the same in any order
+		std::vector<uint32_t> integers(values.begin(), values.end());
+		std::vector<uint32_t> serial_scan(count);
+		std::vector<uint32_t> parallel_scanned(count);
+		std::partial_sum(integers.begin(), integers.end(), serial_scan.begin());
+		parallel_scan(js, integers.data(), parallel_scanned.data(), count);
+		bench_check(parallel_scanned == serial_scan, "parallel_scan matches std::partial_sum");
+
+		printf("  %8u : for %.3f / %.3f ms, reduce %.3f / %.3f ms, sort %.3f / %.3f ms, scan %.3f / %.3f ms (serial / parallel)\n", count,
+			   for_serial, for_parallel, reduce_serial, reduce_parallel, sort_serial, sort_parallel, scan_serial, scan_parallel);
+	}
+
+	js.emancipate();
+}
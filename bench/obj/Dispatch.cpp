@@ -0,0 +1,66 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#include <obj/Any.h>
+#include <obj/DispatchDecl.h>
+
+#include <Bench.h>
+
+#include <functional>
+#include <vector>
+
+using namespace mud;
+
+template <class T>
+void sum_value(T& value, double& sum) { sum += double(value); }
+
+// calls through a Dispatch over the numeric types, against the table of std::function per type id it replaced
+void bench_dispatch(uint32_t count)
+{
+	using Legacy = std::vector<std::function<void(Ref, double&)>>;
+	Legacy legacy(c_max_types);
+	Dispatch<void, double&> dispatch;
+
+	auto add = [&](auto func, auto& value)
+	{
+		using T = typename std::remove_reference<decltype(value)>::type;
+		legacy[type<T>().m_id] = [func](Ref ref, double& sum) { func(val<T>(ref), sum); };
+		dispatch_branch<T>(dispatch, func);
+	};
+
+	int i = 1; float f = 2.f; double d = 3.0; short s = 4; long l = 5; long long ll = 6;
+	unsigned int ui = 7; unsigned short us = 8; unsigned long ul = 9; unsigned long long ull = 10;
+	add(sum_value<int>, i); add(sum_value<float>, f); add(sum_value<double>, d); add(sum_value<short>, s); add(sum_value<long>, l);
+	add(sum_value<long long>, ll); add(sum_value<unsigned int>, ui); add(sum_value<unsigned short>, us); add(sum_value<unsigned long>, ul); add(sum_value<unsigned long long>, ull);
+
+	const std::vector<Ref> values = { Ref(&i), Ref(&f), Ref(&d), Ref(&s), Ref(&l), Ref(&ll), Ref(&ui), Ref(&us), Ref(&ul), Ref(&ull) };
+
+	double legacy_sum = 0.0;
+	double dispatch_sum = 0.0;
+	const double legacy_time = bench_ms([&] { for(uint32_t c = 0; c < count; ++c) { Ref ref = values[c % 10]; legacy[ref.m_type->m_id](ref, legacy_sum); } });
+	const double dispatch_time = bench_ms([&] { for(uint32_t c = 0; c < count; ++c) dispatch.dispatch(values[c % 10], dispatch_sum); });
+
+	const size_t legacy_memory = sizeof(Legacy) + legacy.capacity() * sizeof(Legacy::value_type);
+	printf("dispatch bench : %zu branches, %u calls\n", dispatch.m_branches.size() - 1, count);
+	printf("  std::function table : %zu bytes, %.2f ns per call\n", legacy_memory, legacy_time * 1e6 / count);
+	printf("  sparse dispatch : %zu bytes, %.2f ns per call\n", dispatch.memory(), dispatch_time * 1e6 / count);
+
+	// each round of 10 calls adds 1 + 2 + ... + 10
+	const double expected = 55.0 * (count / 10) + (count % 10) * (count % 10 + 1) / 2;
+	bench_check(dispatch_sum == expected, "dispatch calls the branch of each type");
+	bench_check(legacy_sum == dispatch_sum, "dispatch matches the std::function table");
+
+	bool b = true;
+	bench_check(dispatch.check(type<int>()) && !dispatch.check(type<bool>()), "only the types with a branch are handled");
+
+	bool thrown = false;
+	try { dispatch.dispatch(Ref(&b), dispatch_sum); }
+	catch(const std::bad_function_call&) { thrown = true; }
+	bench_check(thrown, "dispatching a type with no branch throws");
+
+	Dispatch<int> closures;
+	const int offset = 3;
+	closures.function<int>([offset](Ref ref) { return val<int>(ref) + offset; });
+	bench_check(closures.dispatch(Ref(&i)) == 4, "closures are called with what they captured");
+}
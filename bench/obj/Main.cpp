@@ -0,0 +1,17 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#include <Bench.h>
+
+#include <cstdint>
+
+void bench_var(uint32_t count);
+void bench_dispatch(uint32_t count);
+
+int main()
+{
+	bench_var(1 << 20);
+	bench_dispatch(1 << 22);
+	return mud::bench_failures() == 0 ? 0 : 1;
+}
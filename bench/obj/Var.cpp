@@ -0,0 +1,60 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#include <obj/Any.h>
+
+#include <Bench.h>
+
+#include <string>
+#include <vector>
+
+using namespace mud;
+
+namespace
+{
+	// the size of a quat or a Colour, which fits inline, and a trivially copyable value too large for it, which goes to the heap like every value used to
+	struct Small { float m_v[4]; bool operator==(const Small& other) const { return m_v[0] == other.m_v[0]; } };
+	struct Large { float m_v[12]; bool operator==(const Large& other) const { return m_v[0] == other.m_v[0]; } };
+}
+
+namespace mud
+{
+	template <> Type& type<Small>() { static Type ty("Small"); return ty; }
+	template <> Type& type<Large>() { static Type ty("Large"); return ty; }
+}
+
+template <class T>
+void bench_var_value(const char* name, Var value, uint32_t count)
+{
+	std::vector<Var> values(64, value);
+	std::vector<Var> output(64);
+
+	const double copy = bench_ms([&] { for(uint32_t i = 0; i < count; ++i) { Var copy = values[i & 63]; output[i & 63] = copy; } });
+	const double make = bench_ms([&] { for(uint32_t i = 0; i < count; ++i) output[i & 63] = var(val<T>(values[i & 63])); });
+	printf("  %s : copy and assign %.1f ns, make and assign %.1f ns%s\n", name, copy * 1e6 / count, make * 1e6 / count, values[0].m_val.stored_inline() ? "" : " (heap)");
+}
+
+// copy and assign throughput of Var : small values are stored inline in Val, larger values and strings still go to the heap
+// the heap backed values give the baseline : before the inline buffer, Var was 40 bytes and every value was heap backed
+void bench_var(uint32_t count)
+{
+	std::vector<Var> floats(64, var(1.f));
+	std::vector<Var> strings(64, var(std::string("a string long enough to not fit inline")));
+	std::vector<Var> output(64);
+
+	printf("var bench : %u iterations, sizeof(Var) %zu, %zu bytes inline\n", count, sizeof(Var), Val::InlineSize);
+	bench_var_value<float>("float", var(1.f), count);
+	bench_var_value<Small>("16 bytes", var(Small{ { 1.f, 2.f, 3.f, 4.f } }), count);
+	bench_var_value<Large>("48 bytes", var(Large{}), count);
+	bench_var_value<std::string>("string", var(std::string("a string long enough to not fit inline")), count);
+
+	output[0] = strings[0];
+	bench_check(floats[0].m_val.stored_inline() && !strings[0].m_val.stored_inline(), "floats are stored inline and strings on the heap");
+	bench_check(var(Small{}).m_val.stored_inline() && !var(Large{}).m_val.stored_inline(), "values up to the size of a quat are stored inline, larger ones on the heap");
+	bench_check(val<std::string>(output[0]) == val<std::string>(strings[0]) && output[0].m_ref.m_value == output[0].m_val.m_any->ref().m_value, "copies hold the value and refer to their own storage");
+
+	Val value = floats[0].m_val;
+	Val moved = std::move(value);
+	bench_check(val<float>(moved) == 1.f && moved.stored_inline(), "moved inline values keep their value");
+}
@@ -0,0 +1,76 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#include <proto/ECS/Registry.h>
+
+#include <Bench.h>
+
+#include <memory>
+
+using namespace mud;
+
+namespace
+{
+	struct Health
+	{
+		int m_points;
+	};
+
+	// owns heap memory, so that commands dropped without being applied show up as leaks
+	struct Name
+	{
+		std::unique_ptr<int> m_id;
+	};
+}
+
+namespace mud
+{
+	template <> struct TypedBuffer<Health> { using type = ComponentBuffer<Health>; static size_t index() { return 0; } };
+	template <> struct TypedBuffer<Name> { using type = ComponentBuffer<Name>; static size_t index() { return 1; } };
+}
+
+// commands recorded by several threads on the same entities, played back in one sync point
+void test_commands()
+{
+	printf("commands test\n");
+
+	EntityRegistry registry;
+	registry.AddBuffer<Health>();
+	registry.AddBuffer<Name>();
+	registry.ReserveCommands(2);
+
+	const uint32_t a = registry.CreateEntity();
+	const uint32_t b = registry.CreateEntity();
+	registry.AddComponent(a, Health{ 10 });
+	registry.AddComponent(b, Health{ 20 });
+
+	// both threads delete a, and the second one then adds to and removes from it
+	registry.Commands(0).Delete(a);
+	registry.Commands(1).Delete(a);
+	registry.Commands(1).Add(a, Name{ std::make_unique<int>(1) });
+	registry.Commands(1).Remove<Health>(a);
+	registry.Commands(1).Add(b, Name{ std::make_unique<int>(2) });
+	registry.Playback();
+
+	bench_check(!registry.Alive(a) && registry.Alive(b), "only the deleted entity is dead");
+	bench_check(registry.buffer<Health>().m_data.size() == 1 && registry.buffer<Name>().m_data.size() == 1, "commands on a deleted entity are skipped");
+
+	const uint32_t c = registry.CreateEntity();
+	const uint32_t d = registry.CreateEntity();
+	bench_check(c == a && d != a && d != b, "an entity deleted twice is reused once");
+	bench_check(!registry.HasComponent<Health>(c) && !registry.HasComponent<Name>(c), "a reused entity has no components");
+
+	registry.DeleteEntity(b);
+	registry.DeleteEntity(b);
+	bench_check(registry.CreateEntity() == b && registry.CreateEntity() != b, "deleting a dead entity does nothing");
+
+	std::vector<uint32_t> handles = registry.CreateEntities<Health>(4);
+	registry.AddComponent(handles[1], Name{ std::make_unique<int>(3) });
+	const size_t names = registry.buffer<Name>().m_data.size();
+	std::vector<uint32_t> doomed = { handles[0], handles[1], handles[1], handles[3] };
+	registry.DeleteEntities(doomed);
+	bench_check(registry.Alive(handles[2]) && registry.HasComponent<Health>(handles[2]) && registry.buffer<Health>().m_data.size() == 1, "bulk deletion removes the components of the deleted entities only");
+	bench_check(registry.buffer<Name>().m_data.size() == names - 1 && !registry.Alive(handles[1]), "bulk deletion clears every buffer of the entities");
+	bench_check(registry.m_available.size() == 3, "an entity listed twice in a bulk deletion is made available once");
+}
@@ -0,0 +1,145 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#include <proto/ECS/Registry.h>
+#include <proto/ECS/Archetype.h>
+
+#include <Bench.h>
+
+#include <numeric>
+
+using namespace mud;
+
+namespace
+{
+	struct Position
+	{
+		long m_x;
+		long m_y;
+	};
+
+	struct Velocity
+	{
+		long m_x;
+		long m_y;
+	};
+
+	struct Acceleration
+	{
+		long m_x;
+		long m_y;
+	};
+
+	struct Mass
+	{
+		long m_mass;
+	};
+}
+
+namespace mud
+{
+	template <> struct TypedBuffer<Position> { using type = ComponentBuffer<Position>; static size_t index() { return 0; } };
+	template <> struct TypedBuffer<Velocity> { using type = ComponentBuffer<Velocity>; static size_t index() { return 1; } };
+	template <> struct TypedBuffer<Acceleration> { using type = ComponentBuffer<Acceleration>; static size_t index() { return 2; } };
+	template <> struct TypedBuffer<Mass> { using type = ComponentBuffer<Mass>; static size_t index() { return 3; } };
+}
+
+template <class T_Registry>
+long position_sum(T_Registry& registry)
+{
+	long sum = 0;
+	registry.template Loop<Position>([&](uint32_t, Position& p) { sum += p.m_x + p.m_y; });
+	return sum;
+}
+
+// compares the per-type buffers of EntityRegistry with the archetype chunks of ArchetypeRegistry
+// every entity has a Position and a Velocity, one half has an Acceleration, one quarter a Mass
+void bench_ecs(uint32_t count)
+{
+	EntityRegistry registry = { int(count) };
+	registry.AddBuffer<Position>();
+	registry.AddBuffer<Velocity>();
+	registry.AddBuffer<Acceleration>();
+	registry.AddBuffer<Mass>();
+
+	ArchetypeRegistry archetypes = { int(count) };
+	archetypes.AddType<Position>();
+	archetypes.AddType<Velocity>();
+	archetypes.AddType<Acceleration>();
+	archetypes.AddType<Mass>();
+
+	auto populate = [&](auto& registry)
+	{
+		for(uint32_t i = 0; i < count; ++i)
+		{
+			uint32_t handle = registry.CreateEntity();
+			registry.AddComponent(handle, Position{ 0, 0 });
+			registry.AddComponent(handle, Velocity{ 1, 1 });
+			if(i % 2 == 0)
+				registry.AddComponent(handle, Acceleration{ 1, 1 });
+			if(i % 4 == 0)
+				registry.AddComponent(handle, Mass{ 2 });
+		}
+	};
+
+	printf("ecs bench : %u entities\n", count);
+	printf("  populate : buffers %.2f ms, archetypes %.2f ms\n", bench_ms([&] { populate(registry); }), bench_ms([&] { populate(archetypes); }));
+
+	printf("  sort : buffers %.2f ms\n", bench_ms([&] { registry.SortComponents(); }));
+	printf("  sort again : buffers %.2f ms\n", bench_ms([&] { registry.SortComponents(); }));
+
+	auto loop2 = [](uint32_t, Position& p, Velocity& v) { p.m_x += v.m_x; p.m_y += v.m_y; };
+	auto loop3 = [](uint32_t, Position& p, Velocity& v, Acceleration& a) { v.m_x += a.m_x; v.m_y += a.m_y; p.m_x += v.m_x; };
+	auto loop4 = [](uint32_t, Position& p, Velocity& v, Acceleration& a, Mass& m) { v.m_x += a.m_x / m.m_mass; v.m_y += a.m_y / m.m_mass; p.m_x += v.m_x; };
+
+	printf("  2 components : buffers %.2f ms, archetypes %.2f ms\n", bench_ms([&] { registry.Loop<Position, Velocity>(loop2); }), bench_ms([&] { archetypes.Loop<Position, Velocity>(loop2); }));
+	printf("  3 components : buffers %.2f ms, archetypes %.2f ms\n", bench_ms([&] { registry.Loop<Position, Velocity, Acceleration>(loop3); }), bench_ms([&] { archetypes.Loop<Position, Velocity, Acceleration>(loop3); }));
+	printf("  4 components : buffers %.2f ms, archetypes %.2f ms\n", bench_ms([&] { registry.Loop<Position, Velocity, Acceleration, Mass>(loop4); }), bench_ms([&] { archetypes.Loop<Position, Velocity, Acceleration, Mass>(loop4); }));
+
+	// every entity moved by 2, the accelerated ones by 2 more, and those with a mass by 2 more again
+	const long expected = 2 * (long(count) + long((count + 1) / 2) + long((count + 3) / 4));
+	bench_check(position_sum(registry) == expected, "buffers loops move every entity");
+	bench_check(position_sum(archetypes) == expected, "archetypes loops move every entity");
+
+	JobSystem js;
+	js.adopt();
+
+	std::vector<long> distances;
+	auto distance = [](long& sum, uint32_t, Position& p, Velocity& v) { p.m_x += v.m_x; sum += p.m_x; };
+	printf("  2 components parallel : buffers %.2f ms\n", bench_ms([&] { registry.ParallelLoop<Position, Velocity>(js, distances, distance); }));
+	printf("  3 components parallel : buffers %.2f ms\n", bench_ms([&] { registry.ParallelLoop<Position, Velocity, Acceleration>(js, loop3); }));
+
+	js.emancipate();
+
+	// the archetypes went through the same loops so far : running the parallel ones serially on them must give the same results
+	long distance_sum = 0;
+	archetypes.Loop<Position, Velocity>([&](uint32_t handle, Position& p, Velocity& v) { distance(distance_sum, handle, p, v); });
+	archetypes.Loop<Position, Velocity, Acceleration>(loop3);
+	bench_check(std::accumulate(distances.begin(), distances.end(), 0L) == distance_sum, "parallel loop scratch sums match the serial loop");
+	bench_check(position_sum(registry) == position_sum(archetypes), "parallel loops match the serial loops");
+
+	// entity 1 has no Mass : giving it an Acceleration must not mark the Mass buffer for sorting
+	const uint32_t mass_version = registry.buffer<Mass>().m_version;
+	registry.AddComponent(1, Acceleration{ 0, 0 });
+	bench_check(registry.buffer<Mass>().m_version == mass_version, "structural changes only dirty the buffers of the entity");
+
+	const long before = position_sum(registry);
+	std::vector<uint8_t> snapshot;
+	printf("  snapshot : %.2f ms\n", bench_ms([&] { registry.Snapshot(snapshot); }));
+	registry.Loop<Position, Velocity>(loop2);
+
+	bool restored = false;
+	printf("  restore : %.2f ms (%zu bytes)\n", bench_ms([&] { restored = registry.Restore(snapshot.data(), snapshot.size()); }), snapshot.size());
+	bench_check(restored && position_sum(registry) == before, "restore brings back the snapshot positions");
+
+	// loops stamp the components of their non-const types only
+	const uint32_t since = registry.m_tick;
+	registry.Tick();
+	registry.Loop<const Position, Acceleration>([](uint32_t, const Position&, Acceleration&) {});
+	size_t changed_positions = 0;
+	size_t changed_accelerations = 0;
+	registry.LoopChanged<Position>(since, [&](uint32_t, const Position&) { changed_positions++; });
+	registry.LoopChanged<Acceleration>(since, [&](uint32_t, const Acceleration&) { changed_accelerations++; });
+	bench_check(changed_positions == 0 && changed_accelerations == registry.buffer<Acceleration>().m_data.size(), "loops mark their mutable components as changed");
+}
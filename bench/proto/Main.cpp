@@ -0,0 +1,19 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#include <Bench.h>
+
+#include <cstdint>
+
+void bench_ecs(uint32_t count);
+void bench_sparse_indices(uint32_t count, uint32_t spread);
+void test_commands();
+
+int main()
+{
+	bench_ecs(1 << 20);
+	bench_sparse_indices(1 << 16, 20);
+	test_commands();
+	return mud::bench_failures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,53 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#include <proto/ECS/SparseBuffer.h>
+
+#include <Bench.h>
+
+#include <random>
+#include <unordered_map>
+
+using namespace mud;
+
+// add/lookup/remove throughput of the paged indices of uncommon components, against a hash map and a flat array
+// keys are spread over count * spread handles, as for a component owned by one entity in spread
+void bench_sparse_indices(uint32_t count, uint32_t spread)
+{
+	std::vector<uint32_t> keys(count);
+	std::mt19937 random(1);
+	for(uint32_t i = 0; i < count; ++i)
+		keys[i] = random() % (count * spread);
+
+	auto bench = [&](const char* name, auto& indices)
+	{
+		uint32_t sum = 0;
+		double add = bench_ms([&] { for(uint32_t i = 0; i < count; ++i) indices[keys[i]] = i; });
+		double lookup = bench_ms([&] { for(uint32_t i = 0; i < count; ++i) sum += indices[keys[i]]; });
+		double remove = bench_ms([&] { for(uint32_t i = 0; i < count; ++i) indices.erase(keys[i]); });
+		printf("  %s : add %.2f ms, lookup %.2f ms, remove %.2f ms\n", name, add, lookup, remove);
+		return sum;
+	};
+
+	auto removed = [&](const auto& indices)
+	{
+		for(uint32_t i = 0; i < count; ++i)
+			if(indices.find(keys[i]) != UINT32_MAX)
+				return false;
+		return true;
+	};
+
+	printf("sparse indices bench : %u keys over %u handles\n", count, count * spread);
+
+	std::unordered_map<uint32_t, uint32_t> map;
+	const uint32_t expected = bench("hash map", map);
+
+	SparseIndices<false> paged;
+	bench_check(bench("paged", paged) == expected, "paged indices lookups match the hash map");
+	bench_check(removed(paged), "paged indices are all removed");
+
+	SparseIndices<true> flat = { count * spread };
+	bench_check(bench("flat", flat) == expected, "flat indices lookups match the hash map");
+	bench_check(removed(flat), "flat indices are all removed");
+}
@@ -0,0 +1,15 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#include <Bench.h>
+
+#include <cstdint>
+
+void bench_member(uint32_t count);
+
+int main()
+{
+	bench_member(1 << 22);
+	return mud::bench_failures() == 0 ? 0 : 1;
+}
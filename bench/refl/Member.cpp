@@ -0,0 +1,63 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#include <refl/MetaDecl.h>
+#include <refl/Member.h>
+#include <refl/Class.h>
+
+#include <Bench.h>
+
+#include <string>
+
+using namespace mud;
+
+namespace
+{
+	struct Position { float m_x; float m_y; float m_z; };
+	struct Body { Position m_position = { 1.f, 2.f, 3.f }; std::string m_name = "body"; };
+}
+
+namespace mud
+{
+	template <> Type& type<Position>() { static Type ty("Position"); return ty; }
+	template <> Type& type<Body>() { static Type ty("Body"); return ty; }
+}
+
+// members declared like the generated Meta.h does : value fields get typed accessors, used when the value has the exact member type
+void bench_member(uint32_t count)
+{
+	static Meta meta_float = { type<float>(), &namspc({}), "float", sizeof(float), TypeClass::BaseType };
+	static Meta meta_string = { type<std::string>(), &namspc({}), "string", sizeof(std::string), TypeClass::BaseType };
+	static Meta meta_position = { type<Position>(), &namspc({}), "Position", sizeof(Position), TypeClass::Struct };
+	meta_type<float>();
+	meta_type<std::string>();
+	meta_type<Position>();
+
+	Member typed = { type<Body>(), member_address(&Body::m_position), type<Position>(), "position", var(Position()), Member::Value, nullptr, [](Ref object) { return var(val<Body>(object).m_position); }, [](Ref object, Ref value) { member_assign(val<Body>(object).m_position, value); } };
+	Member generic = { type<Body>(), member_address(&Body::m_position), type<Position>(), "position", var(Position()), Member::Value, nullptr };
+	Member name = { type<Body>(), member_address(&Body::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<Body>(object).m_name); }, [](Ref object, Ref value) { member_assign(val<Body>(object).m_name, value); } };
+
+	Body body;
+	Position position = { 4.f, 5.f, 6.f };
+	typed.set(Ref(&body), Ref(&position));
+	bench_check(body.m_position.m_z == 6.f && val<Position>(typed.get_value(Ref(&body))).m_y == 5.f, "typed accessors read and write the field");
+
+	std::string text = "renamed";
+	name.set(Ref(&body), Ref(&text));
+	bench_check(body.m_name == "renamed" && val<std::string>(name.get_value(Ref(&body))) == "renamed", "typed accessors copy non trivial values");
+
+	double sum = 0.0;
+	auto set = [&](Member& member) { return bench_ms([&] { for(uint32_t i = 0; i < count; ++i) { position.m_x = float(i); member.set(Ref(&body), Ref(&position)); } }); };
+	auto get = [&](Member& member) { return bench_ms([&] { for(uint32_t i = 0; i < count; ++i) { Var value = member.get_value(Ref(&body)); sum += val<Position>(value).m_x; } }); };
+
+	const double set_generic = set(generic);
+	const double set_typed = set(typed);
+	const double get_generic = get(generic);
+	const double get_typed = get(typed);
+
+	printf("member bench : %u iterations\n", count);
+	printf("  set : generic %.1f ns, typed %.1f ns\n", set_generic * 1e6 / count, set_typed * 1e6 / count);
+	printf("  get_value : generic %.1f ns, typed %.1f ns\n", get_generic * 1e6 / count, get_typed * 1e6 / count);
+	bench_check(sum == 2.0 * double(count) * double(count - 1), "generic and typed accessors read the same field");
+}
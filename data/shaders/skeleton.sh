@@ -1,12 +1,16 @@
 #include <common.sh>
 
 #define SKELETON_TEXTURE_WIDTH 256
-#define SKELETON_TEXTURE_HEIGHT 4
 
 SAMPLER2D(s_skeleton, 5);
 
+// joints of all skins are packed in a single palette texture : x = joint offset of the skin, y = palette height
+uniform vec4 u_skeleton_params;
+#define u_skeleton_offset u_skeleton_params.x
+#define u_skeleton_height u_skeleton_params.y
+
 #ifdef NO_TEXEL_FETCH
-#define texelFetch(_sampler, _coord, _level) texture2DLod(_sampler, vec2(_coord) / vec2(float(SKELETON_TEXTURE_WIDTH), float(SKELETON_TEXTURE_HEIGHT)), _level)
+#define texelFetch(_sampler, _coord, _level) texture2DLod(_sampler, vec2(_coord) / vec2(float(SKELETON_TEXTURE_WIDTH), u_skeleton_height), _level)
 #endif
 
 mat4 skeleton_matrix(sampler2D skeleton_texture, ivec4 bone_indices, vec4 bone_weights)
@@ -19,7 +23,8 @@ mat4 skeleton_matrix(sampler2D skeleton_texture, ivec4 bone_indices, vec4 bone_w
     
     for(int i = 0; i < 4; ++i)
     {
-        ivec2 tex_ofs = ivec2(int(mod(bone_indices[i], SKELETON_TEXTURE_WIDTH)), (int(bone_indices[i])/SKELETON_TEXTURE_WIDTH)*4);
+        int joint = int(bone_indices[i]) + int(u_skeleton_offset);
+        ivec2 tex_ofs = ivec2(int(mod(float(joint), float(SKELETON_TEXTURE_WIDTH))), (joint/SKELETON_TEXTURE_WIDTH)*4);
         m += mat4(
             texelFetch(skeleton_texture, tex_ofs, 0),
             texelFetch(skeleton_texture, tex_ofs+ivec2(0,1), 0),
@@ -20,4 +20,5 @@ BUILD_DIR = path.join(path.getabsolute(".."), "build")
 dofile "toolchain.lua"
 
 dofile "mud.lua"
-dofile "mud_example.lua"
\ No newline at end of file
+dofile "mud_example.lua"
+dofile "mud_bench.lua"
\ No newline at end of file
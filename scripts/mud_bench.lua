@@ -0,0 +1,21 @@
+-- mud benchmarks
+
+function uses_bench()
+    includedirs {
+        path.join(MUD_DIR, "bench"),
+    }
+end
+
+mud.bench = {}
+
+function mud_bench(name, deps)
+    mud.bench[name] = mud_module(nil, "bench_" .. name, path.join(MUD_DIR, "bench"), name, nil, uses_bench, nil, deps, true, true)
+    mud_binary("bench_" .. name, { mud.bench[name] }, {})
+end
+
+group "bench"
+
+mud_bench("infra",  { mud.infra })
+mud_bench("obj",    { mud.infra, mud.obj })
+mud_bench("refl",   { mud.infra, mud.obj, mud.pool, mud.refl })
+mud_bench("proto",  { mud.infra, mud.obj, mud.refl, mud.proto })
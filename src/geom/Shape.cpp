@@ -322,4 +322,98 @@ namespace mud
 			points[i] = RandomShapePoint::me().dispatch(Ref(&shape));
 		return points;
 	}
+
+	inline vec3 sphere_point(Xoshiro128& rng, float radius, float h = 2.f, float maxh = 1.f)
+	{
+		const float z = rng.unit() * h - maxh;
+		const float angle = rng.unit() * c_pi * 2.f;
+		const float r = sqrt(1.0f - z * z);
+		return vec3{ r * cos(angle), r * sin(angle), z } * radius;
+	}
+
+	inline vec3 circle_point(Xoshiro128& rng, float radius)
+	{
+		const float angle = rng.unit() * c_pi * 2.f;
+		return vec3{ cos(angle), 0.0f, sin(angle) } * radius;
+	}
+
+	inline void distribute_sphere(Xoshiro128& rng, const Sphere& sphere, vec3* points, size_t count)
+	{
+		for(size_t i = 0; i < count; ++i)
+			points[i] = sphere_point(rng, sphere.m_radius);
+	}
+
+	inline void distribute_sphere_ring(Xoshiro128& rng, const SphereRing& sphere, vec3* points, size_t count)
+	{
+		const float maxh = sphere.m_max * 2.0f - 1.0f;
+		const float minh = sphere.m_min * 2.0f - 1.0f;
+		for(size_t i = 0; i < count; ++i)
+			points[i] = sphere_point(rng, sphere.m_radius, maxh - minh, maxh);
+	}
+
+	inline void distribute_circle(Xoshiro128& rng, const Circle& circle, vec3* points, size_t count)
+	{
+		for(size_t i = 0; i < count; ++i)
+			points[i] = circle_point(rng, circle.m_radius);
+	}
+
+	inline void distribute_ring(Xoshiro128& rng, const Ring& ring, vec3* points, size_t count)
+	{
+		for(size_t i = 0; i < count; ++i)
+			points[i] = circle_point(rng, ring.m_radius) * rng.range(ring.m_min, ring.m_max);
+	}
+
+	inline void distribute_rect(Xoshiro128& rng, const Rect& rect, vec3* points, size_t count)
+	{
+		for(size_t i = 0; i < count; ++i)
+			points[i] = vec3{ rng.range(-1.f, 1.f) * rect.m_size.x, 0.f, rng.range(-1.f, 1.f) * rect.m_size.y };
+	}
+
+	inline void distribute_cube(Xoshiro128& rng, const Cube& cube, vec3* points, size_t count)
+	{
+		for(size_t i = 0; i < count; ++i)
+			points[i] = vec3{ rng.range(-1.f, 1.f), rng.range(-1.f, 1.f), rng.range(-1.f, 1.f) } * cube.m_extents;
+	}
+
+	inline void distribute_cylinder(Xoshiro128& rng, const Cylinder& cylinder, vec3* points, size_t count)
+	{
+		// circle points lie in the xz plane, the height goes along y : swizzle to put the height on the cylinder axis
+		const uint axis = uint(cylinder.m_axis);
+		const uint u = axis == 0 ? 1 : 0;
+		const uint v = axis == 2 ? 1 : 2;
+		for(size_t i = 0; i < count; ++i)
+		{
+			const vec3 circle = circle_point(rng, cylinder.m_radius) * sqrt(rng.unit());
+			vec3 point = Zero3;
+			point[axis] = rng.range(-0.5f, 0.5f) * cylinder.m_height;
+			point[u] = circle.x;
+			point[v] = circle.z;
+			points[i] = point;
+		}
+	}
+
+	void distribute_shape(const Shape& shape, Xoshiro128& rng, vec3* points, size_t count)
+	{
+		const Type& shape_type = shape.m_type;
+		if(&shape_type == &type<Sphere>())
+			distribute_sphere(rng, static_cast<const Sphere&>(shape), points, count);
+		else if(&shape_type == &type<SphereRing>())
+			distribute_sphere_ring(rng, static_cast<const SphereRing&>(shape), points, count);
+		else if(&shape_type == &type<Circle>())
+			distribute_circle(rng, static_cast<const Circle&>(shape), points, count);
+		else if(&shape_type == &type<Ring>())
+			distribute_ring(rng, static_cast<const Ring&>(shape), points, count);
+		else if(&shape_type == &type<Rect>())
+			distribute_rect(rng, static_cast<const Rect&>(shape), points, count);
+		else if(&shape_type == &type<Cube>())
+			distribute_cube(rng, static_cast<const Cube&>(shape), points, count);
+		else if(&shape_type == &type<Cylinder>())
+			distribute_cylinder(rng, static_cast<const Cylinder&>(shape), points, count);
+		else if(RandomShapePoint::me().check(Ref(&shape)))
+			for(size_t i = 0; i < count; ++i)
+				points[i] = RandomShapePoint::me().dispatch(Ref(&shape));
+		else
+			for(size_t i = 0; i < count; ++i)
+				points[i] = Zero3;
+	}
 }
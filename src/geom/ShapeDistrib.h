@@ -24,4 +24,8 @@ namespace mud
 	};
 
 	export_ MUD_GEOM_EXPORT std::vector<vec3> distribute_shape(const Shape& shape, size_t count);
+
+	// fills a caller owned buffer, drawing from the given generator : the common emitter shapes (sphere, box, circle, cylinder...)
+	// have a dedicated loop, other shapes go through the dispatch
+	export_ MUD_GEOM_EXPORT void distribute_shape(const Shape& shape, Xoshiro128& rng, vec3* points, size_t count);
 }
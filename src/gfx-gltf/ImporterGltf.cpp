@@ -111,7 +111,7 @@ namespace mud
 
 		size_t index = 0;
 		for(Type* type : system().m_types)
-			if(string(type->m_name).find("glTF") == 0 && g_class[type->m_id] && !type->is<glTFAttributes>())
+			if(string(type->m_name).find("glTF") == 0 && has_class(*type) && !type->is<glTFAttributes>())
 			{
 				for(Member& member : cls(*type).m_members)
 				{
@@ -10,6 +10,8 @@
 module mud.gfx.ui;
 #else
 #include <infra/Vector.h>
+#include <infra/TaskGraph.h>
+#include <infra/FrameArena.h>
 #include <obj/Vector.h>
 #include <obj/DispatchDecl.h>
 #include <pool/ObjectPool.h>
@@ -226,6 +228,49 @@ namespace mud
 		}
 	}
 
+	void panel_frame_arena(Widget& parent, FrameArena& arena)
+	{
+		Widget& self = ui::sheet(parent);
+
+		// heap allocations mean the shared blocks were exhausted, or a request didn't fit in a block
+		Table& columns = ui::columns(self, carray<float, 2>{ 0.4f, 0.6f });
+
+		double_label(columns, "allocations", to_string(arena.m_last_frame.m_num_allocs).c_str());
+		double_label(columns, "bytes", to_string(arena.m_last_frame.m_num_bytes).c_str());
+		double_label(columns, "heap allocations", to_string(arena.m_last_frame.m_num_heap_allocs).c_str());
+		double_label(columns, "threads", to_string(arena.m_threads.size()).c_str());
+	}
+
+	void panel_frame_graph(Widget& parent, TaskGraph& graph)
+	{
+		Widget& self = ui::sheet(parent);
+
+		float max_critical_path = 0.f;
+		for(float critical_path : graph.m_history)
+			max_critical_path = max(max_critical_path, critical_path);
+
+		{
+			Table& columns = ui::columns(self, carray<float, 2>{ 0.4f, 0.6f });
+
+			double_label(columns, "frame", truncate_number(to_string(graph.m_duration)).c_str());
+			double_label(columns, "critical path", truncate_number(to_string(graph.m_critical_path)).c_str());
+			double_label(columns, "max critical path", truncate_number(to_string(max_critical_path)).c_str());
+		}
+
+		static cstring columns[5] = { "stage", "thread", "begin", "time", "critical" };
+		Table& table = ui::table(self, { columns, 5 }, {});
+
+		for(auto& task : graph.m_tasks)
+		{
+			Widget& row = ui::row(table);
+			ui::label(row, task->m_name.c_str());
+			ui::label(row, to_string(task->m_thread).c_str());
+			ui::label(row, truncate_number(to_string(task->m_begin)).c_str());
+			ui::label(row, truncate_number(to_string(task->m_end - task->m_begin)).c_str());
+			ui::label(row, task->m_critical ? "*" : "");
+		}
+	}
+
 	SceneViewer& asset_empty_viewer(Widget& parent, Ref object, vec3 offset, float radius)
 	{
 		static float time = 0.f;
@@ -433,6 +478,12 @@ namespace mud
 		if(Widget* stats = ui::tab(tabber, "Profiling"))
 			panel_gfx_stats(*stats);
 
+		if(Widget* graph = ui::tab(tabber, "Frame graph"))
+			panel_frame_graph(*graph, gfx_system.frame_graph());
+
+		if(Widget* arena = ui::tab(tabber, "Frame arena"))
+			panel_frame_arena(*arena, gfx_system.frame_arena());
+
 #if 0
 		if(Widget* textures = ui::tab(tabber, "Textures"))
 			multi_object_edit_container<Texture>(*textures, gfx_system.m_textures);
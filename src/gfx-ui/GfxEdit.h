@@ -29,6 +29,8 @@ namespace mud
 	MUD_GFX_UI_EXPORT void edit_viewer_filters(Widget& parent, Viewer& viewer);
 
 	MUD_GFX_UI_EXPORT void panel_gfx_stats(Widget& parent);
+	MUD_GFX_UI_EXPORT void panel_frame_graph(Widget& parent, TaskGraph& graph);
+	MUD_GFX_UI_EXPORT void panel_frame_arena(Widget& parent, FrameArena& arena);
 	MUD_GFX_UI_EXPORT void edit_gfx_system(Widget& parent, GfxSystem& system);
 	
 	MUD_GFX_UI_EXPORT void gfx_editor(Widget& parent, GfxSystem& system);
@@ -97,6 +97,7 @@ namespace mud {
     struct Bone;
     class Skeleton;
     struct Joint;
+    class JointPalette;
     class Skin;
     class Rig;
     struct AnimatedTrack;
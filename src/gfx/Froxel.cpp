@@ -10,7 +10,7 @@
 #ifdef MUD_MODULES
 module mud.gfx;
 #else
-#include <infra/Job.h>
+#include <infra/Parallel.h>
 #include <geom/Aabb.h>
 #include <geom/Intersect.h>
 #include <gfx/Froxel.h>
@@ -282,15 +282,11 @@ namespace mud
 #ifdef MUD_THREADED
 		JobSystem& js = *m_gfx_system.m_job_system;
 
-		auto process_task = [&](size_t offset, size_t stride)
+		parallel_for(js, 0, GROUP_COUNT, [&](uint32_t start, uint32_t count)
 		{
-			this->froxelize_light_group(camera, lights, offset, stride);
-		};
-
-		auto parent = js.job();
-		for(size_t i = 0; i < GROUP_COUNT; i++)
-			js.run(job(js, parent, std::cref(process_task), i, GROUP_COUNT));
-		js.complete(parent);
+			for(uint32_t i = start; i < start + count; i++)
+				this->froxelize_light_group(camera, lights, i, GROUP_COUNT);
+		});
 #else
 		for(size_t i = 0; i < GROUP_COUNT; i++)
 			this->froxelize_light_group(camera, lights, i, GROUP_COUNT);
@@ -19,6 +19,9 @@
 module mud.gfx;
 #else
 #include <pool/ObjectPool.h>
+#include <infra/FrameArena.h>
+#include <infra/TaskGraph.h>
+#include <infra/Vector.h>
 #include <infra/StringConvert.h>
 #include <math/Image256.h>
 #include <math/Stream.h>
@@ -77,6 +80,11 @@ namespace mud
 		bx::FileReader m_file_reader;
 		bx::FileWriter m_file_writer;
 
+		JointPalette m_joint_palette;
+
+		FrameArena m_frame_arena;
+		TaskGraph m_frame_graph;
+
 		unique_ptr<TPool<Mesh>> m_meshes;
 		unique_ptr<TPool<Rig>> m_rigs;
 		unique_ptr<TPool<Animation>> m_animations;
@@ -109,6 +117,7 @@ namespace mud
 		Program::ms_gfx_system = this;
 		Material::ms_gfx_system = this;
 		Model::ms_gfx_system = this;
+		Skin::ms_gfx_system = this;
 		for(cstring path : resource_paths)
 		{
 			printf("INFO: resource path: %s\n", path);
@@ -126,6 +135,11 @@ namespace mud
 	TPool<Rig>& GfxSystem::rigs() { return *m_impl->m_rigs; }
 	TPool<Animation>& GfxSystem::animations() { return *m_impl->m_animations; }
 
+	JointPalette& GfxSystem::joint_palette() { return m_impl->m_joint_palette; }
+
+	FrameArena& GfxSystem::frame_arena() { return m_impl->m_frame_arena; }
+	TaskGraph& GfxSystem::frame_graph() { return m_impl->m_frame_graph; }
+
 	AssetStore<Texture>& GfxSystem::textures() { return *m_impl->m_textures; }
 	AssetStore<Program>& GfxSystem::programs() { return *m_impl->m_programs; }
 	AssetStore<Material>& GfxSystem::materials() { return *m_impl->m_materials; }
@@ -201,14 +215,11 @@ namespace mud
 
 	bool GfxSystem::next_frame()
 	{
-		RenderFrame frame = { m_frame, m_time, m_delta_time, Render::s_render_pass_id };
+		FrameArena& arena = m_impl->m_frame_arena;
+		arena.threads(m_job_system ? m_job_system->threads() : 1);
+		arena.next_frame();
 
-		for(auto& name_program : m_impl->m_programs->m_assets)
-			name_program.second->update();
-
-		for(auto& renderer : m_impl->m_renderers)
-			if(renderer)
-				renderer->frame(frame);
+		RenderFrame frame = { m_frame, m_time, m_delta_time, Render::s_render_pass_id, &arena.thread(0) };
 
 #ifdef MUD_GFX_THREADED
 		m_num_encoders = min(uint32_t(4U), bgfx::getCaps()->limits.maxEncoders);
@@ -218,14 +229,53 @@ namespace mud
 			m_encoders[i] = bgfx::begin(true);
 #endif
 
+		// the stages touching bgfx run on this thread, the others overlap with them on the job system workers
+		TaskGraph& graph = m_impl->m_frame_graph;
+		graph.clear();
+
+		const TaskGraph::Resource programs = graph.resource("programs");
+		const TaskGraph::Resource renderers = graph.resource("renderers");
+		const TaskGraph::Resource palette = graph.resource("joint palette");
+		const TaskGraph::Resource particles = graph.resource("particles");
+		const TaskGraph::Resource encoders = graph.resource("encoders");
+
+		graph.add("programs", [&] {
+			for(auto& name_program : m_impl->m_programs->m_assets)
+				name_program.second->update();
+		}, {}, { programs }, TaskGraph::Affinity::Main);
+
+		graph.add("renderers", [&] {
+			for(auto& renderer : m_impl->m_renderers)
+				if(renderer)
+					renderer->frame(frame);
+		}, {}, { renderers }, TaskGraph::Affinity::Main);
+
+		graph.add("joint palette", [&] { m_impl->m_joint_palette.upload(); }, {}, { palette }, TaskGraph::Affinity::Main);
+
+		std::vector<Scene*> scenes;
+		for(GfxContext* context : m_impl->m_contexts)
+			for(Viewport* viewport : context->m_viewports)
+				if(viewport->m_active)
+					vector_add(scenes, viewport->m_scene);
+
+		// once per scene and per frame, however many viewports show it
+		graph.add("particles", [&] {
+			for(Scene* scene : scenes)
+				scene->m_particle_system->update(frame.m_delta_time); // * timeScale
+		}, {}, { particles });
+
 		for(GfxContext* context : m_impl->m_contexts)
 			for(Viewport* viewport : context->m_viewports)
 				if(viewport->m_active)
 				{
-					Renderer& renderer = this->renderer(viewport->m_shading);
-					this->render(renderer, *context, *viewport, frame);
+					graph.add("render", [=, &frame] {
+						Renderer& renderer = this->renderer(viewport->m_shading);
+						this->render(renderer, *context, *viewport, frame);
+					}, { programs, renderers, palette, particles }, { encoders }, TaskGraph::Affinity::Main);
 				}
 
+		graph.run(m_job_system);
+
 #ifdef MUD_GFX_THREADED
 		for(size_t i = 1; i < m_num_encoders; ++i)
 			bgfx::end(m_encoders[i]);
@@ -103,6 +103,14 @@ namespace mud
 		TPool<Rig>& rigs();
 		TPool<Animation>& animations();
 
+		JointPalette& joint_palette();
+
+		// transient allocations of the current frame, released at the start of the next one
+		FrameArena& frame_arena();
+
+		// stages of the last frame, with their timings and critical path
+		TaskGraph& frame_graph();
+
 		attr_ AssetStore<Texture>& textures();
 		attr_ AssetStore<Program>& programs();
 		attr_ AssetStore<Material>& materials();
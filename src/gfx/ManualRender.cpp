@@ -20,16 +20,14 @@ module mud.gfx;
 
 namespace mud
 {
-	std::vector<Item*> frustum_cull(Render& render, const Plane6& frustum_planes, std::function<bool(Item&)> filter)
+	void frustum_cull(Render& render, const Plane6& frustum_planes, std::function<bool(Item&)> filter, FrameVector<Item*>& items)
 	{
-		std::vector<Item*> items;
 		for(Item* item : render.m_shot->m_items)
 			if(!filter || filter(*item))
 			{
 				if(frustum_aabb_intersection(frustum_planes, item->m_aabb))
 					items.push_back(item);
 			}
-		return items;
 	}
 
 	ManualRender::ManualRender(Render& render, bgfx::FrameBufferHandle fbo, const uvec4& viewport_rect)
@@ -51,7 +49,8 @@ namespace mud
 		Plane6 planes = input_planes ? *input_planes : frustum_planes(m_camera.m_projection, m_camera.m_transform);
 
 		auto filter = [](Item& item) { return item.m_visible && item.m_model->m_geometry[PLAIN] && item.m_cast_shadows != ItemShadow::Off; };
-		m_shadow_render.m_shot->m_items = frustum_cull(m_render, planes, filter);
+		m_shadow_render.m_shot->m_items.clear();
+		frustum_cull(m_render, planes, filter, m_shadow_render.m_shot->m_items);
 
 		for(Item* item : m_shadow_render.m_shot->m_items)
 			item->m_depth = plane_distance_to(planes.m_near, item->m_node.m_position);
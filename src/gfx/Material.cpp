@@ -48,6 +48,7 @@ namespace mud
 			: u_uv1_scale_offset(bgfx::createUniform("u_material_params_0", bgfx::UniformType::Vec4))
 			, u_uv2_scale_offset(bgfx::createUniform("u_material_params_1", bgfx::UniformType::Vec4))
 			, s_skeleton(bgfx::createUniform("s_skeleton", bgfx::UniformType::Int1))
+			, u_skeleton_params(bgfx::createUniform("u_skeleton_params", bgfx::UniformType::Vec4))
 		{
 			UNUSED(gfx_system);
 		}
@@ -61,6 +62,7 @@ namespace mud
 		bgfx::UniformHandle u_uv1_scale_offset;
 		bgfx::UniformHandle u_uv2_scale_offset;
 		bgfx::UniformHandle s_skeleton;
+		bgfx::UniformHandle u_skeleton_params;
 	};
 
 	struct UnshadedMaterialUniform
@@ -281,6 +283,10 @@ namespace mud
 			s_pbr_material_block.upload(encoder, m_pbr_block);
 
 		if(skin)
-			encoder.setTexture(uint8_t(TextureSampler::Skeleton), s_base_material_block.s_skeleton, skin->m_texture);
+		{
+			vec4 skeleton_params = { float(skin->m_offset), float(skin->m_palette->m_height), 0.f, 0.f };
+			encoder.setUniform(s_base_material_block.u_skeleton_params, &skeleton_params);
+			encoder.setTexture(uint8_t(TextureSampler::Skeleton), s_base_material_block.s_skeleton, skin->m_palette->m_texture);
+		}
 	}
 }
@@ -5,6 +5,7 @@
 #include <gfx/Cpp20.h>
 #ifndef MUD_CPP_20
 #include <string>
+#include <cstring>
 #endif
 
 #include <bx/math.h>
@@ -15,11 +16,14 @@
 #ifdef MUD_MODULES
 module mud.gfx;
 #else
+#include <infra/Job.h>
+#include <infra/Parallel.h>
 #include <pool/Pool.h>
 #include <math/Math.h>
 #include <math/Random.h>
 #include <math/Anim/Anim.h>
 #include <geom/ShapeDistrib.h>
+#include <geom/Intersect.h>
 #include <gfx/Types.h>
 #include <gfx/Particles.h>
 #include <gfx/GfxSystem.h>
@@ -32,10 +36,18 @@ module mud.gfx;
 #include <gfx/Scene.h>
 #include <gfx/Pipeline.h>
 #include <gfx/Node3.h>
+#include <gfx/Frustum.h>
 #endif
 
 #define SPRITE_TEXTURE_SIZE 2048U
 
+#define MUD_GFX_JOBS
+
+#if defined __SSE__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 1)
+#define MUD_PARTICLES_SSE
+#include <xmmintrin.h>
+#endif
+
 namespace mud
 {
 	using string = std::string;
@@ -64,12 +76,77 @@ namespace mud
 		: m_name(name)
 	{}
 
+	void ParticleArrays::reserve(uint32_t capacity)
+	{
+		size_t size = (capacity + 3) & ~3U;
+
+		for(std::vector<float>* array : { &m_start_x, &m_start_y, &m_start_z, &m_dir_x, &m_dir_y, &m_dir_z,
+										  &m_speed_seed, &m_angle_seed, &m_blend_seed, &m_colour_seed, &m_scale_seed, &m_sprite_seed, &m_life,
+										  &m_pos_x, &m_pos_y, &m_pos_z })
+			array->resize(size, 0.f);
+
+		m_lifetime.resize(size, 1.f);
+		m_rot.resize(size, ZeroQuat);
+	}
+
+	void ParticleArrays::add(const Particle& particle)
+	{
+		uint32_t i = m_count++;
+
+		m_start_x[i] = particle.start.x;
+		m_start_y[i] = particle.start.y;
+		m_start_z[i] = particle.start.z;
+		m_dir_x[i] = particle.dir.x;
+		m_dir_y[i] = particle.dir.y;
+		m_dir_z[i] = particle.dir.z;
+		m_rot[i] = particle.rot;
+
+		m_speed_seed[i] = particle.speed_seed;
+		m_angle_seed[i] = particle.angle_seed;
+		m_blend_seed[i] = particle.blend_seed;
+		m_colour_seed[i] = particle.colour_seed;
+		m_scale_seed[i] = particle.scale_seed;
+		m_sprite_seed[i] = particle.sprite_seed;
+
+		m_life[i] = particle.life;
+		m_lifetime[i] = particle.lifetime;
+	}
+
+	void ParticleArrays::remove(uint32_t i)
+	{
+		uint32_t last = --m_count;
+
+		m_start_x[i] = m_start_x[last];
+		m_start_y[i] = m_start_y[last];
+		m_start_z[i] = m_start_z[last];
+		m_dir_x[i] = m_dir_x[last];
+		m_dir_y[i] = m_dir_y[last];
+		m_dir_z[i] = m_dir_z[last];
+		m_rot[i] = m_rot[last];
+
+		m_speed_seed[i] = m_speed_seed[last];
+		m_angle_seed[i] = m_angle_seed[last];
+		m_blend_seed[i] = m_blend_seed[last];
+		m_colour_seed[i] = m_colour_seed[last];
+		m_scale_seed[i] = m_scale_seed[last];
+		m_sprite_seed[i] = m_sprite_seed[last];
+
+		m_life[i] = m_life[last];
+		m_lifetime[i] = m_lifetime[last];
+	}
+
+	// volume, lifetime, and the six attribute seeds
+	static const size_t c_spawn_seeds = 8;
+
 	Particles::Particles(Node3* node, ShapeVar shape, uint32_t max_particles)
 		: m_node(node)
 		, m_max(max_particles)
+		, m_rng(random_integer<uint32_t>(0U, UINT32_MAX))
 	{
 		m_shape = shape;
 		m_particles.reserve(m_max);
+		m_spawn_points.reserve(m_max);
+		m_spawn_seeds.reserve(m_max * c_spawn_seeds);
 	}
 
 	void Particles::upload()
@@ -79,16 +156,36 @@ namespace mud
 	{
 		m_time += delta;
 
-		for(Particle& particle : m_particles)
-			particle.life += delta / particle.lifetime;
+		// the generator parameters can change every frame, and baking is a few hundred samples
+		m_tables.m_speed.bake(m_speed);
+		m_tables.m_blend.bake(m_blend);
+		m_tables.m_colour.bake(m_colour);
+		m_tables.m_scale.bake(m_scale);
+		m_tables.m_sprite_frame.bake(m_sprite_frame);
+
+		ParticleArrays& particles = m_particles;
+		float* life = particles.m_life.data();
+		const float* lifetime = particles.m_lifetime.data();
+
+#ifdef MUD_PARTICLES_SSE
+		const __m128 dt = _mm_set1_ps(delta);
+		for(uint32_t i = 0; i < particles.m_count; i += 4)
+			_mm_storeu_ps(&life[i], _mm_add_ps(_mm_loadu_ps(&life[i]), _mm_div_ps(dt, _mm_loadu_ps(&lifetime[i]))));
+#else
+		for(uint32_t i = 0; i < particles.m_count; ++i)
+			life[i] += delta / lifetime[i];
+#endif
 
-		vector_remove_if(m_particles, [&](Particle& particle) { return particle.life > m_duration; });
+		for(uint32_t i = particles.m_count; i-- > 0;)
+			if(life[i] > m_duration)
+				particles.remove(i);
 
 		m_ended = m_time > m_duration && !m_loop;
 		if(!m_ended && m_rate.sample(m_time) > 0)
 			spawn(delta);
-	}
 
+		this->simulate();
+	}
 
 	void Particles::spawn(float dt)
 	{
@@ -104,123 +201,329 @@ namespace mud
 		const uint32_t num_particles = uint32_t(m_dt / particle_period);
 		m_dt -= num_particles * particle_period;
 
-		size_t count = min(num_particles, m_max - uint32_t(m_particles.size()));
-		std::vector<vec3> points = distribute_shape(*m_shape, count);
+		size_t count = min(num_particles, m_max - m_particles.m_count);
+		if(count == 0)
+			return;
+
+		// scratch buffers were reserved for m_max particles, so resizing them never allocates
+		m_spawn_points.resize(count);
+		m_spawn_seeds.resize(count * c_spawn_seeds);
+
+		distribute_shape(*m_shape, m_rng, m_spawn_points.data(), count);
+		m_rng.unit(m_spawn_seeds.data(), m_spawn_seeds.size());
+
+		const quat rotation = m_node ? m_node->m_rotation : ZeroQuat;
 
 		float time = 0.0f;
 		for(size_t ii = 0; ii < count; ++ii)
 		{
+			const vec3& point = m_spawn_points[ii];
+			const float* seeds = &m_spawn_seeds[ii * c_spawn_seeds];
+
 			Particle particle;
 
-			float volume = m_volume.sample(m_time, random_scalar(0.f, 1.f));
+			float volume = m_volume.sample(m_time, seeds[0]);
 
-			vec3 pos = points[ii] * volume;
-			vec3 dir = m_flow == EmitterFlow::Outward ? normalize(points[ii]) : m_direction;
+			vec3 pos = point * volume;
+			vec3 dir = m_flow == EmitterFlow::Outward ? normalize(point) : m_direction;
 
 			particle.life = time;
-			particle.lifetime = m_lifetime.sample(m_time, random_scalar(0.f, 1.f));
+			particle.lifetime = m_lifetime.sample(m_time, seeds[1]);
 
 			particle.start = vec3(transform * vec4{ pos, 1.f });
 			particle.dir = vec3(transform * vec4{ dir, 0.f });
-			particle.rot = m_node->m_rotation;
+			particle.rot = rotation;
 
-			particle.speed_seed = random_scalar(0.f, 1.f);
-			particle.angle_seed = random_scalar(0.f, 1.f);
-			particle.blend_seed = random_scalar(0.f, 1.f);
-			particle.colour_seed = random_scalar(0.f, 1.f);
-			particle.scale_seed = random_scalar(0.f, 1.f);
-			particle.sprite_seed = random_scalar(0.f, 1.f);
+			particle.speed_seed = seeds[2];
+			particle.angle_seed = seeds[3];
+			particle.blend_seed = seeds[4];
+			particle.colour_seed = seeds[5];
+			particle.scale_seed = seeds[6];
+			particle.sprite_seed = seeds[7];
 
 			time += particle_period;
 
-			m_particles.push_back(particle);
+			m_particles.add(particle);
 		}
 	}
 
-	uint32_t Particles::render(const SpriteAtlas& atlas, const mat4& view, const vec3& eye, uint32_t first, uint32_t max, ParticleSort* outSort, ParticleVertex* outVertices)
+	struct ParticleBounds
 	{
-		m_aabb =
+		float bmin[3][4];
+		float bmax[3][4];
+	};
+
+#ifdef MUD_PARTICLES_SSE
+	static inline void particle_positions(ParticleArrays& particles, uint32_t first, uint32_t lanes, const float* advances, ParticleBounds& bounds)
+	{
+		const float* start[3] = { &particles.m_start_x[first], &particles.m_start_y[first], &particles.m_start_z[first] };
+		const float* dir[3] = { &particles.m_dir_x[first], &particles.m_dir_y[first], &particles.m_dir_z[first] };
+		float* pos[3] = { &particles.m_pos_x[first], &particles.m_pos_y[first], &particles.m_pos_z[first] };
+
+		const __m128 advance = _mm_loadu_ps(advances);
+		const __m128 valid = _mm_cmplt_ps(_mm_set_ps(3.f, 2.f, 1.f, 0.f), _mm_set1_ps(float(lanes)));
+		const __m128 inf = _mm_set1_ps(bx::kInfinity);
+		const __m128 minf = _mm_set1_ps(-bx::kInfinity);
+
+		for(int a = 0; a < 3; ++a)
 		{
-			{ bx::kInfinity,  bx::kInfinity,  bx::kInfinity },
-			{ -bx::kInfinity, -bx::kInfinity, -bx::kInfinity },
-		};
+			const __m128 p = _mm_add_ps(_mm_loadu_ps(start[a]), _mm_mul_ps(_mm_loadu_ps(dir[a]), advance));
+			_mm_storeu_ps(pos[a], p);
 
-		if(m_sprite == nullptr)
-			return 0;
-		
-		size_t index = first;
-		for(Particle& particle : m_particles)
+			const __m128 lo = _mm_or_ps(_mm_and_ps(valid, p), _mm_andnot_ps(valid, inf));
+			const __m128 hi = _mm_or_ps(_mm_and_ps(valid, p), _mm_andnot_ps(valid, minf));
+			_mm_storeu_ps(bounds.bmin[a], _mm_min_ps(_mm_loadu_ps(bounds.bmin[a]), lo));
+			_mm_storeu_ps(bounds.bmax[a], _mm_max_ps(_mm_loadu_ps(bounds.bmax[a]), hi));
+		}
+	}
+#else
+	static inline void particle_positions(ParticleArrays& particles, uint32_t first, uint32_t lanes, const float* advances, ParticleBounds& bounds)
+	{
+		const float* start[3] = { &particles.m_start_x[first], &particles.m_start_y[first], &particles.m_start_z[first] };
+		const float* dir[3] = { &particles.m_dir_x[first], &particles.m_dir_y[first], &particles.m_dir_z[first] };
+		float* pos[3] = { &particles.m_pos_x[first], &particles.m_pos_y[first], &particles.m_pos_z[first] };
+
+		for(uint32_t l = 0; l < lanes; ++l)
+			for(int a = 0; a < 3; ++a)
+			{
+				pos[a][l] = start[a][l] + dir[a][l] * advances[l];
+				bounds.bmin[a][l] = min(bounds.bmin[a][l], pos[a][l]);
+				bounds.bmax[a][l] = max(bounds.bmax[a][l], pos[a][l]);
+			}
+	}
+#endif
+
+	void Particles::simulate()
+	{
+		ParticleArrays& particles = m_particles;
+
+		ParticleBounds bounds;
+		for(int a = 0; a < 3; ++a)
+			for(int l = 0; l < 4; ++l)
+			{
+				bounds.bmin[a][l] = bx::kInfinity;
+				bounds.bmax[a][l] = -bx::kInfinity;
+			}
+
+		for(uint32_t i = 0; i < particles.m_count; i += 4)
 		{
-			if(index + 1 >= max)
-				break;
+			const uint32_t lanes = min(particles.m_count - i, 4U);
+
+			float advances[4] = {};
+			for(uint32_t l = 0; l < lanes; ++l)
+			{
+				const float life = particles.m_life[i + l];
+				advances[l] = life * particles.m_lifetime[i + l] * m_tables.m_speed.sample(life, particles.m_speed_seed[i + l]);
+			}
 
-			vec3 gravity = { 0.0f, -9.81f * m_gravity.sample(particle.life) * bx::square(particle.life), 0.0f };
-			UNUSED(gravity);
+			particle_positions(particles, i, lanes, advances, bounds);
+		}
 
-			float advance = particle.life * particle.lifetime * m_speed.sample(particle.life, particle.speed_seed);
-			vec3 pos = particle.start + particle.dir * advance; //+ gravity;
+		m_aabb = {};
 
-			ParticleSort& sort = outSort[index];
-			vec3 tmp = eye - pos;
-			sort.dist = bx::sqrt(dot(tmp, tmp));
-			sort.idx = index;
+		if(particles.m_count > 0)
+		{
+			// quads extend at most twice their scale from the particle position along each axis
+			float max_scale = 0.f;
+			for(size_t i = 0; i < ValueTable<float>::Size; ++i)
+				max_scale = max(max_scale, max(bx::abs(m_tables.m_scale.m_min[i]), bx::abs(m_tables.m_scale.m_max[i])));
+
+			vec3 bmin = vec3(bx::kInfinity);
+			vec3 bmax = vec3(-bx::kInfinity);
+			for(int a = 0; a < 3; ++a)
+				for(int l = 0; l < 4; ++l)
+				{
+					bmin[a] = min(bmin[a], bounds.bmin[a][l]);
+					bmax[a] = max(bmax[a], bounds.bmax[a][l]);
+				}
+
+			m_aabb = min_max_to_aabb(bmin - 2.f * max_scale, bmax + 2.f * max_scale);
+		}
+	}
 
-			float blend = m_blend.sample(particle.life, particle.blend_seed);
-			float scale = m_scale.sample(particle.life, particle.scale_seed);
+	// a batch of 4 particles : the sampled tracks are gathered per lane, eye distances and quad corners are computed on all lanes at once
+	struct ParticleBatch
+	{
+		float scale[4];
+		float blend[4];
+		uint32_t abgr[4];
+		vec4 uv[4];
+		float u[3][4];
+		float v[3][4];
+
+		float dist[4];
+		float corners[4][3][4];
+	};
+
+#ifdef MUD_PARTICLES_SSE
+	static inline void particle_batch(const ParticleArrays& particles, uint32_t first, const vec3& eye, ParticleBatch& batch)
+	{
+		const float* pos[3] = { &particles.m_pos_x[first], &particles.m_pos_y[first], &particles.m_pos_z[first] };
+		const float eyes[3] = { eye.x, eye.y, eye.z };
 
-			Colour colour = m_colour.sample(particle.life, particle.colour_seed);
-			uint32_t abgr = to_abgr(colour);
+		const __m128 scale = _mm_loadu_ps(batch.scale);
+		__m128 dist2 = _mm_setzero_ps();
 
-			vec3 udir;
-			vec3 vdir;
+		for(int a = 0; a < 3; ++a)
+		{
+			const __m128 p = _mm_loadu_ps(pos[a]);
+			const __m128 delta = _mm_sub_ps(_mm_set1_ps(eyes[a]), p);
+			dist2 = _mm_add_ps(dist2, _mm_mul_ps(delta, delta));
+
+			const __m128 su = _mm_mul_ps(_mm_loadu_ps(batch.u[a]), scale);
+			const __m128 sv = _mm_mul_ps(_mm_loadu_ps(batch.v[a]), scale);
+			_mm_storeu_ps(batch.corners[0][a], _mm_sub_ps(_mm_sub_ps(p, su), sv));
+			_mm_storeu_ps(batch.corners[1][a], _mm_sub_ps(_mm_add_ps(p, su), sv));
+			_mm_storeu_ps(batch.corners[2][a], _mm_add_ps(_mm_add_ps(p, su), sv));
+			_mm_storeu_ps(batch.corners[3][a], _mm_add_ps(_mm_sub_ps(p, su), sv));
+		}
 
-			if(m_billboard)
+		_mm_storeu_ps(batch.dist, _mm_sqrt_ps(dist2));
+	}
+#else
+	static inline void particle_batch(const ParticleArrays& particles, uint32_t first, const vec3& eye, ParticleBatch& batch)
+	{
+		const float* pos[3] = { &particles.m_pos_x[first], &particles.m_pos_y[first], &particles.m_pos_z[first] };
+		const float eyes[3] = { eye.x, eye.y, eye.z };
+
+		for(uint32_t l = 0; l < 4; ++l)
+		{
+			float dist2 = 0.f;
+			for(int a = 0; a < 3; ++a)
 			{
-				udir = scale * vec3{ view[0][0], view[1][0], view[2][0] };
-				vdir = scale * vec3{ view[0][1], view[1][1], view[2][1] };
+				const float p = pos[a][l];
+				dist2 += (eyes[a] - p) * (eyes[a] - p);
+
+				const float su = batch.u[a][l] * batch.scale[l];
+				const float sv = batch.v[a][l] * batch.scale[l];
+				batch.corners[0][a][l] = p - su - sv;
+				batch.corners[1][a][l] = p + su - sv;
+				batch.corners[2][a][l] = p + su + sv;
+				batch.corners[3][a][l] = p - su + sv;
 			}
-			else
+			batch.dist[l] = bx::sqrt(dist2);
+		}
+	}
+#endif
+
+	uint32_t Particles::render(const SpriteAtlas& atlas, const mat4& view, const vec3& eye, uint32_t first, uint32_t capacity, ParticleSort* outSort, ParticleVertex* outVertices)
+	{
+		if(m_sprite == nullptr || first >= capacity)
+			return 0;
+
+		const ParticleArrays& particles = m_particles;
+		const uint32_t count = min(particles.m_count, capacity - first);
+
+		const vec3 view_x = { view[0][0], view[1][0], view[2][0] };
+		const vec3 view_y = { view[0][1], view[1][1], view[2][1] };
+
+		for(uint32_t i = 0; i < count; i += 4)
+		{
+			const uint32_t lanes = min(count - i, 4U);
+
+			ParticleBatch batch = {};
+			for(uint32_t l = 0; l < lanes; ++l)
 			{
-				udir = scale * rotate(particle.rot, X3);
-				vdir = scale * rotate(particle.rot, Y3);
+				const uint32_t ii = i + l;
+				const float life = particles.m_life[ii];
+
+				batch.scale[l] = m_tables.m_scale.sample(life, particles.m_scale_seed[ii]);
+				batch.blend[l] = m_tables.m_blend.sample(life, particles.m_blend_seed[ii]);
+				batch.abgr[l] = to_abgr(m_tables.m_colour.sample(life, particles.m_colour_seed[ii]));
+				batch.uv[l] = atlas.sprite_uv(*m_sprite, m_tables.m_sprite_frame.sample(life, particles.m_sprite_seed[ii]));
+
+				const vec3 u = m_billboard ? view_x : rotate(particles.m_rot[ii], X3);
+				const vec3 v = m_billboard ? view_y : rotate(particles.m_rot[ii], Y3);
+				for(int a = 0; a < 3; ++a)
+				{
+					batch.u[a][l] = u[a];
+					batch.v[a][l] = v[a];
+				}
 			}
 
-			float frame = m_sprite_frame.sample(particle.life, particle.sprite_seed);
-			const vec4 uv = atlas.sprite_uv(*m_sprite, frame);
+			particle_batch(particles, i, eye, batch);
 
-			ParticleVertex* vertex = &outVertices[index * 4];
+			for(uint32_t l = 0; l < lanes; ++l)
+			{
+				const uint32_t index = first + i + l;
 
-			write_vertex(vertex, { pos - udir - vdir, abgr, { uv[0], uv[1] }, blend, scale });
-			write_vertex(vertex, { pos + udir - vdir, abgr, { uv[2], uv[1] }, blend, scale });
-			write_vertex(vertex, { pos + udir + vdir, abgr, { uv[2], uv[3] }, blend, scale });
-			write_vertex(vertex, { pos - udir + vdir, abgr, { uv[0], uv[3] }, blend, scale });
+				ParticleSort& sort = outSort[index];
+				sort.dist = batch.dist[l];
+				sort.idx = index;
 
-			++index;
+				auto corner = [&](int c) { return vec3{ batch.corners[c][0][l], batch.corners[c][1][l], batch.corners[c][2][l] }; };
+
+				const vec4& uv = batch.uv[l];
+				ParticleVertex* vertex = &outVertices[index * 4];
+				vertex[0] = { corner(0), batch.abgr[l], { uv[0], uv[1] }, batch.blend[l], batch.scale[l] };
+				vertex[1] = { corner(1), batch.abgr[l], { uv[2], uv[1] }, batch.blend[l], batch.scale[l] };
+				vertex[2] = { corner(2), batch.abgr[l], { uv[2], uv[3] }, batch.blend[l], batch.scale[l] };
+				vertex[3] = { corner(3), batch.abgr[l], { uv[0], uv[3] }, batch.blend[l], batch.scale[l] };
+			}
 		}
 
-		return m_particles.size();
+		return count;
 	}
 
-	inline void Particles::write_vertex(ParticleVertex*& dest, ParticleVertex vertex)
+	// LSD radix sort of the particles by decreasing distance, 8 bits per pass
+	static void radix_sort(ParticleSort* data, ParticleSort* temp, uint32_t count)
 	{
-		m_aabb.merge(vertex.m_pos);
-		*dest = vertex;
-		++dest;
-	}
+		auto key = [](const ParticleSort& sort)
+		{
+			union { float f; uint32_t i; } f2i;
+			f2i.f = sort.dist;
+			return ~float_flip(f2i.i);
+		};
 
-	static int32_t particleSortFn(const void* _lhs, const void* _rhs)
-	{
-		const ParticleSort& lhs = *(const ParticleSort*)_lhs;
-		const ParticleSort& rhs = *(const ParticleSort*)_rhs;
-		return lhs.dist > rhs.dist ? -1 : 1;
+		ParticleSort* source = data;
+		ParticleSort* dest = temp;
+
+		for(uint32_t shift = 0; shift < 32; shift += 8)
+		{
+			uint32_t histogram[256] = {};
+			for(uint32_t i = 0; i < count; ++i)
+				++histogram[(key(source[i]) >> shift) & 0xff];
+
+			// all keys share this digit : the pass wouldn't change the order
+			if(histogram[(key(source[0]) >> shift) & 0xff] == count)
+				continue;
+
+			uint32_t offset = 0;
+			for(uint32_t d = 0; d < 256; ++d)
+			{
+				uint32_t digit_count = histogram[d];
+				histogram[d] = offset;
+				offset += digit_count;
+			}
+
+			for(uint32_t i = 0; i < count; ++i)
+				dest[histogram[(key(source[i]) >> shift) & 0xff]++] = source[i];
+
+			std::swap(source, dest);
+		}
+
+		if(source != data)
+			memcpy(data, source, count * sizeof(ParticleSort));
 	}
 
+	static const uint32_t MAX_QUADS = UINT16_MAX / 4;
+
 	ParticleSystem::ParticleSystem(GfxSystem& gfx_system, TPool<Particles>& emitters)
 		: m_gfx_system(gfx_system)
 		, m_block(*gfx_system.m_pipeline->block<BlockParticles>())
 		, m_emitters(emitters)
 		, m_program(gfx_system.programs().fetch("particle").default_version())
-	{}
+	{
+		const bgfx::Memory* memory = bgfx::alloc(MAX_QUADS * 6 * sizeof(uint16_t));
+		uint16_t* indices = (uint16_t*)memory->data;
+		for(uint32_t ii = 0; ii < MAX_QUADS; ++ii)
+		{
+			const uint16_t index = uint16_t(ii * 4);
+			*indices++ = index + 0; *indices++ = index + 1; *indices++ = index + 2;
+			*indices++ = index + 2; *indices++ = index + 3; *indices++ = index + 0;
+		}
+		m_quad_indices = bgfx::createIndexBuffer(memory);
+	}
 
 	ParticleSystem::~ParticleSystem()
 	{}
@@ -228,64 +531,124 @@ namespace mud
 	void ParticleSystem::shutdown()
 	{
 		bgfx::destroy(m_program);
+		bgfx::destroy(m_quad_indices);
 	}
 
-	void ParticleSystem::update(float _dt)
+	void ParticleSystem::update(float timestep)
 	{
-		uint32_t num_particles = 0;
-		for(Particles* emitter : m_emitters.m_vec_pool->m_objects)
+		std::vector<Particles*>& emitters = m_emitters.m_vec_pool->m_objects;
+
+#ifdef MUD_GFX_JOBS
+		JobSystem& js = *m_gfx_system.m_job_system;
+		parallel_for(js, 0, uint32_t(emitters.size()), [&emitters, timestep](uint32_t start, uint32_t count)
 		{
-			emitter->update(_dt);
-			num_particles += emitter->m_particles.size();
-		}
+			for(uint32_t i = start; i < start + count; ++i)
+				emitters[i]->update(timestep);
+		});
+#else
+		for(Particles* emitter : emitters)
+			emitter->update(timestep);
+#endif
+
+		uint32_t num_particles = 0;
+		for(Particles* emitter : emitters)
+			num_particles += emitter->m_particles.m_count;
 		m_num = num_particles;
 	}
 
-	void ParticleSystem::render(bgfx::Encoder& encoder, uint8_t pass, const mat4& view, const vec3& eye)
+	void ParticleSystem::render(bgfx::Encoder& encoder, uint8_t pass, const mat4& view, const vec3& eye, const Plane6& planes)
 	{
 		if(0 == m_num)
 			return;
 
-		const uint32_t numVertices = min(bgfx::getAvailTransientVertexBuffer(m_num * 4, ParticleVertex::ms_decl), uint32_t(UINT16_MAX));
-		const uint32_t numIndices = bgfx::getAvailTransientIndexBuffer(m_num * 6);
-		const uint32_t max = bx::uint32_min(numVertices / 4, numIndices / 6);
-		BX_WARN(m_num == max, "Truncating transient buffer for particles to maximum available (requested %d, available %d).", m_num, max);
+		m_culled.clear();
+		for(Particles* emitter : m_emitters.m_vec_pool->m_objects)
+			if(emitter->m_sprite && emitter->m_particles.m_count > 0 && frustum_aabb_intersection(planes, emitter->m_aabb))
+				m_culled.push_back(emitter);
+
+		// each visible emitter writes its particles at an offset given by the prefix sum of the particle counts
+		// emitters are grouped by blend mode, so that each mode is one contiguous batch
+		m_visible.clear();
+		m_offsets.clear();
+		m_batches.clear();
+
+		uint32_t num_visible = 0;
+		for(uint32_t mode = 0; mode <= uint32_t(BlendMode::Alpha); ++mode)
+		{
+			const uint32_t begin = num_visible;
+			for(Particles* emitter : m_culled)
+				if(emitter->m_blend_mode == BlendMode(mode))
+				{
+					m_visible.push_back(emitter);
+					m_offsets.push_back(num_visible);
+					num_visible += emitter->m_particles.m_count;
+				}
+
+			if(num_visible > begin)
+				m_batches.push_back({ BlendMode(mode), begin, num_visible });
+		}
+
+		if(0 == num_visible)
+			return;
+
+		m_sort.resize(num_visible);
+		m_sort_temp.resize(num_visible);
+		m_quads.resize(num_visible * 4);
+
+		struct Output { const SpriteAtlas& atlas; const mat4& view; const vec3& eye; uint32_t capacity; ParticleSort* sort; ParticleVertex* vertices; };
+		Output output = { m_block.m_sprites, view, eye, num_visible, m_sort.data(), m_quads.data() };
 
-		if(0 < max)
+#ifdef MUD_GFX_JOBS
+		JobSystem& js = *m_gfx_system.m_job_system;
+		parallel_for(js, 0, uint32_t(m_visible.size()), [this, &output](uint32_t start, uint32_t count)
 		{
-			bgfx::TransientVertexBuffer vertex_buffer;
-			bgfx::TransientIndexBuffer index_buffer;
+			for(uint32_t i = start; i < start + count; ++i)
+				m_visible[i]->render(output.atlas, output.view, output.eye, m_offsets[i], output.capacity, output.sort, output.vertices);
+		});
+#else
+		for(size_t i = 0; i < m_visible.size(); ++i)
+			m_visible[i]->render(output.atlas, output.view, output.eye, m_offsets[i], output.capacity, output.sort, output.vertices);
+#endif
 
-			bgfx::allocTransientBuffers(&vertex_buffer, ParticleVertex::ms_decl, max * 4, &index_buffer, max * 6);
+		for(Batch& batch : m_batches)
+			radix_sort(&m_sort[batch.m_begin], &m_sort_temp[batch.m_begin], batch.m_end - batch.m_begin);
 
-			std::vector<ParticleSort> particleSort{ max };
+		const uint32_t max = bgfx::getAvailTransientVertexBuffer(num_visible * 4, ParticleVertex::ms_decl) / 4;
+		BX_WARN(num_visible == max, "Truncating transient buffer for particles to maximum available (requested %d, available %d).", num_visible, max);
 
-			uint32_t pos = 0;
-			ParticleVertex* vertices = (ParticleVertex*)vertex_buffer.data;
+		if(0 == max)
+			return;
+
+		bgfx::TransientVertexBuffer vertex_buffer;
+		bgfx::allocTransientVertexBuffer(&vertex_buffer, max * 4, ParticleVertex::ms_decl);
+		ParticleVertex* vertices = (ParticleVertex*)vertex_buffer.data;
 
-			for(Particles* emitter : m_emitters.m_vec_pool->m_objects)
-				pos += emitter->render(m_block.m_sprites, view, eye, pos, max, particleSort.data(), vertices);
+		uint32_t cursor = 0;
+		for(Batch& batch : m_batches)
+		{
+			// when truncating, the farthest particles of the batch are dropped
+			const uint32_t count = min(batch.m_end - batch.m_begin, max - cursor);
+			const ParticleSort* sorted = &m_sort[batch.m_end - count];
 
-			qsort(particleSort.data(), max, sizeof(ParticleSort), particleSortFn);
+			// quads are copied in sorted order, so they can be drawn in chunks with the shared quad indices
+			for(uint32_t ii = 0; ii < count; ++ii)
+				memcpy(&vertices[(cursor + ii) * 4], &m_quads[sorted[ii].idx * 4], 4 * sizeof(ParticleVertex));
 
-			uint16_t* indices = (uint16_t*)index_buffer.data;
-			for(uint32_t ii = 0; ii < max; ++ii)
+			for(uint32_t first = 0; first < count; first += MAX_QUADS)
 			{
-				auto tri = [](uint16_t*& dest, uint16_t a, uint16_t b, uint16_t c) { *dest++ = a; *dest++ = b; *dest++ = c; };
-				const uint16_t index = uint16_t(particleSort[ii].idx) * 4;
-				uint16_t* dest = &indices[ii * 6];
-				tri(dest, index + 0, index + 1, index + 2);
-				tri(dest, index + 2, index + 3, index + 0);
-			}
+				const uint32_t quads = min(count - first, MAX_QUADS);
 
-			uint64_t bgfx_state = 0 | BGFX_STATE_WRITE_RGB | BGFX_STATE_WRITE_A | BGFX_STATE_DEPTH_TEST_LESS; // | BGFX_STATE_CULL_CW;
-			blend_state(m_emitters.m_vec_pool->m_objects[0]->m_blend_mode, bgfx_state);
+				uint64_t bgfx_state = 0 | BGFX_STATE_WRITE_RGB | BGFX_STATE_WRITE_A | BGFX_STATE_DEPTH_TEST_LESS; // | BGFX_STATE_CULL_CW;
+				blend_state(batch.m_blend_mode, bgfx_state);
 
-			encoder.setState(bgfx_state);
-			encoder.setVertexBuffer(0, &vertex_buffer);
-			encoder.setIndexBuffer(&index_buffer);
-			encoder.setTexture(uint8_t(TextureSampler::Color), m_block.s_color, m_block.m_texture);
-			encoder.submit(pass, m_program);
+				encoder.setState(bgfx_state);
+				encoder.setVertexBuffer(0, &vertex_buffer, (cursor + first) * 4, quads * 4);
+				encoder.setIndexBuffer(m_quad_indices, 0, quads * 6);
+				encoder.setTexture(uint8_t(TextureSampler::Color), m_block.s_color, m_block.m_texture);
+				encoder.submit(pass, m_program);
+			}
+
+			cursor += count;
 		}
 	}
 
@@ -369,7 +732,8 @@ namespace mud
 		Pass particle_pass = render.next_pass("particles");
 		bgfx::Encoder& encoder = *particle_pass.m_encoder;
 
-		render.m_scene.m_particle_system->update(render.m_frame.m_delta_time); // * timeScale
-		render.m_scene.m_particle_system->render(encoder, particle_pass.m_index, render.m_camera.m_transform, render.m_camera.m_eye);
+		Plane6 planes = frustum_planes(render.m_camera.m_projection, render.m_camera.m_transform);
+
+		render.m_scene.m_particle_system->render(encoder, particle_pass.m_index, render.m_camera.m_transform, render.m_camera.m_eye, planes);
 	}
 }
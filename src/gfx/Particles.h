@@ -7,6 +7,7 @@
 #ifndef MUD_MODULES
 #include <math/Vec.h>
 #include <math/Curve.h>
+#include <math/Random.h>
 #include <math/ImageAtlas.h>
 #include <geom/Shape.h>
 #endif
@@ -41,6 +42,44 @@ namespace mud
 		float lifetime;
 	};
 
+	// particle attributes stored as separate arrays, so that update and vertex generation process them in batches of 4
+	// arrays are padded to a multiple of 4, and dead particles are swapped with the last one
+	struct ParticleArrays
+	{
+		void reserve(uint32_t capacity);
+		void add(const Particle& particle);
+		void remove(uint32_t index);
+
+		uint32_t m_count = 0;
+
+		std::vector<float> m_start_x, m_start_y, m_start_z;
+		std::vector<float> m_dir_x, m_dir_y, m_dir_z;
+		std::vector<quat> m_rot;
+
+		std::vector<float> m_speed_seed;
+		std::vector<float> m_angle_seed;
+		std::vector<float> m_blend_seed;
+		std::vector<float> m_colour_seed;
+		std::vector<float> m_scale_seed;
+		std::vector<float> m_sprite_seed;
+
+		std::vector<float> m_life;
+		std::vector<float> m_lifetime;
+
+		// current positions, computed by the emitter update
+		std::vector<float> m_pos_x, m_pos_y, m_pos_z;
+	};
+
+	// per particle tracks of the emitter, baked over the particle life
+	struct ParticleTables
+	{
+		ValueTable<float> m_speed;
+		ValueTable<float> m_blend;
+		ValueTable<Colour> m_colour;
+		ValueTable<float> m_scale;
+		ValueTable<float> m_sprite_frame;
+	};
+
 	struct ParticleSort
 	{
 		float    dist;
@@ -120,9 +159,8 @@ namespace mud
 		void upload();
 		void update(float dt);
 		void spawn(float dt);
-		uint32_t render(const SpriteAtlas& atlas, const mat4& view, const vec3& eye, uint32_t first, uint32_t max, ParticleSort* outSort, ParticleVertex* outVertices);
-
-		inline void write_vertex(ParticleVertex*& dest, ParticleVertex vertex);
+		void simulate();
+		uint32_t render(const SpriteAtlas& atlas, const mat4& view, const vec3& eye, uint32_t first, uint32_t capacity, ParticleSort* outSort, ParticleVertex* outVertices);
 
 		float m_time = 0.0f;
 		float m_dt = 0.0f;
@@ -130,8 +168,14 @@ namespace mud
 
 		Aabb m_aabb;
 
-		std::vector<Particle> m_particles;
+		ParticleArrays m_particles;
+		ParticleTables m_tables;
 		uint32_t m_max;
+
+		// spawning draws from its own generator and fills scratch buffers sized once for m_max particles
+		Xoshiro128 m_rng;
+		std::vector<vec3> m_spawn_points;
+		std::vector<float> m_spawn_seeds;
 	};
 
 #ifndef MUD_MODULES
@@ -151,13 +195,34 @@ namespace mud
 		void shutdown();
 
 		void update(float timestep);
-		void render(bgfx::Encoder& encoder, uint8_t pass, const mat4& view, const vec3& eye);
+		void render(bgfx::Encoder& encoder, uint8_t pass, const mat4& view, const vec3& eye, const Plane6& planes);
 		
 		TPool<Particles>& m_emitters;
 
 		bgfx::ProgramHandle m_program;
 
 		uint32_t m_num = 0;
+
+		// particles of one blend mode, sorted back to front and drawn together
+		struct Batch
+		{
+			BlendMode m_blend_mode;
+			uint32_t m_begin;
+			uint32_t m_end;
+		};
+
+		// visible emitters of the current render grouped by blend mode, and their first particle in the scratch buffers
+		std::vector<Particles*> m_culled;
+		std::vector<Particles*> m_visible;
+		std::vector<uint32_t> m_offsets;
+		std::vector<Batch> m_batches;
+
+		std::vector<ParticleSort> m_sort;
+		std::vector<ParticleSort> m_sort_temp;
+		std::vector<ParticleVertex> m_quads;
+
+		// quad indices for the largest draw addressable with 16-bit indices, drawn at a different base vertex for each chunk
+		bgfx::IndexBufferHandle m_quad_indices = BGFX_INVALID_HANDLE;
 	};
 
 	export_ class refl_ MUD_GFX_EXPORT BlockParticles : public GfxBlock
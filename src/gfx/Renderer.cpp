@@ -10,7 +10,7 @@
 #ifdef MUD_MODULES
 module mud.gfx;
 #else
-#include <infra/JobLoop.h>
+#include <infra/Parallel.h>
 #include <gfx/Types.h>
 #include <gfx/Renderer.h>
 #include <gfx/Pipeline.h>
@@ -50,7 +50,7 @@ namespace mud
 	Render::Render(Viewport& viewport, RenderTarget& target, RenderFrame& frame)
 		: m_scene(*viewport.m_scene), m_target(&target), m_target_fbo(target.m_fbo), m_viewport(viewport)
 		, m_camera(*viewport.m_camera), m_frame(frame), m_filters(viewport.m_filters), m_pass_index(frame.m_render_pass)
-		, m_shot(make_unique<Shot>())
+		, m_shot(frame.m_arena->make<Shot>(*frame.m_arena))
 	{
 		static bool init_uniform = true;
 		if(init_uniform)
@@ -63,11 +63,14 @@ namespace mud
 	Render::Render(Viewport& viewport, bgfx::FrameBufferHandle& target_fbo, RenderFrame& frame)
 		: m_scene(*viewport.m_scene), m_target(nullptr), m_target_fbo(target_fbo), m_viewport(viewport)
 		, m_camera(*viewport.m_camera), m_frame(frame), m_filters(viewport.m_filters), m_pass_index(frame.m_render_pass)
-		, m_shot(make_unique<Shot>())
+		, m_shot(frame.m_arena->make<Shot>(*frame.m_arena))
 	{}
 
 	Render::~Render()
-	{}
+	{
+		// the arena memory is released at the next frame, but the destructors are not called
+		m_shot->~Shot();
+	}
 
 	Pass Render::next_pass(const char* name, bool subpass)
 	{
@@ -349,15 +352,12 @@ namespace mud
 			render.m_viewport.render_pass(m_name, render_pass);
 
 #ifdef MUD_GFX_JOBS
-			auto submit = [&](JobSystem& js, Job* job, size_t start, size_t count)
+			JobSystem& js = *m_gfx_system.m_job_system;
+			parallel_for(js, 0, uint32_t(m_impl->m_draw_elements.size()), [&](uint32_t start, uint32_t count)
 			{
 				bgfx::Encoder& encoder = *m_gfx_system.m_encoders[js.thread()];
 				this->submit_draw_elements(encoder, render, render_pass, start, count);
-			};
-
-			JobSystem& js = *m_gfx_system.m_job_system;
-			Job* job = jobs<16>(js, nullptr, 0, m_impl->m_draw_elements.size(), submit);
-			js.complete(job);
+			}, 16);
 #else
 			bgfx::Encoder& encoder = *render_pass.m_encoder;
 			this->submit_draw_elements(encoder, render, render_pass, 0, m_impl->m_draw_elements.size());
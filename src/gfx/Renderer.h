@@ -25,6 +25,8 @@ namespace mud
 
 	MUD_GFX_EXPORT const bgfx::VertexDecl& vertex_decl(size_t vertex_format);
 
+	MUD_GFX_EXPORT uint32_t float_flip(uint32_t f);
+
 	export_ enum class refl_ TextureSampler : unsigned int
 	{
 		Source0 = 0,
@@ -105,6 +107,7 @@ namespace mud
 		float m_time;
 		float m_delta_time;
 		uint8_t m_render_pass;
+		LinearArena* m_arena;
 	};
 
 	struct RenderFilters;
@@ -122,7 +125,7 @@ namespace mud
 		Camera& m_camera;
 		RenderFrame& m_frame;
 
-		unique_ptr<Frustum> m_frustum;
+		Frustum* m_frustum = nullptr;
 
 		Environment* m_environment = nullptr;
 		RenderFilters* m_filters = nullptr;
@@ -140,7 +143,8 @@ namespace mud
 		uint8_t m_pass_index = s_render_pass_id;
 		uint8_t m_sub_pass_index = 0;
 
-		unique_ptr<Shot> m_shot;
+		// allocated in the frame arena
+		Shot* m_shot;
 
 		Pass next_pass(const char* name, bool subpass = false);
 		uint8_t next_pass_id() { return m_pass_index++; }
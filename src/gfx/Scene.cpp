@@ -88,7 +88,7 @@ namespace mud
 
 		vec4 lod_levels = render.m_camera.m_far * vec4{ 0.02f, 0.3f, 0.6f, 0.8f };
 
-		//render.m_shot->m_items.reserve(m_pool->pool<Item>().m_vec_pool.size());
+		render.m_shot->m_items.reserve(m_pool->pool<Item>().m_vec_pool->count());
 
 		m_pool->iterate_objects<Item>([&](Item& item)
 		{
@@ -109,7 +109,7 @@ namespace mud
 			}
 		});
 
-		//render.m_shot->m_lights.reserve(m_shot->m_lights.size());
+		render.m_shot->m_lights.reserve(m_pool->pool<Light>().m_vec_pool->count());
 
 		m_pool->iterate_objects<Light>([&](Light& light)
 		{
@@ -139,7 +139,7 @@ namespace mud
 		});
 #endif
 
-		render.m_frustum = make_unique<Frustum>(optimized_frustum(render.m_camera, to_array(render.m_shot->m_items)));
+		render.m_frustum = render.m_frame.m_arena->make<Frustum>(optimized_frustum(render.m_camera, to_array(render.m_shot->m_items)));
 
 		render.m_environment = &m_environment;
 		render.m_shot->m_immediate = { m_immediate.get() };
@@ -4,21 +4,23 @@
 
 #pragma once
 
-#include <gfx/Forward.h>
-
-#ifndef MUD_CPP_20
-#include <vector>
+#ifndef MUD_MODULES
+#include <infra/FrameArena.h>
 #endif
+#include <gfx/Forward.h>
 
 namespace mud
 {
+	// the items and lights gathered for one render : allocated in the frame arena, along with its containers
 	export_ class refl_ MUD_GFX_EXPORT Shot
 	{
 	public:
-		std::vector<Item*> m_items;
-		std::vector<Light*> m_lights;
+		Shot(LinearArena& arena) : m_items(arena), m_lights(arena), m_immediate(arena) {}
+
+		FrameVector<Item*> m_items;
+		FrameVector<Light*> m_lights;
 		//std::vector<ReflectionProbe*> m_reflection_probes;
 		//std::vector<GIProbe*> m_gi_probes;
-		std::vector<ImmediateDraw*> m_immediate;
+		FrameVector<ImmediateDraw*> m_immediate;
 	};
 }
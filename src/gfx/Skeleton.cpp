@@ -7,12 +7,18 @@
 #ifdef MUD_MODULES
 module mud.gfx;
 #else
+#include <math/Math.h>
 #include <gfx/Skeleton.h>
 #include <gfx/Renderer.h>
+#include <gfx/GfxSystem.h>
 #endif
 
 #include <bx/math.h>
 
+#ifndef MUD_CPP_20
+#include <algorithm>
+#endif
+
 #define SKELETON_TEXTURE_SIZE 256
 
 namespace mud
@@ -51,15 +57,114 @@ namespace mud
 		return nullptr;
 	}
 
+	JointPalette::JointPalette()
+	{}
+
+	JointPalette::~JointPalette()
+	{
+		if(bgfx::isValid(m_texture))
+			bgfx::destroy(m_texture);
+	}
+
+	uint32_t JointPalette::allocate(uint32_t num_joints)
+	{
+		for(size_t i = 0; i < m_free.size(); ++i)
+			if(m_free[i].m_count >= num_joints)
+			{
+				uint32_t offset = m_free[i].m_offset;
+				m_free[i].m_offset += num_joints;
+				m_free[i].m_count -= num_joints;
+				if(m_free[i].m_count == 0)
+					m_free.erase(m_free.begin() + i);
+				return offset;
+			}
+
+		uint32_t offset = m_cursor;
+		m_cursor += num_joints;
+
+		if(m_cursor > m_capacity)
+		{
+			while(m_capacity < m_cursor)
+				m_capacity = max(m_capacity * 2, uint32_t(SKELETON_TEXTURE_SIZE));
+			m_data.resize(m_capacity * 4 * 4);
+		}
+
+		return offset;
+	}
+
+	void JointPalette::release(uint32_t offset, uint32_t num_joints)
+	{
+		// free ranges are kept sorted by offset and merged with their neighbours, and the last one is given back to the cursor
+		auto it = std::lower_bound(m_free.begin(), m_free.end(), offset, [](const Range& range, uint32_t offset) { return range.m_offset < offset; });
+		it = m_free.insert(it, { offset, num_joints });
+
+		if(it + 1 != m_free.end() && it->m_offset + it->m_count == (it + 1)->m_offset)
+		{
+			it->m_count += (it + 1)->m_count;
+			m_free.erase(it + 1);
+		}
+
+		if(it != m_free.begin() && (it - 1)->m_offset + (it - 1)->m_count == it->m_offset)
+		{
+			(it - 1)->m_count += it->m_count;
+			m_free.erase(it);
+		}
+
+		if(m_free.back().m_offset + m_free.back().m_count == m_cursor)
+		{
+			m_cursor = m_free.back().m_offset;
+			m_free.pop_back();
+		}
+	}
+
+	void JointPalette::write(uint32_t index, const mat4& joint)
+	{
+		float* texture = m_data.data();
+		size_t offset = ((index / SKELETON_TEXTURE_SIZE) * SKELETON_TEXTURE_SIZE) * 4 * 4 + (index % SKELETON_TEXTURE_SIZE) * 4;
+
+		for(int i = 0; i < 4; ++i)
+		{
+			for(int j = 0; j < 4; ++j)
+				texture[offset + j] = joint[j][i];
+			offset += SKELETON_TEXTURE_SIZE * 4;
+		}
+
+		m_dirty = true;
+	}
+
+	void JointPalette::upload()
+	{
+		if(!m_dirty)
+			return;
+
+		uint16_t height = uint16_t(m_capacity / SKELETON_TEXTURE_SIZE * 4);
+		if(height != m_height)
+		{
+			if(bgfx::isValid(m_texture))
+				bgfx::destroy(m_texture);
+			m_texture = bgfx::createTexture2D(SKELETON_TEXTURE_SIZE, height, false, 1, bgfx::TextureFormat::RGBA32F, GFX_TEXTURE_POINT | GFX_TEXTURE_CLAMP);
+			m_height = height;
+		}
+
+		// only the rows covering allocated joints are uploaded, in a single copy for all skins
+		int rows = (m_cursor + SKELETON_TEXTURE_SIZE - 1) / SKELETON_TEXTURE_SIZE;
+		if(rows > 0)
+		{
+			const bgfx::Memory* memory = bgfx::copy(m_data.data(), uint32_t(SKELETON_TEXTURE_SIZE * rows * 4 * 4 * sizeof(float)));
+			bgfx::updateTexture2D(m_texture, 0, 0, 0, 0, SKELETON_TEXTURE_SIZE, uint16_t(rows * 4), memory);
+		}
+
+		m_dirty = false;
+	}
+
+	GfxSystem* Skin::ms_gfx_system = nullptr;
+
 	Skin::Skin(Skeleton& skeleton, int num_joints)
 		: m_skeleton(&skeleton)
+		, m_palette(&ms_gfx_system->joint_palette())
+		, m_capacity(uint32_t(num_joints))
 	{
-		int height = num_joints / SKELETON_TEXTURE_SIZE;
-		if(num_joints % SKELETON_TEXTURE_SIZE)
-			height++;
-
-		m_texture = bgfx::createTexture2D(SKELETON_TEXTURE_SIZE, uint16_t(height * 4), false, 1, bgfx::TextureFormat::RGBA32F, GFX_TEXTURE_POINT | GFX_TEXTURE_CLAMP);
-		//m_texture_data.resize(SKELETON_TEXTURE_SIZE * height * 4 * 4);
+		m_offset = m_palette->allocate(m_capacity);
 	}
 
 	Skin::Skin(const Skin& copy, Skeleton& skeleton)
@@ -69,16 +174,33 @@ namespace mud
 		m_skeleton = &skeleton;
 	}
 
+	Skin::Skin(Skin&& other) noexcept
+		: m_skeleton(other.m_skeleton)
+		, m_palette(other.m_palette)
+		, m_offset(other.m_offset)
+		, m_capacity(other.m_capacity)
+		, m_joints(std::move(other.m_joints))
+	{
+		other.m_palette = nullptr;
+	}
+
 	Skin::~Skin()
 	{
-		if(bgfx::isValid(m_texture))
-			bgfx::destroy(m_texture);
+		if(m_palette)
+			m_palette->release(m_offset, m_capacity);
 	}
 
 	void Skin::add_joint(cstring bone, const mat4& inverse_bind)
 	{
 		Joint joint = { size_t(m_skeleton->find_bone(bone)->m_index), inverse_bind, mat4{} };
 		m_joints.push_back(joint);
+
+		if(m_joints.size() > m_capacity)
+		{
+			m_palette->release(m_offset, m_capacity);
+			m_capacity = uint32_t(m_joints.size());
+			m_offset = m_palette->allocate(m_capacity);
+		}
 	}
 
 	Joint* Skin::find_bone_joint(cstring name)
@@ -91,34 +213,12 @@ namespace mud
 
 	void Skin::update_joints()
 	{
-		int height = m_joints.size() / SKELETON_TEXTURE_SIZE;
-		if(m_joints.size() % SKELETON_TEXTURE_SIZE)
-			height++;
-
-		m_memory = bgfx::alloc(SKELETON_TEXTURE_SIZE * height * 4 * 4 * sizeof(float));
-
-		int index = 0;
+		uint32_t index = m_offset;
 		for(Joint& joint : m_joints)
 		{
 			joint.m_joint = m_skeleton->m_bones[joint.m_bone].m_pose * joint.m_inverse_bind;
-
-			float* texture = (float*)m_memory->data;
-			//float* texture = m_texture_data.data();
-			int offset = ((index / SKELETON_TEXTURE_SIZE) * SKELETON_TEXTURE_SIZE) * 4 * 4 + (index % SKELETON_TEXTURE_SIZE) * 4;
-			index++;
-
-			//debug_print_mat(joint.m_joint);
-
-			for(int i = 0; i < 4; ++i)
-			{
-				for(int j = 0; j < 4; ++j)
-					texture[offset + j] = joint.m_joint[j][i];
-				offset += SKELETON_TEXTURE_SIZE * 4;
-			}
+			m_palette->write(index++, joint.m_joint);
 		}
-
-		//const bgfx::Memory* mem = bgfx::makeRef(m_texture_data.data(), sizeof(float) * m_texture_data.size());
-		bgfx::updateTexture2D(m_texture, 0, 0, 0, 0, SKELETON_TEXTURE_SIZE, uint16_t(height * 4), m_memory);
 	}
 
 	Rig::Rig()
@@ -133,7 +233,11 @@ namespace mud
 
 	Rig& Rig::operator=(const Rig& rig)
 	{
+		if(this == &rig)
+			return *this;
 		m_skeleton = rig.m_skeleton;
+		// releases the palette ranges of the old skins
+		m_skins.clear();
 		m_skins.reserve(rig.m_skins.size());
 		for(const Skin& skin : rig.m_skins)
 			m_skins.emplace_back(skin, m_skeleton);
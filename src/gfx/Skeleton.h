@@ -5,6 +5,7 @@
 #pragma once
 
 #ifndef MUD_MODULES
+#include <infra/NonCopy.h>
 #include <math/Vec.h>
 #endif
 #include <gfx/Forward.h>
@@ -63,11 +64,39 @@ namespace mud
 		mat4 m_joint;
 	};
 
+	// frame-global joint matrices of all skins, packed in a single texture uploaded once per frame
+	// each skin is assigned a range of joints at construction, and skinned draws only pass that offset
+	export_ class MUD_GFX_EXPORT JointPalette : public NonCopy
+	{
+	public:
+		JointPalette();
+		~JointPalette();
+
+		uint32_t allocate(uint32_t num_joints);
+		void release(uint32_t offset, uint32_t num_joints);
+
+		void write(uint32_t index, const mat4& joint);
+		void upload();
+
+		struct Range { uint32_t m_offset; uint32_t m_count; };
+
+		bgfx::TextureHandle m_texture = BGFX_INVALID_HANDLE;
+		uint16_t m_height = 0;
+
+		uint32_t m_capacity = 0;
+		uint32_t m_cursor = 0;
+		std::vector<Range> m_free;
+
+		std::vector<float> m_data;
+		bool m_dirty = false;
+	};
+
 	export_ class refl_ MUD_GFX_EXPORT Skin
 	{
 	public:
 		Skin(Skeleton& skeleton, int num_joints);
 		Skin(const Skin& copy, Skeleton& skeleton);
+		Skin(Skin&& other) noexcept;
 		~Skin();
 
 		void add_joint(cstring bone, const mat4& inverse_bind);
@@ -76,11 +105,13 @@ namespace mud
 
 		Skeleton* m_skeleton;
 
-		bgfx::TextureHandle m_texture = BGFX_INVALID_HANDLE;
-		const bgfx::Memory* m_memory = nullptr;
-		//std::vector<float> m_texture_data;
+		JointPalette* m_palette = nullptr;
+		uint32_t m_offset = 0;
+		uint32_t m_capacity = 0;
 
 		std::vector<Joint> m_joints;
+
+		static GfxSystem* ms_gfx_system;
 	};
 
 	export_ class refl_ MUD_GFX_EXPORT Rig
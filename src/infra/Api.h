@@ -1,19 +1,23 @@
 #include <infra/Array.h>
 #include <infra/Config.h>
+#include <infra/Coroutine.h>
 #include <infra/Cpp20.h>
 #include <infra/EnumArray.h>
 #include <infra/File.h>
+#include <infra/FrameArena.h>
 #include <infra/Forward.h>
 #include <infra/Generic.h>
 #include <infra/Global.h>
 #include <infra/Job.h>
 #include <infra/Limits.h>
+#include <infra/NameTable.h>
 #include <infra/NonCopy.h>
 #include <infra/Pragma.h>
 #include <infra/Reverse.h>
 #include <infra/String.h>
 #include <infra/StringConvert.h>
 #include <infra/Strung.h>
+#include <infra/TaskGraph.h>
 #include <infra/Types.h>
 #include <infra/TypeTraits.h>
 #include <infra/Vector.h>
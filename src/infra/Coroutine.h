@@ -0,0 +1,255 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <infra/Config.h>
+#include <infra/Job.h>
+
+#if defined __cpp_impl_coroutine
+#define MUD_COROUTINES
+#endif
+
+#ifdef MUD_COROUTINES
+
+#ifndef MUD_CPP_20
+#include <atomic>
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <utility>
+#include <vector>
+#endif
+
+namespace mud
+{
+	export_ template <class T>
+	class Task;
+
+	namespace detail
+	{
+		struct TaskPromiseBase
+		{
+			// resumed when the task completes : set when the task is awaited by another one
+			std::coroutine_handle<> m_continuation;
+			std::atomic<bool> m_done = { false };
+			bool m_detached = false;
+
+			struct FinalAwaiter
+			{
+				bool await_ready() noexcept { return false; }
+
+				template <class T_Promise>
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<T_Promise> handle) noexcept
+				{
+					TaskPromiseBase& promise = handle.promise();
+					std::coroutine_handle<> continuation = promise.m_continuation;
+					const bool detached = promise.m_detached;
+					promise.m_done.store(true, std::memory_order_release);
+					if(continuation)
+						return continuation;
+					if(detached)
+						handle.destroy();
+					return std::noop_coroutine();
+				}
+
+				void await_resume() noexcept {}
+			};
+
+			// tasks start suspended : they run when awaited, or when started on a job system
+			std::suspend_always initial_suspend() noexcept { return {}; }
+			FinalAwaiter final_suspend() noexcept { return {}; }
+
+			// like jobs, tasks don't propagate exceptions
+			void unhandled_exception() { std::terminate(); }
+		};
+
+		template <class T>
+		struct TaskPromise : public TaskPromiseBase
+		{
+			Task<T> get_return_object() { return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this)); }
+
+			template <class U>
+			void return_value(U&& value) { m_value = std::forward<U>(value); }
+
+			T m_value = {};
+		};
+
+		template <>
+		struct TaskPromise<void> : public TaskPromiseBase
+		{
+			Task<void> get_return_object();
+
+			void return_void() {}
+		};
+	}
+
+	// a coroutine which runs on the job system : awaiting a job, another task, or a thread queue suspends it without blocking the thread
+	// it's resumed by a job pushed on the work queue of the thread which completes what it waited on
+	export_ template <class T>
+	class Task
+	{
+	public:
+		using promise_type = detail::TaskPromise<T>;
+		using Handle = std::coroutine_handle<promise_type>;
+
+		Task() {}
+		explicit Task(Handle handle) : m_handle(handle) {}
+		Task(Task&& other) : m_handle(std::exchange(other.m_handle, nullptr)) {}
+		Task& operator=(Task&& other) { if(this != &other) { this->reset(); m_handle = std::exchange(other.m_handle, nullptr); } return *this; }
+		~Task() { this->reset(); }
+
+		Task(const Task& other) = delete;
+		Task& operator=(const Task& other) = delete;
+
+		bool valid() const { return bool(m_handle); }
+		bool done() const { return m_handle && m_handle.promise().m_done.load(std::memory_order_acquire); }
+
+		// runs the task on a job system worker, as a background job with JobSystem::BACKGROUND : it must not have started yet
+		void start(JobSystem& js, uint32_t flags = 0)
+		{
+			assert(m_handle && !m_handle.promise().m_done);
+			Handle handle = m_handle;
+			js.run(js.job(nullptr, [handle](JobSystem& js, Job* job) { UNUSED(js); UNUSED(job); handle.resume(); }), flags);
+		}
+
+		// starts the task and lets it free itself once completed
+		void detach(JobSystem& js, uint32_t flags = 0)
+		{
+			m_handle.promise().m_detached = true;
+			this->start(js, flags);
+			m_handle = nullptr;
+		}
+
+		// runs jobs on the calling thread until the task has completed
+		void wait(JobSystem& js)
+		{
+			while(!this->done())
+				if(!js.yield())
+					std::this_thread::yield();
+		}
+
+		template <class U = T, class = typename std::enable_if<!std::is_void<U>::value>::type>
+		U& result() { assert(this->done()); return m_handle.promise().m_value; }
+
+		struct Awaiter
+		{
+			Handle m_handle;
+
+			bool await_ready() const { return m_handle.promise().m_done.load(std::memory_order_acquire); }
+
+			// the awaited task runs right away on this thread, and resumes the awaiting one when it completes
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting)
+			{
+				m_handle.promise().m_continuation = awaiting;
+				return m_handle;
+			}
+
+			template <class U = T>
+			typename std::enable_if<!std::is_void<U>::value, U>::type await_resume() { return std::move(m_handle.promise().m_value); }
+			template <class U = T>
+			typename std::enable_if<std::is_void<U>::value>::type await_resume() {}
+		};
+
+		Awaiter operator co_await() && { assert(m_handle); return Awaiter{ m_handle }; }
+		Awaiter operator co_await() & { assert(m_handle); return Awaiter{ m_handle }; }
+
+	private:
+		void reset()
+		{
+			if(m_handle)
+			{
+				assert(m_handle.done() || !m_handle.promise().m_continuation);
+				m_handle.destroy();
+			}
+			m_handle = nullptr;
+		}
+
+		Handle m_handle = nullptr;
+	};
+
+	inline Task<void> detail::TaskPromise<void>::get_return_object() { return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this)); }
+
+	// coroutines waiting to run on one given thread, like the main thread for the bgfx calls : that thread calls pump() regularly
+	export_ class ThreadQueue
+	{
+	public:
+		void push(std::coroutine_handle<> handle)
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_handles.push_back(handle);
+		}
+
+		// resumes the waiting coroutines, returns how many
+		size_t pump()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+				std::swap(m_handles, m_pumped);
+			}
+			for(std::coroutine_handle<> handle : m_pumped)
+				handle.resume();
+			const size_t count = m_pumped.size();
+			m_pumped.clear();
+			return count;
+		}
+
+	private:
+		std::mutex m_lock;
+		std::vector<std::coroutine_handle<>> m_handles;
+		std::vector<std::coroutine_handle<>> m_pumped;
+	};
+
+	struct JobAwaiter
+	{
+		JobSystem& m_js;
+		Job* m_job;
+
+		bool await_ready() const { return false; }
+
+		void await_suspend(std::coroutine_handle<> handle)
+		{
+			Job* continuation = m_js.continuation([handle](JobSystem& js, Job* job) { UNUSED(js); UNUSED(job); handle.resume(); });
+			m_js.then(m_job, continuation);
+		}
+
+		void await_resume() {}
+	};
+
+	struct JobSystemAwaiter
+	{
+		JobSystem& m_js;
+		uint32_t m_flags;
+
+		bool await_ready() const { return false; }
+
+		void await_suspend(std::coroutine_handle<> handle)
+		{
+			m_js.run(m_js.job(nullptr, [handle](JobSystem& js, Job* job) { UNUSED(js); UNUSED(job); handle.resume(); }), m_flags);
+		}
+
+		void await_resume() {}
+	};
+
+	struct ThreadQueueAwaiter
+	{
+		ThreadQueue& m_queue;
+
+		bool await_ready() const { return false; }
+		void await_suspend(std::coroutine_handle<> handle) { m_queue.push(handle); }
+		void await_resume() {}
+	};
+
+	// runs a job which has no parent and has not been run yet, and resumes once it has completed along with its children
+	export_ inline JobAwaiter join(JobSystem& js, Job* job) { return { js, job }; }
+
+	// resumes on a job system worker, as a background job with JobSystem::BACKGROUND
+	export_ inline JobSystemAwaiter resume_on(JobSystem& js, uint32_t flags = 0) { return { js, flags }; }
+
+	// resumes on the thread pumping the queue
+	export_ inline ThreadQueueAwaiter resume_on(ThreadQueue& queue) { return { queue }; }
+}
+
+#endif
@@ -16,6 +16,16 @@ module mud.infra;
 #include <infra/File.h>
 #endif
 
+#ifdef _WIN32
+	#include <windows.h>
+#else
+	#include <cstdio>
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
 namespace mud
 {
 	std::vector<uint8_t> read_binary_file(const string& path)
@@ -71,4 +81,63 @@ namespace mud
 		out << content;
 	}
 
+	bool write_binary_file(cstring path, const uint8_t* data, size_t size)
+	{
+		std::ofstream out(path, std::ios::binary);
+		out.write((const char*)data, size);
+		return out.good();
+	}
+
+#ifdef _WIN32
+	MappedFile::MappedFile(cstring path)
+	{
+		HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if(file == INVALID_HANDLE_VALUE)
+			return;
+
+		LARGE_INTEGER size;
+		HANDLE mapping = GetFileSizeEx(file, &size) && size.QuadPart > 0 ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+		CloseHandle(file);
+		if(!mapping)
+			return;
+
+		m_data = (const uint8_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		m_size = m_data ? size_t(size.QuadPart) : 0;
+		m_handle = mapping;
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if(m_data)
+			UnmapViewOfFile(m_data);
+		if(m_handle)
+			CloseHandle(m_handle);
+	}
+#else
+	MappedFile::MappedFile(cstring path)
+	{
+		int file = open(path, O_RDONLY);
+		if(file < 0)
+			return;
+
+		struct stat info;
+		if(fstat(file, &info) == 0 && info.st_size > 0)
+		{
+			void* data = mmap(nullptr, size_t(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+			if(data != MAP_FAILED)
+			{
+				m_data = (const uint8_t*)data;
+				m_size = size_t(info.st_size);
+			}
+		}
+		close(file);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if(m_data)
+			munmap((void*)m_data, m_size);
+	}
+#endif
+
 }
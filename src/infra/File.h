@@ -32,4 +32,22 @@ namespace mud
 	export_ MUD_INFRA_EXPORT void visit_files(cstring path, FileVisitor visit_file);
 	export_ MUD_INFRA_EXPORT void visit_folders(cstring path, FileVisitor visit_folder, bool ignore_symbolic = true);
 	export_ MUD_INFRA_EXPORT void write_file(cstring path, cstring content);
+	export_ MUD_INFRA_EXPORT bool write_binary_file(cstring path, const uint8_t* data, size_t size);
+
+	// read-only memory mapping of a whole file : m_data is null if the file couldn't be mapped
+	export_ class MUD_INFRA_EXPORT MappedFile
+	{
+	public:
+		MappedFile(cstring path);
+		~MappedFile();
+
+		MappedFile(const MappedFile& other) = delete;
+		MappedFile& operator=(const MappedFile& other) = delete;
+
+		const uint8_t* m_data = nullptr;
+		size_t m_size = 0;
+
+	private:
+		void* m_handle = nullptr;
+	};
 }
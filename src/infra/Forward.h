@@ -22,5 +22,9 @@ namespace mud {
     struct swallow;
     class NonCopy;
     class Movabl;
+    class LinearArena;
+    class FrameArena;
+    class TaskGraph;
+    class NameTable;
 }
 
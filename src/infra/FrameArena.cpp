@@ -0,0 +1,127 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#ifdef MUD_CPP_20
+#include <infra/Cpp20.h>
+#endif
+
+#ifdef MUD_MODULES
+module mud.infra;
+#else
+#include <infra/FrameArena.h>
+#endif
+
+namespace mud
+{
+	LinearArena::LinearArena(FrameBlocks& blocks)
+		: m_blocks(blocks)
+	{}
+
+	LinearArena::LinearArena(LinearArena&& other)
+		: m_blocks(other.m_blocks)
+	{
+		assert(other.m_used.empty() && other.m_oversized.empty());
+		std::swap(m_heap, other.m_heap);
+		std::swap(m_spare, other.m_spare);
+	}
+
+	LinearArena::~LinearArena()
+	{
+		this->reset();
+		for(FrameBlock* block : m_heap)
+			delete block;
+	}
+
+	void* LinearArena::alloc(size_t size, size_t alignment)
+	{
+		m_num_allocs++;
+		m_num_bytes += size;
+
+		if(size + alignment > FrameBlock::Size)
+		{
+			m_num_heap_allocs++;
+			m_oversized.push_back(operator new(size));
+			return m_oversized.back();
+		}
+
+		uint8_t* pointer = pointermath::align(m_cursor, alignment);
+		if(!m_cursor || pointer + size > m_end)
+		{
+			this->next_block();
+			pointer = pointermath::align(m_cursor, alignment);
+		}
+
+		m_cursor = pointer + size;
+		return pointer;
+	}
+
+	void LinearArena::next_block()
+	{
+		FrameBlock* block = (FrameBlock*)m_blocks.alloc();
+		if(!block && !m_spare.empty())
+		{
+			block = m_spare.back();
+			m_spare.pop_back();
+		}
+		else if(!block)
+		{
+			m_num_heap_allocs++;
+			block = new FrameBlock;
+			m_heap.push_back(block);
+		}
+
+		m_used.push_back(block);
+		m_cursor = block->m_data;
+		m_end = block->m_data + FrameBlock::Size;
+	}
+
+	// the heap blocks used this frame join the ones left over from previous frames
+	void LinearArena::reset()
+	{
+		for(FrameBlock* block : m_used)
+		{
+			if(block >= m_blocks.m_begin && block < m_blocks.m_end)
+				m_blocks.free(block);
+			else
+				m_spare.push_back(block);
+		}
+
+		for(void* pointer : m_oversized)
+			operator delete(pointer);
+
+		m_used.clear();
+		m_oversized.clear();
+		m_cursor = nullptr;
+		m_end = nullptr;
+
+		m_num_allocs = 0;
+		m_num_bytes = 0;
+		m_num_heap_allocs = 0;
+	}
+
+	FrameArena::FrameArena(size_t num_blocks, uint32_t num_threads)
+		: m_blocks("frame", num_blocks * sizeof(FrameBlock))
+	{
+		this->threads(num_threads);
+	}
+
+	void FrameArena::threads(uint32_t count)
+	{
+		m_threads.reserve(count);
+		while(m_threads.size() < count)
+			m_threads.emplace_back(m_blocks);
+	}
+
+	void FrameArena::next_frame()
+	{
+		m_last_frame = {};
+		for(LinearArena& arena : m_threads)
+		{
+			m_last_frame.m_num_allocs += arena.m_num_allocs;
+			m_last_frame.m_num_bytes += arena.m_num_bytes;
+			m_last_frame.m_num_heap_allocs += arena.m_num_heap_allocs;
+			arena.reset();
+		}
+	}
+}
@@ -0,0 +1,123 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <infra/Config.h>
+#include <infra/Pool.h>
+
+#ifndef MUD_CPP_20
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+#endif
+
+namespace mud
+{
+	struct FrameBlock
+	{
+		static const size_t Size = 64 * 1024;
+		alignas(16) uint8_t m_data[Size];
+	};
+
+	using FrameBlocks = Arena<FrameBlock, AtomicFreeList>;
+
+	// bump allocator for the data of one frame, used by one thread at a time
+	// blocks are taken from the shared arena, and when it's exhausted from the heap : heap blocks are kept for the next frames
+	// nothing is freed individually, and destructors are not called : reset() releases everything at once
+	export_ class MUD_INFRA_EXPORT LinearArena
+	{
+	public:
+		LinearArena(FrameBlocks& blocks);
+		LinearArena(LinearArena&& other);
+		~LinearArena();
+
+		LinearArena(const LinearArena& other) = delete;
+		LinearArena& operator=(const LinearArena& other) = delete;
+
+		void* alloc(size_t size, size_t alignment);
+
+		template <class T>
+		T* alloc(size_t count) { return (T*)this->alloc(count * sizeof(T), alignof(T)); }
+
+		template <class T, class... T_Args>
+		T* make(T_Args&&... args) { return new (this->alloc(sizeof(T), alignof(T))) T(std::forward<T_Args>(args)...); }
+
+		void reset();
+
+		FrameBlocks& m_blocks;
+
+		// counters of the current frame : heap allocations are oversized requests and blocks missing from the shared arena
+		size_t m_num_allocs = 0;
+		size_t m_num_bytes = 0;
+		size_t m_num_heap_allocs = 0;
+
+	private:
+		void next_block();
+
+		uint8_t* m_cursor = nullptr;
+		uint8_t* m_end = nullptr;
+
+		std::vector<FrameBlock*> m_used;
+		std::vector<FrameBlock*> m_heap;
+		std::vector<FrameBlock*> m_spare;
+		std::vector<void*> m_oversized;
+	};
+
+	// one linear arena per thread, reset wholesale when a frame ends : index the arenas by JobSystem::thread()
+	export_ class MUD_INFRA_EXPORT FrameArena
+	{
+	public:
+		FrameArena(size_t num_blocks = 256, uint32_t num_threads = 1);
+
+		FrameArena(const FrameArena& other) = delete;
+		FrameArena& operator=(const FrameArena& other) = delete;
+
+		LinearArena& thread(uint32_t index) { return m_threads[index]; }
+
+		// must not be called while a frame is in flight
+		void threads(uint32_t count);
+
+		void next_frame();
+
+		struct Stats
+		{
+			size_t m_num_allocs = 0;
+			size_t m_num_bytes = 0;
+			size_t m_num_heap_allocs = 0;
+		};
+
+		// counters of the last completed frame, summed over threads
+		Stats m_last_frame;
+
+		FrameBlocks m_blocks;
+		std::vector<LinearArena> m_threads;
+	};
+
+	// allocator for standard containers holding per frame data : memory is released by the arena reset, never by the container
+	export_ template <class T>
+	struct FrameAllocator
+	{
+		using value_type = T;
+
+		FrameAllocator(LinearArena& arena) : m_arena(&arena) {}
+		template <class U>
+		FrameAllocator(const FrameAllocator<U>& other) : m_arena(other.m_arena) {}
+
+		T* allocate(size_t count) { return m_arena->alloc<T>(count); }
+		void deallocate(T* pointer, size_t count) { UNUSED(pointer); UNUSED(count); }
+
+		template <class U>
+		bool operator==(const FrameAllocator<U>& other) const { return m_arena == other.m_arena; }
+		template <class U>
+		bool operator!=(const FrameAllocator<U>& other) const { return m_arena != other.m_arena; }
+
+		LinearArena* m_arena;
+	};
+
+	export_ template <class T>
+	using FrameVector = std::vector<T, FrameAllocator<T>>;
+}
@@ -35,9 +35,11 @@ namespace mud
 	thread_local JobSystem::ThreadState* s_thread_state(nullptr);
 
 	JobSystem::JobSystem(size_t num_threads, size_t adoptable_threads)
-		: m_job_pool("JobSystem Job pool", MAX_JOB_COUNT * sizeof(Job))
-		, m_jobs(static_cast<Job*>(m_job_pool.current()))
+		: m_blocks(MAX_BLOCKS)
 	{
+		for(size_t i = 0; i < 4; ++i)
+			this->grow();
+
 		if(num_threads == 0)
 		{
 			size_t hardware_threads = std::thread::hardware_concurrency();
@@ -52,13 +54,16 @@ namespace mud
 		m_thread_count = uint16_t(num_threads);
 		m_parallel_split_count = (uint8_t)std::ceil((std::log2f(num_threads + adoptable_threads)));
 
+		// keep one worker for the frame jobs
+		m_background_budget = uint32_t(num_threads > 1 ? num_threads - 1 : 1);
+
 		//assert(m_exit_requested.is_lock_free());
 		//assert(Job().running_jobs.is_lock_free());
 
 		for(size_t i = 0, n = m_thread_states.size(); i < n; i++)
 		{
 			ThreadState& state = m_thread_states[i];
-			state.work_queue.m_jobs = m_jobs;
+			state.job_cache.reserve(CACHE_SIZE);
 			state.index = uint32_t(i);
 			state.mask = uint32_t(1UL << i);
 			state.js = this;
@@ -78,6 +83,9 @@ namespace mud
 			if(state.thread.joinable())
 				state.thread.join();
 		}
+
+		for(uint32_t i = 0; i < m_num_blocks; ++i)
+			aligned_free(m_blocks[i].load());
 	}
 
 	JobSystem* JobSystem::instance()
@@ -128,6 +136,17 @@ namespace mud
 		return m_thread_states[index];
 	}
 
+	bool JobSystem::yield()
+	{
+		return execute(state());
+	}
+
+	void JobSystem::background_budget(uint32_t count)
+	{
+		m_background_budget.store(std::max(1U, count), std::memory_order_relaxed);
+		this->signal();
+	}
+
 	bool JobSystem::execute(ThreadState& state)
 	{
 		Job* job = state.work_queue.pop();
@@ -148,8 +167,54 @@ namespace mud
 				job->function(job->padding, *this, job);
 
 			finish(job);
+			return true;
+		}
+
+		// frame jobs still queued somewhere come first, even when the steal missed them
+		if(m_active_jobs.load(std::memory_order_relaxed) == 0)
+			return this->execute_background(state);
+		return false;
+	}
+
+	inline bool JobSystem::background_ready(ThreadState& state) const
+	{
+		return (state.index < m_thread_count || m_thread_count == 0)
+			&& m_background_pending.load(std::memory_order_relaxed) > 0
+			&& m_background_running.load(std::memory_order_relaxed) < m_background_budget.load(std::memory_order_relaxed);
+	}
+
+	bool JobSystem::execute_background(ThreadState& state)
+	{
+		if(!this->background_ready(state))
+			return false;
+
+		Job* job = nullptr;
+		{
+			std::lock_guard<std::mutex> lock(m_background_lock);
+			if(m_background_jobs.empty() || m_background_running.load(std::memory_order_relaxed) >= m_background_budget.load(std::memory_order_relaxed))
+				return false;
+			job = m_background_jobs.front();
+			m_background_jobs.pop_front();
+			m_background_pending.fetch_sub(1, std::memory_order_relaxed);
+			m_background_running.fetch_add(1, std::memory_order_relaxed);
 		}
-		return job != nullptr;
+
+		if(job->function)
+			job->function(job->padding, *this, job);
+
+		finish(job);
+
+		m_background_running.fetch_sub(1, std::memory_order_relaxed);
+		// workers which went to sleep because the budget was spent can take the next one
+		if(m_background_pending.load(std::memory_order_relaxed) > 0)
+			this->signal();
+		return true;
+	}
+
+	void JobSystem::signal()
+	{
+		{ std::lock_guard<std::mutex> lock(m_lock); }
+		m_condition.notify_one();
 	}
 
 	void JobSystem::loop(ThreadState* thread_state)
@@ -163,29 +228,94 @@ namespace mud
 			if(!execute(*thread_state))
 			{
 				std::unique_lock<std::mutex> lock(m_lock);
-				while(!exiting() && !(m_active_jobs.load(std::memory_order_relaxed)))
+				while(!exiting() && !(m_active_jobs.load(std::memory_order_relaxed)) && !this->background_ready(*thread_state))
 					m_condition.wait(lock);
 			}
 		} while(!exiting());
 	}
 	
+	bool JobSystem::grow()
+	{
+		const uint32_t block = m_num_blocks.load(std::memory_order_relaxed);
+		if(block == MAX_BLOCKS)
+			return false;
+
+		Job* jobs = static_cast<Job*>(aligned_alloc(BLOCK_SIZE, BLOCK_SIZE));
+		if(!jobs)
+			return false;
+
+		// the first slot is the block header
+		*reinterpret_cast<uint32_t*>(jobs) = block;
+		for(size_t i = BLOCK_JOBS - 1; i > 0; --i)
+			m_free_jobs.push_back(new (&jobs[i]) Job());
+
+		m_blocks[block].store(jobs, std::memory_order_release);
+		m_num_blocks.store(block + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	Job* JobSystem::alloc_job()
+	{
+		ThreadState* const state = s_thread_state;
+		if(!state || state->js != this)
+		{
+			std::lock_guard<std::mutex> lock(m_pool_lock);
+			if(m_free_jobs.empty() && !this->grow())
+				return nullptr;
+			return vector_pop(m_free_jobs);
+		}
+
+		std::vector<Job*>& cache = state->job_cache;
+		[[unlikely]] if(cache.empty())
+		{
+			std::lock_guard<std::mutex> lock(m_pool_lock);
+			while(m_free_jobs.size() < CACHE_SIZE / 2 && this->grow())
+				;
+			const size_t count = std::min(CACHE_SIZE / 2, m_free_jobs.size());
+			cache.insert(cache.end(), m_free_jobs.end() - count, m_free_jobs.end());
+			m_free_jobs.resize(m_free_jobs.size() - count);
+			if(cache.empty())
+				return nullptr;
+		}
+		return vector_pop(cache);
+	}
+
+	void JobSystem::free_job(Job* job)
+	{
+		ThreadState* const state = s_thread_state;
+		if(!state || state->js != this)
+		{
+			std::lock_guard<std::mutex> lock(m_pool_lock);
+			m_free_jobs.push_back(job);
+			return;
+		}
+
+		std::vector<Job*>& cache = state->job_cache;
+		cache.push_back(job);
+		[[unlikely]] if(cache.size() == CACHE_SIZE)
+		{
+			std::lock_guard<std::mutex> lock(m_pool_lock);
+			m_free_jobs.insert(m_free_jobs.end(), cache.end() - CACHE_SIZE / 2, cache.end());
+			cache.resize(CACHE_SIZE / 2);
+		}
+	}
+
 	Job* JobSystem::create(Job* parent, JobFunc func)
 	{
 		parent = (parent == nullptr) ? m_master_job : parent;
-		Job* const job = m_job_pool.make();
+		Job* const job = this->alloc_job();
 		[[likely]] if(job)
 		{
-			size_t index = 0x7FFF;
+			uint32_t index = NO_PARENT;
 			if(parent)
 			{
 				assert(parent->running_jobs.load(std::memory_order_relaxed) > 0);
 
 				parent->running_jobs.fetch_add(1, std::memory_order_relaxed);
-				index = parent - m_jobs;
-				assert(index < MAX_JOB_COUNT);
+				index = job_index(parent);
 			}
 			job->function = func;
-			job->parent = uint16_t(index);
+			job->parent = index;
 			job->running_jobs.store(1, std::memory_order_relaxed);
 		}
 		return job;
@@ -193,8 +323,6 @@ namespace mud
 
 	void JobSystem::finish(Job* job)
 	{
-		auto& job_pool = m_job_pool;
-		Job* const storage = m_jobs;
 		do {
 			int32_t running_jobs = job->running_jobs.fetch_sub(1, std::memory_order_release) - 1;
 			assert(running_jobs >= 0);
@@ -204,8 +332,17 @@ namespace mud
 			}
 			else
 			{
-				Job* const parent = job->parent == 0x7FFF ? nullptr : &storage[job->parent];
-				job_pool.destroy(job);
+				[[unlikely]] if(job->parent == CONTINUATION)
+				{
+					// the job the continuation waited on has completed : it's now run like any other job
+					job->parent = NO_PARENT;
+					job->running_jobs.store(1, std::memory_order_relaxed);
+					this->run(job);
+					break;
+				}
+
+				Job* const parent = job->parent == NO_PARENT ? nullptr : job_at(job->parent);
+				this->free_job(job);
 				job = parent;
 			}
 		} while(job);
@@ -213,21 +350,48 @@ namespace mud
 
 	void JobSystem::run(Job* job, uint32_t flags)
 	{
+		[[unlikely]] if(flags & BACKGROUND)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_background_lock);
+				m_background_jobs.push_back(job);
+				m_background_pending.fetch_add(1, std::memory_order_relaxed);
+			}
+			if(!(flags & DONT_SIGNAL))
+				this->signal();
+			return;
+		}
+
 		ThreadState& state = this->state();
 
 		uint32_t active_jobs = m_active_jobs.fetch_add(1, std::memory_order_relaxed);
-		state.work_queue.push(job);
+		[[unlikely]] if(!state.work_queue.push(job))
+		{
+			// the queue is full : run the job inline rather than dropping it
+			m_active_jobs.fetch_sub(1, std::memory_order_relaxed);
+			if(job->function)
+				job->function(job->padding, *this, job);
+			finish(job);
+			return;
+		}
 
 		if(!(flags & DONT_SIGNAL))
 		{
 			if(active_jobs)
-			{
-				{ std::lock_guard<std::mutex> lock(m_lock); }
-				m_condition.notify_one();
-			}
+				this->signal();
 		}
 	}
 
+	void JobSystem::then(Job* job, Job* continuation)
+	{
+		assert(job->parent == NO_PARENT && continuation->parent == CONTINUATION);
+		assert(continuation->running_jobs.load(std::memory_order_relaxed) == 1);
+
+		// the continuation count of one stands for the job : it drops to zero when the job and its children have completed
+		job->parent = job_index(continuation);
+		this->run(job);
+	}
+
 	void JobSystem::wait(Job const* job)
 	{
 		assert(job);
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 
 #ifdef WIN32
@@ -49,47 +50,44 @@ namespace mud
 		Job(Job&&) = delete;
 
 		JobFunc function;
-		uint16_t parent;
-		std::atomic<uint16_t> running_jobs = { 0 };
-		void* padding[JOB_PADDING]; // on 64-bits systems, there is an extra 32-bits lost here
+		uint32_t parent;
+		std::atomic<uint32_t> running_jobs = { 0 };
+		void* padding[JOB_PADDING];
 	};
 
 	template <size_t Count>
 	class WorkQueue
 	{
 	public:
-		WorkQueue() {}
-		WorkQueue(Job* jobs) : m_jobs(jobs) {}
+		StealQueue<Job*, Count> m_queue;
 
-		Job* m_jobs = nullptr;
-		StealQueue<uint16_t, Count> m_queue;
-
-		inline void push(Job* job)
-		{
-			size_t index = job - m_jobs;
-			assert(index >= 0 && index < Count);
-			m_queue.push(uint16_t(index + 1));
-		}
-
-		inline Job* pop()
+		// only the owner thread pushes : false if the queue is full, in which case the job should be run inline
+		inline bool push(Job* job)
 		{
-			size_t index = m_queue.pop();
-			assert(index <= Count);
-			return !index ? nullptr : (m_jobs - 1) + index;
+			if(m_queue.count() >= int32_t(Count))
+				return false;
+			m_queue.push(job);
+			return true;
 		}
 
-		inline Job* steal()
-		{
-			size_t index = m_queue.steal();
-			assert(index <= Count);
-			return !index ? nullptr : (m_jobs - 1) + index;
-		}
+		inline Job* pop() { return m_queue.pop(); }
+		inline Job* steal() { return m_queue.steal(); }
 	};
 
 	class MUD_INFRA_EXPORT JobSystem
 	{
-		static constexpr size_t MAX_JOB_COUNT = 4096;
-		static_assert(MAX_JOB_COUNT <= 0x7FFE, "MAX_JOB_COUNT must be <= 0x7FFE");
+		// jobs are stored in blocks which are allocated as needed and never freed before the job system is destroyed
+		// blocks are aligned to their size, and their first slot holds the block index, so that a job index can be found from its address
+		static constexpr size_t BLOCK_JOBS = 1024;
+		static constexpr size_t BLOCK_SIZE = BLOCK_JOBS * sizeof(Job);
+		static constexpr size_t MAX_BLOCKS = 4096;
+		static constexpr size_t QUEUE_SIZE = 4096;
+		// each thread keeps up to CACHE_SIZE free jobs, and exchanges half of them with the shared free list when empty or full
+		static constexpr size_t CACHE_SIZE = 256;
+		static constexpr uint32_t NO_PARENT = UINT32_MAX;
+		// parent of a continuation job, which is queued when its count of running jobs drops to zero
+		static constexpr uint32_t CONTINUATION = UINT32_MAX - 1;
+		static_assert(!(BLOCK_SIZE & (BLOCK_SIZE - 1)), "BLOCK_SIZE must be a power of two");
 
 	public:
 		static_assert((sizeof(Job) % CACHELINE_SIZE == 0) || (CACHELINE_SIZE % sizeof(Job) == 0),
@@ -105,6 +103,14 @@ namespace mud
 		static JobSystem* instance();
 
 		uint32_t thread();
+		uint32_t threads() const { return uint32_t(m_thread_states.size()); }
+
+		// maximum number of workers running background jobs at the same time
+		uint32_t background_budget() const { return m_background_budget.load(std::memory_order_relaxed); }
+		void background_budget(uint32_t count);
+
+		// number of jobs the storage can currently hold without growing
+		size_t capacity() const { return m_num_blocks.load(std::memory_order_relaxed) * (BLOCK_JOBS - 1); }
 
 		Job* job(Job* parent = nullptr) { return create(parent, nullptr); }
 
@@ -159,7 +165,22 @@ namespace mud
 			return job;
 		}
 
-		enum runFlags { DONT_SIGNAL = 0x1 };
+		// a job which runs once the job it's chained to with then() has completed, along with its children : it must not be run directly
+		template <typename T>
+		Job* continuation(T functor)
+		{
+			Job* job = this->job(nullptr, std::move(functor));
+			if(job)
+				job->parent = CONTINUATION;
+			return job;
+		}
+
+		// runs a job which has no parent and has not been run yet, and queues the continuation once it has completed
+		void then(Job* job, Job* continuation);
+
+		// background jobs go to a shared queue : workers only take them when they find no frame job, and never more than the budget at once
+		// adopted threads never run them, unless there are no workers at all
+		enum runFlags { DONT_SIGNAL = 0x1, BACKGROUND = 0x2 };
 		void run(Job* job, uint32_t flags = 0);
 		void wait(Job const* job);
 
@@ -171,10 +192,14 @@ namespace mud
 
 		void finish(Job* job);
 
+		// runs one pending job on the calling thread, if there is one : lets a thread waiting on something else than a job help the workers
+		bool yield();
+
 	public:
 		struct alignas(CACHELINE_SIZE) ThreadState  // this causes 40-bytes padding // make sure storage is cache-line aligned
 		{   			   
-			WorkQueue<MAX_JOB_COUNT> work_queue;
+			WorkQueue<QUEUE_SIZE> work_queue;
+			std::vector<Job*> job_cache;
 
 			// these are not accessed by the worker threads
 			alignas(CACHELINE_SIZE) JobSystem* js;    // this causes 56-bytes padding
@@ -189,6 +214,20 @@ namespace mud
 		static ThreadState& state();
 
 		Job* create(Job* parent, JobFunc func);
+		Job* alloc_job();
+		void free_job(Job* job);
+		bool grow();
+
+		Job* job_at(uint32_t index) const
+		{
+			return m_blocks[index / BLOCK_JOBS].load(std::memory_order_acquire) + index % BLOCK_JOBS;
+		}
+
+		uint32_t job_index(const Job* job) const
+		{
+			const uintptr_t block = uintptr_t(job) & ~uintptr_t(BLOCK_SIZE - 1);
+			return *reinterpret_cast<const uint32_t*>(block) * uint32_t(BLOCK_JOBS) + uint32_t((uintptr_t(job) - block) / sizeof(Job));
+		}
 		ThreadState& random_thread_state(ThreadState& state);
 		bool completed(Job const* job);
 
@@ -197,12 +236,25 @@ namespace mud
 
 		void loop(ThreadState* state);
 		bool execute(ThreadState& state);
+		bool execute_background(ThreadState& state);
+		bool background_ready(ThreadState& state) const;
+		void signal();
 
 		// these have thread contention, keep them together
 		std::mutex m_lock;
 		std::condition_variable m_condition;
 		std::atomic<uint32_t> m_active_jobs = { 0 };
-		Arena<Job, AtomicFreeList> m_job_pool;
+
+		std::mutex m_pool_lock;
+		std::vector<Job*> m_free_jobs;
+		std::vector<std::atomic<Job*>> m_blocks;
+		std::atomic<uint32_t> m_num_blocks = { 0 };
+
+		std::mutex m_background_lock;
+		std::deque<Job*> m_background_jobs;
+		std::atomic<uint32_t> m_background_pending = { 0 };
+		std::atomic<uint32_t> m_background_running = { 0 };
+		std::atomic<uint32_t> m_background_budget = { 1 };
 
 		template <typename T>
 		using aligned_vector = std::vector<T, STLAlignedAllocator<T>>;
@@ -215,7 +267,6 @@ namespace mud
 			aligned_vector<ThreadState> m_thread_states;          // actual data is stored offline
 		std::atomic<bool> m_exit_requested = { 0 };           // this one is almost never written
 		std::atomic<uint16_t> m_adopted_threads = { 0 };      // this one is almost never written
-		Job* const m_jobs;                         // Base for conversion to indices
 		uint16_t m_thread_count = 0;                          // total # of threads in the pool
 	public:
 		uint8_t m_parallel_split_count = 0;                    // # of split allowable in parallel_for
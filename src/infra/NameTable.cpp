@@ -0,0 +1,88 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#ifdef MUD_CPP_20
+#include <infra/Cpp20.h>
+#else
+#include <cstring>
+#endif
+
+#ifdef MUD_MODULES
+module mud.infra;
+#else
+#include <infra/NameTable.h>
+#endif
+
+namespace mud
+{
+	uint32_t NameTable::hash(cstring name, uint32_t seed)
+	{
+		// FNV-1a
+		uint32_t hash = seed;
+		for(const char* c = name; *c; ++c)
+			hash = (hash ^ uint8_t(*c)) * 16777619U;
+		return hash;
+	}
+
+	void NameTable::clear()
+	{
+		m_slots.clear();
+		m_count = 0;
+		m_mask = 0;
+	}
+
+	void NameTable::reserve(size_t count)
+	{
+		// kept at most half full, so that probe sequences stay short
+		size_t capacity = 16;
+		while(capacity < count * 2)
+			capacity *= 2;
+		if(capacity <= m_slots.size())
+			return;
+
+		std::vector<Slot> slots = std::move(m_slots);
+		m_slots.assign(capacity, Slot{ 0, NotFound, nullptr, nullptr });
+		m_mask = uint32_t(capacity - 1);
+
+		for(const Slot& slot : slots)
+			if(slot.m_index != NotFound)
+				m_slots[this->probe(slot.m_hash, slot.m_scope, slot.m_name)] = slot;
+	}
+
+	uint32_t NameTable::probe(uint32_t hash, cstring scope, cstring name) const
+	{
+		uint32_t index = hash & m_mask;
+		while(true)
+		{
+			const Slot& slot = m_slots[index];
+			if(slot.m_index == NotFound)
+				return index;
+			if(slot.m_hash == hash && strcmp(slot.m_name, name) == 0 && (slot.m_scope == scope || (slot.m_scope && scope && strcmp(slot.m_scope, scope) == 0)))
+				return index;
+			index = (index + 1) & m_mask;
+		}
+	}
+
+	void NameTable::insert(cstring scope, cstring name, uint32_t index)
+	{
+		this->reserve(m_count + 1);
+
+		const uint32_t hash = NameTable::hash(name, scope ? NameTable::hash(scope) : 2166136261U);
+		Slot& slot = m_slots[this->probe(hash, scope, name)];
+		if(slot.m_index != NotFound)
+			return;
+
+		slot = { hash, index, scope, name };
+		m_count++;
+	}
+
+	uint32_t NameTable::find(cstring scope, cstring name) const
+	{
+		if(m_count == 0)
+			return NotFound;
+
+		const uint32_t hash = NameTable::hash(name, scope ? NameTable::hash(scope) : 2166136261U);
+		return m_slots[this->probe(hash, scope, name)].m_index;
+	}
+}
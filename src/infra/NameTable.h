@@ -0,0 +1,53 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <infra/Config.h>
+#include <infra/Array.h>
+
+#ifndef MUD_CPP_20
+#include <cstdint>
+#include <vector>
+#endif
+
+namespace mud
+{
+	// open addressing table from names, optionally scoped, to indices : for tables built once and searched by name often
+	// names are not copied, they must outlive the table, as the names of reflected types and functions do
+	// when a name is inserted twice, the first index is kept, like a linear search would find it first
+	export_ class MUD_INFRA_EXPORT NameTable
+	{
+	public:
+		static const uint32_t NotFound = UINT32_MAX;
+
+		static uint32_t hash(cstring name, uint32_t seed = 2166136261U);
+
+		void clear();
+		void reserve(size_t count);
+
+		void insert(cstring name, uint32_t index) { this->insert(nullptr, name, index); }
+		void insert(cstring scope, cstring name, uint32_t index);
+
+		uint32_t find(cstring name) const { return this->find(nullptr, name); }
+		uint32_t find(cstring scope, cstring name) const;
+
+		size_t size() const { return m_count; }
+
+	private:
+		struct Slot
+		{
+			uint32_t m_hash;
+			uint32_t m_index;
+			cstring m_scope;
+			cstring m_name;
+		};
+
+		uint32_t probe(uint32_t hash, cstring scope, cstring name) const;
+
+		std::vector<Slot> m_slots;
+		size_t m_count = 0;
+		uint32_t m_mask = 0;
+	};
+}
@@ -0,0 +1,218 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <infra/Config.h>
+#include <infra/Job.h>
+#include <infra/JobLoop.h>
+#include <infra/Vector.h>
+
+#ifndef MUD_CPP_20
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <vector>
+#endif
+
+namespace mud
+{
+	// ranges are split in halves as long as they're larger than twice the grain
+	class GrainSplitter
+	{
+	public:
+		GrainSplitter(uint32_t grain) : m_grain(grain) {}
+		bool split(size_t splits, size_t count) const { return splits < 24 && count >= size_t(m_grain) * 2; }
+		uint32_t m_grain;
+	};
+
+	// small enough for each thread to get a few ranges to balance the load, never smaller than min_grain
+	export_ inline uint32_t grain_size(JobSystem& js, uint32_t count, uint32_t min_grain = 1)
+	{
+		const uint32_t ranges = js.threads() * 4;
+		return std::max(std::max(min_grain, 1U), (count + ranges - 1) / ranges);
+	}
+
+	// calls func(start, count) on consecutive ranges covering [start, start + count), and returns once all are done
+	// a range too small to split runs inline on the calling thread
+	export_ template <class F>
+	void parallel_for(JobSystem& js, uint32_t start, uint32_t count, F func, uint32_t min_grain = 1)
+	{
+		const uint32_t grain = grain_size(js, count, min_grain);
+		if(count <= grain)
+		{
+			if(count > 0)
+				func(start, count);
+			return;
+		}
+
+		auto range = [&func](JobSystem& js, Job* job, uint32_t start, uint32_t count) { UNUSED(js); UNUSED(job); func(start, count); };
+		Job* job = jobs(js, nullptr, start, count, range, GrainSplitter(grain));
+		js.complete(job);
+	}
+
+	// func(accumulator, start, count) accumulates ranges into the accumulator of the thread running them, then the accumulators are combined with reduce
+	// reduce must be associative and commutative, since which ranges end up in which accumulator is not deterministic
+	export_ template <class T, class F, class R>
+	T parallel_reduce(JobSystem& js, uint32_t start, uint32_t count, T identity, F func, R reduce, uint32_t min_grain = 1)
+	{
+		struct alignas(CACHELINE_SIZE) Accumulator { T m_value; };
+		std::vector<Accumulator, STLAlignedAllocator<Accumulator>> accumulators(js.threads(), Accumulator{ identity });
+
+		parallel_for(js, start, count, [&](uint32_t start, uint32_t count) { func(accumulators[js.thread()].m_value, start, count); }, min_grain);
+
+		T result = identity;
+		for(Accumulator& accumulator : accumulators)
+			result = reduce(result, accumulator.m_value);
+		return result;
+	}
+
+	namespace details
+	{
+		// how many of the first d merged elements come from a, when merging a and b with elements of a first on ties, like std::merge
+		template <class T, class Compare>
+		uint32_t merge_path(const T* a, uint32_t na, const T* b, uint32_t nb, uint32_t d, Compare& compare)
+		{
+			uint32_t lo = d > nb ? d - nb : 0;
+			uint32_t hi = std::min(d, na);
+			while(lo < hi)
+			{
+				const uint32_t i = (lo + hi) / 2;
+				if(compare(b[d - i - 1], a[i]))
+					hi = i;
+				else
+					lo = i + 1;
+			}
+			return lo;
+		}
+	}
+
+	// sorts runs of grain elements in parallel, then merges them pairwise : each merge is split along its merge path, so that every round is parallel
+	// like std::sort, it is not stable
+	export_ template <class T, class Compare = std::less<T>>
+	void parallel_sort(JobSystem& js, T* data, uint32_t count, Compare compare = Compare(), uint32_t min_grain = 4096)
+	{
+		const uint32_t grain = grain_size(js, count, min_grain);
+		if(count <= grain)
+		{
+			std::sort(data, data + count, compare);
+			return;
+		}
+
+		const uint32_t num_runs = (count + grain - 1) / grain;
+		parallel_for(js, 0, num_runs, [&](uint32_t start, uint32_t num)
+		{
+			for(uint32_t run = start; run < start + num; ++run)
+				std::sort(data + run * grain, data + std::min(count, (run + 1) * grain), compare);
+		});
+
+		std::vector<T> temp(count);
+		T* source = data;
+		T* dest = temp.data();
+
+		// where each piece of the output starts in the first run of its merge : found before merging, since merging moves the elements out
+		std::vector<uint32_t> splits(num_runs);
+
+		for(uint32_t width = grain; width < count; width *= 2)
+		{
+			// the merged runs are a multiple of grain long, so each piece falls within one merge
+			auto bounds = [&](uint32_t piece, uint32_t& lo, uint32_t& mid, uint32_t& hi)
+			{
+				lo = piece * grain / (2 * width) * (2 * width);
+				mid = std::min(lo + width, count);
+				hi = std::min(lo + 2 * width, count);
+			};
+
+			parallel_for(js, 0, num_runs, [&](uint32_t start, uint32_t num)
+			{
+				for(uint32_t piece = start; piece < start + num; ++piece)
+				{
+					uint32_t lo, mid, hi;
+					bounds(piece, lo, mid, hi);
+					splits[piece] = details::merge_path(source + lo, mid - lo, source + mid, hi - mid, piece * grain - lo, compare);
+				}
+			});
+
+			parallel_for(js, 0, num_runs, [&](uint32_t start, uint32_t num)
+			{
+				for(uint32_t piece = start; piece < start + num; ++piece)
+				{
+					uint32_t lo, mid, hi;
+					bounds(piece, lo, mid, hi);
+
+					const uint32_t first = piece * grain - lo;
+					const uint32_t last = std::min(first + grain, hi - lo);
+					const uint32_t a0 = splits[piece];
+					const uint32_t a1 = last == hi - lo ? mid - lo : splits[piece + 1];
+
+					std::merge(std::make_move_iterator(source + lo + a0), std::make_move_iterator(source + lo + a1),
+							   std::make_move_iterator(source + mid + first - a0), std::make_move_iterator(source + mid + last - a1),
+							   dest + lo + first, compare);
+				}
+			});
+
+			std::swap(source, dest);
+		}
+
+		if(source != data)
+			std::move(source, source + count, data);
+	}
+
+	// prefix sums of in with op, starting from init : out[i] includes in[i] if inclusive, and only the elements before it otherwise
+	// out can be in, for an in place scan
+	export_ template <class T, class Op = std::plus<T>>
+	void parallel_scan(JobSystem& js, const T* in, T* out, uint32_t count, T init = T(), Op op = Op(), bool inclusive = true, uint32_t min_grain = 4096)
+	{
+		auto scan = [&](uint32_t begin, uint32_t end, T sum)
+		{
+			for(uint32_t i = begin; i < end; ++i)
+			{
+				const T value = in[i];
+				if(inclusive)
+					out[i] = sum = op(sum, value);
+				else
+				{
+					out[i] = sum;
+					sum = op(sum, value);
+				}
+			}
+		};
+
+		const uint32_t grain = grain_size(js, count, min_grain);
+		const uint32_t num_blocks = (count + grain - 1) / grain;
+		if(num_blocks <= 1)
+		{
+			scan(0, count, init);
+			return;
+		}
+
+		// sum each block, scan the block sums, then scan each block again from its offset
+		std::vector<T> sums(num_blocks);
+		parallel_for(js, 0, num_blocks, [&](uint32_t start, uint32_t num)
+		{
+			for(uint32_t block = start; block < start + num; ++block)
+			{
+				const uint32_t end = std::min(count, (block + 1) * grain);
+				T sum = in[block * grain];
+				for(uint32_t i = block * grain + 1; i < end; ++i)
+					sum = op(sum, in[i]);
+				sums[block] = sum;
+			}
+		});
+
+		T offset = init;
+		for(T& sum : sums)
+		{
+			const T block = sum;
+			sum = offset;
+			offset = op(offset, block);
+		}
+
+		parallel_for(js, 0, num_blocks, [&](uint32_t start, uint32_t num)
+		{
+			for(uint32_t block = start; block < start + num; ++block)
+				scan(block * grain, std::min(count, (block + 1) * grain), sums[block]);
+		});
+	}
+}
@@ -140,7 +140,7 @@ namespace mud
 
 		~Arena()
 		{
-			free(m_begin);
+			::free(m_begin);
 		}
 
 		void* alloc()
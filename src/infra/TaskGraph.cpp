@@ -0,0 +1,242 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#ifdef MUD_CPP_20
+#include <infra/Cpp20.h>
+#else
+#include <algorithm>
+#include <cstdio>
+#endif
+
+#ifdef MUD_MODULES
+module mud.infra;
+#else
+#include <infra/TaskGraph.h>
+#include <infra/Job.h>
+#endif
+
+namespace mud
+{
+	TaskGraph::TaskGraph()
+	{}
+
+	TaskGraph::~TaskGraph()
+	{}
+
+	TaskGraph::Resource TaskGraph::resource(cstring name)
+	{
+		for(size_t i = 0; i < m_resources.size(); ++i)
+			if(m_resources[i] == name)
+				return Resource(i);
+		m_resources.push_back(name);
+		return Resource(m_resources.size() - 1);
+	}
+
+	uint32_t TaskGraph::add(cstring name, TaskFunc func, const std::vector<Resource>& reads, const std::vector<Resource>& writes, Affinity affinity)
+	{
+		m_tasks.emplace_back(std::make_unique<Task>());
+		Task& task = *m_tasks.back();
+		task.m_name = name;
+		task.m_func = std::move(func);
+		task.m_affinity = affinity;
+		task.m_reads = reads;
+		task.m_writes = writes;
+		return uint32_t(m_tasks.size() - 1);
+	}
+
+	void TaskGraph::depend(uint32_t task, uint32_t dependency)
+	{
+		assert(dependency < task);
+		std::vector<uint32_t>& successors = m_tasks[dependency]->m_successors;
+		if(std::find(successors.begin(), successors.end(), task) == successors.end())
+		{
+			successors.push_back(task);
+			m_tasks[task]->m_num_dependencies++;
+		}
+	}
+
+	void TaskGraph::clear()
+	{
+		m_tasks.clear();
+	}
+
+	void TaskGraph::compile()
+	{
+		// for each resource, the last task writing it and the tasks reading it since
+		std::vector<uint32_t> writers(m_resources.size(), UINT32_MAX);
+		std::vector<std::vector<uint32_t>> readers(m_resources.size());
+
+		for(uint32_t index = 0; index < m_tasks.size(); ++index)
+		{
+			Task& task = *m_tasks[index];
+			for(Resource resource : task.m_reads)
+			{
+				if(writers[resource] != UINT32_MAX)
+					this->depend(index, writers[resource]);
+				readers[resource].push_back(index);
+			}
+
+			for(Resource resource : task.m_writes)
+			{
+				if(writers[resource] != UINT32_MAX && writers[resource] != index)
+					this->depend(index, writers[resource]);
+				for(uint32_t reader : readers[resource])
+					if(reader != index)
+						this->depend(index, reader);
+				writers[resource] = index;
+				readers[resource].clear();
+			}
+		}
+	}
+
+	void TaskGraph::run(JobSystem* js)
+	{
+		for(auto& task : m_tasks)
+		{
+			task->m_successors.clear();
+			task->m_num_dependencies = 0;
+		}
+
+		this->compile();
+
+		m_start = Clock::now();
+		m_remaining = uint32_t(m_tasks.size());
+		for(auto& task : m_tasks)
+			task->m_pending.store(task->m_num_dependencies, std::memory_order_relaxed);
+
+		if(!js)
+		{
+			for(uint32_t index = 0; index < m_tasks.size(); ++index)
+				this->execute(js, index);
+		}
+		else
+		{
+			for(uint32_t index = 0; index < m_tasks.size(); ++index)
+				if(m_tasks[index]->m_num_dependencies == 0)
+					this->schedule(js, index);
+
+			// the calling thread runs the main thread tasks as they become ready, and helps the workers while they have queued jobs
+			// once there are none, it sleeps until a main thread task is ready or the last task is done
+			while(true)
+			{
+				uint32_t index = UINT32_MAX;
+				{
+					std::unique_lock<std::mutex> lock(m_main_lock);
+					while(m_main_ready.empty() && m_remaining.load(std::memory_order_acquire) > 0)
+					{
+						lock.unlock();
+						const bool helped = js->yield();
+						lock.lock();
+						if(!helped && m_main_ready.empty() && m_remaining.load(std::memory_order_acquire) > 0)
+							m_main_signal.wait(lock);
+					}
+
+					if(m_main_ready.empty())
+						break;
+					index = m_main_ready.back();
+					m_main_ready.pop_back();
+				}
+
+				this->execute(js, index);
+			}
+		}
+
+		m_duration = float(std::chrono::duration<double, std::milli>(Clock::now() - m_start).count());
+		this->update_critical_path();
+	}
+
+	void TaskGraph::schedule(JobSystem* js, uint32_t index)
+	{
+		if(m_tasks[index]->m_affinity == Affinity::Main)
+		{
+			std::lock_guard<std::mutex> lock(m_main_lock);
+			m_main_ready.push_back(index);
+			m_main_signal.notify_one();
+			return;
+		}
+
+		Job* job = js->job(nullptr, [this, index](JobSystem& js, Job* job) { UNUSED(job); this->execute(&js, index); });
+		js->run(job);
+	}
+
+	void TaskGraph::execute(JobSystem* js, uint32_t index)
+	{
+		Task& task = *m_tasks[index];
+		task.m_begin = std::chrono::duration<double, std::milli>(Clock::now() - m_start).count();
+		task.m_func();
+		task.m_end = std::chrono::duration<double, std::milli>(Clock::now() - m_start).count();
+		task.m_thread = js ? js->thread() : 0;
+
+		if(js)
+			for(uint32_t successor : task.m_successors)
+				if(m_tasks[successor]->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					this->schedule(js, successor);
+
+		// the lock orders the notification after the check of the waiting thread
+		if(m_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1 && js)
+		{
+			std::lock_guard<std::mutex> lock(m_main_lock);
+			m_main_signal.notify_one();
+		}
+	}
+
+	void TaskGraph::update_critical_path()
+	{
+		// longest chain of task durations, in the order the tasks were added, which is a topological order
+		const size_t count = m_tasks.size();
+		std::vector<double> finish(count, 0.0);
+		std::vector<double> start(count, 0.0);
+		std::vector<uint32_t> previous(count, UINT32_MAX);
+
+		uint32_t last = UINT32_MAX;
+		for(uint32_t index = 0; index < count; ++index)
+		{
+			Task& task = *m_tasks[index];
+			task.m_critical = false;
+			finish[index] = start[index] + (task.m_end - task.m_begin);
+			for(uint32_t successor : task.m_successors)
+				if(finish[index] > start[successor])
+				{
+					start[successor] = finish[index];
+					previous[successor] = index;
+				}
+			if(last == UINT32_MAX || finish[index] > finish[last])
+				last = index;
+		}
+
+		for(uint32_t index = last; index != UINT32_MAX; index = previous[index])
+			m_tasks[index]->m_critical = true;
+
+		m_critical_path = last == UINT32_MAX ? 0.f : float(finish[last]);
+
+		if(m_history.size() < HistorySize)
+			m_history.push_back(m_critical_path);
+		else
+		{
+			m_history[m_history_cursor] = m_critical_path;
+			m_history_cursor = (m_history_cursor + 1) % HistorySize;
+		}
+	}
+
+	std::string TaskGraph::timeline(size_t width) const
+	{
+		char line[256];
+		snprintf(line, sizeof(line), "%u tasks : %.3f ms, critical path %.3f ms\n", uint32_t(m_tasks.size()), m_duration, m_critical_path);
+		std::string result = line;
+
+		const double scale = m_duration > 0.f ? width / double(m_duration) : 0.0;
+		for(const auto& task : m_tasks)
+		{
+			const size_t begin = std::min(width - 1, size_t(task->m_begin * scale));
+			const size_t end = std::max(begin + 1, std::min(width, size_t(task->m_end * scale)));
+
+			std::string bar(width, '.');
+			std::fill(bar.begin() + begin, bar.begin() + end, task->m_critical ? '*' : '#');
+
+			snprintf(line, sizeof(line), "%-24.24s %2u |%s| %.3f ms\n", task->m_name.c_str(), task->m_thread, bar.c_str(), task->m_end - task->m_begin);
+			result += line;
+		}
+		return result;
+	}
+}
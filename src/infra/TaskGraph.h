@@ -0,0 +1,106 @@
+//  Copyright (c) 2018 Hugo Amiard hugo.amiard@laposte.net
+//  This software is provided 'as-is' under the zlib License, see the LICENSE.txt file.
+//  This notice and the license may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <infra/Config.h>
+#include <infra/Array.h>
+#include <infra/NonCopy.h>
+
+#ifndef MUD_CPP_20
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#endif
+
+namespace mud
+{
+	class JobSystem;
+
+	// a frame described as tasks which declare the resources they read and write
+	// a task runs after the tasks added before it which write a resource it accesses, or read a resource it writes
+	// independent tasks run concurrently on the job system workers, while main thread tasks run on the thread calling run()
+	export_ class MUD_INFRA_EXPORT TaskGraph : public NonCopy
+	{
+	public:
+		using Resource = uint32_t;
+		using TaskFunc = std::function<void()>;
+
+		enum class Affinity : unsigned int
+		{
+			Any,
+			Main
+		};
+
+		struct Task
+		{
+			std::string m_name;
+			TaskFunc m_func;
+			Affinity m_affinity;
+			std::vector<Resource> m_reads;
+			std::vector<Resource> m_writes;
+			std::vector<uint32_t> m_successors;
+			uint32_t m_num_dependencies = 0;
+			std::atomic<uint32_t> m_pending = { 0 };
+
+			// timings of the last run, in milliseconds since it started
+			double m_begin = 0.0;
+			double m_end = 0.0;
+			uint32_t m_thread = 0;
+			bool m_critical = false;
+		};
+
+		TaskGraph();
+		~TaskGraph();
+
+		// the same name always gives the same resource
+		Resource resource(cstring name);
+
+		uint32_t add(cstring name, TaskFunc func, const std::vector<Resource>& reads = {}, const std::vector<Resource>& writes = {}, Affinity affinity = Affinity::Any);
+
+		// orders two tasks which share no declared resource
+		void depend(uint32_t task, uint32_t dependency);
+
+		// removes the tasks : resources and history are kept, so that a graph can be rebuilt every frame
+		void clear();
+
+		// runs all the tasks and returns once they are done : without a job system, they run in the order they were added
+		void run(JobSystem* js);
+
+		// one line per task over the duration of the last run : tasks on the critical path are drawn with '*'
+		std::string timeline(size_t width = 64) const;
+
+		std::vector<std::unique_ptr<Task>> m_tasks;
+		std::vector<std::string> m_resources;
+
+		// duration of the last run, and of its longest chain of dependent tasks : no number of workers can make the run shorter than it
+		float m_duration = 0.f;
+		float m_critical_path = 0.f;
+
+		// critical path of the last runs, oldest first once full
+		static const size_t HistorySize = 128;
+		std::vector<float> m_history;
+		size_t m_history_cursor = 0;
+
+	private:
+		void compile();
+		void schedule(JobSystem* js, uint32_t index);
+		void execute(JobSystem* js, uint32_t index);
+		void update_critical_path();
+
+		using Clock = std::chrono::steady_clock;
+		Clock::time_point m_start;
+
+		std::atomic<uint32_t> m_remaining = { 0 };
+		std::mutex m_main_lock;
+		std::condition_variable m_main_signal;
+		std::vector<uint32_t> m_main_ready;
+	};
+}
@@ -18,12 +18,12 @@ namespace mud
 	template <typename T>
 	struct is_comparable<std::vector<T>> : is_comparable_base<T> {};
 
-	export_ template <class T>
-	array<T> to_array(std::vector<T>& vector) { return { &vector[0], vector.size() }; }
-	export_ template <class T>
-	array<T> to_array(std::vector<T>& vector, size_t offset) { return { &vector[offset], vector.size() - offset }; }
-	export_ template <class T>
-	array<T> to_array(std::vector<T>& vector, size_t offset, size_t count) { return { &vector[offset], count }; }
+	export_ template <class T, class A>
+	array<T> to_array(std::vector<T, A>& vector) { return { &vector[0], vector.size() }; }
+	export_ template <class T, class A>
+	array<T> to_array(std::vector<T, A>& vector, size_t offset) { return { &vector[offset], vector.size() - offset }; }
+	export_ template <class T, class A>
+	array<T> to_array(std::vector<T, A>& vector, size_t offset, size_t count) { return { &vector[offset], count }; }
 
 	export_ template <class T>
 	std::vector<T> to_vector(const array<T>& array) { return { array.m_pointer, array.m_pointer + array.m_count }; }
@@ -607,7 +607,7 @@ namespace mud
 		set_type_closure(state, "__newindex", newindex_function, type);
 		set_type_closure(state, "__tostring", tostring_function, type);
 		set_type_closure(state, "__eq", eq_function, type);
-		if(g_class[type.m_id] && !cls(type).m_destructor.empty())
+		if(has_class(type) && !cls(type).m_destructor.empty())
 			set_type_closure(state, "__gc", gc_function, type);
 
 		lua_pushstring(state, "cpp_type");
@@ -923,7 +923,7 @@ namespace mud
 			m_context->register_type(*type);
 
 		for(Type* type : system.m_types)
-			if(g_class[type->m_id])
+			if(has_class(*type))
 			{
 				for(Member& member : cls(*type).m_members)
 					m_context->register_member(*type, member);
@@ -30,11 +30,12 @@ namespace mud
 
 		T sample_curve(float t)
 		{
-			uint32_t key = uint32_t(t * (m_keys.size() - 1));
-			float interval = 1.f / float(m_keys.size() - 1);
-			float ttmod = fmod(t, interval) / interval;
+			float position = t * float(m_keys.size() - 1);
+			uint32_t key = uint32_t(position);
+			if(key > m_keys.size() - 2)
+				key = uint32_t(m_keys.size() - 2);
 
-			return mud::lerp(m_keys[key], m_keys[key + 1], ttmod);
+			return mud::lerp(m_keys[key], m_keys[key + 1], position - float(key));
 		}
 
 		attr_ std::vector<T> m_keys;
@@ -101,4 +102,48 @@ namespace mud
 	export_ template struct refl_ struct_ MUD_MATH_EXPORT ValueTrack<float>;
 	export_ template struct refl_ struct_ MUD_MATH_EXPORT ValueTrack<uint32_t>;
 	export_ template struct refl_ struct_ MUD_MATH_EXPORT ValueTrack<Colour>;
+
+	// a ValueTrack baked into fixed size lookup tables over t in [0, 1], for fast batch sampling
+	// the min and max tables are interpolated by the seed, so all track modes sample the same way
+	export_ template <class T>
+	struct ValueTable
+	{
+		static constexpr size_t Size = 32;
+
+		void bake(ValueTrack<T>& track)
+		{
+			for(size_t i = 0; i < Size + 1; ++i)
+			{
+				float t = float(i < Size - 1 ? i : Size - 1) / float(Size - 1);
+				if(track.m_mode == TrackMode::Constant)
+					m_min[i] = m_max[i] = track.m_value;
+				else if(track.m_mode == TrackMode::ConstantRandom)
+				{
+					m_min[i] = track.m_min;
+					m_max[i] = track.m_max;
+				}
+				else if(track.m_mode == TrackMode::Curve)
+					m_min[i] = m_max[i] = track.m_value * track.m_curve.sample_curve(t);
+				else //if(track.m_mode == TrackMode::CurveRandom)
+				{
+					m_min[i] = track.m_min * track.m_min_curve.sample_curve(t);
+					m_max[i] = track.m_max * track.m_max_curve.sample_curve(t);
+				}
+			}
+		}
+
+		inline T sample(float t, float seed) const
+		{
+			float position = (t < 0.f ? 0.f : t > 1.f ? 1.f : t) * float(Size - 1);
+			size_t index = size_t(position);
+			float ratio = position - float(index);
+			T low = mud::lerp(m_min[index], m_min[index + 1], ratio);
+			T high = mud::lerp(m_max[index], m_max[index + 1], ratio);
+			return mud::lerp(low, high, seed);
+		}
+
+		// one extra entry so that sampling at t = 1 can interpolate without a bounds check
+		T m_min[Size + 1];
+		T m_max[Size + 1];
+	};
 }
@@ -69,6 +69,7 @@ namespace mud {
     class Clock;
     struct Anim;
     class Animator;
+    struct Xoshiro128;
 }
 
 namespace mud {
@@ -8,6 +8,7 @@
 
 #ifndef MUD_CPP_20
 #include <random>
+#include <cstdint>
 #endif
 
 namespace mud
@@ -15,8 +16,8 @@ namespace mud
 	export_ template <class T>
 	T random_integer(T min, T max)
 	{
-		static std::random_device randomDevice;
-		static std::mt19937 range(randomDevice());
+		static thread_local std::random_device randomDevice;
+		static thread_local std::mt19937 range(randomDevice());
 
 		std::uniform_int_distribution<T> uniform(min, max);
 		return uniform(range);
@@ -25,11 +26,50 @@ namespace mud
 	export_ template <class T>
 	T random_scalar(T min, T max)
 	{
-		static std::random_device randomDevice;
-		static std::mt19937 range(randomDevice());
+		static thread_local std::random_device randomDevice;
+		static thread_local std::mt19937 range(randomDevice());
 
 		std::uniform_real_distribution<T> uniform(min, max);
 		return uniform(range);
 	}
 
+	// xoshiro128+ generator : a few cycles per number, meant to be owned by whoever draws numbers in bulk (e.g. one per particle emitter)
+	// the standard generators above are kept for one-off draws
+	export_ struct Xoshiro128
+	{
+		Xoshiro128(uint32_t seed = 0x9e3779b9U) { this->seed(seed); }
+
+		void seed(uint32_t seed)
+		{
+			// splitmix32 to spread the seed bits over the whole state
+			for(uint32_t& s : m_state)
+			{
+				uint32_t z = (seed += 0x9e3779b9U);
+				z = (z ^ (z >> 16)) * 0x85ebca6bU;
+				z = (z ^ (z >> 13)) * 0xc2b2ae35U;
+				s = z ^ (z >> 16);
+			}
+		}
+
+		inline uint32_t next()
+		{
+			const uint32_t result = m_state[0] + m_state[3];
+			const uint32_t t = m_state[1] << 9;
+			m_state[2] ^= m_state[0];
+			m_state[3] ^= m_state[1];
+			m_state[1] ^= m_state[2];
+			m_state[0] ^= m_state[3];
+			m_state[2] ^= t;
+			m_state[3] = (m_state[3] << 11) | (m_state[3] >> 21);
+			return result;
+		}
+
+		// uniform in [0, 1), using the 24 high bits which are the best distributed ones
+		inline float unit() { return float(next() >> 8) * (1.f / 16777216.f); }
+		inline float range(float min, float max) { return min + unit() * (max - min); }
+
+		void unit(float* out, size_t count) { for(size_t i = 0; i < count; ++i) out[i] = unit(); }
+
+		uint32_t m_state[4];
+	};
 }
@@ -27,31 +27,33 @@ namespace mud
     // mud::GlfwContext
     {
         static Meta meta = { type<mud::GlfwContext>(), &namspc({ "mud" }), "GlfwContext", sizeof(mud::GlfwContext), TypeClass::Object };
-        static Class cls = { type<mud::GlfwContext>(),
-            // bases
-            { &type<mud::Context>() },
-            { base_offset<mud::GlfwContext, mud::Context>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
+        lazy_class<mud::GlfwContext>([] {
+            static Class cls = { type<mud::GlfwContext>(),
+                // bases
+                { &type<mud::Context>() },
+                { base_offset<mud::GlfwContext, mud::Context>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        
-        meta_class<mud::GlfwContext>();
+            
+            
+            init_class<mud::GlfwContext>();
+        });
     }
     
 
@@ -82,44 +82,46 @@ namespace mud
     // mud::Context
     {
         static Meta meta = { type<mud::Context>(), &namspc({ "mud" }), "Context", sizeof(mud::Context), TypeClass::Object };
-        static Class cls = { type<mud::Context>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Context>(), member_address(&mud::Context::m_resource_path), type<mud::string>(), "resource_path", var(mud::string()), Member::Value, nullptr },
-                { type<mud::Context>(), member_address(&mud::Context::m_title), type<std::string>(), "title", var(std::string()), Member::Value, nullptr },
-                { type<mud::Context>(), member_address(&mud::Context::m_width), type<uint>(), "width", var(uint()), Member::Value, nullptr },
-                { type<mud::Context>(), member_address(&mud::Context::m_height), type<uint>(), "height", var(uint()), Member::Value, nullptr },
-                { type<mud::Context>(), member_address(&mud::Context::m_full_screen), type<bool>(), "full_screen", var(bool()), Member::Value, nullptr },
-                { type<mud::Context>(), member_address(&mud::Context::m_active), type<bool>(), "active", var(bool(true)), Member::Value, nullptr },
-                { type<mud::Context>(), member_address(&mud::Context::m_shutdown), type<bool>(), "shutdown", var(bool(false)), Member::Value, nullptr },
-                { type<mud::Context>(), member_address(&mud::Context::m_cursor), type<mud::vec2>(), "cursor", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::Context>(), member_address(&mud::Context::m_mouse_lock), type<bool>(), "mouse_lock", var(bool(false)), Member::Value, nullptr }
-            },
-            // methods
-            {
-                { type<mud::Context>(), "reset", member_address(&mud::Context::reset), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Context>(object).reset(val<uint16_t>(args[0]), val<uint16_t>(args[1])); }, { { "width", var(uint16_t()) }, { "height", var(uint16_t()) } }, Var() },
-                //{ type<mud::Context>(), "init_input", member_address(&mud::Context::init_input), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Context>(object).init_input(val<mud::Mouse>(args[0]), val<mud::Keyboard>(args[1])); }, { { "mouse", Ref(type<mud::Mouse>()) }, { "keyboard", Ref(type<mud::Keyboard>()) } }, Var() },
-                { type<mud::Context>(), "next_frame", member_address(&mud::Context::next_frame), [](Ref object, array<Var> args, Var& result) { UNUSED(args);val<bool>(result) = val<mud::Context>(object).next_frame(); }, {}, var(bool()) },
-                { type<mud::Context>(), "lock_mouse", member_address(&mud::Context::lock_mouse), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Context>(object).lock_mouse(val<bool>(args[0])); }, { { "locked", var(bool()) } }, Var() }
-            },
-            // static members
-            {
-            }
-        };
-        
-        
+        lazy_class<mud::Context>([] {
+            static Class cls = { type<mud::Context>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Context>(), member_address(&mud::Context::m_resource_path), type<mud::string>(), "resource_path", var(mud::string()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Context>(object).m_resource_path); }, [](Ref object, Ref value) { member_assign(val<mud::Context>(object).m_resource_path, value); } },
+                    { type<mud::Context>(), member_address(&mud::Context::m_title), type<std::string>(), "title", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Context>(object).m_title); }, [](Ref object, Ref value) { member_assign(val<mud::Context>(object).m_title, value); } },
+                    { type<mud::Context>(), member_address(&mud::Context::m_width), type<uint>(), "width", var(uint()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Context>(object).m_width); }, [](Ref object, Ref value) { member_assign(val<mud::Context>(object).m_width, value); } },
+                    { type<mud::Context>(), member_address(&mud::Context::m_height), type<uint>(), "height", var(uint()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Context>(object).m_height); }, [](Ref object, Ref value) { member_assign(val<mud::Context>(object).m_height, value); } },
+                    { type<mud::Context>(), member_address(&mud::Context::m_full_screen), type<bool>(), "full_screen", var(bool()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Context>(object).m_full_screen); }, [](Ref object, Ref value) { member_assign(val<mud::Context>(object).m_full_screen, value); } },
+                    { type<mud::Context>(), member_address(&mud::Context::m_active), type<bool>(), "active", var(bool(true)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Context>(object).m_active); }, [](Ref object, Ref value) { member_assign(val<mud::Context>(object).m_active, value); } },
+                    { type<mud::Context>(), member_address(&mud::Context::m_shutdown), type<bool>(), "shutdown", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Context>(object).m_shutdown); }, [](Ref object, Ref value) { member_assign(val<mud::Context>(object).m_shutdown, value); } },
+                    { type<mud::Context>(), member_address(&mud::Context::m_cursor), type<mud::vec2>(), "cursor", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Context>(object).m_cursor); }, [](Ref object, Ref value) { member_assign(val<mud::Context>(object).m_cursor, value); } },
+                    { type<mud::Context>(), member_address(&mud::Context::m_mouse_lock), type<bool>(), "mouse_lock", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Context>(object).m_mouse_lock); }, [](Ref object, Ref value) { member_assign(val<mud::Context>(object).m_mouse_lock, value); } }
+                },
+                // methods
+                {
+                    { type<mud::Context>(), "reset", member_address(&mud::Context::reset), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Context>(object).reset(val<uint16_t>(args[0]), val<uint16_t>(args[1])); }, { { "width", var(uint16_t()) }, { "height", var(uint16_t()) } }, Var() },
+                    //{ type<mud::Context>(), "init_input", member_address(&mud::Context::init_input), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Context>(object).init_input(val<mud::Mouse>(args[0]), val<mud::Keyboard>(args[1])); }, { { "mouse", Ref(type<mud::Mouse>()) }, { "keyboard", Ref(type<mud::Keyboard>()) } }, Var() },
+                    { type<mud::Context>(), "next_frame", member_address(&mud::Context::next_frame), [](Ref object, array<Var> args, Var& result) { UNUSED(args);val<bool>(result) = val<mud::Context>(object).next_frame(); }, {}, var(bool()) },
+                    { type<mud::Context>(), "lock_mouse", member_address(&mud::Context::lock_mouse), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Context>(object).lock_mouse(val<bool>(args[0])); }, { { "locked", var(bool()) } }, Var() }
+                },
+                // static members
+                {
+                }
+            };
         
         
-        meta_class<mud::Context>();
+            
+            
+            init_class<mud::Context>();
+        });
     }
     
     
@@ -127,31 +129,33 @@ namespace mud
     // mud::ControlNode
     {
         static Meta meta = { type<mud::ControlNode>(), &namspc({ "mud" }), "ControlNode", sizeof(mud::ControlNode), TypeClass::Object };
-        static Class cls = { type<mud::ControlNode>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
+        lazy_class<mud::ControlNode>([] {
+            static Class cls = { type<mud::ControlNode>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        meta_class<mud::ControlNode>();
+            
+            
+            init_class<mud::ControlNode>();
+        });
     }
     
     
@@ -161,36 +165,38 @@ namespace mud
     // mud::InputEvent
     {
         static Meta meta = { type<mud::InputEvent>(), &namspc({ "mud" }), "InputEvent", sizeof(mud::InputEvent), TypeClass::Struct };
-        static Class cls = { type<mud::InputEvent>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::InputEvent>(), [](Ref ref, Ref other) { new(&val<mud::InputEvent>(ref)) mud::InputEvent(val<mud::InputEvent>(other)); } }
-            },
-            // members
-            {
-                { type<mud::InputEvent>(), member_address(&mud::InputEvent::m_deviceType), type<mud::DeviceType>(), "deviceType", var(mud::DeviceType()), Member::Value, nullptr },
-                { type<mud::InputEvent>(), member_address(&mud::InputEvent::m_eventType), type<mud::EventType>(), "eventType", var(mud::EventType()), Member::Value, nullptr }
-            },
-            // methods
-            {
-                { type<mud::InputEvent>(), "consume", member_address(&mud::InputEvent::consume), [](Ref object, array<Var> args, Var& result) { val<mud::InputEvent>(result) = val<mud::InputEvent>(object).consume(val<mud::ControlNode>(args[0])); }, { { "consumer", Ref(type<mud::ControlNode>()) } }, var(mud::InputEvent()) },
-                { type<mud::InputEvent>(), "valid", member_address(&mud::InputEvent::valid), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<bool>(result) = val<mud::InputEvent>(object).valid(); }, {}, var(bool()) }
-            },
-            // static members
-            {
-            }
-        };
-        
-        
+        lazy_class<mud::InputEvent>([] {
+            static Class cls = { type<mud::InputEvent>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::InputEvent>(), [](Ref ref, Ref other) { new(&val<mud::InputEvent>(ref)) mud::InputEvent(val<mud::InputEvent>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::InputEvent>(), member_address(&mud::InputEvent::m_deviceType), type<mud::DeviceType>(), "deviceType", var(mud::DeviceType()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InputEvent>(object).m_deviceType); }, [](Ref object, Ref value) { member_assign(val<mud::InputEvent>(object).m_deviceType, value); } },
+                    { type<mud::InputEvent>(), member_address(&mud::InputEvent::m_eventType), type<mud::EventType>(), "eventType", var(mud::EventType()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InputEvent>(object).m_eventType); }, [](Ref object, Ref value) { member_assign(val<mud::InputEvent>(object).m_eventType, value); } }
+                },
+                // methods
+                {
+                    { type<mud::InputEvent>(), "consume", member_address(&mud::InputEvent::consume), [](Ref object, array<Var> args, Var& result) { val<mud::InputEvent>(result) = val<mud::InputEvent>(object).consume(val<mud::ControlNode>(args[0])); }, { { "consumer", Ref(type<mud::ControlNode>()) } }, var(mud::InputEvent()) },
+                    { type<mud::InputEvent>(), "valid", member_address(&mud::InputEvent::valid), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<bool>(result) = val<mud::InputEvent>(object).valid(); }, {}, var(bool()) }
+                },
+                // static members
+                {
+                }
+            };
         
         
-        meta_class<mud::InputEvent>();
+            
+            
+            init_class<mud::InputEvent>();
+        });
     }
     
     
@@ -202,31 +208,33 @@ namespace mud
     // mud::RenderSystem
     {
         static Meta meta = { type<mud::RenderSystem>(), &namspc({ "mud" }), "RenderSystem", sizeof(mud::RenderSystem), TypeClass::Object };
-        static Class cls = { type<mud::RenderSystem>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
+        lazy_class<mud::RenderSystem>([] {
+            static Class cls = { type<mud::RenderSystem>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        meta_class<mud::RenderSystem>();
+            
+            
+            init_class<mud::RenderSystem>();
+        });
     }
     
     
@@ -240,34 +248,36 @@ namespace mud
     // mud::KeyEvent
     {
         static Meta meta = { type<mud::KeyEvent>(), &namspc({ "mud" }), "KeyEvent", sizeof(mud::KeyEvent), TypeClass::Struct };
-        static Class cls = { type<mud::KeyEvent>(),
-            // bases
-            { &type<mud::InputEvent>() },
-            { base_offset<mud::KeyEvent, mud::InputEvent>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::KeyEvent>(), [](Ref ref, Ref other) { new(&val<mud::KeyEvent>(ref)) mud::KeyEvent(val<mud::KeyEvent>(other)); } }
-            },
-            // members
-            {
-                { type<mud::KeyEvent>(), member_address(&mud::KeyEvent::m_code), type<mud::Key>(), "code", var(mud::Key()), Member::Value, nullptr },
-                { type<mud::KeyEvent>(), member_address(&mud::KeyEvent::m_char), type<char>(), "char", var(char()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
+        lazy_class<mud::KeyEvent>([] {
+            static Class cls = { type<mud::KeyEvent>(),
+                // bases
+                { &type<mud::InputEvent>() },
+                { base_offset<mud::KeyEvent, mud::InputEvent>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::KeyEvent>(), [](Ref ref, Ref other) { new(&val<mud::KeyEvent>(ref)) mud::KeyEvent(val<mud::KeyEvent>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::KeyEvent>(), member_address(&mud::KeyEvent::m_code), type<mud::Key>(), "code", var(mud::Key()), Member::Value, nullptr, [](Ref object) { return var(val<mud::KeyEvent>(object).m_code); }, [](Ref object, Ref value) { member_assign(val<mud::KeyEvent>(object).m_code, value); } },
+                    { type<mud::KeyEvent>(), member_address(&mud::KeyEvent::m_char), type<char>(), "char", var(char()), Member::Value, nullptr, [](Ref object) { return var(val<mud::KeyEvent>(object).m_char); }, [](Ref object, Ref value) { member_assign(val<mud::KeyEvent>(object).m_char, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        meta_class<mud::KeyEvent>();
+            
+            
+            init_class<mud::KeyEvent>();
+        });
     }
     
     
@@ -275,38 +285,40 @@ namespace mud
     // mud::MouseEvent
     {
         static Meta meta = { type<mud::MouseEvent>(), &namspc({ "mud" }), "MouseEvent", sizeof(mud::MouseEvent), TypeClass::Struct };
-        static Class cls = { type<mud::MouseEvent>(),
-            // bases
-            { &type<mud::InputEvent>() },
-            { base_offset<mud::MouseEvent, mud::InputEvent>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::MouseEvent>(), [](Ref ref, Ref other) { new(&val<mud::MouseEvent>(ref)) mud::MouseEvent(val<mud::MouseEvent>(other)); } }
-            },
-            // members
-            {
-                { type<mud::MouseEvent>(), member_address(&mud::MouseEvent::m_pos), type<mud::vec2>(), "pos", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::MouseEvent>(), member_address(&mud::MouseEvent::m_relative), type<mud::vec2>(), "relative", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::MouseEvent>(), member_address(&mud::MouseEvent::m_delta), type<mud::vec2>(), "delta", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::MouseEvent>(), member_address(&mud::MouseEvent::m_deltaZ), type<float>(), "deltaZ", var(float(0.f)), Member::Value, nullptr },
-                { type<mud::MouseEvent>(), member_address(&mud::MouseEvent::m_pressed), type<mud::vec2>(), "pressed", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::MouseEvent>(), member_address(&mud::MouseEvent::m_button), type<mud::MouseButtonCode>(), "button", var(mud::MouseButtonCode()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
+        lazy_class<mud::MouseEvent>([] {
+            static Class cls = { type<mud::MouseEvent>(),
+                // bases
+                { &type<mud::InputEvent>() },
+                { base_offset<mud::MouseEvent, mud::InputEvent>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::MouseEvent>(), [](Ref ref, Ref other) { new(&val<mud::MouseEvent>(ref)) mud::MouseEvent(val<mud::MouseEvent>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::MouseEvent>(), member_address(&mud::MouseEvent::m_pos), type<mud::vec2>(), "pos", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::MouseEvent>(object).m_pos); }, [](Ref object, Ref value) { member_assign(val<mud::MouseEvent>(object).m_pos, value); } },
+                    { type<mud::MouseEvent>(), member_address(&mud::MouseEvent::m_relative), type<mud::vec2>(), "relative", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::MouseEvent>(object).m_relative); }, [](Ref object, Ref value) { member_assign(val<mud::MouseEvent>(object).m_relative, value); } },
+                    { type<mud::MouseEvent>(), member_address(&mud::MouseEvent::m_delta), type<mud::vec2>(), "delta", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::MouseEvent>(object).m_delta); }, [](Ref object, Ref value) { member_assign(val<mud::MouseEvent>(object).m_delta, value); } },
+                    { type<mud::MouseEvent>(), member_address(&mud::MouseEvent::m_deltaZ), type<float>(), "deltaZ", var(float(0.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::MouseEvent>(object).m_deltaZ); }, [](Ref object, Ref value) { member_assign(val<mud::MouseEvent>(object).m_deltaZ, value); } },
+                    { type<mud::MouseEvent>(), member_address(&mud::MouseEvent::m_pressed), type<mud::vec2>(), "pressed", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::MouseEvent>(object).m_pressed); }, [](Ref object, Ref value) { member_assign(val<mud::MouseEvent>(object).m_pressed, value); } },
+                    { type<mud::MouseEvent>(), member_address(&mud::MouseEvent::m_button), type<mud::MouseButtonCode>(), "button", var(mud::MouseButtonCode()), Member::Value, nullptr, [](Ref object) { return var(val<mud::MouseEvent>(object).m_button); }, [](Ref object, Ref value) { member_assign(val<mud::MouseEvent>(object).m_button, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        meta_class<mud::MouseEvent>();
+            
+            
+            init_class<mud::MouseEvent>();
+        });
     }
     
     
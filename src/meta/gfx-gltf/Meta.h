@@ -77,121 +77,155 @@ namespace mud
     // Sequences
     {
         static Meta meta = { type<std::vector<glTFAccessor>>(), &namspc({}), "std::vector<glTFAccessor>", sizeof(std::vector<glTFAccessor>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<glTFAccessor>>() };
-        cls.m_content = &type<glTFAccessor>();
-        meta_sequence<std::vector<glTFAccessor>, glTFAccessor>();
+        lazy_class<std::vector<glTFAccessor>>([] {
+            static Class cls = { type<std::vector<glTFAccessor>>() };
+            cls.m_content = &type<glTFAccessor>();
+            init_vector<std::vector<glTFAccessor>, glTFAccessor>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<glTFAnimation>>(), &namspc({}), "std::vector<glTFAnimation>", sizeof(std::vector<glTFAnimation>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<glTFAnimation>>() };
-        cls.m_content = &type<glTFAnimation>();
-        meta_sequence<std::vector<glTFAnimation>, glTFAnimation>();
+        lazy_class<std::vector<glTFAnimation>>([] {
+            static Class cls = { type<std::vector<glTFAnimation>>() };
+            cls.m_content = &type<glTFAnimation>();
+            init_vector<std::vector<glTFAnimation>, glTFAnimation>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<glTFAnimationChannel>>(), &namspc({}), "std::vector<glTFAnimationChannel>", sizeof(std::vector<glTFAnimationChannel>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<glTFAnimationChannel>>() };
-        cls.m_content = &type<glTFAnimationChannel>();
-        meta_sequence<std::vector<glTFAnimationChannel>, glTFAnimationChannel>();
+        lazy_class<std::vector<glTFAnimationChannel>>([] {
+            static Class cls = { type<std::vector<glTFAnimationChannel>>() };
+            cls.m_content = &type<glTFAnimationChannel>();
+            init_vector<std::vector<glTFAnimationChannel>, glTFAnimationChannel>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<glTFAnimationSampler>>(), &namspc({}), "std::vector<glTFAnimationSampler>", sizeof(std::vector<glTFAnimationSampler>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<glTFAnimationSampler>>() };
-        cls.m_content = &type<glTFAnimationSampler>();
-        meta_sequence<std::vector<glTFAnimationSampler>, glTFAnimationSampler>();
+        lazy_class<std::vector<glTFAnimationSampler>>([] {
+            static Class cls = { type<std::vector<glTFAnimationSampler>>() };
+            cls.m_content = &type<glTFAnimationSampler>();
+            init_vector<std::vector<glTFAnimationSampler>, glTFAnimationSampler>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<glTFBuffer>>(), &namspc({}), "std::vector<glTFBuffer>", sizeof(std::vector<glTFBuffer>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<glTFBuffer>>() };
-        cls.m_content = &type<glTFBuffer>();
-        meta_sequence<std::vector<glTFBuffer>, glTFBuffer>();
+        lazy_class<std::vector<glTFBuffer>>([] {
+            static Class cls = { type<std::vector<glTFBuffer>>() };
+            cls.m_content = &type<glTFBuffer>();
+            init_vector<std::vector<glTFBuffer>, glTFBuffer>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<glTFBufferView>>(), &namspc({}), "std::vector<glTFBufferView>", sizeof(std::vector<glTFBufferView>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<glTFBufferView>>() };
-        cls.m_content = &type<glTFBufferView>();
-        meta_sequence<std::vector<glTFBufferView>, glTFBufferView>();
+        lazy_class<std::vector<glTFBufferView>>([] {
+            static Class cls = { type<std::vector<glTFBufferView>>() };
+            cls.m_content = &type<glTFBufferView>();
+            init_vector<std::vector<glTFBufferView>, glTFBufferView>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<glTFCamera>>(), &namspc({}), "std::vector<glTFCamera>", sizeof(std::vector<glTFCamera>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<glTFCamera>>() };
-        cls.m_content = &type<glTFCamera>();
-        meta_sequence<std::vector<glTFCamera>, glTFCamera>();
+        lazy_class<std::vector<glTFCamera>>([] {
+            static Class cls = { type<std::vector<glTFCamera>>() };
+            cls.m_content = &type<glTFCamera>();
+            init_vector<std::vector<glTFCamera>, glTFCamera>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<glTFImage>>(), &namspc({}), "std::vector<glTFImage>", sizeof(std::vector<glTFImage>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<glTFImage>>() };
-        cls.m_content = &type<glTFImage>();
-        meta_sequence<std::vector<glTFImage>, glTFImage>();
+        lazy_class<std::vector<glTFImage>>([] {
+            static Class cls = { type<std::vector<glTFImage>>() };
+            cls.m_content = &type<glTFImage>();
+            init_vector<std::vector<glTFImage>, glTFImage>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<glTFMaterial>>(), &namspc({}), "std::vector<glTFMaterial>", sizeof(std::vector<glTFMaterial>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<glTFMaterial>>() };
-        cls.m_content = &type<glTFMaterial>();
-        meta_sequence<std::vector<glTFMaterial>, glTFMaterial>();
+        lazy_class<std::vector<glTFMaterial>>([] {
+            static Class cls = { type<std::vector<glTFMaterial>>() };
+            cls.m_content = &type<glTFMaterial>();
+            init_vector<std::vector<glTFMaterial>, glTFMaterial>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<glTFMesh>>(), &namspc({}), "std::vector<glTFMesh>", sizeof(std::vector<glTFMesh>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<glTFMesh>>() };
-        cls.m_content = &type<glTFMesh>();
-        meta_sequence<std::vector<glTFMesh>, glTFMesh>();
+        lazy_class<std::vector<glTFMesh>>([] {
+            static Class cls = { type<std::vector<glTFMesh>>() };
+            cls.m_content = &type<glTFMesh>();
+            init_vector<std::vector<glTFMesh>, glTFMesh>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<glTFMorphTarget>>(), &namspc({}), "std::vector<glTFMorphTarget>", sizeof(std::vector<glTFMorphTarget>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<glTFMorphTarget>>() };
-        cls.m_content = &type<glTFMorphTarget>();
-        meta_sequence<std::vector<glTFMorphTarget>, glTFMorphTarget>();
+        lazy_class<std::vector<glTFMorphTarget>>([] {
+            static Class cls = { type<std::vector<glTFMorphTarget>>() };
+            cls.m_content = &type<glTFMorphTarget>();
+            init_vector<std::vector<glTFMorphTarget>, glTFMorphTarget>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<glTFNode>>(), &namspc({}), "std::vector<glTFNode>", sizeof(std::vector<glTFNode>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<glTFNode>>() };
-        cls.m_content = &type<glTFNode>();
-        meta_sequence<std::vector<glTFNode>, glTFNode>();
+        lazy_class<std::vector<glTFNode>>([] {
+            static Class cls = { type<std::vector<glTFNode>>() };
+            cls.m_content = &type<glTFNode>();
+            init_vector<std::vector<glTFNode>, glTFNode>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<glTFPrimitive>>(), &namspc({}), "std::vector<glTFPrimitive>", sizeof(std::vector<glTFPrimitive>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<glTFPrimitive>>() };
-        cls.m_content = &type<glTFPrimitive>();
-        meta_sequence<std::vector<glTFPrimitive>, glTFPrimitive>();
+        lazy_class<std::vector<glTFPrimitive>>([] {
+            static Class cls = { type<std::vector<glTFPrimitive>>() };
+            cls.m_content = &type<glTFPrimitive>();
+            init_vector<std::vector<glTFPrimitive>, glTFPrimitive>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<glTFScene>>(), &namspc({}), "std::vector<glTFScene>", sizeof(std::vector<glTFScene>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<glTFScene>>() };
-        cls.m_content = &type<glTFScene>();
-        meta_sequence<std::vector<glTFScene>, glTFScene>();
+        lazy_class<std::vector<glTFScene>>([] {
+            static Class cls = { type<std::vector<glTFScene>>() };
+            cls.m_content = &type<glTFScene>();
+            init_vector<std::vector<glTFScene>, glTFScene>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<glTFSkin>>(), &namspc({}), "std::vector<glTFSkin>", sizeof(std::vector<glTFSkin>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<glTFSkin>>() };
-        cls.m_content = &type<glTFSkin>();
-        meta_sequence<std::vector<glTFSkin>, glTFSkin>();
+        lazy_class<std::vector<glTFSkin>>([] {
+            static Class cls = { type<std::vector<glTFSkin>>() };
+            cls.m_content = &type<glTFSkin>();
+            init_vector<std::vector<glTFSkin>, glTFSkin>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<glTFTexture>>(), &namspc({}), "std::vector<glTFTexture>", sizeof(std::vector<glTFTexture>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<glTFTexture>>() };
-        cls.m_content = &type<glTFTexture>();
-        meta_sequence<std::vector<glTFTexture>, glTFTexture>();
+        lazy_class<std::vector<glTFTexture>>([] {
+            static Class cls = { type<std::vector<glTFTexture>>() };
+            cls.m_content = &type<glTFTexture>();
+            init_vector<std::vector<glTFTexture>, glTFTexture>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<int>>(), &namspc({}), "std::vector<int>", sizeof(std::vector<int>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<int>>() };
-        cls.m_content = &type<int>();
-        meta_sequence<std::vector<int>, int>();
+        lazy_class<std::vector<int>>([] {
+            static Class cls = { type<std::vector<int>>() };
+            cls.m_content = &type<int>();
+            init_vector<std::vector<int>, int>();
+        });
     }
     
     
@@ -229,44 +263,46 @@ namespace mud
     // glTF
     {
         static Meta meta = { type<glTF>(), &namspc({}), "glTF", sizeof(glTF), TypeClass::Struct };
-        static Class cls = { type<glTF>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTF>(), [](Ref ref, Ref other) { new(&val<glTF>(ref)) glTF(val<glTF>(other)); } }
-            },
-            // members
-            {
-                { type<glTF>(), member_address(&glTF::m_buffers), type<std::vector<glTFBuffer>>(), "buffers", var(std::vector<glTFBuffer>()), Member::Value, nullptr },
-                { type<glTF>(), member_address(&glTF::m_buffer_views), type<std::vector<glTFBufferView>>(), "buffer_views", var(std::vector<glTFBufferView>()), Member::Value, nullptr },
-                { type<glTF>(), member_address(&glTF::m_accessors), type<std::vector<glTFAccessor>>(), "accessors", var(std::vector<glTFAccessor>()), Member::Value, nullptr },
-                { type<glTF>(), member_address(&glTF::m_images), type<std::vector<glTFImage>>(), "images", var(std::vector<glTFImage>()), Member::Value, nullptr },
-                { type<glTF>(), member_address(&glTF::m_textures), type<std::vector<glTFTexture>>(), "textures", var(std::vector<glTFTexture>()), Member::Value, nullptr },
-                { type<glTF>(), member_address(&glTF::m_materials), type<std::vector<glTFMaterial>>(), "materials", var(std::vector<glTFMaterial>()), Member::Value, nullptr },
-                { type<glTF>(), member_address(&glTF::m_meshes), type<std::vector<glTFMesh>>(), "meshes", var(std::vector<glTFMesh>()), Member::Value, nullptr },
-                { type<glTF>(), member_address(&glTF::m_nodes), type<std::vector<glTFNode>>(), "nodes", var(std::vector<glTFNode>()), Member::Value, nullptr },
-                { type<glTF>(), member_address(&glTF::m_skins), type<std::vector<glTFSkin>>(), "skins", var(std::vector<glTFSkin>()), Member::Value, nullptr },
-                { type<glTF>(), member_address(&glTF::m_animations), type<std::vector<glTFAnimation>>(), "animations", var(std::vector<glTFAnimation>()), Member::Value, nullptr },
-                { type<glTF>(), member_address(&glTF::m_cameras), type<std::vector<glTFCamera>>(), "cameras", var(std::vector<glTFCamera>()), Member::Value, nullptr },
-                { type<glTF>(), member_address(&glTF::m_scenes), type<std::vector<glTFScene>>(), "scenes", var(std::vector<glTFScene>()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTF>();
+        lazy_class<glTF>([] {
+            static Class cls = { type<glTF>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTF>(), [](Ref ref, Ref other) { new(&val<glTF>(ref)) glTF(val<glTF>(other)); } }
+                },
+                // members
+                {
+                    { type<glTF>(), member_address(&glTF::m_buffers), type<std::vector<glTFBuffer>>(), "buffers", var(std::vector<glTFBuffer>()), Member::Value, nullptr, [](Ref object) { return var(val<glTF>(object).m_buffers); }, [](Ref object, Ref value) { member_assign(val<glTF>(object).m_buffers, value); } },
+                    { type<glTF>(), member_address(&glTF::m_buffer_views), type<std::vector<glTFBufferView>>(), "buffer_views", var(std::vector<glTFBufferView>()), Member::Value, nullptr, [](Ref object) { return var(val<glTF>(object).m_buffer_views); }, [](Ref object, Ref value) { member_assign(val<glTF>(object).m_buffer_views, value); } },
+                    { type<glTF>(), member_address(&glTF::m_accessors), type<std::vector<glTFAccessor>>(), "accessors", var(std::vector<glTFAccessor>()), Member::Value, nullptr, [](Ref object) { return var(val<glTF>(object).m_accessors); }, [](Ref object, Ref value) { member_assign(val<glTF>(object).m_accessors, value); } },
+                    { type<glTF>(), member_address(&glTF::m_images), type<std::vector<glTFImage>>(), "images", var(std::vector<glTFImage>()), Member::Value, nullptr, [](Ref object) { return var(val<glTF>(object).m_images); }, [](Ref object, Ref value) { member_assign(val<glTF>(object).m_images, value); } },
+                    { type<glTF>(), member_address(&glTF::m_textures), type<std::vector<glTFTexture>>(), "textures", var(std::vector<glTFTexture>()), Member::Value, nullptr, [](Ref object) { return var(val<glTF>(object).m_textures); }, [](Ref object, Ref value) { member_assign(val<glTF>(object).m_textures, value); } },
+                    { type<glTF>(), member_address(&glTF::m_materials), type<std::vector<glTFMaterial>>(), "materials", var(std::vector<glTFMaterial>()), Member::Value, nullptr, [](Ref object) { return var(val<glTF>(object).m_materials); }, [](Ref object, Ref value) { member_assign(val<glTF>(object).m_materials, value); } },
+                    { type<glTF>(), member_address(&glTF::m_meshes), type<std::vector<glTFMesh>>(), "meshes", var(std::vector<glTFMesh>()), Member::Value, nullptr, [](Ref object) { return var(val<glTF>(object).m_meshes); }, [](Ref object, Ref value) { member_assign(val<glTF>(object).m_meshes, value); } },
+                    { type<glTF>(), member_address(&glTF::m_nodes), type<std::vector<glTFNode>>(), "nodes", var(std::vector<glTFNode>()), Member::Value, nullptr, [](Ref object) { return var(val<glTF>(object).m_nodes); }, [](Ref object, Ref value) { member_assign(val<glTF>(object).m_nodes, value); } },
+                    { type<glTF>(), member_address(&glTF::m_skins), type<std::vector<glTFSkin>>(), "skins", var(std::vector<glTFSkin>()), Member::Value, nullptr, [](Ref object) { return var(val<glTF>(object).m_skins); }, [](Ref object, Ref value) { member_assign(val<glTF>(object).m_skins, value); } },
+                    { type<glTF>(), member_address(&glTF::m_animations), type<std::vector<glTFAnimation>>(), "animations", var(std::vector<glTFAnimation>()), Member::Value, nullptr, [](Ref object) { return var(val<glTF>(object).m_animations); }, [](Ref object, Ref value) { member_assign(val<glTF>(object).m_animations, value); } },
+                    { type<glTF>(), member_address(&glTF::m_cameras), type<std::vector<glTFCamera>>(), "cameras", var(std::vector<glTFCamera>()), Member::Value, nullptr, [](Ref object) { return var(val<glTF>(object).m_cameras); }, [](Ref object, Ref value) { member_assign(val<glTF>(object).m_cameras, value); } },
+                    { type<glTF>(), member_address(&glTF::m_scenes), type<std::vector<glTFScene>>(), "scenes", var(std::vector<glTFScene>()), Member::Value, nullptr, [](Ref object) { return var(val<glTF>(object).m_scenes); }, [](Ref object, Ref value) { member_assign(val<glTF>(object).m_scenes, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTF>();
+        });
     }
     
     
@@ -274,39 +310,41 @@ namespace mud
     // glTFAccessor
     {
         static Meta meta = { type<glTFAccessor>(), &namspc({}), "glTFAccessor", sizeof(glTFAccessor), TypeClass::Struct };
-        static Class cls = { type<glTFAccessor>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFAccessor>(), [](Ref ref, Ref other) { new(&val<glTFAccessor>(ref)) glTFAccessor(val<glTFAccessor>(other)); } }
-            },
-            // members
-            {
-                { type<glTFAccessor>(), member_address(&glTFAccessor::buffer_view), type<int>(), "buffer_view", var(int()), Member::Value, nullptr },
-                { type<glTFAccessor>(), member_address(&glTFAccessor::byte_offset), type<int>(), "byte_offset", var(int(0)), Member::Value, nullptr },
-                { type<glTFAccessor>(), member_address(&glTFAccessor::component_type), type<glTFComponentType>(), "component_type", var(glTFComponentType()), Member::Value, nullptr },
-                { type<glTFAccessor>(), member_address(&glTFAccessor::normalized), type<bool>(), "normalized", var(bool(false)), Member::Value, nullptr },
-                { type<glTFAccessor>(), member_address(&glTFAccessor::count), type<int>(), "count", var(int()), Member::Value, nullptr },
-                { type<glTFAccessor>(), member_address(&glTFAccessor::type), type<glTFType>(), "type", var(glTFType()), Member::Value, nullptr },
-                { type<glTFAccessor>(), member_address(&glTFAccessor::sparse), type<glTFSparse>(), "sparse", var(glTFSparse()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFAccessor>();
+        lazy_class<glTFAccessor>([] {
+            static Class cls = { type<glTFAccessor>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFAccessor>(), [](Ref ref, Ref other) { new(&val<glTFAccessor>(ref)) glTFAccessor(val<glTFAccessor>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFAccessor>(), member_address(&glTFAccessor::buffer_view), type<int>(), "buffer_view", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAccessor>(object).buffer_view); }, [](Ref object, Ref value) { member_assign(val<glTFAccessor>(object).buffer_view, value); } },
+                    { type<glTFAccessor>(), member_address(&glTFAccessor::byte_offset), type<int>(), "byte_offset", var(int(0)), Member::Value, nullptr, [](Ref object) { return var(val<glTFAccessor>(object).byte_offset); }, [](Ref object, Ref value) { member_assign(val<glTFAccessor>(object).byte_offset, value); } },
+                    { type<glTFAccessor>(), member_address(&glTFAccessor::component_type), type<glTFComponentType>(), "component_type", var(glTFComponentType()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAccessor>(object).component_type); }, [](Ref object, Ref value) { member_assign(val<glTFAccessor>(object).component_type, value); } },
+                    { type<glTFAccessor>(), member_address(&glTFAccessor::normalized), type<bool>(), "normalized", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<glTFAccessor>(object).normalized); }, [](Ref object, Ref value) { member_assign(val<glTFAccessor>(object).normalized, value); } },
+                    { type<glTFAccessor>(), member_address(&glTFAccessor::count), type<int>(), "count", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAccessor>(object).count); }, [](Ref object, Ref value) { member_assign(val<glTFAccessor>(object).count, value); } },
+                    { type<glTFAccessor>(), member_address(&glTFAccessor::type), type<glTFType>(), "type", var(glTFType()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAccessor>(object).type); }, [](Ref object, Ref value) { member_assign(val<glTFAccessor>(object).type, value); } },
+                    { type<glTFAccessor>(), member_address(&glTFAccessor::sparse), type<glTFSparse>(), "sparse", var(glTFSparse()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAccessor>(object).sparse); }, [](Ref object, Ref value) { member_assign(val<glTFAccessor>(object).sparse, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFAccessor>();
+        });
     }
     
     
@@ -314,35 +352,37 @@ namespace mud
     // glTFAnimation
     {
         static Meta meta = { type<glTFAnimation>(), &namspc({}), "glTFAnimation", sizeof(glTFAnimation), TypeClass::Struct };
-        static Class cls = { type<glTFAnimation>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFAnimation>(), [](Ref ref, Ref other) { new(&val<glTFAnimation>(ref)) glTFAnimation(val<glTFAnimation>(other)); } }
-            },
-            // members
-            {
-                { type<glTFAnimation>(), member_address(&glTFAnimation::name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr },
-                { type<glTFAnimation>(), member_address(&glTFAnimation::samplers), type<std::vector<glTFAnimationSampler>>(), "samplers", var(std::vector<glTFAnimationSampler>()), Member::Value, nullptr },
-                { type<glTFAnimation>(), member_address(&glTFAnimation::channels), type<std::vector<glTFAnimationChannel>>(), "channels", var(std::vector<glTFAnimationChannel>()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFAnimation>();
+        lazy_class<glTFAnimation>([] {
+            static Class cls = { type<glTFAnimation>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFAnimation>(), [](Ref ref, Ref other) { new(&val<glTFAnimation>(ref)) glTFAnimation(val<glTFAnimation>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFAnimation>(), member_address(&glTFAnimation::name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAnimation>(object).name); }, [](Ref object, Ref value) { member_assign(val<glTFAnimation>(object).name, value); } },
+                    { type<glTFAnimation>(), member_address(&glTFAnimation::samplers), type<std::vector<glTFAnimationSampler>>(), "samplers", var(std::vector<glTFAnimationSampler>()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAnimation>(object).samplers); }, [](Ref object, Ref value) { member_assign(val<glTFAnimation>(object).samplers, value); } },
+                    { type<glTFAnimation>(), member_address(&glTFAnimation::channels), type<std::vector<glTFAnimationChannel>>(), "channels", var(std::vector<glTFAnimationChannel>()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAnimation>(object).channels); }, [](Ref object, Ref value) { member_assign(val<glTFAnimation>(object).channels, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFAnimation>();
+        });
     }
     
     
@@ -350,34 +390,36 @@ namespace mud
     // glTFAnimationChannel
     {
         static Meta meta = { type<glTFAnimationChannel>(), &namspc({}), "glTFAnimationChannel", sizeof(glTFAnimationChannel), TypeClass::Struct };
-        static Class cls = { type<glTFAnimationChannel>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFAnimationChannel>(), [](Ref ref, Ref other) { new(&val<glTFAnimationChannel>(ref)) glTFAnimationChannel(val<glTFAnimationChannel>(other)); } }
-            },
-            // members
-            {
-                { type<glTFAnimationChannel>(), member_address(&glTFAnimationChannel::sampler), type<int>(), "sampler", var(int()), Member::Value, nullptr },
-                { type<glTFAnimationChannel>(), member_address(&glTFAnimationChannel::target), type<glTFAnimationTarget>(), "target", var(glTFAnimationTarget()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFAnimationChannel>();
+        lazy_class<glTFAnimationChannel>([] {
+            static Class cls = { type<glTFAnimationChannel>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFAnimationChannel>(), [](Ref ref, Ref other) { new(&val<glTFAnimationChannel>(ref)) glTFAnimationChannel(val<glTFAnimationChannel>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFAnimationChannel>(), member_address(&glTFAnimationChannel::sampler), type<int>(), "sampler", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAnimationChannel>(object).sampler); }, [](Ref object, Ref value) { member_assign(val<glTFAnimationChannel>(object).sampler, value); } },
+                    { type<glTFAnimationChannel>(), member_address(&glTFAnimationChannel::target), type<glTFAnimationTarget>(), "target", var(glTFAnimationTarget()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAnimationChannel>(object).target); }, [](Ref object, Ref value) { member_assign(val<glTFAnimationChannel>(object).target, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFAnimationChannel>();
+        });
     }
     
     
@@ -385,35 +427,37 @@ namespace mud
     // glTFAnimationSampler
     {
         static Meta meta = { type<glTFAnimationSampler>(), &namspc({}), "glTFAnimationSampler", sizeof(glTFAnimationSampler), TypeClass::Struct };
-        static Class cls = { type<glTFAnimationSampler>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFAnimationSampler>(), [](Ref ref, Ref other) { new(&val<glTFAnimationSampler>(ref)) glTFAnimationSampler(val<glTFAnimationSampler>(other)); } }
-            },
-            // members
-            {
-                { type<glTFAnimationSampler>(), member_address(&glTFAnimationSampler::interpolation), type<glTFInterpolation>(), "interpolation", var(glTFInterpolation()), Member::Value, nullptr },
-                { type<glTFAnimationSampler>(), member_address(&glTFAnimationSampler::input), type<int>(), "input", var(int()), Member::Value, nullptr },
-                { type<glTFAnimationSampler>(), member_address(&glTFAnimationSampler::output), type<int>(), "output", var(int()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFAnimationSampler>();
+        lazy_class<glTFAnimationSampler>([] {
+            static Class cls = { type<glTFAnimationSampler>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFAnimationSampler>(), [](Ref ref, Ref other) { new(&val<glTFAnimationSampler>(ref)) glTFAnimationSampler(val<glTFAnimationSampler>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFAnimationSampler>(), member_address(&glTFAnimationSampler::interpolation), type<glTFInterpolation>(), "interpolation", var(glTFInterpolation()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAnimationSampler>(object).interpolation); }, [](Ref object, Ref value) { member_assign(val<glTFAnimationSampler>(object).interpolation, value); } },
+                    { type<glTFAnimationSampler>(), member_address(&glTFAnimationSampler::input), type<int>(), "input", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAnimationSampler>(object).input); }, [](Ref object, Ref value) { member_assign(val<glTFAnimationSampler>(object).input, value); } },
+                    { type<glTFAnimationSampler>(), member_address(&glTFAnimationSampler::output), type<int>(), "output", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAnimationSampler>(object).output); }, [](Ref object, Ref value) { member_assign(val<glTFAnimationSampler>(object).output, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFAnimationSampler>();
+        });
     }
     
     
@@ -421,34 +465,36 @@ namespace mud
     // glTFAnimationTarget
     {
         static Meta meta = { type<glTFAnimationTarget>(), &namspc({}), "glTFAnimationTarget", sizeof(glTFAnimationTarget), TypeClass::Struct };
-        static Class cls = { type<glTFAnimationTarget>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFAnimationTarget>(), [](Ref ref, Ref other) { new(&val<glTFAnimationTarget>(ref)) glTFAnimationTarget(val<glTFAnimationTarget>(other)); } }
-            },
-            // members
-            {
-                { type<glTFAnimationTarget>(), member_address(&glTFAnimationTarget::node), type<int>(), "node", var(int()), Member::Value, nullptr },
-                { type<glTFAnimationTarget>(), member_address(&glTFAnimationTarget::path), type<std::string>(), "path", var(std::string()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFAnimationTarget>();
+        lazy_class<glTFAnimationTarget>([] {
+            static Class cls = { type<glTFAnimationTarget>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFAnimationTarget>(), [](Ref ref, Ref other) { new(&val<glTFAnimationTarget>(ref)) glTFAnimationTarget(val<glTFAnimationTarget>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFAnimationTarget>(), member_address(&glTFAnimationTarget::node), type<int>(), "node", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAnimationTarget>(object).node); }, [](Ref object, Ref value) { member_assign(val<glTFAnimationTarget>(object).node, value); } },
+                    { type<glTFAnimationTarget>(), member_address(&glTFAnimationTarget::path), type<std::string>(), "path", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAnimationTarget>(object).path); }, [](Ref object, Ref value) { member_assign(val<glTFAnimationTarget>(object).path, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFAnimationTarget>();
+        });
     }
     
     
@@ -456,40 +502,42 @@ namespace mud
     // glTFAttributes
     {
         static Meta meta = { type<glTFAttributes>(), &namspc({}), "glTFAttributes", sizeof(glTFAttributes), TypeClass::Struct };
-        static Class cls = { type<glTFAttributes>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFAttributes>(), [](Ref ref, Ref other) { new(&val<glTFAttributes>(ref)) glTFAttributes(val<glTFAttributes>(other)); } }
-            },
-            // members
-            {
-                { type<glTFAttributes>(), member_address(&glTFAttributes::POSITION), type<int>(), "POSITION", var(int()), Member::Value, nullptr },
-                { type<glTFAttributes>(), member_address(&glTFAttributes::NORMAL), type<int>(), "NORMAL", var(int()), Member::Value, nullptr },
-                { type<glTFAttributes>(), member_address(&glTFAttributes::TANGENT), type<int>(), "TANGENT", var(int()), Member::Value, nullptr },
-                { type<glTFAttributes>(), member_address(&glTFAttributes::TEXCOORD_0), type<int>(), "TEXCOORD_0", var(int()), Member::Value, nullptr },
-                { type<glTFAttributes>(), member_address(&glTFAttributes::TEXCOORD_1), type<int>(), "TEXCOORD_1", var(int()), Member::Value, nullptr },
-                { type<glTFAttributes>(), member_address(&glTFAttributes::COLOR_0), type<int>(), "COLOR_0", var(int()), Member::Value, nullptr },
-                { type<glTFAttributes>(), member_address(&glTFAttributes::JOINTS_0), type<int>(), "JOINTS_0", var(int()), Member::Value, nullptr },
-                { type<glTFAttributes>(), member_address(&glTFAttributes::WEIGHTS_0), type<int>(), "WEIGHTS_0", var(int()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFAttributes>();
+        lazy_class<glTFAttributes>([] {
+            static Class cls = { type<glTFAttributes>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFAttributes>(), [](Ref ref, Ref other) { new(&val<glTFAttributes>(ref)) glTFAttributes(val<glTFAttributes>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFAttributes>(), member_address(&glTFAttributes::POSITION), type<int>(), "POSITION", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAttributes>(object).POSITION); }, [](Ref object, Ref value) { member_assign(val<glTFAttributes>(object).POSITION, value); } },
+                    { type<glTFAttributes>(), member_address(&glTFAttributes::NORMAL), type<int>(), "NORMAL", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAttributes>(object).NORMAL); }, [](Ref object, Ref value) { member_assign(val<glTFAttributes>(object).NORMAL, value); } },
+                    { type<glTFAttributes>(), member_address(&glTFAttributes::TANGENT), type<int>(), "TANGENT", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAttributes>(object).TANGENT); }, [](Ref object, Ref value) { member_assign(val<glTFAttributes>(object).TANGENT, value); } },
+                    { type<glTFAttributes>(), member_address(&glTFAttributes::TEXCOORD_0), type<int>(), "TEXCOORD_0", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAttributes>(object).TEXCOORD_0); }, [](Ref object, Ref value) { member_assign(val<glTFAttributes>(object).TEXCOORD_0, value); } },
+                    { type<glTFAttributes>(), member_address(&glTFAttributes::TEXCOORD_1), type<int>(), "TEXCOORD_1", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAttributes>(object).TEXCOORD_1); }, [](Ref object, Ref value) { member_assign(val<glTFAttributes>(object).TEXCOORD_1, value); } },
+                    { type<glTFAttributes>(), member_address(&glTFAttributes::COLOR_0), type<int>(), "COLOR_0", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAttributes>(object).COLOR_0); }, [](Ref object, Ref value) { member_assign(val<glTFAttributes>(object).COLOR_0, value); } },
+                    { type<glTFAttributes>(), member_address(&glTFAttributes::JOINTS_0), type<int>(), "JOINTS_0", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAttributes>(object).JOINTS_0); }, [](Ref object, Ref value) { member_assign(val<glTFAttributes>(object).JOINTS_0, value); } },
+                    { type<glTFAttributes>(), member_address(&glTFAttributes::WEIGHTS_0), type<int>(), "WEIGHTS_0", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFAttributes>(object).WEIGHTS_0); }, [](Ref object, Ref value) { member_assign(val<glTFAttributes>(object).WEIGHTS_0, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFAttributes>();
+        });
     }
     
     
@@ -497,35 +545,37 @@ namespace mud
     // glTFBuffer
     {
         static Meta meta = { type<glTFBuffer>(), &namspc({}), "glTFBuffer", sizeof(glTFBuffer), TypeClass::Struct };
-        static Class cls = { type<glTFBuffer>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFBuffer>(), [](Ref ref, Ref other) { new(&val<glTFBuffer>(ref)) glTFBuffer(val<glTFBuffer>(other)); } }
-            },
-            // members
-            {
-                { type<glTFBuffer>(), member_address(&glTFBuffer::mime_type), type<std::string>(), "mime_type", var(std::string()), Member::Value, nullptr },
-                { type<glTFBuffer>(), member_address(&glTFBuffer::uri), type<std::string>(), "uri", var(std::string()), Member::Value, nullptr },
-                { type<glTFBuffer>(), member_address(&glTFBuffer::byte_length), type<int>(), "byte_length", var(int()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFBuffer>();
+        lazy_class<glTFBuffer>([] {
+            static Class cls = { type<glTFBuffer>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFBuffer>(), [](Ref ref, Ref other) { new(&val<glTFBuffer>(ref)) glTFBuffer(val<glTFBuffer>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFBuffer>(), member_address(&glTFBuffer::mime_type), type<std::string>(), "mime_type", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<glTFBuffer>(object).mime_type); }, [](Ref object, Ref value) { member_assign(val<glTFBuffer>(object).mime_type, value); } },
+                    { type<glTFBuffer>(), member_address(&glTFBuffer::uri), type<std::string>(), "uri", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<glTFBuffer>(object).uri); }, [](Ref object, Ref value) { member_assign(val<glTFBuffer>(object).uri, value); } },
+                    { type<glTFBuffer>(), member_address(&glTFBuffer::byte_length), type<int>(), "byte_length", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFBuffer>(object).byte_length); }, [](Ref object, Ref value) { member_assign(val<glTFBuffer>(object).byte_length, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFBuffer>();
+        });
     }
     
     
@@ -533,37 +583,39 @@ namespace mud
     // glTFBufferView
     {
         static Meta meta = { type<glTFBufferView>(), &namspc({}), "glTFBufferView", sizeof(glTFBufferView), TypeClass::Struct };
-        static Class cls = { type<glTFBufferView>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFBufferView>(), [](Ref ref, Ref other) { new(&val<glTFBufferView>(ref)) glTFBufferView(val<glTFBufferView>(other)); } }
-            },
-            // members
-            {
-                { type<glTFBufferView>(), member_address(&glTFBufferView::buffer), type<int>(), "buffer", var(int(0)), Member::Value, nullptr },
-                { type<glTFBufferView>(), member_address(&glTFBufferView::byte_offset), type<size_t>(), "byte_offset", var(size_t()), Member::Value, nullptr },
-                { type<glTFBufferView>(), member_address(&glTFBufferView::byte_length), type<size_t>(), "byte_length", var(size_t()), Member::Value, nullptr },
-                { type<glTFBufferView>(), member_address(&glTFBufferView::byte_stride), type<size_t>(), "byte_stride", var(size_t()), Member::Value, nullptr },
-                { type<glTFBufferView>(), member_address(&glTFBufferView::target), type<int>(), "target", var(int(0)), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFBufferView>();
+        lazy_class<glTFBufferView>([] {
+            static Class cls = { type<glTFBufferView>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFBufferView>(), [](Ref ref, Ref other) { new(&val<glTFBufferView>(ref)) glTFBufferView(val<glTFBufferView>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFBufferView>(), member_address(&glTFBufferView::buffer), type<int>(), "buffer", var(int(0)), Member::Value, nullptr, [](Ref object) { return var(val<glTFBufferView>(object).buffer); }, [](Ref object, Ref value) { member_assign(val<glTFBufferView>(object).buffer, value); } },
+                    { type<glTFBufferView>(), member_address(&glTFBufferView::byte_offset), type<size_t>(), "byte_offset", var(size_t()), Member::Value, nullptr, [](Ref object) { return var(val<glTFBufferView>(object).byte_offset); }, [](Ref object, Ref value) { member_assign(val<glTFBufferView>(object).byte_offset, value); } },
+                    { type<glTFBufferView>(), member_address(&glTFBufferView::byte_length), type<size_t>(), "byte_length", var(size_t()), Member::Value, nullptr, [](Ref object) { return var(val<glTFBufferView>(object).byte_length); }, [](Ref object, Ref value) { member_assign(val<glTFBufferView>(object).byte_length, value); } },
+                    { type<glTFBufferView>(), member_address(&glTFBufferView::byte_stride), type<size_t>(), "byte_stride", var(size_t()), Member::Value, nullptr, [](Ref object) { return var(val<glTFBufferView>(object).byte_stride); }, [](Ref object, Ref value) { member_assign(val<glTFBufferView>(object).byte_stride, value); } },
+                    { type<glTFBufferView>(), member_address(&glTFBufferView::target), type<int>(), "target", var(int(0)), Member::Value, nullptr, [](Ref object) { return var(val<glTFBufferView>(object).target); }, [](Ref object, Ref value) { member_assign(val<glTFBufferView>(object).target, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFBufferView>();
+        });
     }
     
     
@@ -571,35 +623,37 @@ namespace mud
     // glTFCamera
     {
         static Meta meta = { type<glTFCamera>(), &namspc({}), "glTFCamera", sizeof(glTFCamera), TypeClass::Struct };
-        static Class cls = { type<glTFCamera>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFCamera>(), [](Ref ref, Ref other) { new(&val<glTFCamera>(ref)) glTFCamera(val<glTFCamera>(other)); } }
-            },
-            // members
-            {
-                { type<glTFCamera>(), member_address(&glTFCamera::type), type<std::string>(), "type", var(std::string()), Member::Value, nullptr },
-                { type<glTFCamera>(), member_address(&glTFCamera::orthographic), type<glTFOrthographic>(), "orthographic", var(glTFOrthographic()), Member::Value, nullptr },
-                { type<glTFCamera>(), member_address(&glTFCamera::perspective), type<glTFPerspective>(), "perspective", var(glTFPerspective()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFCamera>();
+        lazy_class<glTFCamera>([] {
+            static Class cls = { type<glTFCamera>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFCamera>(), [](Ref ref, Ref other) { new(&val<glTFCamera>(ref)) glTFCamera(val<glTFCamera>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFCamera>(), member_address(&glTFCamera::type), type<std::string>(), "type", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<glTFCamera>(object).type); }, [](Ref object, Ref value) { member_assign(val<glTFCamera>(object).type, value); } },
+                    { type<glTFCamera>(), member_address(&glTFCamera::orthographic), type<glTFOrthographic>(), "orthographic", var(glTFOrthographic()), Member::Value, nullptr, [](Ref object) { return var(val<glTFCamera>(object).orthographic); }, [](Ref object, Ref value) { member_assign(val<glTFCamera>(object).orthographic, value); } },
+                    { type<glTFCamera>(), member_address(&glTFCamera::perspective), type<glTFPerspective>(), "perspective", var(glTFPerspective()), Member::Value, nullptr, [](Ref object) { return var(val<glTFCamera>(object).perspective); }, [](Ref object, Ref value) { member_assign(val<glTFCamera>(object).perspective, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFCamera>();
+        });
     }
     
     
@@ -607,35 +661,37 @@ namespace mud
     // glTFImage
     {
         static Meta meta = { type<glTFImage>(), &namspc({}), "glTFImage", sizeof(glTFImage), TypeClass::Struct };
-        static Class cls = { type<glTFImage>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFImage>(), [](Ref ref, Ref other) { new(&val<glTFImage>(ref)) glTFImage(val<glTFImage>(other)); } }
-            },
-            // members
-            {
-                { type<glTFImage>(), member_address(&glTFImage::mime_type), type<std::string>(), "mime_type", var(std::string()), Member::Value, nullptr },
-                { type<glTFImage>(), member_address(&glTFImage::uri), type<std::string>(), "uri", var(std::string()), Member::Value, nullptr },
-                { type<glTFImage>(), member_address(&glTFImage::buffer_view), type<int>(), "buffer_view", var(int()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFImage>();
+        lazy_class<glTFImage>([] {
+            static Class cls = { type<glTFImage>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFImage>(), [](Ref ref, Ref other) { new(&val<glTFImage>(ref)) glTFImage(val<glTFImage>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFImage>(), member_address(&glTFImage::mime_type), type<std::string>(), "mime_type", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<glTFImage>(object).mime_type); }, [](Ref object, Ref value) { member_assign(val<glTFImage>(object).mime_type, value); } },
+                    { type<glTFImage>(), member_address(&glTFImage::uri), type<std::string>(), "uri", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<glTFImage>(object).uri); }, [](Ref object, Ref value) { member_assign(val<glTFImage>(object).uri, value); } },
+                    { type<glTFImage>(), member_address(&glTFImage::buffer_view), type<int>(), "buffer_view", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFImage>(object).buffer_view); }, [](Ref object, Ref value) { member_assign(val<glTFImage>(object).buffer_view, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFImage>();
+        });
     }
     
     
@@ -643,40 +699,42 @@ namespace mud
     // glTFMaterial
     {
         static Meta meta = { type<glTFMaterial>(), &namspc({}), "glTFMaterial", sizeof(glTFMaterial), TypeClass::Struct };
-        static Class cls = { type<glTFMaterial>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFMaterial>(), [](Ref ref, Ref other) { new(&val<glTFMaterial>(ref)) glTFMaterial(val<glTFMaterial>(other)); } }
-            },
-            // members
-            {
-                { type<glTFMaterial>(), member_address(&glTFMaterial::name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr },
-                { type<glTFMaterial>(), member_address(&glTFMaterial::normal_texture), type<glTFTextureInfo>(), "normal_texture", var(glTFTextureInfo()), Member::Value, nullptr },
-                { type<glTFMaterial>(), member_address(&glTFMaterial::occlusion_texture), type<glTFTextureInfo>(), "occlusion_texture", var(glTFTextureInfo()), Member::Value, nullptr },
-                { type<glTFMaterial>(), member_address(&glTFMaterial::emissive_factor), type<mud::vec3>(), "emissive_factor", var(mud::vec3()), Member::Value, nullptr },
-                { type<glTFMaterial>(), member_address(&glTFMaterial::emissive_texture), type<glTFTextureInfo>(), "emissive_texture", var(glTFTextureInfo()), Member::Value, nullptr },
-                { type<glTFMaterial>(), member_address(&glTFMaterial::double_sided), type<bool>(), "double_sided", var(bool(false)), Member::Value, nullptr },
-                { type<glTFMaterial>(), member_address(&glTFMaterial::alpha_mode), type<glTFAlphaMode>(), "alpha_mode", var(glTFAlphaMode()), Member::Value, nullptr },
-                { type<glTFMaterial>(), member_address(&glTFMaterial::pbr_metallic_roughness), type<glTFMaterialPBR>(), "pbr_metallic_roughness", var(glTFMaterialPBR()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFMaterial>();
+        lazy_class<glTFMaterial>([] {
+            static Class cls = { type<glTFMaterial>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFMaterial>(), [](Ref ref, Ref other) { new(&val<glTFMaterial>(ref)) glTFMaterial(val<glTFMaterial>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFMaterial>(), member_address(&glTFMaterial::name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<glTFMaterial>(object).name); }, [](Ref object, Ref value) { member_assign(val<glTFMaterial>(object).name, value); } },
+                    { type<glTFMaterial>(), member_address(&glTFMaterial::normal_texture), type<glTFTextureInfo>(), "normal_texture", var(glTFTextureInfo()), Member::Value, nullptr, [](Ref object) { return var(val<glTFMaterial>(object).normal_texture); }, [](Ref object, Ref value) { member_assign(val<glTFMaterial>(object).normal_texture, value); } },
+                    { type<glTFMaterial>(), member_address(&glTFMaterial::occlusion_texture), type<glTFTextureInfo>(), "occlusion_texture", var(glTFTextureInfo()), Member::Value, nullptr, [](Ref object) { return var(val<glTFMaterial>(object).occlusion_texture); }, [](Ref object, Ref value) { member_assign(val<glTFMaterial>(object).occlusion_texture, value); } },
+                    { type<glTFMaterial>(), member_address(&glTFMaterial::emissive_factor), type<mud::vec3>(), "emissive_factor", var(mud::vec3()), Member::Value, nullptr, [](Ref object) { return var(val<glTFMaterial>(object).emissive_factor); }, [](Ref object, Ref value) { member_assign(val<glTFMaterial>(object).emissive_factor, value); } },
+                    { type<glTFMaterial>(), member_address(&glTFMaterial::emissive_texture), type<glTFTextureInfo>(), "emissive_texture", var(glTFTextureInfo()), Member::Value, nullptr, [](Ref object) { return var(val<glTFMaterial>(object).emissive_texture); }, [](Ref object, Ref value) { member_assign(val<glTFMaterial>(object).emissive_texture, value); } },
+                    { type<glTFMaterial>(), member_address(&glTFMaterial::double_sided), type<bool>(), "double_sided", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<glTFMaterial>(object).double_sided); }, [](Ref object, Ref value) { member_assign(val<glTFMaterial>(object).double_sided, value); } },
+                    { type<glTFMaterial>(), member_address(&glTFMaterial::alpha_mode), type<glTFAlphaMode>(), "alpha_mode", var(glTFAlphaMode()), Member::Value, nullptr, [](Ref object) { return var(val<glTFMaterial>(object).alpha_mode); }, [](Ref object, Ref value) { member_assign(val<glTFMaterial>(object).alpha_mode, value); } },
+                    { type<glTFMaterial>(), member_address(&glTFMaterial::pbr_metallic_roughness), type<glTFMaterialPBR>(), "pbr_metallic_roughness", var(glTFMaterialPBR()), Member::Value, nullptr, [](Ref object) { return var(val<glTFMaterial>(object).pbr_metallic_roughness); }, [](Ref object, Ref value) { member_assign(val<glTFMaterial>(object).pbr_metallic_roughness, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFMaterial>();
+        });
     }
     
     
@@ -684,37 +742,39 @@ namespace mud
     // glTFMaterialPBR
     {
         static Meta meta = { type<glTFMaterialPBR>(), &namspc({}), "glTFMaterialPBR", sizeof(glTFMaterialPBR), TypeClass::Struct };
-        static Class cls = { type<glTFMaterialPBR>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFMaterialPBR>(), [](Ref ref, Ref other) { new(&val<glTFMaterialPBR>(ref)) glTFMaterialPBR(val<glTFMaterialPBR>(other)); } }
-            },
-            // members
-            {
-                { type<glTFMaterialPBR>(), member_address(&glTFMaterialPBR::base_color_factor), type<mud::vec4>(), "base_color_factor", var(mud::vec4()), Member::Value, nullptr },
-                { type<glTFMaterialPBR>(), member_address(&glTFMaterialPBR::base_color_texture), type<glTFTextureInfo>(), "base_color_texture", var(glTFTextureInfo()), Member::Value, nullptr },
-                { type<glTFMaterialPBR>(), member_address(&glTFMaterialPBR::metallic_factor), type<float>(), "metallic_factor", var(float(1.f)), Member::Value, nullptr },
-                { type<glTFMaterialPBR>(), member_address(&glTFMaterialPBR::roughness_factor), type<float>(), "roughness_factor", var(float(1.f)), Member::Value, nullptr },
-                { type<glTFMaterialPBR>(), member_address(&glTFMaterialPBR::metallic_roughness_texture), type<glTFTextureInfo>(), "metallic_roughness_texture", var(glTFTextureInfo()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFMaterialPBR>();
+        lazy_class<glTFMaterialPBR>([] {
+            static Class cls = { type<glTFMaterialPBR>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFMaterialPBR>(), [](Ref ref, Ref other) { new(&val<glTFMaterialPBR>(ref)) glTFMaterialPBR(val<glTFMaterialPBR>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFMaterialPBR>(), member_address(&glTFMaterialPBR::base_color_factor), type<mud::vec4>(), "base_color_factor", var(mud::vec4()), Member::Value, nullptr, [](Ref object) { return var(val<glTFMaterialPBR>(object).base_color_factor); }, [](Ref object, Ref value) { member_assign(val<glTFMaterialPBR>(object).base_color_factor, value); } },
+                    { type<glTFMaterialPBR>(), member_address(&glTFMaterialPBR::base_color_texture), type<glTFTextureInfo>(), "base_color_texture", var(glTFTextureInfo()), Member::Value, nullptr, [](Ref object) { return var(val<glTFMaterialPBR>(object).base_color_texture); }, [](Ref object, Ref value) { member_assign(val<glTFMaterialPBR>(object).base_color_texture, value); } },
+                    { type<glTFMaterialPBR>(), member_address(&glTFMaterialPBR::metallic_factor), type<float>(), "metallic_factor", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<glTFMaterialPBR>(object).metallic_factor); }, [](Ref object, Ref value) { member_assign(val<glTFMaterialPBR>(object).metallic_factor, value); } },
+                    { type<glTFMaterialPBR>(), member_address(&glTFMaterialPBR::roughness_factor), type<float>(), "roughness_factor", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<glTFMaterialPBR>(object).roughness_factor); }, [](Ref object, Ref value) { member_assign(val<glTFMaterialPBR>(object).roughness_factor, value); } },
+                    { type<glTFMaterialPBR>(), member_address(&glTFMaterialPBR::metallic_roughness_texture), type<glTFTextureInfo>(), "metallic_roughness_texture", var(glTFTextureInfo()), Member::Value, nullptr, [](Ref object) { return var(val<glTFMaterialPBR>(object).metallic_roughness_texture); }, [](Ref object, Ref value) { member_assign(val<glTFMaterialPBR>(object).metallic_roughness_texture, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFMaterialPBR>();
+        });
     }
     
     
@@ -722,34 +782,36 @@ namespace mud
     // glTFMesh
     {
         static Meta meta = { type<glTFMesh>(), &namspc({}), "glTFMesh", sizeof(glTFMesh), TypeClass::Struct };
-        static Class cls = { type<glTFMesh>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFMesh>(), [](Ref ref, Ref other) { new(&val<glTFMesh>(ref)) glTFMesh(val<glTFMesh>(other)); } }
-            },
-            // members
-            {
-                { type<glTFMesh>(), member_address(&glTFMesh::primitives), type<std::vector<glTFPrimitive>>(), "primitives", var(std::vector<glTFPrimitive>()), Member::Value, nullptr },
-                { type<glTFMesh>(), member_address(&glTFMesh::weights), type<std::vector<float>>(), "weights", var(std::vector<float>()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFMesh>();
+        lazy_class<glTFMesh>([] {
+            static Class cls = { type<glTFMesh>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFMesh>(), [](Ref ref, Ref other) { new(&val<glTFMesh>(ref)) glTFMesh(val<glTFMesh>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFMesh>(), member_address(&glTFMesh::primitives), type<std::vector<glTFPrimitive>>(), "primitives", var(std::vector<glTFPrimitive>()), Member::Value, nullptr, [](Ref object) { return var(val<glTFMesh>(object).primitives); }, [](Ref object, Ref value) { member_assign(val<glTFMesh>(object).primitives, value); } },
+                    { type<glTFMesh>(), member_address(&glTFMesh::weights), type<std::vector<float>>(), "weights", var(std::vector<float>()), Member::Value, nullptr, [](Ref object) { return var(val<glTFMesh>(object).weights); }, [](Ref object, Ref value) { member_assign(val<glTFMesh>(object).weights, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFMesh>();
+        });
     }
     
     
@@ -757,35 +819,37 @@ namespace mud
     // glTFMorphTarget
     {
         static Meta meta = { type<glTFMorphTarget>(), &namspc({}), "glTFMorphTarget", sizeof(glTFMorphTarget), TypeClass::Struct };
-        static Class cls = { type<glTFMorphTarget>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFMorphTarget>(), [](Ref ref, Ref other) { new(&val<glTFMorphTarget>(ref)) glTFMorphTarget(val<glTFMorphTarget>(other)); } }
-            },
-            // members
-            {
-                { type<glTFMorphTarget>(), member_address(&glTFMorphTarget::POSITION), type<int>(), "POSITION", var(int()), Member::Value, nullptr },
-                { type<glTFMorphTarget>(), member_address(&glTFMorphTarget::NORMAL), type<int>(), "NORMAL", var(int()), Member::Value, nullptr },
-                { type<glTFMorphTarget>(), member_address(&glTFMorphTarget::TANGENT), type<int>(), "TANGENT", var(int()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFMorphTarget>();
+        lazy_class<glTFMorphTarget>([] {
+            static Class cls = { type<glTFMorphTarget>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFMorphTarget>(), [](Ref ref, Ref other) { new(&val<glTFMorphTarget>(ref)) glTFMorphTarget(val<glTFMorphTarget>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFMorphTarget>(), member_address(&glTFMorphTarget::POSITION), type<int>(), "POSITION", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFMorphTarget>(object).POSITION); }, [](Ref object, Ref value) { member_assign(val<glTFMorphTarget>(object).POSITION, value); } },
+                    { type<glTFMorphTarget>(), member_address(&glTFMorphTarget::NORMAL), type<int>(), "NORMAL", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFMorphTarget>(object).NORMAL); }, [](Ref object, Ref value) { member_assign(val<glTFMorphTarget>(object).NORMAL, value); } },
+                    { type<glTFMorphTarget>(), member_address(&glTFMorphTarget::TANGENT), type<int>(), "TANGENT", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFMorphTarget>(object).TANGENT); }, [](Ref object, Ref value) { member_assign(val<glTFMorphTarget>(object).TANGENT, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFMorphTarget>();
+        });
     }
     
     
@@ -793,41 +857,43 @@ namespace mud
     // glTFNode
     {
         static Meta meta = { type<glTFNode>(), &namspc({}), "glTFNode", sizeof(glTFNode), TypeClass::Struct };
-        static Class cls = { type<glTFNode>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFNode>(), [](Ref ref, Ref other) { new(&val<glTFNode>(ref)) glTFNode(val<glTFNode>(other)); } }
-            },
-            // members
-            {
-                { type<glTFNode>(), member_address(&glTFNode::name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr },
-                { type<glTFNode>(), member_address(&glTFNode::mesh), type<int>(), "mesh", var(int()), Member::Value, nullptr },
-                { type<glTFNode>(), member_address(&glTFNode::camera), type<int>(), "camera", var(int()), Member::Value, nullptr },
-                { type<glTFNode>(), member_address(&glTFNode::skin), type<int>(), "skin", var(int()), Member::Value, nullptr },
-                { type<glTFNode>(), member_address(&glTFNode::matrix), type<mud::mat4>(), "matrix", var(mud::mat4()), Member::Value, nullptr },
-                { type<glTFNode>(), member_address(&glTFNode::translation), type<mud::vec3>(), "translation", var(mud::vec3()), Member::Value, nullptr },
-                { type<glTFNode>(), member_address(&glTFNode::rotation), type<mud::quat>(), "rotation", var(mud::quat()), Member::Value, nullptr },
-                { type<glTFNode>(), member_address(&glTFNode::scale), type<mud::vec3>(), "scale", var(mud::vec3()), Member::Value, nullptr },
-                { type<glTFNode>(), member_address(&glTFNode::children), type<std::vector<int>>(), "children", var(std::vector<int>()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFNode>();
+        lazy_class<glTFNode>([] {
+            static Class cls = { type<glTFNode>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFNode>(), [](Ref ref, Ref other) { new(&val<glTFNode>(ref)) glTFNode(val<glTFNode>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFNode>(), member_address(&glTFNode::name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<glTFNode>(object).name); }, [](Ref object, Ref value) { member_assign(val<glTFNode>(object).name, value); } },
+                    { type<glTFNode>(), member_address(&glTFNode::mesh), type<int>(), "mesh", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFNode>(object).mesh); }, [](Ref object, Ref value) { member_assign(val<glTFNode>(object).mesh, value); } },
+                    { type<glTFNode>(), member_address(&glTFNode::camera), type<int>(), "camera", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFNode>(object).camera); }, [](Ref object, Ref value) { member_assign(val<glTFNode>(object).camera, value); } },
+                    { type<glTFNode>(), member_address(&glTFNode::skin), type<int>(), "skin", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFNode>(object).skin); }, [](Ref object, Ref value) { member_assign(val<glTFNode>(object).skin, value); } },
+                    { type<glTFNode>(), member_address(&glTFNode::matrix), type<mud::mat4>(), "matrix", var(mud::mat4()), Member::Value, nullptr, [](Ref object) { return var(val<glTFNode>(object).matrix); }, [](Ref object, Ref value) { member_assign(val<glTFNode>(object).matrix, value); } },
+                    { type<glTFNode>(), member_address(&glTFNode::translation), type<mud::vec3>(), "translation", var(mud::vec3()), Member::Value, nullptr, [](Ref object) { return var(val<glTFNode>(object).translation); }, [](Ref object, Ref value) { member_assign(val<glTFNode>(object).translation, value); } },
+                    { type<glTFNode>(), member_address(&glTFNode::rotation), type<mud::quat>(), "rotation", var(mud::quat()), Member::Value, nullptr, [](Ref object) { return var(val<glTFNode>(object).rotation); }, [](Ref object, Ref value) { member_assign(val<glTFNode>(object).rotation, value); } },
+                    { type<glTFNode>(), member_address(&glTFNode::scale), type<mud::vec3>(), "scale", var(mud::vec3()), Member::Value, nullptr, [](Ref object) { return var(val<glTFNode>(object).scale); }, [](Ref object, Ref value) { member_assign(val<glTFNode>(object).scale, value); } },
+                    { type<glTFNode>(), member_address(&glTFNode::children), type<std::vector<int>>(), "children", var(std::vector<int>()), Member::Value, nullptr, [](Ref object) { return var(val<glTFNode>(object).children); }, [](Ref object, Ref value) { member_assign(val<glTFNode>(object).children, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFNode>();
+        });
     }
     
     
@@ -835,36 +901,38 @@ namespace mud
     // glTFOrthographic
     {
         static Meta meta = { type<glTFOrthographic>(), &namspc({}), "glTFOrthographic", sizeof(glTFOrthographic), TypeClass::Struct };
-        static Class cls = { type<glTFOrthographic>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFOrthographic>(), [](Ref ref, Ref other) { new(&val<glTFOrthographic>(ref)) glTFOrthographic(val<glTFOrthographic>(other)); } }
-            },
-            // members
-            {
-                { type<glTFOrthographic>(), member_address(&glTFOrthographic::xmag), type<float>(), "xmag", var(float()), Member::Value, nullptr },
-                { type<glTFOrthographic>(), member_address(&glTFOrthographic::ymag), type<float>(), "ymag", var(float()), Member::Value, nullptr },
-                { type<glTFOrthographic>(), member_address(&glTFOrthographic::zfar), type<float>(), "zfar", var(float()), Member::Value, nullptr },
-                { type<glTFOrthographic>(), member_address(&glTFOrthographic::znear), type<float>(), "znear", var(float()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFOrthographic>();
+        lazy_class<glTFOrthographic>([] {
+            static Class cls = { type<glTFOrthographic>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFOrthographic>(), [](Ref ref, Ref other) { new(&val<glTFOrthographic>(ref)) glTFOrthographic(val<glTFOrthographic>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFOrthographic>(), member_address(&glTFOrthographic::xmag), type<float>(), "xmag", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<glTFOrthographic>(object).xmag); }, [](Ref object, Ref value) { member_assign(val<glTFOrthographic>(object).xmag, value); } },
+                    { type<glTFOrthographic>(), member_address(&glTFOrthographic::ymag), type<float>(), "ymag", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<glTFOrthographic>(object).ymag); }, [](Ref object, Ref value) { member_assign(val<glTFOrthographic>(object).ymag, value); } },
+                    { type<glTFOrthographic>(), member_address(&glTFOrthographic::zfar), type<float>(), "zfar", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<glTFOrthographic>(object).zfar); }, [](Ref object, Ref value) { member_assign(val<glTFOrthographic>(object).zfar, value); } },
+                    { type<glTFOrthographic>(), member_address(&glTFOrthographic::znear), type<float>(), "znear", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<glTFOrthographic>(object).znear); }, [](Ref object, Ref value) { member_assign(val<glTFOrthographic>(object).znear, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFOrthographic>();
+        });
     }
     
     
@@ -872,36 +940,38 @@ namespace mud
     // glTFPerspective
     {
         static Meta meta = { type<glTFPerspective>(), &namspc({}), "glTFPerspective", sizeof(glTFPerspective), TypeClass::Struct };
-        static Class cls = { type<glTFPerspective>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFPerspective>(), [](Ref ref, Ref other) { new(&val<glTFPerspective>(ref)) glTFPerspective(val<glTFPerspective>(other)); } }
-            },
-            // members
-            {
-                { type<glTFPerspective>(), member_address(&glTFPerspective::yfov), type<float>(), "yfov", var(float()), Member::Value, nullptr },
-                { type<glTFPerspective>(), member_address(&glTFPerspective::zfar), type<float>(), "zfar", var(float()), Member::Value, nullptr },
-                { type<glTFPerspective>(), member_address(&glTFPerspective::znear), type<float>(), "znear", var(float()), Member::Value, nullptr },
-                { type<glTFPerspective>(), member_address(&glTFPerspective::aspect_ration), type<float>(), "aspect_ration", var(float()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFPerspective>();
+        lazy_class<glTFPerspective>([] {
+            static Class cls = { type<glTFPerspective>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFPerspective>(), [](Ref ref, Ref other) { new(&val<glTFPerspective>(ref)) glTFPerspective(val<glTFPerspective>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFPerspective>(), member_address(&glTFPerspective::yfov), type<float>(), "yfov", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<glTFPerspective>(object).yfov); }, [](Ref object, Ref value) { member_assign(val<glTFPerspective>(object).yfov, value); } },
+                    { type<glTFPerspective>(), member_address(&glTFPerspective::zfar), type<float>(), "zfar", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<glTFPerspective>(object).zfar); }, [](Ref object, Ref value) { member_assign(val<glTFPerspective>(object).zfar, value); } },
+                    { type<glTFPerspective>(), member_address(&glTFPerspective::znear), type<float>(), "znear", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<glTFPerspective>(object).znear); }, [](Ref object, Ref value) { member_assign(val<glTFPerspective>(object).znear, value); } },
+                    { type<glTFPerspective>(), member_address(&glTFPerspective::aspect_ration), type<float>(), "aspect_ration", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<glTFPerspective>(object).aspect_ration); }, [](Ref object, Ref value) { member_assign(val<glTFPerspective>(object).aspect_ration, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFPerspective>();
+        });
     }
     
     
@@ -909,37 +979,39 @@ namespace mud
     // glTFPrimitive
     {
         static Meta meta = { type<glTFPrimitive>(), &namspc({}), "glTFPrimitive", sizeof(glTFPrimitive), TypeClass::Struct };
-        static Class cls = { type<glTFPrimitive>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFPrimitive>(), [](Ref ref, Ref other) { new(&val<glTFPrimitive>(ref)) glTFPrimitive(val<glTFPrimitive>(other)); } }
-            },
-            // members
-            {
-                { type<glTFPrimitive>(), member_address(&glTFPrimitive::attributes), type<glTFAttributes>(), "attributes", var(glTFAttributes()), Member::Value, nullptr },
-                { type<glTFPrimitive>(), member_address(&glTFPrimitive::indices), type<int>(), "indices", var(int()), Member::Value, nullptr },
-                { type<glTFPrimitive>(), member_address(&glTFPrimitive::material), type<int>(), "material", var(int()), Member::Value, nullptr },
-                { type<glTFPrimitive>(), member_address(&glTFPrimitive::mode), type<glTFPrimitiveType>(), "mode", var(glTFPrimitiveType()), Member::Value, nullptr },
-                { type<glTFPrimitive>(), member_address(&glTFPrimitive::targets), type<std::vector<glTFMorphTarget>>(), "targets", var(std::vector<glTFMorphTarget>()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFPrimitive>();
+        lazy_class<glTFPrimitive>([] {
+            static Class cls = { type<glTFPrimitive>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFPrimitive>(), [](Ref ref, Ref other) { new(&val<glTFPrimitive>(ref)) glTFPrimitive(val<glTFPrimitive>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFPrimitive>(), member_address(&glTFPrimitive::attributes), type<glTFAttributes>(), "attributes", var(glTFAttributes()), Member::Value, nullptr, [](Ref object) { return var(val<glTFPrimitive>(object).attributes); }, [](Ref object, Ref value) { member_assign(val<glTFPrimitive>(object).attributes, value); } },
+                    { type<glTFPrimitive>(), member_address(&glTFPrimitive::indices), type<int>(), "indices", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFPrimitive>(object).indices); }, [](Ref object, Ref value) { member_assign(val<glTFPrimitive>(object).indices, value); } },
+                    { type<glTFPrimitive>(), member_address(&glTFPrimitive::material), type<int>(), "material", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFPrimitive>(object).material); }, [](Ref object, Ref value) { member_assign(val<glTFPrimitive>(object).material, value); } },
+                    { type<glTFPrimitive>(), member_address(&glTFPrimitive::mode), type<glTFPrimitiveType>(), "mode", var(glTFPrimitiveType()), Member::Value, nullptr, [](Ref object) { return var(val<glTFPrimitive>(object).mode); }, [](Ref object, Ref value) { member_assign(val<glTFPrimitive>(object).mode, value); } },
+                    { type<glTFPrimitive>(), member_address(&glTFPrimitive::targets), type<std::vector<glTFMorphTarget>>(), "targets", var(std::vector<glTFMorphTarget>()), Member::Value, nullptr, [](Ref object) { return var(val<glTFPrimitive>(object).targets); }, [](Ref object, Ref value) { member_assign(val<glTFPrimitive>(object).targets, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFPrimitive>();
+        });
     }
     
     
@@ -947,37 +1019,39 @@ namespace mud
     // glTFSampler
     {
         static Meta meta = { type<glTFSampler>(), &namspc({}), "glTFSampler", sizeof(glTFSampler), TypeClass::Struct };
-        static Class cls = { type<glTFSampler>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFSampler>(), [](Ref ref, Ref other) { new(&val<glTFSampler>(ref)) glTFSampler(val<glTFSampler>(other)); } }
-            },
-            // members
-            {
-                { type<glTFSampler>(), member_address(&glTFSampler::mag_filter), type<int>(), "mag_filter", var(int()), Member::Value, nullptr },
-                { type<glTFSampler>(), member_address(&glTFSampler::min_filter), type<int>(), "min_filter", var(int()), Member::Value, nullptr },
-                { type<glTFSampler>(), member_address(&glTFSampler::wrap_s), type<int>(), "wrap_s", var(int(10497)), Member::Value, nullptr },
-                { type<glTFSampler>(), member_address(&glTFSampler::wrap_t), type<int>(), "wrap_t", var(int(10497)), Member::Value, nullptr },
-                { type<glTFSampler>(), member_address(&glTFSampler::name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFSampler>();
+        lazy_class<glTFSampler>([] {
+            static Class cls = { type<glTFSampler>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFSampler>(), [](Ref ref, Ref other) { new(&val<glTFSampler>(ref)) glTFSampler(val<glTFSampler>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFSampler>(), member_address(&glTFSampler::mag_filter), type<int>(), "mag_filter", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFSampler>(object).mag_filter); }, [](Ref object, Ref value) { member_assign(val<glTFSampler>(object).mag_filter, value); } },
+                    { type<glTFSampler>(), member_address(&glTFSampler::min_filter), type<int>(), "min_filter", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFSampler>(object).min_filter); }, [](Ref object, Ref value) { member_assign(val<glTFSampler>(object).min_filter, value); } },
+                    { type<glTFSampler>(), member_address(&glTFSampler::wrap_s), type<int>(), "wrap_s", var(int(10497)), Member::Value, nullptr, [](Ref object) { return var(val<glTFSampler>(object).wrap_s); }, [](Ref object, Ref value) { member_assign(val<glTFSampler>(object).wrap_s, value); } },
+                    { type<glTFSampler>(), member_address(&glTFSampler::wrap_t), type<int>(), "wrap_t", var(int(10497)), Member::Value, nullptr, [](Ref object) { return var(val<glTFSampler>(object).wrap_t); }, [](Ref object, Ref value) { member_assign(val<glTFSampler>(object).wrap_t, value); } },
+                    { type<glTFSampler>(), member_address(&glTFSampler::name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<glTFSampler>(object).name); }, [](Ref object, Ref value) { member_assign(val<glTFSampler>(object).name, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFSampler>();
+        });
     }
     
     
@@ -985,34 +1059,36 @@ namespace mud
     // glTFScene
     {
         static Meta meta = { type<glTFScene>(), &namspc({}), "glTFScene", sizeof(glTFScene), TypeClass::Struct };
-        static Class cls = { type<glTFScene>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFScene>(), [](Ref ref, Ref other) { new(&val<glTFScene>(ref)) glTFScene(val<glTFScene>(other)); } }
-            },
-            // members
-            {
-                { type<glTFScene>(), member_address(&glTFScene::name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr },
-                { type<glTFScene>(), member_address(&glTFScene::nodes), type<std::vector<int>>(), "nodes", var(std::vector<int>()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFScene>();
+        lazy_class<glTFScene>([] {
+            static Class cls = { type<glTFScene>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFScene>(), [](Ref ref, Ref other) { new(&val<glTFScene>(ref)) glTFScene(val<glTFScene>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFScene>(), member_address(&glTFScene::name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<glTFScene>(object).name); }, [](Ref object, Ref value) { member_assign(val<glTFScene>(object).name, value); } },
+                    { type<glTFScene>(), member_address(&glTFScene::nodes), type<std::vector<int>>(), "nodes", var(std::vector<int>()), Member::Value, nullptr, [](Ref object) { return var(val<glTFScene>(object).nodes); }, [](Ref object, Ref value) { member_assign(val<glTFScene>(object).nodes, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFScene>();
+        });
     }
     
     
@@ -1020,36 +1096,38 @@ namespace mud
     // glTFSkin
     {
         static Meta meta = { type<glTFSkin>(), &namspc({}), "glTFSkin", sizeof(glTFSkin), TypeClass::Struct };
-        static Class cls = { type<glTFSkin>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFSkin>(), [](Ref ref, Ref other) { new(&val<glTFSkin>(ref)) glTFSkin(val<glTFSkin>(other)); } }
-            },
-            // members
-            {
-                { type<glTFSkin>(), member_address(&glTFSkin::name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr },
-                { type<glTFSkin>(), member_address(&glTFSkin::skeleton), type<int>(), "skeleton", var(int()), Member::Value, nullptr },
-                { type<glTFSkin>(), member_address(&glTFSkin::joints), type<std::vector<int>>(), "joints", var(std::vector<int>()), Member::Value, nullptr },
-                { type<glTFSkin>(), member_address(&glTFSkin::inverse_bind_matrices), type<int>(), "inverse_bind_matrices", var(int()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFSkin>();
+        lazy_class<glTFSkin>([] {
+            static Class cls = { type<glTFSkin>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFSkin>(), [](Ref ref, Ref other) { new(&val<glTFSkin>(ref)) glTFSkin(val<glTFSkin>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFSkin>(), member_address(&glTFSkin::name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<glTFSkin>(object).name); }, [](Ref object, Ref value) { member_assign(val<glTFSkin>(object).name, value); } },
+                    { type<glTFSkin>(), member_address(&glTFSkin::skeleton), type<int>(), "skeleton", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFSkin>(object).skeleton); }, [](Ref object, Ref value) { member_assign(val<glTFSkin>(object).skeleton, value); } },
+                    { type<glTFSkin>(), member_address(&glTFSkin::joints), type<std::vector<int>>(), "joints", var(std::vector<int>()), Member::Value, nullptr, [](Ref object) { return var(val<glTFSkin>(object).joints); }, [](Ref object, Ref value) { member_assign(val<glTFSkin>(object).joints, value); } },
+                    { type<glTFSkin>(), member_address(&glTFSkin::inverse_bind_matrices), type<int>(), "inverse_bind_matrices", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFSkin>(object).inverse_bind_matrices); }, [](Ref object, Ref value) { member_assign(val<glTFSkin>(object).inverse_bind_matrices, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFSkin>();
+        });
     }
     
     
@@ -1057,35 +1135,37 @@ namespace mud
     // glTFSparse
     {
         static Meta meta = { type<glTFSparse>(), &namspc({}), "glTFSparse", sizeof(glTFSparse), TypeClass::Struct };
-        static Class cls = { type<glTFSparse>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFSparse>(), [](Ref ref, Ref other) { new(&val<glTFSparse>(ref)) glTFSparse(val<glTFSparse>(other)); } }
-            },
-            // members
-            {
-                { type<glTFSparse>(), member_address(&glTFSparse::count), type<int>(), "count", var(int(0)), Member::Value, nullptr },
-                { type<glTFSparse>(), member_address(&glTFSparse::indices), type<glTFSparseIndices>(), "indices", var(glTFSparseIndices()), Member::Value, nullptr },
-                { type<glTFSparse>(), member_address(&glTFSparse::values), type<glTFSparseValues>(), "values", var(glTFSparseValues()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFSparse>();
+        lazy_class<glTFSparse>([] {
+            static Class cls = { type<glTFSparse>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFSparse>(), [](Ref ref, Ref other) { new(&val<glTFSparse>(ref)) glTFSparse(val<glTFSparse>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFSparse>(), member_address(&glTFSparse::count), type<int>(), "count", var(int(0)), Member::Value, nullptr, [](Ref object) { return var(val<glTFSparse>(object).count); }, [](Ref object, Ref value) { member_assign(val<glTFSparse>(object).count, value); } },
+                    { type<glTFSparse>(), member_address(&glTFSparse::indices), type<glTFSparseIndices>(), "indices", var(glTFSparseIndices()), Member::Value, nullptr, [](Ref object) { return var(val<glTFSparse>(object).indices); }, [](Ref object, Ref value) { member_assign(val<glTFSparse>(object).indices, value); } },
+                    { type<glTFSparse>(), member_address(&glTFSparse::values), type<glTFSparseValues>(), "values", var(glTFSparseValues()), Member::Value, nullptr, [](Ref object) { return var(val<glTFSparse>(object).values); }, [](Ref object, Ref value) { member_assign(val<glTFSparse>(object).values, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFSparse>();
+        });
     }
     
     
@@ -1093,35 +1173,37 @@ namespace mud
     // glTFSparseIndices
     {
         static Meta meta = { type<glTFSparseIndices>(), &namspc({}), "glTFSparseIndices", sizeof(glTFSparseIndices), TypeClass::Struct };
-        static Class cls = { type<glTFSparseIndices>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFSparseIndices>(), [](Ref ref, Ref other) { new(&val<glTFSparseIndices>(ref)) glTFSparseIndices(val<glTFSparseIndices>(other)); } }
-            },
-            // members
-            {
-                { type<glTFSparseIndices>(), member_address(&glTFSparseIndices::buffer_view), type<int>(), "buffer_view", var(int()), Member::Value, nullptr },
-                { type<glTFSparseIndices>(), member_address(&glTFSparseIndices::byte_offset), type<int>(), "byte_offset", var(int(0)), Member::Value, nullptr },
-                { type<glTFSparseIndices>(), member_address(&glTFSparseIndices::component_type), type<glTFComponentType>(), "component_type", var(glTFComponentType()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFSparseIndices>();
+        lazy_class<glTFSparseIndices>([] {
+            static Class cls = { type<glTFSparseIndices>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFSparseIndices>(), [](Ref ref, Ref other) { new(&val<glTFSparseIndices>(ref)) glTFSparseIndices(val<glTFSparseIndices>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFSparseIndices>(), member_address(&glTFSparseIndices::buffer_view), type<int>(), "buffer_view", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFSparseIndices>(object).buffer_view); }, [](Ref object, Ref value) { member_assign(val<glTFSparseIndices>(object).buffer_view, value); } },
+                    { type<glTFSparseIndices>(), member_address(&glTFSparseIndices::byte_offset), type<int>(), "byte_offset", var(int(0)), Member::Value, nullptr, [](Ref object) { return var(val<glTFSparseIndices>(object).byte_offset); }, [](Ref object, Ref value) { member_assign(val<glTFSparseIndices>(object).byte_offset, value); } },
+                    { type<glTFSparseIndices>(), member_address(&glTFSparseIndices::component_type), type<glTFComponentType>(), "component_type", var(glTFComponentType()), Member::Value, nullptr, [](Ref object) { return var(val<glTFSparseIndices>(object).component_type); }, [](Ref object, Ref value) { member_assign(val<glTFSparseIndices>(object).component_type, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFSparseIndices>();
+        });
     }
     
     
@@ -1129,34 +1211,36 @@ namespace mud
     // glTFSparseValues
     {
         static Meta meta = { type<glTFSparseValues>(), &namspc({}), "glTFSparseValues", sizeof(glTFSparseValues), TypeClass::Struct };
-        static Class cls = { type<glTFSparseValues>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFSparseValues>(), [](Ref ref, Ref other) { new(&val<glTFSparseValues>(ref)) glTFSparseValues(val<glTFSparseValues>(other)); } }
-            },
-            // members
-            {
-                { type<glTFSparseValues>(), member_address(&glTFSparseValues::buffer_view), type<int>(), "buffer_view", var(int()), Member::Value, nullptr },
-                { type<glTFSparseValues>(), member_address(&glTFSparseValues::byte_offset), type<int>(), "byte_offset", var(int(0)), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFSparseValues>();
+        lazy_class<glTFSparseValues>([] {
+            static Class cls = { type<glTFSparseValues>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFSparseValues>(), [](Ref ref, Ref other) { new(&val<glTFSparseValues>(ref)) glTFSparseValues(val<glTFSparseValues>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFSparseValues>(), member_address(&glTFSparseValues::buffer_view), type<int>(), "buffer_view", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFSparseValues>(object).buffer_view); }, [](Ref object, Ref value) { member_assign(val<glTFSparseValues>(object).buffer_view, value); } },
+                    { type<glTFSparseValues>(), member_address(&glTFSparseValues::byte_offset), type<int>(), "byte_offset", var(int(0)), Member::Value, nullptr, [](Ref object) { return var(val<glTFSparseValues>(object).byte_offset); }, [](Ref object, Ref value) { member_assign(val<glTFSparseValues>(object).byte_offset, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFSparseValues>();
+        });
     }
     
     
@@ -1164,34 +1248,36 @@ namespace mud
     // glTFTexture
     {
         static Meta meta = { type<glTFTexture>(), &namspc({}), "glTFTexture", sizeof(glTFTexture), TypeClass::Struct };
-        static Class cls = { type<glTFTexture>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFTexture>(), [](Ref ref, Ref other) { new(&val<glTFTexture>(ref)) glTFTexture(val<glTFTexture>(other)); } }
-            },
-            // members
-            {
-                { type<glTFTexture>(), member_address(&glTFTexture::source), type<int>(), "source", var(int()), Member::Value, nullptr },
-                { type<glTFTexture>(), member_address(&glTFTexture::name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFTexture>();
+        lazy_class<glTFTexture>([] {
+            static Class cls = { type<glTFTexture>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFTexture>(), [](Ref ref, Ref other) { new(&val<glTFTexture>(ref)) glTFTexture(val<glTFTexture>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFTexture>(), member_address(&glTFTexture::source), type<int>(), "source", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFTexture>(object).source); }, [](Ref object, Ref value) { member_assign(val<glTFTexture>(object).source, value); } },
+                    { type<glTFTexture>(), member_address(&glTFTexture::name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<glTFTexture>(object).name); }, [](Ref object, Ref value) { member_assign(val<glTFTexture>(object).name, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFTexture>();
+        });
     }
     
     
@@ -1199,34 +1285,36 @@ namespace mud
     // glTFTextureInfo
     {
         static Meta meta = { type<glTFTextureInfo>(), &namspc({}), "glTFTextureInfo", sizeof(glTFTextureInfo), TypeClass::Struct };
-        static Class cls = { type<glTFTextureInfo>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<glTFTextureInfo>(), [](Ref ref, Ref other) { new(&val<glTFTextureInfo>(ref)) glTFTextureInfo(val<glTFTextureInfo>(other)); } }
-            },
-            // members
-            {
-                { type<glTFTextureInfo>(), member_address(&glTFTextureInfo::index), type<int>(), "index", var(int()), Member::Value, nullptr },
-                { type<glTFTextureInfo>(), member_address(&glTFTextureInfo::scale), type<float>(), "scale", var(float(1.f)), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<glTFTextureInfo>();
+        lazy_class<glTFTextureInfo>([] {
+            static Class cls = { type<glTFTextureInfo>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<glTFTextureInfo>(), [](Ref ref, Ref other) { new(&val<glTFTextureInfo>(ref)) glTFTextureInfo(val<glTFTextureInfo>(other)); } }
+                },
+                // members
+                {
+                    { type<glTFTextureInfo>(), member_address(&glTFTextureInfo::index), type<int>(), "index", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<glTFTextureInfo>(object).index); }, [](Ref object, Ref value) { member_assign(val<glTFTextureInfo>(object).index, value); } },
+                    { type<glTFTextureInfo>(), member_address(&glTFTextureInfo::scale), type<float>(), "scale", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<glTFTextureInfo>(object).scale); }, [](Ref object, Ref value) { member_assign(val<glTFTextureInfo>(object).scale, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<glTFTextureInfo>();
+        });
     }
     
 
@@ -38,36 +38,38 @@ namespace mud
     // mud::BCS
     {
         static Meta meta = { type<mud::BCS>(), &namspc({ "mud" }), "BCS", sizeof(mud::BCS), TypeClass::Struct };
-        static Class cls = { type<mud::BCS>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::BCS>(), [](Ref ref, Ref other) { new(&val<mud::BCS>(ref)) mud::BCS(val<mud::BCS>(other)); } }
-            },
-            // members
-            {
-                { type<mud::BCS>(), member_address(&mud::BCS::m_enabled), type<bool>(), "enabled", var(bool(false)), Member::Value, nullptr },
-                { type<mud::BCS>(), member_address(&mud::BCS::m_brightness), type<float>(), "brightness", var(float(1.0f)), Member::Value, nullptr },
-                { type<mud::BCS>(), member_address(&mud::BCS::m_contrast), type<float>(), "contrast", var(float(1.0f)), Member::Value, nullptr },
-                { type<mud::BCS>(), member_address(&mud::BCS::m_saturation), type<float>(), "saturation", var(float(1.0f)), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::BCS>();
+        lazy_class<mud::BCS>([] {
+            static Class cls = { type<mud::BCS>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::BCS>(), [](Ref ref, Ref other) { new(&val<mud::BCS>(ref)) mud::BCS(val<mud::BCS>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::BCS>(), member_address(&mud::BCS::m_enabled), type<bool>(), "enabled", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::BCS>(object).m_enabled); }, [](Ref object, Ref value) { member_assign(val<mud::BCS>(object).m_enabled, value); } },
+                    { type<mud::BCS>(), member_address(&mud::BCS::m_brightness), type<float>(), "brightness", var(float(1.0f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::BCS>(object).m_brightness); }, [](Ref object, Ref value) { member_assign(val<mud::BCS>(object).m_brightness, value); } },
+                    { type<mud::BCS>(), member_address(&mud::BCS::m_contrast), type<float>(), "contrast", var(float(1.0f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::BCS>(object).m_contrast); }, [](Ref object, Ref value) { member_assign(val<mud::BCS>(object).m_contrast, value); } },
+                    { type<mud::BCS>(), member_address(&mud::BCS::m_saturation), type<float>(), "saturation", var(float(1.0f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::BCS>(object).m_saturation); }, [](Ref object, Ref value) { member_assign(val<mud::BCS>(object).m_saturation, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::BCS>();
+        });
     }
     
     
@@ -78,40 +80,42 @@ namespace mud
     // mud::DofBlur
     {
         static Meta meta = { type<mud::DofBlur>(), &namspc({ "mud" }), "DofBlur", sizeof(mud::DofBlur), TypeClass::Struct };
-        static Class cls = { type<mud::DofBlur>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::DofBlur>(), [](Ref ref, Ref other) { new(&val<mud::DofBlur>(ref)) mud::DofBlur(val<mud::DofBlur>(other)); } }
-            },
-            // members
-            {
-                { type<mud::DofBlur>(), member_address(&mud::DofBlur::m_enabled), type<bool>(), "enabled", var(bool(false)), Member::Value, nullptr },
-                { type<mud::DofBlur>(), member_address(&mud::DofBlur::m_far_distance), type<float>(), "far_distance", var(float(10.f)), Member::Value, nullptr },
-                { type<mud::DofBlur>(), member_address(&mud::DofBlur::m_far_transition), type<float>(), "far_transition", var(float(5.f)), Member::Value, nullptr },
-                { type<mud::DofBlur>(), member_address(&mud::DofBlur::m_far_radius), type<float>(), "far_radius", var(float(5.f)), Member::Value, nullptr },
-                { type<mud::DofBlur>(), member_address(&mud::DofBlur::m_near_distance), type<float>(), "near_distance", var(float(2.f)), Member::Value, nullptr },
-                { type<mud::DofBlur>(), member_address(&mud::DofBlur::m_near_transition), type<float>(), "near_transition", var(float(1.f)), Member::Value, nullptr },
-                { type<mud::DofBlur>(), member_address(&mud::DofBlur::m_near_radius), type<float>(), "near_radius", var(float(5.f)), Member::Value, nullptr },
-                { type<mud::DofBlur>(), member_address(&mud::DofBlur::m_max_coc_radius), type<float>(), "max_coc_radius", var(float(8.f)), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::DofBlur>();
+        lazy_class<mud::DofBlur>([] {
+            static Class cls = { type<mud::DofBlur>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::DofBlur>(), [](Ref ref, Ref other) { new(&val<mud::DofBlur>(ref)) mud::DofBlur(val<mud::DofBlur>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::DofBlur>(), member_address(&mud::DofBlur::m_enabled), type<bool>(), "enabled", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::DofBlur>(object).m_enabled); }, [](Ref object, Ref value) { member_assign(val<mud::DofBlur>(object).m_enabled, value); } },
+                    { type<mud::DofBlur>(), member_address(&mud::DofBlur::m_far_distance), type<float>(), "far_distance", var(float(10.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::DofBlur>(object).m_far_distance); }, [](Ref object, Ref value) { member_assign(val<mud::DofBlur>(object).m_far_distance, value); } },
+                    { type<mud::DofBlur>(), member_address(&mud::DofBlur::m_far_transition), type<float>(), "far_transition", var(float(5.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::DofBlur>(object).m_far_transition); }, [](Ref object, Ref value) { member_assign(val<mud::DofBlur>(object).m_far_transition, value); } },
+                    { type<mud::DofBlur>(), member_address(&mud::DofBlur::m_far_radius), type<float>(), "far_radius", var(float(5.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::DofBlur>(object).m_far_radius); }, [](Ref object, Ref value) { member_assign(val<mud::DofBlur>(object).m_far_radius, value); } },
+                    { type<mud::DofBlur>(), member_address(&mud::DofBlur::m_near_distance), type<float>(), "near_distance", var(float(2.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::DofBlur>(object).m_near_distance); }, [](Ref object, Ref value) { member_assign(val<mud::DofBlur>(object).m_near_distance, value); } },
+                    { type<mud::DofBlur>(), member_address(&mud::DofBlur::m_near_transition), type<float>(), "near_transition", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::DofBlur>(object).m_near_transition); }, [](Ref object, Ref value) { member_assign(val<mud::DofBlur>(object).m_near_transition, value); } },
+                    { type<mud::DofBlur>(), member_address(&mud::DofBlur::m_near_radius), type<float>(), "near_radius", var(float(5.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::DofBlur>(object).m_near_radius); }, [](Ref object, Ref value) { member_assign(val<mud::DofBlur>(object).m_near_radius, value); } },
+                    { type<mud::DofBlur>(), member_address(&mud::DofBlur::m_max_coc_radius), type<float>(), "max_coc_radius", var(float(8.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::DofBlur>(object).m_max_coc_radius); }, [](Ref object, Ref value) { member_assign(val<mud::DofBlur>(object).m_max_coc_radius, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::DofBlur>();
+        });
     }
     
     
@@ -122,40 +126,42 @@ namespace mud
     // mud::Glow
     {
         static Meta meta = { type<mud::Glow>(), &namspc({ "mud" }), "Glow", sizeof(mud::Glow), TypeClass::Struct };
-        static Class cls = { type<mud::Glow>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Glow>(), [](Ref ref, Ref other) { new(&val<mud::Glow>(ref)) mud::Glow(val<mud::Glow>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Glow>(), member_address(&mud::Glow::m_enabled), type<bool>(), "enabled", var(bool(false)), Member::Value, nullptr },
-                { type<mud::Glow>(), member_address(&mud::Glow::m_levels_1_4), type<mud::vec4>(), "levels_1_4", var(mud::vec4()), Member::Value, nullptr },
-                { type<mud::Glow>(), member_address(&mud::Glow::m_levels_5_8), type<mud::vec4>(), "levels_5_8", var(mud::vec4()), Member::Value, nullptr },
-                { type<mud::Glow>(), member_address(&mud::Glow::m_intensity), type<float>(), "intensity", var(float(0.4f)), Member::Value, nullptr },
-                { type<mud::Glow>(), member_address(&mud::Glow::m_bloom), type<float>(), "bloom", var(float(0.0f)), Member::Value, nullptr },
-                { type<mud::Glow>(), member_address(&mud::Glow::m_bleed_threshold), type<float>(), "bleed_threshold", var(float(1.0f)), Member::Value, nullptr },
-                { type<mud::Glow>(), member_address(&mud::Glow::m_bleed_scale), type<float>(), "bleed_scale", var(float(2.0f)), Member::Value, nullptr },
-                { type<mud::Glow>(), member_address(&mud::Glow::m_bicubic_filter), type<bool>(), "bicubic_filter", var(bool(false)), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Glow>();
+        lazy_class<mud::Glow>([] {
+            static Class cls = { type<mud::Glow>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Glow>(), [](Ref ref, Ref other) { new(&val<mud::Glow>(ref)) mud::Glow(val<mud::Glow>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Glow>(), member_address(&mud::Glow::m_enabled), type<bool>(), "enabled", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Glow>(object).m_enabled); }, [](Ref object, Ref value) { member_assign(val<mud::Glow>(object).m_enabled, value); } },
+                    { type<mud::Glow>(), member_address(&mud::Glow::m_levels_1_4), type<mud::vec4>(), "levels_1_4", var(mud::vec4()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Glow>(object).m_levels_1_4); }, [](Ref object, Ref value) { member_assign(val<mud::Glow>(object).m_levels_1_4, value); } },
+                    { type<mud::Glow>(), member_address(&mud::Glow::m_levels_5_8), type<mud::vec4>(), "levels_5_8", var(mud::vec4()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Glow>(object).m_levels_5_8); }, [](Ref object, Ref value) { member_assign(val<mud::Glow>(object).m_levels_5_8, value); } },
+                    { type<mud::Glow>(), member_address(&mud::Glow::m_intensity), type<float>(), "intensity", var(float(0.4f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Glow>(object).m_intensity); }, [](Ref object, Ref value) { member_assign(val<mud::Glow>(object).m_intensity, value); } },
+                    { type<mud::Glow>(), member_address(&mud::Glow::m_bloom), type<float>(), "bloom", var(float(0.0f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Glow>(object).m_bloom); }, [](Ref object, Ref value) { member_assign(val<mud::Glow>(object).m_bloom, value); } },
+                    { type<mud::Glow>(), member_address(&mud::Glow::m_bleed_threshold), type<float>(), "bleed_threshold", var(float(1.0f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Glow>(object).m_bleed_threshold); }, [](Ref object, Ref value) { member_assign(val<mud::Glow>(object).m_bleed_threshold, value); } },
+                    { type<mud::Glow>(), member_address(&mud::Glow::m_bleed_scale), type<float>(), "bleed_scale", var(float(2.0f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Glow>(object).m_bleed_scale); }, [](Ref object, Ref value) { member_assign(val<mud::Glow>(object).m_bleed_scale, value); } },
+                    { type<mud::Glow>(), member_address(&mud::Glow::m_bicubic_filter), type<bool>(), "bicubic_filter", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Glow>(object).m_bicubic_filter); }, [](Ref object, Ref value) { member_assign(val<mud::Glow>(object).m_bicubic_filter, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Glow>();
+        });
     }
     
     
@@ -166,32 +172,34 @@ namespace mud
     // mud::LightShadow
     {
         static Meta meta = { type<mud::LightShadow>(), &namspc({ "mud" }), "LightShadow", sizeof(mud::LightShadow), TypeClass::Struct };
-        static Class cls = { type<mud::LightShadow>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::LightShadow>(), [](Ref ref, Ref other) { new(&val<mud::LightShadow>(ref)) mud::LightShadow(val<mud::LightShadow>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::LightShadow>();
+        lazy_class<mud::LightShadow>([] {
+            static Class cls = { type<mud::LightShadow>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::LightShadow>(), [](Ref ref, Ref other) { new(&val<mud::LightShadow>(ref)) mud::LightShadow(val<mud::LightShadow>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::LightShadow>();
+        });
     }
     
     
@@ -208,37 +216,39 @@ namespace mud
     // mud::ReflectionProbe
     {
         static Meta meta = { type<mud::ReflectionProbe>(), &namspc({ "mud" }), "ReflectionProbe", sizeof(mud::ReflectionProbe), TypeClass::Object };
-        static Class cls = { type<mud::ReflectionProbe>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::ReflectionProbe>(), Address(), type<mud::Node3>(), "node", Ref(type<mud::Node3>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::ReflectionProbe>(object).m_node); } },
-                { type<mud::ReflectionProbe>(), member_address(&mud::ReflectionProbe::m_visible), type<bool>(), "visible", var(bool(true)), Member::Value, nullptr },
-                { type<mud::ReflectionProbe>(), member_address(&mud::ReflectionProbe::m_intensity), type<float>(), "intensity", var(float(1.f)), Member::Value, nullptr },
-                { type<mud::ReflectionProbe>(), member_address(&mud::ReflectionProbe::m_extents), type<mud::vec3>(), "extents", var(mud::vec3()), Member::Value, nullptr },
-                { type<mud::ReflectionProbe>(), member_address(&mud::ReflectionProbe::m_shadows), type<bool>(), "shadows", var(bool(false)), Member::Value, nullptr },
-                { type<mud::ReflectionProbe>(), member_address(&mud::ReflectionProbe::m_dirty), type<bool>(), "dirty", var(bool(true)), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::ReflectionProbe>();
+        lazy_class<mud::ReflectionProbe>([] {
+            static Class cls = { type<mud::ReflectionProbe>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::ReflectionProbe>(), Address(), type<mud::Node3>(), "node", Ref(type<mud::Node3>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::ReflectionProbe>(object).m_node); } },
+                    { type<mud::ReflectionProbe>(), member_address(&mud::ReflectionProbe::m_visible), type<bool>(), "visible", var(bool(true)), Member::Value, nullptr, [](Ref object) { return var(val<mud::ReflectionProbe>(object).m_visible); }, [](Ref object, Ref value) { member_assign(val<mud::ReflectionProbe>(object).m_visible, value); } },
+                    { type<mud::ReflectionProbe>(), member_address(&mud::ReflectionProbe::m_intensity), type<float>(), "intensity", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::ReflectionProbe>(object).m_intensity); }, [](Ref object, Ref value) { member_assign(val<mud::ReflectionProbe>(object).m_intensity, value); } },
+                    { type<mud::ReflectionProbe>(), member_address(&mud::ReflectionProbe::m_extents), type<mud::vec3>(), "extents", var(mud::vec3()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ReflectionProbe>(object).m_extents); }, [](Ref object, Ref value) { member_assign(val<mud::ReflectionProbe>(object).m_extents, value); } },
+                    { type<mud::ReflectionProbe>(), member_address(&mud::ReflectionProbe::m_shadows), type<bool>(), "shadows", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::ReflectionProbe>(object).m_shadows); }, [](Ref object, Ref value) { member_assign(val<mud::ReflectionProbe>(object).m_shadows, value); } },
+                    { type<mud::ReflectionProbe>(), member_address(&mud::ReflectionProbe::m_dirty), type<bool>(), "dirty", var(bool(true)), Member::Value, nullptr, [](Ref object) { return var(val<mud::ReflectionProbe>(object).m_dirty); }, [](Ref object, Ref value) { member_assign(val<mud::ReflectionProbe>(object).m_dirty, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::ReflectionProbe>();
+        });
     }
     
     
@@ -248,36 +258,38 @@ namespace mud
     // mud::RenderFilters
     {
         static Meta meta = { type<mud::RenderFilters>(), &namspc({ "mud" }), "RenderFilters", sizeof(mud::RenderFilters), TypeClass::Struct };
-        static Class cls = { type<mud::RenderFilters>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::RenderFilters>(), [](Ref ref, Ref other) { new(&val<mud::RenderFilters>(ref)) mud::RenderFilters(val<mud::RenderFilters>(other)); } }
-            },
-            // members
-            {
-                { type<mud::RenderFilters>(), member_address(&mud::RenderFilters::m_dof_blur), type<mud::DofBlur>(), "dof_blur", var(mud::DofBlur()), Member::Value, nullptr },
-                { type<mud::RenderFilters>(), member_address(&mud::RenderFilters::m_glow), type<mud::Glow>(), "glow", var(mud::Glow()), Member::Value, nullptr },
-                { type<mud::RenderFilters>(), member_address(&mud::RenderFilters::m_bcs), type<mud::BCS>(), "bcs", var(mud::BCS()), Member::Value, nullptr },
-                { type<mud::RenderFilters>(), member_address(&mud::RenderFilters::m_tonemap), type<mud::Tonemap>(), "tonemap", var(mud::Tonemap()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::RenderFilters>();
+        lazy_class<mud::RenderFilters>([] {
+            static Class cls = { type<mud::RenderFilters>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::RenderFilters>(), [](Ref ref, Ref other) { new(&val<mud::RenderFilters>(ref)) mud::RenderFilters(val<mud::RenderFilters>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::RenderFilters>(), member_address(&mud::RenderFilters::m_dof_blur), type<mud::DofBlur>(), "dof_blur", var(mud::DofBlur()), Member::Value, nullptr, [](Ref object) { return var(val<mud::RenderFilters>(object).m_dof_blur); }, [](Ref object, Ref value) { member_assign(val<mud::RenderFilters>(object).m_dof_blur, value); } },
+                    { type<mud::RenderFilters>(), member_address(&mud::RenderFilters::m_glow), type<mud::Glow>(), "glow", var(mud::Glow()), Member::Value, nullptr, [](Ref object) { return var(val<mud::RenderFilters>(object).m_glow); }, [](Ref object, Ref value) { member_assign(val<mud::RenderFilters>(object).m_glow, value); } },
+                    { type<mud::RenderFilters>(), member_address(&mud::RenderFilters::m_bcs), type<mud::BCS>(), "bcs", var(mud::BCS()), Member::Value, nullptr, [](Ref object) { return var(val<mud::RenderFilters>(object).m_bcs); }, [](Ref object, Ref value) { member_assign(val<mud::RenderFilters>(object).m_bcs, value); } },
+                    { type<mud::RenderFilters>(), member_address(&mud::RenderFilters::m_tonemap), type<mud::Tonemap>(), "tonemap", var(mud::Tonemap()), Member::Value, nullptr, [](Ref object) { return var(val<mud::RenderFilters>(object).m_tonemap); }, [](Ref object, Ref value) { member_assign(val<mud::RenderFilters>(object).m_tonemap, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::RenderFilters>();
+        });
     }
     
     
@@ -295,36 +307,38 @@ namespace mud
     // mud::Tonemap
     {
         static Meta meta = { type<mud::Tonemap>(), &namspc({ "mud" }), "Tonemap", sizeof(mud::Tonemap), TypeClass::Struct };
-        static Class cls = { type<mud::Tonemap>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Tonemap>(), [](Ref ref, Ref other) { new(&val<mud::Tonemap>(ref)) mud::Tonemap(val<mud::Tonemap>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Tonemap>(), member_address(&mud::Tonemap::m_mode), type<mud::TonemapMode>(), "mode", var(mud::TonemapMode()), Member::Value, nullptr },
-                { type<mud::Tonemap>(), member_address(&mud::Tonemap::m_enabled), type<bool>(), "enabled", var(bool(false)), Member::Value, nullptr },
-                { type<mud::Tonemap>(), member_address(&mud::Tonemap::m_exposure), type<float>(), "exposure", var(float(1.0f)), Member::Value, nullptr },
-                { type<mud::Tonemap>(), member_address(&mud::Tonemap::m_white_point), type<float>(), "white_point", var(float(1.0f)), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Tonemap>();
+        lazy_class<mud::Tonemap>([] {
+            static Class cls = { type<mud::Tonemap>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Tonemap>(), [](Ref ref, Ref other) { new(&val<mud::Tonemap>(ref)) mud::Tonemap(val<mud::Tonemap>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Tonemap>(), member_address(&mud::Tonemap::m_mode), type<mud::TonemapMode>(), "mode", var(mud::TonemapMode()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Tonemap>(object).m_mode); }, [](Ref object, Ref value) { member_assign(val<mud::Tonemap>(object).m_mode, value); } },
+                    { type<mud::Tonemap>(), member_address(&mud::Tonemap::m_enabled), type<bool>(), "enabled", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Tonemap>(object).m_enabled); }, [](Ref object, Ref value) { member_assign(val<mud::Tonemap>(object).m_enabled, value); } },
+                    { type<mud::Tonemap>(), member_address(&mud::Tonemap::m_exposure), type<float>(), "exposure", var(float(1.0f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Tonemap>(object).m_exposure); }, [](Ref object, Ref value) { member_assign(val<mud::Tonemap>(object).m_exposure, value); } },
+                    { type<mud::Tonemap>(), member_address(&mud::Tonemap::m_white_point), type<float>(), "white_point", var(float(1.0f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Tonemap>(object).m_white_point); }, [](Ref object, Ref value) { member_assign(val<mud::Tonemap>(object).m_white_point, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Tonemap>();
+        });
     }
     
     
@@ -348,31 +362,33 @@ namespace mud
     // mud::BlockBlur
     {
         static Meta meta = { type<mud::BlockBlur>(), &namspc({ "mud" }), "BlockBlur", sizeof(mud::BlockBlur), TypeClass::Object };
-        static Class cls = { type<mud::BlockBlur>(),
-            // bases
-            { &type<mud::GfxBlock>() },
-            { base_offset<mud::BlockBlur, mud::GfxBlock>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::BlockBlur>();
+        lazy_class<mud::BlockBlur>([] {
+            static Class cls = { type<mud::BlockBlur>(),
+                // bases
+                { &type<mud::GfxBlock>() },
+                { base_offset<mud::BlockBlur, mud::GfxBlock>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::BlockBlur>();
+        });
     }
     
     
@@ -380,31 +396,33 @@ namespace mud
     // mud::BlockDofBlur
     {
         static Meta meta = { type<mud::BlockDofBlur>(), &namspc({ "mud" }), "BlockDofBlur", sizeof(mud::BlockDofBlur), TypeClass::Object };
-        static Class cls = { type<mud::BlockDofBlur>(),
-            // bases
-            { &type<mud::GfxBlock>() },
-            { base_offset<mud::BlockDofBlur, mud::GfxBlock>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::BlockDofBlur>();
+        lazy_class<mud::BlockDofBlur>([] {
+            static Class cls = { type<mud::BlockDofBlur>(),
+                // bases
+                { &type<mud::GfxBlock>() },
+                { base_offset<mud::BlockDofBlur, mud::GfxBlock>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::BlockDofBlur>();
+        });
     }
     
     
@@ -412,31 +430,33 @@ namespace mud
     // mud::BlockGlow
     {
         static Meta meta = { type<mud::BlockGlow>(), &namspc({ "mud" }), "BlockGlow", sizeof(mud::BlockGlow), TypeClass::Object };
-        static Class cls = { type<mud::BlockGlow>(),
-            // bases
-            { &type<mud::GfxBlock>() },
-            { base_offset<mud::BlockGlow, mud::GfxBlock>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::BlockGlow>();
+        lazy_class<mud::BlockGlow>([] {
+            static Class cls = { type<mud::BlockGlow>(),
+                // bases
+                { &type<mud::GfxBlock>() },
+                { base_offset<mud::BlockGlow, mud::GfxBlock>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::BlockGlow>();
+        });
     }
     
     
@@ -444,31 +464,33 @@ namespace mud
     // mud::BlockReflection
     {
         static Meta meta = { type<mud::BlockReflection>(), &namspc({ "mud" }), "BlockReflection", sizeof(mud::BlockReflection), TypeClass::Object };
-        static Class cls = { type<mud::BlockReflection>(),
-            // bases
-            { &type<mud::GfxBlock>() },
-            { base_offset<mud::BlockReflection, mud::GfxBlock>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::BlockReflection>();
+        lazy_class<mud::BlockReflection>([] {
+            static Class cls = { type<mud::BlockReflection>(),
+                // bases
+                { &type<mud::GfxBlock>() },
+                { base_offset<mud::BlockReflection, mud::GfxBlock>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::BlockReflection>();
+        });
     }
     
     
@@ -476,31 +498,33 @@ namespace mud
     // mud::BlockTonemap
     {
         static Meta meta = { type<mud::BlockTonemap>(), &namspc({ "mud" }), "BlockTonemap", sizeof(mud::BlockTonemap), TypeClass::Object };
-        static Class cls = { type<mud::BlockTonemap>(),
-            // bases
-            { &type<mud::GfxBlock>() },
-            { base_offset<mud::BlockTonemap, mud::GfxBlock>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::BlockTonemap>();
+        lazy_class<mud::BlockTonemap>([] {
+            static Class cls = { type<mud::BlockTonemap>(),
+                // bases
+                { &type<mud::GfxBlock>() },
+                { base_offset<mud::BlockTonemap, mud::GfxBlock>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::BlockTonemap>();
+        });
     }
     
     
@@ -508,31 +532,33 @@ namespace mud
     // mud::BlockLight
     {
         static Meta meta = { type<mud::BlockLight>(), &namspc({ "mud" }), "BlockLight", sizeof(mud::BlockLight), TypeClass::Object };
-        static Class cls = { type<mud::BlockLight>(),
-            // bases
-            { &type<mud::DrawBlock>() },
-            { base_offset<mud::BlockLight, mud::DrawBlock>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::BlockLight>();
+        lazy_class<mud::BlockLight>([] {
+            static Class cls = { type<mud::BlockLight>(),
+                // bases
+                { &type<mud::DrawBlock>() },
+                { base_offset<mud::BlockLight, mud::DrawBlock>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::BlockLight>();
+        });
     }
     
     
@@ -540,31 +566,33 @@ namespace mud
     // mud::BlockRadiance
     {
         static Meta meta = { type<mud::BlockRadiance>(), &namspc({ "mud" }), "BlockRadiance", sizeof(mud::BlockRadiance), TypeClass::Object };
-        static Class cls = { type<mud::BlockRadiance>(),
-            // bases
-            { &type<mud::DrawBlock>() },
-            { base_offset<mud::BlockRadiance, mud::DrawBlock>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::BlockRadiance>();
+        lazy_class<mud::BlockRadiance>([] {
+            static Class cls = { type<mud::BlockRadiance>(),
+                // bases
+                { &type<mud::DrawBlock>() },
+                { base_offset<mud::BlockRadiance, mud::DrawBlock>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::BlockRadiance>();
+        });
     }
     
     
@@ -572,31 +600,33 @@ namespace mud
     // mud::BlockShadow
     {
         static Meta meta = { type<mud::BlockShadow>(), &namspc({ "mud" }), "BlockShadow", sizeof(mud::BlockShadow), TypeClass::Object };
-        static Class cls = { type<mud::BlockShadow>(),
-            // bases
-            { &type<mud::DrawBlock>() },
-            { base_offset<mud::BlockShadow, mud::DrawBlock>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::BlockShadow>();
+        lazy_class<mud::BlockShadow>([] {
+            static Class cls = { type<mud::BlockShadow>(),
+                // bases
+                { &type<mud::DrawBlock>() },
+                { base_offset<mud::BlockShadow, mud::DrawBlock>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::BlockShadow>();
+        });
     }
     
 
@@ -44,31 +44,33 @@ namespace mud
     // mud::ViewerController
     {
         static Meta meta = { type<mud::ViewerController>(), &namspc({ "mud" }), "ViewerController", sizeof(mud::ViewerController), TypeClass::Object };
-        static Class cls = { type<mud::ViewerController>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
+        lazy_class<mud::ViewerController>([] {
+            static Class cls = { type<mud::ViewerController>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        
-        meta_class<mud::ViewerController>();
+            
+            
+            init_class<mud::ViewerController>();
+        });
     }
     
     
@@ -77,31 +79,33 @@ namespace mud
     // mud::SpaceSheet
     {
         static Meta meta = { type<mud::SpaceSheet>(), &namspc({ "mud" }), "SpaceSheet", sizeof(mud::SpaceSheet), TypeClass::Object };
-        static Class cls = { type<mud::SpaceSheet>(),
-            // bases
-            { &type<mud::Ui>() },
-            { base_offset<mud::SpaceSheet, mud::Ui>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
+        lazy_class<mud::SpaceSheet>([] {
+            static Class cls = { type<mud::SpaceSheet>(),
+                // bases
+                { &type<mud::Ui>() },
+                { base_offset<mud::SpaceSheet, mud::Ui>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        meta_class<mud::SpaceSheet>();
+            
+            
+            init_class<mud::SpaceSheet>();
+        });
     }
     
     
@@ -109,35 +113,37 @@ namespace mud
     // mud::Viewer
     {
         static Meta meta = { type<mud::Viewer>(), &namspc({ "mud" }), "Viewer", sizeof(mud::Viewer), TypeClass::Object };
-        static Class cls = { type<mud::Viewer>(),
-            // bases
-            { &type<mud::Widget>() },
-            { base_offset<mud::Viewer, mud::Widget>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Viewer>(), member_address(&mud::Viewer::m_scene), type<mud::Scene>(), "scene", Ref(type<mud::Scene>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::Viewer>(), member_address(&mud::Viewer::m_viewport), type<mud::Viewport>(), "viewport", Ref(type<mud::Viewport>()), Member::None, nullptr },
-                { type<mud::Viewer>(), member_address(&mud::Viewer::m_position), type<mud::vec2>(), "position", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::Viewer>(), member_address(&mud::Viewer::m_size), type<mud::vec2>(), "size", var(mud::vec2()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
+        lazy_class<mud::Viewer>([] {
+            static Class cls = { type<mud::Viewer>(),
+                // bases
+                { &type<mud::Widget>() },
+                { base_offset<mud::Viewer, mud::Widget>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Viewer>(), member_address(&mud::Viewer::m_scene), type<mud::Scene>(), "scene", Ref(type<mud::Scene>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::Viewer>(), member_address(&mud::Viewer::m_viewport), type<mud::Viewport>(), "viewport", Ref(type<mud::Viewport>()), Member::None, nullptr },
+                    { type<mud::Viewer>(), member_address(&mud::Viewer::m_position), type<mud::vec2>(), "position", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Viewer>(object).m_position); }, [](Ref object, Ref value) { member_assign(val<mud::Viewer>(object).m_position, value); } },
+                    { type<mud::Viewer>(), member_address(&mud::Viewer::m_size), type<mud::vec2>(), "size", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Viewer>(object).m_size); }, [](Ref object, Ref value) { member_assign(val<mud::Viewer>(object).m_size, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        meta_class<mud::Viewer>();
+            
+            
+            init_class<mud::Viewer>();
+        });
     }
     
     
@@ -145,31 +151,33 @@ namespace mud
     // mud::SceneViewer
     {
         static Meta meta = { type<mud::SceneViewer>(), &namspc({ "mud" }), "SceneViewer", sizeof(mud::SceneViewer), TypeClass::Object };
-        static Class cls = { type<mud::SceneViewer>(),
-            // bases
-            { &type<mud::Scene>(), &type<mud::Viewer>() },
-            { base_offset<mud::SceneViewer, mud::Scene>(), base_offset<mud::SceneViewer, mud::Viewer>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
+        lazy_class<mud::SceneViewer>([] {
+            static Class cls = { type<mud::SceneViewer>(),
+                // bases
+                { &type<mud::Scene>(), &type<mud::Viewer>() },
+                { base_offset<mud::SceneViewer, mud::Scene>(), base_offset<mud::SceneViewer, mud::Viewer>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        
-        meta_class<mud::SceneViewer>();
+            
+            
+            init_class<mud::SceneViewer>();
+        });
     }
     
     
@@ -178,31 +186,33 @@ namespace mud
     // mud::FreeOrbitController
     {
         static Meta meta = { type<mud::FreeOrbitController>(), &namspc({ "mud" }), "FreeOrbitController", sizeof(mud::FreeOrbitController), TypeClass::Object };
-        static Class cls = { type<mud::FreeOrbitController>(),
-            // bases
-            { &type<mud::OrbitController>() },
-            { base_offset<mud::FreeOrbitController, mud::OrbitController>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
+        lazy_class<mud::FreeOrbitController>([] {
+            static Class cls = { type<mud::FreeOrbitController>(),
+                // bases
+                { &type<mud::OrbitController>() },
+                { base_offset<mud::FreeOrbitController, mud::OrbitController>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        meta_class<mud::FreeOrbitController>();
+            
+            
+            init_class<mud::FreeOrbitController>();
+        });
     }
     
     
@@ -210,31 +220,33 @@ namespace mud
     // mud::OrbitController
     {
         static Meta meta = { type<mud::OrbitController>(), &namspc({ "mud" }), "OrbitController", sizeof(mud::OrbitController), TypeClass::Object };
-        static Class cls = { type<mud::OrbitController>(),
-            // bases
-            { &type<mud::ViewerController>() },
-            { base_offset<mud::OrbitController, mud::ViewerController>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
+        lazy_class<mud::OrbitController>([] {
+            static Class cls = { type<mud::OrbitController>(),
+                // bases
+                { &type<mud::ViewerController>() },
+                { base_offset<mud::OrbitController, mud::ViewerController>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        meta_class<mud::OrbitController>();
+            
+            
+            init_class<mud::OrbitController>();
+        });
     }
     
 
@@ -275,30 +275,38 @@ namespace mud
     // Sequences
     {
         static Meta meta = { type<array<mud::mat4>>(), &namspc({}), "array<mud::mat4>", sizeof(array<mud::mat4>), TypeClass::Sequence };
-        static Class cls = { type<array<mud::mat4>>() };
-        cls.m_content = &type<mud::mat4>();
-        meta_sequence<array<mud::mat4>, mud::mat4>();
+        lazy_class<array<mud::mat4>>([] {
+            static Class cls = { type<array<mud::mat4>>() };
+            cls.m_content = &type<mud::mat4>();
+            init_vector<array<mud::mat4>, mud::mat4>();
+        });
     }
 
 	{
 		static Meta meta = { type<std::vector<mud::Animation*>>(), &namspc({}), "std::vector<mud::Animation*>", sizeof(std::vector<mud::Animation*>), TypeClass::Sequence };
-		static Class cls = { type<std::vector<mud::Animation*>>() };
-		cls.m_content = &type<mud::Animation>();
-		meta_sequence<std::vector<mud::Animation*>, mud::Animation*>();
+		lazy_class<std::vector<mud::Animation*>>([] {
+			static Class cls = { type<std::vector<mud::Animation*>>() };
+			cls.m_content = &type<mud::Animation>();
+			init_vector<std::vector<mud::Animation*>, mud::Animation*>();
+		});
 	}
 
 	{
 		static Meta meta = { type<std::vector<mud::AnimationPlay>>(), &namspc({}), "std::vector<mud::AnimationPlay>", sizeof(std::vector<mud::AnimationPlay>), TypeClass::Sequence };
-		static Class cls = { type<std::vector<mud::AnimationPlay>>() };
-		cls.m_content = &type<mud::AnimationPlay>();
-		meta_sequence<std::vector<mud::AnimationPlay>, mud::AnimationPlay>();
+		lazy_class<std::vector<mud::AnimationPlay>>([] {
+			static Class cls = { type<std::vector<mud::AnimationPlay>>() };
+			cls.m_content = &type<mud::AnimationPlay>();
+			init_vector<std::vector<mud::AnimationPlay>, mud::AnimationPlay>();
+		});
 	}
 
     {
         static Meta meta = { type<std::vector<mud::PrefabNode>>(), &namspc({}), "std::vector<mud::PrefabNode>", sizeof(std::vector<mud::PrefabNode>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<mud::PrefabNode>>() };
-        cls.m_content = &type<mud::PrefabNode>();
-        meta_sequence<std::vector<mud::PrefabNode>, mud::PrefabNode>();
+        lazy_class<std::vector<mud::PrefabNode>>([] {
+            static Class cls = { type<std::vector<mud::PrefabNode>>() };
+            cls.m_content = &type<mud::PrefabNode>();
+            init_vector<std::vector<mud::PrefabNode>, mud::PrefabNode>();
+        });
     }
     
     
@@ -308,40 +316,42 @@ namespace mud
 	// mud::AnimationPlay
 	{
 		static Meta meta = { type<mud::AnimationPlay>(), &namspc({ "mud" }), "AnimationPlay", sizeof(mud::AnimationPlay), TypeClass::Struct };
-		static Class cls = { type<mud::AnimationPlay>(),
-			// bases
-		{},
-		{},
-			// constructors
-		{
-		},
-		// copy constructor
-		{
-			{ type<mud::AnimationPlay>(), [](Ref ref, Ref other) { new(&val<mud::AnimationPlay>(ref)) mud::AnimationPlay(val<mud::AnimationPlay>(other)); } }
-		},
-			// members
-		{
-			{ type<mud::AnimationPlay>(), member_address(&mud::AnimationPlay::m_animation), type<mud::Animation>(), "animation", Ref(type<mud::Animation>()), Member::Flags(Member::Pointer | Member::Link), nullptr },
-			{ type<mud::AnimationPlay>(), member_address(&mud::AnimationPlay::m_loop), type<bool>(), "loop", var(bool(true)), Member::Value, nullptr },
-			{ type<mud::AnimationPlay>(), member_address(&mud::AnimationPlay::m_speed), type<float>(), "speed", var(float(1.f)), Member::Value, nullptr },
-			{ type<mud::AnimationPlay>(), member_address(&mud::AnimationPlay::m_transient), type<bool>(), "transient", var(bool(false)), Member::Value, nullptr },
-			{ type<mud::AnimationPlay>(), member_address(&mud::AnimationPlay::m_fadeout), type<float>(), "fadeout", var(float(0.f)), Member::Value, nullptr },
-			{ type<mud::AnimationPlay>(), member_address(&mud::AnimationPlay::m_fadeout_left), type<float>(), "fadeout_left", var(float(0.f)), Member::Value, nullptr },
-			{ type<mud::AnimationPlay>(), member_address(&mud::AnimationPlay::m_cursor), type<float>(), "cursor", var(float(0.f)), Member::Value, nullptr },
-			{ type<mud::AnimationPlay>(), member_address(&mud::AnimationPlay::m_ended), type<bool>(), "ended", var(bool(false)), Member::Value, nullptr }
-		},
-			// methods
-		{
-		},
-		// static members
-		{
-		}
-		};
+		lazy_class<mud::AnimationPlay>([] {
+			static Class cls = { type<mud::AnimationPlay>(),
+				// bases
+			{},
+			{},
+				// constructors
+			{
+			},
+			// copy constructor
+			{
+				{ type<mud::AnimationPlay>(), [](Ref ref, Ref other) { new(&val<mud::AnimationPlay>(ref)) mud::AnimationPlay(val<mud::AnimationPlay>(other)); } }
+			},
+				// members
+			{
+				{ type<mud::AnimationPlay>(), member_address(&mud::AnimationPlay::m_animation), type<mud::Animation>(), "animation", Ref(type<mud::Animation>()), Member::Flags(Member::Pointer | Member::Link), nullptr },
+				{ type<mud::AnimationPlay>(), member_address(&mud::AnimationPlay::m_loop), type<bool>(), "loop", var(bool(true)), Member::Value, nullptr, [](Ref object) { return var(val<mud::AnimationPlay>(object).m_loop); }, [](Ref object, Ref value) { member_assign(val<mud::AnimationPlay>(object).m_loop, value); } },
+				{ type<mud::AnimationPlay>(), member_address(&mud::AnimationPlay::m_speed), type<float>(), "speed", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::AnimationPlay>(object).m_speed); }, [](Ref object, Ref value) { member_assign(val<mud::AnimationPlay>(object).m_speed, value); } },
+				{ type<mud::AnimationPlay>(), member_address(&mud::AnimationPlay::m_transient), type<bool>(), "transient", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::AnimationPlay>(object).m_transient); }, [](Ref object, Ref value) { member_assign(val<mud::AnimationPlay>(object).m_transient, value); } },
+				{ type<mud::AnimationPlay>(), member_address(&mud::AnimationPlay::m_fadeout), type<float>(), "fadeout", var(float(0.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::AnimationPlay>(object).m_fadeout); }, [](Ref object, Ref value) { member_assign(val<mud::AnimationPlay>(object).m_fadeout, value); } },
+				{ type<mud::AnimationPlay>(), member_address(&mud::AnimationPlay::m_fadeout_left), type<float>(), "fadeout_left", var(float(0.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::AnimationPlay>(object).m_fadeout_left); }, [](Ref object, Ref value) { member_assign(val<mud::AnimationPlay>(object).m_fadeout_left, value); } },
+				{ type<mud::AnimationPlay>(), member_address(&mud::AnimationPlay::m_cursor), type<float>(), "cursor", var(float(0.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::AnimationPlay>(object).m_cursor); }, [](Ref object, Ref value) { member_assign(val<mud::AnimationPlay>(object).m_cursor, value); } },
+				{ type<mud::AnimationPlay>(), member_address(&mud::AnimationPlay::m_ended), type<bool>(), "ended", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::AnimationPlay>(object).m_ended); }, [](Ref object, Ref value) { member_assign(val<mud::AnimationPlay>(object).m_ended, value); } }
+			},
+				// methods
+			{
+			},
+			// static members
+			{
+			}
+			};
 
 
 
 
-		meta_class<mud::AnimationPlay>();
+			init_class<mud::AnimationPlay>();
+		});
 	}
 
 
@@ -349,37 +359,39 @@ namespace mud
 	// mud::AnimationTrack
 	{
 		static Meta meta = { type<mud::AnimationTrack>(), &namspc({ "mud" }), "AnimationTrack", sizeof(mud::AnimationTrack), TypeClass::Object };
-		static Class cls = { type<mud::AnimationTrack>(),
-			// bases
-		{},
-		{},
-			// constructors
-		{
-		},
-		// copy constructor
-		{
-		},
-		// members
-		{
-			{ type<mud::AnimationTrack>(), member_address(&mud::AnimationTrack::m_animation), type<mud::Animation>(), "animation", Ref(type<mud::Animation>()), Member::Flags(Member::Pointer | Member::Link), nullptr },
-			{ type<mud::AnimationTrack>(), member_address(&mud::AnimationTrack::m_node), type<size_t>(), "node", var(size_t()), Member::Value, nullptr },
-			{ type<mud::AnimationTrack>(), member_address(&mud::AnimationTrack::m_node_name), type<std::string>(), "node_name", var(std::string()), Member::Value, nullptr },
-			{ type<mud::AnimationTrack>(), member_address(&mud::AnimationTrack::m_member), type<mud::Member>(), "member", Ref(type<mud::Member>()), Member::Flags(Member::Pointer | Member::Link), nullptr },
-			{ type<mud::AnimationTrack>(), member_address(&mud::AnimationTrack::m_length), type<float>(), "length", var(float(0.f)), Member::Value, nullptr },
-			{ type<mud::AnimationTrack>(), member_address(&mud::AnimationTrack::m_interpolation), type<mud::Interpolation>(), "interpolation", var(mud::Interpolation()), Member::Value, nullptr }
-		},
-			// methods
-		{
-		},
-		// static members
-		{
-		}
-		};
+		lazy_class<mud::AnimationTrack>([] {
+			static Class cls = { type<mud::AnimationTrack>(),
+				// bases
+			{},
+			{},
+				// constructors
+			{
+			},
+			// copy constructor
+			{
+			},
+			// members
+			{
+				{ type<mud::AnimationTrack>(), member_address(&mud::AnimationTrack::m_animation), type<mud::Animation>(), "animation", Ref(type<mud::Animation>()), Member::Flags(Member::Pointer | Member::Link), nullptr },
+				{ type<mud::AnimationTrack>(), member_address(&mud::AnimationTrack::m_node), type<size_t>(), "node", var(size_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::AnimationTrack>(object).m_node); }, [](Ref object, Ref value) { member_assign(val<mud::AnimationTrack>(object).m_node, value); } },
+				{ type<mud::AnimationTrack>(), member_address(&mud::AnimationTrack::m_node_name), type<std::string>(), "node_name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<mud::AnimationTrack>(object).m_node_name); }, [](Ref object, Ref value) { member_assign(val<mud::AnimationTrack>(object).m_node_name, value); } },
+				{ type<mud::AnimationTrack>(), member_address(&mud::AnimationTrack::m_member), type<mud::Member>(), "member", Ref(type<mud::Member>()), Member::Flags(Member::Pointer | Member::Link), nullptr },
+				{ type<mud::AnimationTrack>(), member_address(&mud::AnimationTrack::m_length), type<float>(), "length", var(float(0.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::AnimationTrack>(object).m_length); }, [](Ref object, Ref value) { member_assign(val<mud::AnimationTrack>(object).m_length, value); } },
+				{ type<mud::AnimationTrack>(), member_address(&mud::AnimationTrack::m_interpolation), type<mud::Interpolation>(), "interpolation", var(mud::Interpolation()), Member::Value, nullptr, [](Ref object) { return var(val<mud::AnimationTrack>(object).m_interpolation); }, [](Ref object, Ref value) { member_assign(val<mud::AnimationTrack>(object).m_interpolation, value); } }
+			},
+				// methods
+			{
+			},
+			// static members
+			{
+			}
+			};
 
 
 
 
-		meta_class<mud::AnimationTrack>();
+			init_class<mud::AnimationTrack>();
+		});
 	}
 
     
@@ -387,32 +399,34 @@ namespace mud
     // mud::AnimatedTrack
     {
         static Meta meta = { type<mud::AnimatedTrack>(), &namspc({ "mud" }), "AnimatedTrack", sizeof(mud::AnimatedTrack), TypeClass::Struct };
-        static Class cls = { type<mud::AnimatedTrack>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::AnimatedTrack>(), [](Ref ref, Ref other) { new(&val<mud::AnimatedTrack>(ref)) mud::AnimatedTrack(val<mud::AnimatedTrack>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::AnimatedTrack>();
+        lazy_class<mud::AnimatedTrack>([] {
+            static Class cls = { type<mud::AnimatedTrack>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::AnimatedTrack>(), [](Ref ref, Ref other) { new(&val<mud::AnimatedTrack>(ref)) mud::AnimatedTrack(val<mud::AnimatedTrack>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::AnimatedTrack>();
+        });
     }
     
     
@@ -420,31 +434,33 @@ namespace mud
     // mud::Animation
     {
         static Meta meta = { type<mud::Animation>(), &namspc({ "mud" }), "Animation", sizeof(mud::Animation), TypeClass::Object };
-        static Class cls = { type<mud::Animation>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Animation>();
+        lazy_class<mud::Animation>([] {
+            static Class cls = { type<mud::Animation>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Animation>();
+        });
     }
     
     
@@ -453,32 +469,34 @@ namespace mud
     // mud::AnimationPlay
     {
         static Meta meta = { type<mud::AnimationPlay>(), &namspc({ "mud" }), "AnimationPlay", sizeof(mud::AnimationPlay), TypeClass::Struct };
-        static Class cls = { type<mud::AnimationPlay>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::AnimationPlay>(), [](Ref ref, Ref other) { new(&val<mud::AnimationPlay>(ref)) mud::AnimationPlay(val<mud::AnimationPlay>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::AnimationPlay>();
+        lazy_class<mud::AnimationPlay>([] {
+            static Class cls = { type<mud::AnimationPlay>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::AnimationPlay>(), [](Ref ref, Ref other) { new(&val<mud::AnimationPlay>(ref)) mud::AnimationPlay(val<mud::AnimationPlay>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::AnimationPlay>();
+        });
     }
     
     
@@ -486,31 +504,33 @@ namespace mud
     // mud::AnimationTrack
     {
         static Meta meta = { type<mud::AnimationTrack>(), &namspc({ "mud" }), "AnimationTrack", sizeof(mud::AnimationTrack), TypeClass::Object };
-        static Class cls = { type<mud::AnimationTrack>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::AnimationTrack>();
+        lazy_class<mud::AnimationTrack>([] {
+            static Class cls = { type<mud::AnimationTrack>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::AnimationTrack>();
+        });
     }
     
     
@@ -518,36 +538,38 @@ namespace mud
     // mud::AssetStore<mud::Material>
     {
         static Meta meta = { type<mud::AssetStore<mud::Material>>(), &namspc({ "mud" }), "AssetStore<mud::Material>", sizeof(mud::AssetStore<mud::Material>), TypeClass::Object };
-        static Class cls = { type<mud::AssetStore<mud::Material>>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-                { type<mud::AssetStore<mud::Material>>(), "get", member_address(&mud::AssetStore<mud::Material>::get), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Material>>(object).get(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Material>()) },
-                { type<mud::AssetStore<mud::Material>>(), "create", member_address(&mud::AssetStore<mud::Material>::create), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Material>>(object).create(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Material>()) },
-                { type<mud::AssetStore<mud::Material>>(), "fetch", member_address(&mud::AssetStore<mud::Material>::fetch), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Material>>(object).fetch(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Material>()) },
-                { type<mud::AssetStore<mud::Material>>(), "file_at", member_address(&mud::AssetStore<mud::Material>::file_at), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Material>>(object).file_at(val<cstring>(args[0]), val<cstring>(args[1]))); }, { { "path", var(cstring()) }, { "name", var(cstring()) } }, Ref(type<mud::Material>()) },
-                { type<mud::AssetStore<mud::Material>>(), "file", member_address(&mud::AssetStore<mud::Material>::file), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Material>>(object).file(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Material>()) }
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::AssetStore<mud::Material>>();
+        lazy_class<mud::AssetStore<mud::Material>>([] {
+            static Class cls = { type<mud::AssetStore<mud::Material>>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                    { type<mud::AssetStore<mud::Material>>(), "get", member_address(&mud::AssetStore<mud::Material>::get), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Material>>(object).get(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Material>()) },
+                    { type<mud::AssetStore<mud::Material>>(), "create", member_address(&mud::AssetStore<mud::Material>::create), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Material>>(object).create(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Material>()) },
+                    { type<mud::AssetStore<mud::Material>>(), "fetch", member_address(&mud::AssetStore<mud::Material>::fetch), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Material>>(object).fetch(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Material>()) },
+                    { type<mud::AssetStore<mud::Material>>(), "file_at", member_address(&mud::AssetStore<mud::Material>::file_at), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Material>>(object).file_at(val<cstring>(args[0]), val<cstring>(args[1]))); }, { { "path", var(cstring()) }, { "name", var(cstring()) } }, Ref(type<mud::Material>()) },
+                    { type<mud::AssetStore<mud::Material>>(), "file", member_address(&mud::AssetStore<mud::Material>::file), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Material>>(object).file(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Material>()) }
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::AssetStore<mud::Material>>();
+        });
     }
     
     
@@ -555,36 +577,38 @@ namespace mud
     // mud::AssetStore<mud::Model>
     {
         static Meta meta = { type<mud::AssetStore<mud::Model>>(), &namspc({ "mud" }), "AssetStore<mud::Model>", sizeof(mud::AssetStore<mud::Model>), TypeClass::Object };
-        static Class cls = { type<mud::AssetStore<mud::Model>>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-                { type<mud::AssetStore<mud::Model>>(), "get", member_address(&mud::AssetStore<mud::Model>::get), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Model>>(object).get(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Model>()) },
-                { type<mud::AssetStore<mud::Model>>(), "create", member_address(&mud::AssetStore<mud::Model>::create), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Model>>(object).create(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Model>()) },
-                { type<mud::AssetStore<mud::Model>>(), "fetch", member_address(&mud::AssetStore<mud::Model>::fetch), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Model>>(object).fetch(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Model>()) },
-                { type<mud::AssetStore<mud::Model>>(), "file_at", member_address(&mud::AssetStore<mud::Model>::file_at), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Model>>(object).file_at(val<cstring>(args[0]), val<cstring>(args[1]))); }, { { "path", var(cstring()) }, { "name", var(cstring()) } }, Ref(type<mud::Model>()) },
-                { type<mud::AssetStore<mud::Model>>(), "file", member_address(&mud::AssetStore<mud::Model>::file), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Model>>(object).file(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Model>()) }
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::AssetStore<mud::Model>>();
+        lazy_class<mud::AssetStore<mud::Model>>([] {
+            static Class cls = { type<mud::AssetStore<mud::Model>>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                    { type<mud::AssetStore<mud::Model>>(), "get", member_address(&mud::AssetStore<mud::Model>::get), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Model>>(object).get(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Model>()) },
+                    { type<mud::AssetStore<mud::Model>>(), "create", member_address(&mud::AssetStore<mud::Model>::create), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Model>>(object).create(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Model>()) },
+                    { type<mud::AssetStore<mud::Model>>(), "fetch", member_address(&mud::AssetStore<mud::Model>::fetch), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Model>>(object).fetch(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Model>()) },
+                    { type<mud::AssetStore<mud::Model>>(), "file_at", member_address(&mud::AssetStore<mud::Model>::file_at), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Model>>(object).file_at(val<cstring>(args[0]), val<cstring>(args[1]))); }, { { "path", var(cstring()) }, { "name", var(cstring()) } }, Ref(type<mud::Model>()) },
+                    { type<mud::AssetStore<mud::Model>>(), "file", member_address(&mud::AssetStore<mud::Model>::file), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Model>>(object).file(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Model>()) }
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::AssetStore<mud::Model>>();
+        });
     }
     
     
@@ -592,36 +616,38 @@ namespace mud
     // mud::AssetStore<mud::ParticleGenerator>
     {
         static Meta meta = { type<mud::AssetStore<mud::ParticleGenerator>>(), &namspc({ "mud" }), "AssetStore<mud::ParticleGenerator>", sizeof(mud::AssetStore<mud::ParticleGenerator>), TypeClass::Object };
-        static Class cls = { type<mud::AssetStore<mud::ParticleGenerator>>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-                { type<mud::AssetStore<mud::ParticleGenerator>>(), "get", member_address(&mud::AssetStore<mud::ParticleGenerator>::get), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::ParticleGenerator>>(object).get(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::ParticleGenerator>()) },
-                { type<mud::AssetStore<mud::ParticleGenerator>>(), "create", member_address(&mud::AssetStore<mud::ParticleGenerator>::create), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::ParticleGenerator>>(object).create(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::ParticleGenerator>()) },
-                { type<mud::AssetStore<mud::ParticleGenerator>>(), "fetch", member_address(&mud::AssetStore<mud::ParticleGenerator>::fetch), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::ParticleGenerator>>(object).fetch(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::ParticleGenerator>()) },
-                { type<mud::AssetStore<mud::ParticleGenerator>>(), "file_at", member_address(&mud::AssetStore<mud::ParticleGenerator>::file_at), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::ParticleGenerator>>(object).file_at(val<cstring>(args[0]), val<cstring>(args[1]))); }, { { "path", var(cstring()) }, { "name", var(cstring()) } }, Ref(type<mud::ParticleGenerator>()) },
-                { type<mud::AssetStore<mud::ParticleGenerator>>(), "file", member_address(&mud::AssetStore<mud::ParticleGenerator>::file), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::ParticleGenerator>>(object).file(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::ParticleGenerator>()) }
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::AssetStore<mud::ParticleGenerator>>();
+        lazy_class<mud::AssetStore<mud::ParticleGenerator>>([] {
+            static Class cls = { type<mud::AssetStore<mud::ParticleGenerator>>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                    { type<mud::AssetStore<mud::ParticleGenerator>>(), "get", member_address(&mud::AssetStore<mud::ParticleGenerator>::get), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::ParticleGenerator>>(object).get(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::ParticleGenerator>()) },
+                    { type<mud::AssetStore<mud::ParticleGenerator>>(), "create", member_address(&mud::AssetStore<mud::ParticleGenerator>::create), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::ParticleGenerator>>(object).create(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::ParticleGenerator>()) },
+                    { type<mud::AssetStore<mud::ParticleGenerator>>(), "fetch", member_address(&mud::AssetStore<mud::ParticleGenerator>::fetch), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::ParticleGenerator>>(object).fetch(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::ParticleGenerator>()) },
+                    { type<mud::AssetStore<mud::ParticleGenerator>>(), "file_at", member_address(&mud::AssetStore<mud::ParticleGenerator>::file_at), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::ParticleGenerator>>(object).file_at(val<cstring>(args[0]), val<cstring>(args[1]))); }, { { "path", var(cstring()) }, { "name", var(cstring()) } }, Ref(type<mud::ParticleGenerator>()) },
+                    { type<mud::AssetStore<mud::ParticleGenerator>>(), "file", member_address(&mud::AssetStore<mud::ParticleGenerator>::file), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::ParticleGenerator>>(object).file(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::ParticleGenerator>()) }
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::AssetStore<mud::ParticleGenerator>>();
+        });
     }
     
     
@@ -629,36 +655,38 @@ namespace mud
     // mud::AssetStore<mud::Prefab>
     {
         static Meta meta = { type<mud::AssetStore<mud::Prefab>>(), &namspc({ "mud" }), "AssetStore<mud::Prefab>", sizeof(mud::AssetStore<mud::Prefab>), TypeClass::Object };
-        static Class cls = { type<mud::AssetStore<mud::Prefab>>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-                { type<mud::AssetStore<mud::Prefab>>(), "get", member_address(&mud::AssetStore<mud::Prefab>::get), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Prefab>>(object).get(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Prefab>()) },
-                { type<mud::AssetStore<mud::Prefab>>(), "create", member_address(&mud::AssetStore<mud::Prefab>::create), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Prefab>>(object).create(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Prefab>()) },
-                { type<mud::AssetStore<mud::Prefab>>(), "fetch", member_address(&mud::AssetStore<mud::Prefab>::fetch), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Prefab>>(object).fetch(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Prefab>()) },
-                { type<mud::AssetStore<mud::Prefab>>(), "file_at", member_address(&mud::AssetStore<mud::Prefab>::file_at), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Prefab>>(object).file_at(val<cstring>(args[0]), val<cstring>(args[1]))); }, { { "path", var(cstring()) }, { "name", var(cstring()) } }, Ref(type<mud::Prefab>()) },
-                { type<mud::AssetStore<mud::Prefab>>(), "file", member_address(&mud::AssetStore<mud::Prefab>::file), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Prefab>>(object).file(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Prefab>()) }
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::AssetStore<mud::Prefab>>();
+        lazy_class<mud::AssetStore<mud::Prefab>>([] {
+            static Class cls = { type<mud::AssetStore<mud::Prefab>>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                    { type<mud::AssetStore<mud::Prefab>>(), "get", member_address(&mud::AssetStore<mud::Prefab>::get), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Prefab>>(object).get(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Prefab>()) },
+                    { type<mud::AssetStore<mud::Prefab>>(), "create", member_address(&mud::AssetStore<mud::Prefab>::create), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Prefab>>(object).create(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Prefab>()) },
+                    { type<mud::AssetStore<mud::Prefab>>(), "fetch", member_address(&mud::AssetStore<mud::Prefab>::fetch), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Prefab>>(object).fetch(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Prefab>()) },
+                    { type<mud::AssetStore<mud::Prefab>>(), "file_at", member_address(&mud::AssetStore<mud::Prefab>::file_at), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Prefab>>(object).file_at(val<cstring>(args[0]), val<cstring>(args[1]))); }, { { "path", var(cstring()) }, { "name", var(cstring()) } }, Ref(type<mud::Prefab>()) },
+                    { type<mud::AssetStore<mud::Prefab>>(), "file", member_address(&mud::AssetStore<mud::Prefab>::file), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Prefab>>(object).file(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Prefab>()) }
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::AssetStore<mud::Prefab>>();
+        });
     }
     
     
@@ -666,36 +694,38 @@ namespace mud
     // mud::AssetStore<mud::Program>
     {
         static Meta meta = { type<mud::AssetStore<mud::Program>>(), &namspc({ "mud" }), "AssetStore<mud::Program>", sizeof(mud::AssetStore<mud::Program>), TypeClass::Object };
-        static Class cls = { type<mud::AssetStore<mud::Program>>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-                { type<mud::AssetStore<mud::Program>>(), "get", member_address(&mud::AssetStore<mud::Program>::get), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Program>>(object).get(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Program>()) },
-                { type<mud::AssetStore<mud::Program>>(), "create", member_address(&mud::AssetStore<mud::Program>::create), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Program>>(object).create(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Program>()) },
-                { type<mud::AssetStore<mud::Program>>(), "fetch", member_address(&mud::AssetStore<mud::Program>::fetch), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Program>>(object).fetch(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Program>()) },
-                { type<mud::AssetStore<mud::Program>>(), "file_at", member_address(&mud::AssetStore<mud::Program>::file_at), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Program>>(object).file_at(val<cstring>(args[0]), val<cstring>(args[1]))); }, { { "path", var(cstring()) }, { "name", var(cstring()) } }, Ref(type<mud::Program>()) },
-                { type<mud::AssetStore<mud::Program>>(), "file", member_address(&mud::AssetStore<mud::Program>::file), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Program>>(object).file(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Program>()) }
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::AssetStore<mud::Program>>();
+        lazy_class<mud::AssetStore<mud::Program>>([] {
+            static Class cls = { type<mud::AssetStore<mud::Program>>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                    { type<mud::AssetStore<mud::Program>>(), "get", member_address(&mud::AssetStore<mud::Program>::get), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Program>>(object).get(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Program>()) },
+                    { type<mud::AssetStore<mud::Program>>(), "create", member_address(&mud::AssetStore<mud::Program>::create), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Program>>(object).create(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Program>()) },
+                    { type<mud::AssetStore<mud::Program>>(), "fetch", member_address(&mud::AssetStore<mud::Program>::fetch), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Program>>(object).fetch(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Program>()) },
+                    { type<mud::AssetStore<mud::Program>>(), "file_at", member_address(&mud::AssetStore<mud::Program>::file_at), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Program>>(object).file_at(val<cstring>(args[0]), val<cstring>(args[1]))); }, { { "path", var(cstring()) }, { "name", var(cstring()) } }, Ref(type<mud::Program>()) },
+                    { type<mud::AssetStore<mud::Program>>(), "file", member_address(&mud::AssetStore<mud::Program>::file), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Program>>(object).file(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Program>()) }
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::AssetStore<mud::Program>>();
+        });
     }
     
     
@@ -703,36 +733,38 @@ namespace mud
     // mud::AssetStore<mud::Texture>
     {
         static Meta meta = { type<mud::AssetStore<mud::Texture>>(), &namspc({ "mud" }), "AssetStore<mud::Texture>", sizeof(mud::AssetStore<mud::Texture>), TypeClass::Object };
-        static Class cls = { type<mud::AssetStore<mud::Texture>>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-                { type<mud::AssetStore<mud::Texture>>(), "get", member_address(&mud::AssetStore<mud::Texture>::get), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Texture>>(object).get(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Texture>()) },
-                { type<mud::AssetStore<mud::Texture>>(), "create", member_address(&mud::AssetStore<mud::Texture>::create), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Texture>>(object).create(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Texture>()) },
-                { type<mud::AssetStore<mud::Texture>>(), "fetch", member_address(&mud::AssetStore<mud::Texture>::fetch), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Texture>>(object).fetch(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Texture>()) },
-                { type<mud::AssetStore<mud::Texture>>(), "file_at", member_address(&mud::AssetStore<mud::Texture>::file_at), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Texture>>(object).file_at(val<cstring>(args[0]), val<cstring>(args[1]))); }, { { "path", var(cstring()) }, { "name", var(cstring()) } }, Ref(type<mud::Texture>()) },
-                { type<mud::AssetStore<mud::Texture>>(), "file", member_address(&mud::AssetStore<mud::Texture>::file), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Texture>>(object).file(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Texture>()) }
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::AssetStore<mud::Texture>>();
+        lazy_class<mud::AssetStore<mud::Texture>>([] {
+            static Class cls = { type<mud::AssetStore<mud::Texture>>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                    { type<mud::AssetStore<mud::Texture>>(), "get", member_address(&mud::AssetStore<mud::Texture>::get), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Texture>>(object).get(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Texture>()) },
+                    { type<mud::AssetStore<mud::Texture>>(), "create", member_address(&mud::AssetStore<mud::Texture>::create), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Texture>>(object).create(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Texture>()) },
+                    { type<mud::AssetStore<mud::Texture>>(), "fetch", member_address(&mud::AssetStore<mud::Texture>::fetch), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Texture>>(object).fetch(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Texture>()) },
+                    { type<mud::AssetStore<mud::Texture>>(), "file_at", member_address(&mud::AssetStore<mud::Texture>::file_at), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::AssetStore<mud::Texture>>(object).file_at(val<cstring>(args[0]), val<cstring>(args[1]))); }, { { "path", var(cstring()) }, { "name", var(cstring()) } }, Ref(type<mud::Texture>()) },
+                    { type<mud::AssetStore<mud::Texture>>(), "file", member_address(&mud::AssetStore<mud::Texture>::file), [](Ref object, array<Var> args, Var& result) { result = Ref(val<mud::AssetStore<mud::Texture>>(object).file(val<cstring>(args[0]))); }, { { "name", var(cstring()) } }, Ref(type<mud::Texture>()) }
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::AssetStore<mud::Texture>>();
+        });
     }
     
 
@@ -740,78 +772,82 @@ namespace mud
 	// mud::Animated
 	{
 		static Meta meta = { type<mud::Animated>(), &namspc({ "mud" }), "Animated", sizeof(mud::Animated), TypeClass::Object };
-		static Class cls = { type<mud::Animated>(),
-		// bases
-		{},
-		{},
-		// constructors
-		{
-		},
-		// copy constructor
-		{
-		},
-		// members
-		{
-			//{ type<mud::Animated>(), member_address(&mud::Animated::m_playing), type<std::vector<mud::AnimationPlay>>(), "playing", var(std::vector<mud::AnimationPlay>()), Member::Value, nullptr },
-			{ type<mud::Animated>(), member_address(&mud::Animated::m_queue), type<std::vector<mud::Animation*>>(), "queue", var(std::vector<mud::Animation*>()), Member::Value, nullptr },
-			{ type<mud::Animated>(), member_address(&mud::Animated::m_active), type<bool>(), "active", var(bool(true)), Member::Value, nullptr },
-			{ type<mud::Animated>(), member_address(&mud::Animated::m_speed_scale), type<float>(), "speed_scale", var(float(1.f)), Member::Value, nullptr },
-			{ type<mud::Animated>(), member_address(&mud::Animated::m_default_blend_time), type<float>(), "default_blend_time", var(float(1.f)), Member::Value, nullptr }
-		},
-		// methods
-		{
-			//{ type<mud::Animated>(), "play", member_address<void (mud::Animated::*)(const Animation&, bool, float, float, bool)>(&mud::Animated::play), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Animated>(object).play(val<mud::Animation>(args[0]), val<bool>(args[1]), val<float>(args[2]), val<float>(args[3]), val<bool>(args[4])); },{ { "animation", Ref(type<mud::Animation>()) },{ "loop", var(bool()) },{ "blend", var(float(0.f)), Param::Default },{ "speed", var(float(1.f)), Param::Default },{ "transient", var(bool(false)), Param::Default } }, Var() },
-			{ type<mud::Animated>(), "play", member_address<void (mud::Animated::*)(cstring, bool, float, float, bool)>(&mud::Animated::play), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Animated>(object).play(val<cstring>(args[0]), val<bool>(args[1]), val<float>(args[2]), val<float>(args[3]), val<bool>(args[4])); },{ { "animation", var(cstring()) },{ "loop", var(bool()) },{ "blend", var(float(0.f)), Param::Default },{ "speed", var(float(1.f)), Param::Default },{ "transient", var(bool(false)), Param::Default } }, Var() },
-			{ type<mud::Animated>(), "seek", member_address(&mud::Animated::seek), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Animated>(object).seek(val<float>(args[0])); },{ { "time", var(float()) } }, Var() },
-			{ type<mud::Animated>(), "pause", member_address(&mud::Animated::pause), [](Ref object, array<Var> args, Var& result) { UNUSED(result); UNUSED(args); val<mud::Animated>(object).pause(); },{}, Var() },
-			{ type<mud::Animated>(), "stop", member_address(&mud::Animated::stop), [](Ref object, array<Var> args, Var& result) { UNUSED(result); UNUSED(args); val<mud::Animated>(object).stop(); },{}, Var() },
-			{ type<mud::Animated>(), "advance", member_address(&mud::Animated::advance), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Animated>(object).advance(val<float>(args[0])); },{ { "time", var(float()) } }, Var() },
-			{ type<mud::Animated>(), "next_animation", member_address(&mud::Animated::next_animation), [](Ref object, array<Var> args, Var& result) { UNUSED(result); UNUSED(args); val<mud::Animated>(object).next_animation(); },{}, Var() },
-			{ type<mud::Animated>(), "playing", member_address(&mud::Animated::playing), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<std::string>(result) = val<mud::Animated>(object).playing(); },{}, var(std::string()) }
-		},
-		// static members
-		{
-		}
-		};
+		lazy_class<mud::Animated>([] {
+			static Class cls = { type<mud::Animated>(),
+			// bases
+			{},
+			{},
+			// constructors
+			{
+			},
+			// copy constructor
+			{
+			},
+			// members
+			{
+				//{ type<mud::Animated>(), member_address(&mud::Animated::m_playing), type<std::vector<mud::AnimationPlay>>(), "playing", var(std::vector<mud::AnimationPlay>()), Member::Value, nullptr },
+				{ type<mud::Animated>(), member_address(&mud::Animated::m_queue), type<std::vector<mud::Animation*>>(), "queue", var(std::vector<mud::Animation*>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Animated>(object).m_queue); }, [](Ref object, Ref value) { member_assign(val<mud::Animated>(object).m_queue, value); } },
+				{ type<mud::Animated>(), member_address(&mud::Animated::m_active), type<bool>(), "active", var(bool(true)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Animated>(object).m_active); }, [](Ref object, Ref value) { member_assign(val<mud::Animated>(object).m_active, value); } },
+				{ type<mud::Animated>(), member_address(&mud::Animated::m_speed_scale), type<float>(), "speed_scale", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Animated>(object).m_speed_scale); }, [](Ref object, Ref value) { member_assign(val<mud::Animated>(object).m_speed_scale, value); } },
+				{ type<mud::Animated>(), member_address(&mud::Animated::m_default_blend_time), type<float>(), "default_blend_time", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Animated>(object).m_default_blend_time); }, [](Ref object, Ref value) { member_assign(val<mud::Animated>(object).m_default_blend_time, value); } }
+			},
+			// methods
+			{
+				//{ type<mud::Animated>(), "play", member_address<void (mud::Animated::*)(const Animation&, bool, float, float, bool)>(&mud::Animated::play), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Animated>(object).play(val<mud::Animation>(args[0]), val<bool>(args[1]), val<float>(args[2]), val<float>(args[3]), val<bool>(args[4])); },{ { "animation", Ref(type<mud::Animation>()) },{ "loop", var(bool()) },{ "blend", var(float(0.f)), Param::Default },{ "speed", var(float(1.f)), Param::Default },{ "transient", var(bool(false)), Param::Default } }, Var() },
+				{ type<mud::Animated>(), "play", member_address<void (mud::Animated::*)(cstring, bool, float, float, bool)>(&mud::Animated::play), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Animated>(object).play(val<cstring>(args[0]), val<bool>(args[1]), val<float>(args[2]), val<float>(args[3]), val<bool>(args[4])); },{ { "animation", var(cstring()) },{ "loop", var(bool()) },{ "blend", var(float(0.f)), Param::Default },{ "speed", var(float(1.f)), Param::Default },{ "transient", var(bool(false)), Param::Default } }, Var() },
+				{ type<mud::Animated>(), "seek", member_address(&mud::Animated::seek), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Animated>(object).seek(val<float>(args[0])); },{ { "time", var(float()) } }, Var() },
+				{ type<mud::Animated>(), "pause", member_address(&mud::Animated::pause), [](Ref object, array<Var> args, Var& result) { UNUSED(result); UNUSED(args); val<mud::Animated>(object).pause(); },{}, Var() },
+				{ type<mud::Animated>(), "stop", member_address(&mud::Animated::stop), [](Ref object, array<Var> args, Var& result) { UNUSED(result); UNUSED(args); val<mud::Animated>(object).stop(); },{}, Var() },
+				{ type<mud::Animated>(), "advance", member_address(&mud::Animated::advance), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Animated>(object).advance(val<float>(args[0])); },{ { "time", var(float()) } }, Var() },
+				{ type<mud::Animated>(), "next_animation", member_address(&mud::Animated::next_animation), [](Ref object, array<Var> args, Var& result) { UNUSED(result); UNUSED(args); val<mud::Animated>(object).next_animation(); },{}, Var() },
+				{ type<mud::Animated>(), "playing", member_address(&mud::Animated::playing), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<std::string>(result) = val<mud::Animated>(object).playing(); },{}, var(std::string()) }
+			},
+			// static members
+			{
+			}
+			};
 
 
 
 
-		meta_class<mud::Animated>();
+			init_class<mud::Animated>();
+		});
 	}
         
     // mud::Background
     {
         static Meta meta = { type<mud::Background>(), &namspc({ "mud" }), "Background", sizeof(mud::Background), TypeClass::Struct };
-        static Class cls = { type<mud::Background>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Background>(), [](Ref ref, Ref other) { new(&val<mud::Background>(ref)) mud::Background(val<mud::Background>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Background>(), member_address(&mud::Background::m_mode), type<mud::BackgroundMode>(), "mode", var(mud::BackgroundMode()), Member::Value, nullptr },
-                { type<mud::Background>(), member_address(&mud::Background::m_colour), type<mud::Colour>(), "colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::Background>(), member_address(&mud::Background::m_custom_program), type<mud::Program>(), "custoprogram", Ref(type<mud::Program>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Background>();
+        lazy_class<mud::Background>([] {
+            static Class cls = { type<mud::Background>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Background>(), [](Ref ref, Ref other) { new(&val<mud::Background>(ref)) mud::Background(val<mud::Background>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Background>(), member_address(&mud::Background::m_mode), type<mud::BackgroundMode>(), "mode", var(mud::BackgroundMode()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Background>(object).m_mode); }, [](Ref object, Ref value) { member_assign(val<mud::Background>(object).m_mode, value); } },
+                    { type<mud::Background>(), member_address(&mud::Background::m_colour), type<mud::Colour>(), "colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Background>(object).m_colour); }, [](Ref object, Ref value) { member_assign(val<mud::Background>(object).m_colour, value); } },
+                    { type<mud::Background>(), member_address(&mud::Background::m_custom_program), type<mud::Program>(), "custoprogram", Ref(type<mud::Program>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Background>();
+        });
     }
     
     
@@ -819,42 +855,44 @@ namespace mud
     // mud::BaseMaterialBlock
     {
         static Meta meta = { type<mud::BaseMaterialBlock>(), &namspc({ "mud" }), "BaseMaterialBlock", sizeof(mud::BaseMaterialBlock), TypeClass::Struct };
-        static Class cls = { type<mud::BaseMaterialBlock>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::BaseMaterialBlock>(), [](Ref ref, Ref other) { new(&val<mud::BaseMaterialBlock>(ref)) mud::BaseMaterialBlock(val<mud::BaseMaterialBlock>(other)); } }
-            },
-            // members
-            {
-                { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_blend_mode), type<mud::BlendMode>(), "blend_mode", var(mud::BlendMode()), Member::Value, nullptr },
-                { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_cull_mode), type<mud::CullMode>(), "cull_mode", var(mud::CullMode()), Member::Value, nullptr },
-                { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_depth_draw_mode), type<mud::DepthDraw>(), "depth_draw_mode", var(mud::DepthDraw()), Member::Value, nullptr },
-                { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_depth_test), type<mud::DepthTest>(), "depth_test", var(mud::DepthTest()), Member::Value, nullptr },
-                { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_uv1_scale), type<mud::vec2>(), "uv1_scale", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_uv1_offset), type<mud::vec2>(), "uv1_offset", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_uv2_scale), type<mud::vec2>(), "uv2_scale", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_uv2_offset), type<mud::vec2>(), "uv2_offset", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_is_alpha), type<bool>(), "is_alpha", var(bool(false)), Member::Value, nullptr },
-                { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_screen_filter), type<bool>(), "screen_filter", var(bool(false)), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::BaseMaterialBlock>();
+        lazy_class<mud::BaseMaterialBlock>([] {
+            static Class cls = { type<mud::BaseMaterialBlock>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::BaseMaterialBlock>(), [](Ref ref, Ref other) { new(&val<mud::BaseMaterialBlock>(ref)) mud::BaseMaterialBlock(val<mud::BaseMaterialBlock>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_blend_mode), type<mud::BlendMode>(), "blend_mode", var(mud::BlendMode()), Member::Value, nullptr, [](Ref object) { return var(val<mud::BaseMaterialBlock>(object).m_blend_mode); }, [](Ref object, Ref value) { member_assign(val<mud::BaseMaterialBlock>(object).m_blend_mode, value); } },
+                    { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_cull_mode), type<mud::CullMode>(), "cull_mode", var(mud::CullMode()), Member::Value, nullptr, [](Ref object) { return var(val<mud::BaseMaterialBlock>(object).m_cull_mode); }, [](Ref object, Ref value) { member_assign(val<mud::BaseMaterialBlock>(object).m_cull_mode, value); } },
+                    { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_depth_draw_mode), type<mud::DepthDraw>(), "depth_draw_mode", var(mud::DepthDraw()), Member::Value, nullptr, [](Ref object) { return var(val<mud::BaseMaterialBlock>(object).m_depth_draw_mode); }, [](Ref object, Ref value) { member_assign(val<mud::BaseMaterialBlock>(object).m_depth_draw_mode, value); } },
+                    { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_depth_test), type<mud::DepthTest>(), "depth_test", var(mud::DepthTest()), Member::Value, nullptr, [](Ref object) { return var(val<mud::BaseMaterialBlock>(object).m_depth_test); }, [](Ref object, Ref value) { member_assign(val<mud::BaseMaterialBlock>(object).m_depth_test, value); } },
+                    { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_uv1_scale), type<mud::vec2>(), "uv1_scale", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::BaseMaterialBlock>(object).m_uv1_scale); }, [](Ref object, Ref value) { member_assign(val<mud::BaseMaterialBlock>(object).m_uv1_scale, value); } },
+                    { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_uv1_offset), type<mud::vec2>(), "uv1_offset", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::BaseMaterialBlock>(object).m_uv1_offset); }, [](Ref object, Ref value) { member_assign(val<mud::BaseMaterialBlock>(object).m_uv1_offset, value); } },
+                    { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_uv2_scale), type<mud::vec2>(), "uv2_scale", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::BaseMaterialBlock>(object).m_uv2_scale); }, [](Ref object, Ref value) { member_assign(val<mud::BaseMaterialBlock>(object).m_uv2_scale, value); } },
+                    { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_uv2_offset), type<mud::vec2>(), "uv2_offset", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::BaseMaterialBlock>(object).m_uv2_offset); }, [](Ref object, Ref value) { member_assign(val<mud::BaseMaterialBlock>(object).m_uv2_offset, value); } },
+                    { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_is_alpha), type<bool>(), "is_alpha", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::BaseMaterialBlock>(object).m_is_alpha); }, [](Ref object, Ref value) { member_assign(val<mud::BaseMaterialBlock>(object).m_is_alpha, value); } },
+                    { type<mud::BaseMaterialBlock>(), member_address(&mud::BaseMaterialBlock::m_screen_filter), type<bool>(), "screen_filter", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::BaseMaterialBlock>(object).m_screen_filter); }, [](Ref object, Ref value) { member_assign(val<mud::BaseMaterialBlock>(object).m_screen_filter, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::BaseMaterialBlock>();
+        });
     }
     
     
@@ -863,35 +901,37 @@ namespace mud
     // mud::Bone
     {
         static Meta meta = { type<mud::Bone>(), &namspc({ "mud" }), "Bone", sizeof(mud::Bone), TypeClass::Struct };
-        static Class cls = { type<mud::Bone>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Bone>(), [](Ref ref, Ref other) { new(&val<mud::Bone>(ref)) mud::Bone(val<mud::Bone>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Bone>(), member_address(&mud::Bone::m_position), type<mud::vec3>(), "position", var(mud::vec3()), Member::Value, nullptr },
-                { type<mud::Bone>(), member_address(&mud::Bone::m_rotation), type<mud::quat>(), "rotation", var(mud::quat()), Member::Value, nullptr },
-                { type<mud::Bone>(), member_address(&mud::Bone::m_scale), type<mud::vec3>(), "scale", var(mud::vec3()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Bone>();
+        lazy_class<mud::Bone>([] {
+            static Class cls = { type<mud::Bone>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Bone>(), [](Ref ref, Ref other) { new(&val<mud::Bone>(ref)) mud::Bone(val<mud::Bone>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Bone>(), member_address(&mud::Bone::m_position), type<mud::vec3>(), "position", var(mud::vec3()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Bone>(object).m_position); }, [](Ref object, Ref value) { member_assign(val<mud::Bone>(object).m_position, value); } },
+                    { type<mud::Bone>(), member_address(&mud::Bone::m_rotation), type<mud::quat>(), "rotation", var(mud::quat()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Bone>(object).m_rotation); }, [](Ref object, Ref value) { member_assign(val<mud::Bone>(object).m_rotation, value); } },
+                    { type<mud::Bone>(), member_address(&mud::Bone::m_scale), type<mud::vec3>(), "scale", var(mud::vec3()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Bone>(object).m_scale); }, [](Ref object, Ref value) { member_assign(val<mud::Bone>(object).m_scale, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Bone>();
+        });
     }
     
     
@@ -899,44 +939,46 @@ namespace mud
     // mud::Camera
     {
         static Meta meta = { type<mud::Camera>(), &namspc({ "mud" }), "Camera", sizeof(mud::Camera), TypeClass::Object };
-        static Class cls = { type<mud::Camera>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                //{ type<mud::Camera>(), member_address(&mud::Camera::m_scene), type<mud::Scene>(), "scene", Ref(type<mud::Scene>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::Camera>(), member_address(&mud::Camera::m_eye), type<mud::vec3>(), "eye", var(mud::vec3()), Member::Value, nullptr },
-                { type<mud::Camera>(), member_address(&mud::Camera::m_target), type<mud::vec3>(), "target", var(mud::vec3()), Member::Value, nullptr },
-                { type<mud::Camera>(), member_address(&mud::Camera::m_transform), type<mud::mat4>(), "transform", var(mud::mat4()), Member::Value, nullptr },
-                { type<mud::Camera>(), member_address(&mud::Camera::m_projection), type<mud::mat4>(), "projection", var(mud::mat4()), Member::Value, nullptr },
-                { type<mud::Camera>(), member_address(&mud::Camera::m_fov), type<float>(), "fov", var(float(60.f)), Member::Value, nullptr },
-                { type<mud::Camera>(), member_address(&mud::Camera::m_aspect), type<float>(), "aspect", var(float(1.f)), Member::Value, nullptr },
-                { type<mud::Camera>(), member_address(&mud::Camera::m_near), type<float>(), "near", var(float(0.001f)), Member::Value, nullptr },
-                { type<mud::Camera>(), member_address(&mud::Camera::m_far), type<float>(), "far", var(float(100.f)), Member::Value, nullptr },
-                { type<mud::Camera>(), member_address(&mud::Camera::m_orthographic), type<bool>(), "orthographic", var(bool(false)), Member::Value, nullptr },
-                { type<mud::Camera>(), member_address(&mud::Camera::m_height), type<float>(), "height", var(float(1.f)), Member::Value, nullptr },
-                { type<mud::Camera>(), member_address(&mud::Camera::m_optimize_ends), type<bool>(), "optimize_ends", var(bool(true)), Member::Value, nullptr },
-                { type<mud::Camera>(), member_address(&mud::Camera::m_lod_offsets), type<mud::vec4>(), "lod_offsets", var(mud::vec4()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Camera>();
+        lazy_class<mud::Camera>([] {
+            static Class cls = { type<mud::Camera>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    //{ type<mud::Camera>(), member_address(&mud::Camera::m_scene), type<mud::Scene>(), "scene", Ref(type<mud::Scene>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::Camera>(), member_address(&mud::Camera::m_eye), type<mud::vec3>(), "eye", var(mud::vec3()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Camera>(object).m_eye); }, [](Ref object, Ref value) { member_assign(val<mud::Camera>(object).m_eye, value); } },
+                    { type<mud::Camera>(), member_address(&mud::Camera::m_target), type<mud::vec3>(), "target", var(mud::vec3()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Camera>(object).m_target); }, [](Ref object, Ref value) { member_assign(val<mud::Camera>(object).m_target, value); } },
+                    { type<mud::Camera>(), member_address(&mud::Camera::m_transform), type<mud::mat4>(), "transform", var(mud::mat4()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Camera>(object).m_transform); }, [](Ref object, Ref value) { member_assign(val<mud::Camera>(object).m_transform, value); } },
+                    { type<mud::Camera>(), member_address(&mud::Camera::m_projection), type<mud::mat4>(), "projection", var(mud::mat4()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Camera>(object).m_projection); }, [](Ref object, Ref value) { member_assign(val<mud::Camera>(object).m_projection, value); } },
+                    { type<mud::Camera>(), member_address(&mud::Camera::m_fov), type<float>(), "fov", var(float(60.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Camera>(object).m_fov); }, [](Ref object, Ref value) { member_assign(val<mud::Camera>(object).m_fov, value); } },
+                    { type<mud::Camera>(), member_address(&mud::Camera::m_aspect), type<float>(), "aspect", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Camera>(object).m_aspect); }, [](Ref object, Ref value) { member_assign(val<mud::Camera>(object).m_aspect, value); } },
+                    { type<mud::Camera>(), member_address(&mud::Camera::m_near), type<float>(), "near", var(float(0.001f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Camera>(object).m_near); }, [](Ref object, Ref value) { member_assign(val<mud::Camera>(object).m_near, value); } },
+                    { type<mud::Camera>(), member_address(&mud::Camera::m_far), type<float>(), "far", var(float(100.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Camera>(object).m_far); }, [](Ref object, Ref value) { member_assign(val<mud::Camera>(object).m_far, value); } },
+                    { type<mud::Camera>(), member_address(&mud::Camera::m_orthographic), type<bool>(), "orthographic", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Camera>(object).m_orthographic); }, [](Ref object, Ref value) { member_assign(val<mud::Camera>(object).m_orthographic, value); } },
+                    { type<mud::Camera>(), member_address(&mud::Camera::m_height), type<float>(), "height", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Camera>(object).m_height); }, [](Ref object, Ref value) { member_assign(val<mud::Camera>(object).m_height, value); } },
+                    { type<mud::Camera>(), member_address(&mud::Camera::m_optimize_ends), type<bool>(), "optimize_ends", var(bool(true)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Camera>(object).m_optimize_ends); }, [](Ref object, Ref value) { member_assign(val<mud::Camera>(object).m_optimize_ends, value); } },
+                    { type<mud::Camera>(), member_address(&mud::Camera::m_lod_offsets), type<mud::vec4>(), "lod_offsets", var(mud::vec4()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Camera>(object).m_lod_offsets); }, [](Ref object, Ref value) { member_assign(val<mud::Camera>(object).m_lod_offsets, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Camera>();
+        });
     }
     
     
@@ -946,32 +988,34 @@ namespace mud
     // mud::DepthParams
     {
         static Meta meta = { type<mud::DepthParams>(), &namspc({ "mud" }), "DepthParams", sizeof(mud::DepthParams), TypeClass::Struct };
-        static Class cls = { type<mud::DepthParams>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::DepthParams>(), [](Ref ref, Ref other) { new(&val<mud::DepthParams>(ref)) mud::DepthParams(val<mud::DepthParams>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
+        lazy_class<mud::DepthParams>([] {
+            static Class cls = { type<mud::DepthParams>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::DepthParams>(), [](Ref ref, Ref other) { new(&val<mud::DepthParams>(ref)) mud::DepthParams(val<mud::DepthParams>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        meta_class<mud::DepthParams>();
+            
+            
+            init_class<mud::DepthParams>();
+        });
     }
     
     
@@ -983,36 +1027,38 @@ namespace mud
     // mud::Environment
     {
         static Meta meta = { type<mud::Environment>(), &namspc({ "mud" }), "Environment", sizeof(mud::Environment), TypeClass::Struct };
-        static Class cls = { type<mud::Environment>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Environment>(), [](Ref ref, Ref other) { new(&val<mud::Environment>(ref)) mud::Environment(val<mud::Environment>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Environment>(), member_address(&mud::Environment::m_background), type<mud::Background>(), "background", var(mud::Background()), Member::Value, nullptr },
-                { type<mud::Environment>(), member_address(&mud::Environment::m_radiance), type<mud::Radiance>(), "radiance", var(mud::Radiance()), Member::Value, nullptr },
-                { type<mud::Environment>(), member_address(&mud::Environment::m_sun), type<mud::Sun>(), "sun", var(mud::Sun()), Member::Value, nullptr },
-                { type<mud::Environment>(), member_address(&mud::Environment::m_fog), type<mud::Fog>(), "fog", var(mud::Fog()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Environment>();
+        lazy_class<mud::Environment>([] {
+            static Class cls = { type<mud::Environment>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Environment>(), [](Ref ref, Ref other) { new(&val<mud::Environment>(ref)) mud::Environment(val<mud::Environment>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Environment>(), member_address(&mud::Environment::m_background), type<mud::Background>(), "background", var(mud::Background()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Environment>(object).m_background); }, [](Ref object, Ref value) { member_assign(val<mud::Environment>(object).m_background, value); } },
+                    { type<mud::Environment>(), member_address(&mud::Environment::m_radiance), type<mud::Radiance>(), "radiance", var(mud::Radiance()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Environment>(object).m_radiance); }, [](Ref object, Ref value) { member_assign(val<mud::Environment>(object).m_radiance, value); } },
+                    { type<mud::Environment>(), member_address(&mud::Environment::m_sun), type<mud::Sun>(), "sun", var(mud::Sun()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Environment>(object).m_sun); }, [](Ref object, Ref value) { member_assign(val<mud::Environment>(object).m_sun, value); } },
+                    { type<mud::Environment>(), member_address(&mud::Environment::m_fog), type<mud::Fog>(), "fog", var(mud::Fog()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Environment>(object).m_fog); }, [](Ref object, Ref value) { member_assign(val<mud::Environment>(object).m_fog, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Environment>();
+        });
     }
     
     
@@ -1021,31 +1067,33 @@ namespace mud
     // mud::Filter
     {
         static Meta meta = { type<mud::Filter>(), &namspc({ "mud" }), "Filter", sizeof(mud::Filter), TypeClass::Object };
-        static Class cls = { type<mud::Filter>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Filter>();
+        lazy_class<mud::Filter>([] {
+            static Class cls = { type<mud::Filter>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Filter>();
+        });
     }
     
     
@@ -1054,44 +1102,46 @@ namespace mud
     // mud::Fog
     {
         static Meta meta = { type<mud::Fog>(), &namspc({ "mud" }), "Fog", sizeof(mud::Fog), TypeClass::Struct };
-        static Class cls = { type<mud::Fog>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Fog>(), [](Ref ref, Ref other) { new(&val<mud::Fog>(ref)) mud::Fog(val<mud::Fog>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Fog>(), member_address(&mud::Fog::m_enabled), type<bool>(), "enabled", var(bool(false)), Member::Value, nullptr },
-                { type<mud::Fog>(), member_address(&mud::Fog::m_density), type<float>(), "density", var(float(0.01f)), Member::Value, nullptr },
-                { type<mud::Fog>(), member_address(&mud::Fog::m_colour), type<mud::Colour>(), "colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::Fog>(), member_address(&mud::Fog::m_depth), type<bool>(), "depth", var(bool(false)), Member::Value, nullptr },
-                { type<mud::Fog>(), member_address(&mud::Fog::m_depth_begin), type<float>(), "depth_begin", var(float(0.f)), Member::Value, nullptr },
-                { type<mud::Fog>(), member_address(&mud::Fog::m_depth_curve), type<float>(), "depth_curve", var(float(1.f)), Member::Value, nullptr },
-                { type<mud::Fog>(), member_address(&mud::Fog::m_height), type<bool>(), "height", var(bool(false)), Member::Value, nullptr },
-                { type<mud::Fog>(), member_address(&mud::Fog::m_height_min), type<float>(), "height_min", var(float(0.f)), Member::Value, nullptr },
-                { type<mud::Fog>(), member_address(&mud::Fog::m_height_max), type<float>(), "height_max", var(float(1.f)), Member::Value, nullptr },
-                { type<mud::Fog>(), member_address(&mud::Fog::m_height_curve), type<float>(), "height_curve", var(float(0.1f)), Member::Value, nullptr },
-                { type<mud::Fog>(), member_address(&mud::Fog::m_transmit), type<bool>(), "transmit", var(bool(false)), Member::Value, nullptr },
-                { type<mud::Fog>(), member_address(&mud::Fog::m_transmit_curve), type<float>(), "transmit_curve", var(float(1.f)), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Fog>();
+        lazy_class<mud::Fog>([] {
+            static Class cls = { type<mud::Fog>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Fog>(), [](Ref ref, Ref other) { new(&val<mud::Fog>(ref)) mud::Fog(val<mud::Fog>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Fog>(), member_address(&mud::Fog::m_enabled), type<bool>(), "enabled", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Fog>(object).m_enabled); }, [](Ref object, Ref value) { member_assign(val<mud::Fog>(object).m_enabled, value); } },
+                    { type<mud::Fog>(), member_address(&mud::Fog::m_density), type<float>(), "density", var(float(0.01f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Fog>(object).m_density); }, [](Ref object, Ref value) { member_assign(val<mud::Fog>(object).m_density, value); } },
+                    { type<mud::Fog>(), member_address(&mud::Fog::m_colour), type<mud::Colour>(), "colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Fog>(object).m_colour); }, [](Ref object, Ref value) { member_assign(val<mud::Fog>(object).m_colour, value); } },
+                    { type<mud::Fog>(), member_address(&mud::Fog::m_depth), type<bool>(), "depth", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Fog>(object).m_depth); }, [](Ref object, Ref value) { member_assign(val<mud::Fog>(object).m_depth, value); } },
+                    { type<mud::Fog>(), member_address(&mud::Fog::m_depth_begin), type<float>(), "depth_begin", var(float(0.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Fog>(object).m_depth_begin); }, [](Ref object, Ref value) { member_assign(val<mud::Fog>(object).m_depth_begin, value); } },
+                    { type<mud::Fog>(), member_address(&mud::Fog::m_depth_curve), type<float>(), "depth_curve", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Fog>(object).m_depth_curve); }, [](Ref object, Ref value) { member_assign(val<mud::Fog>(object).m_depth_curve, value); } },
+                    { type<mud::Fog>(), member_address(&mud::Fog::m_height), type<bool>(), "height", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Fog>(object).m_height); }, [](Ref object, Ref value) { member_assign(val<mud::Fog>(object).m_height, value); } },
+                    { type<mud::Fog>(), member_address(&mud::Fog::m_height_min), type<float>(), "height_min", var(float(0.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Fog>(object).m_height_min); }, [](Ref object, Ref value) { member_assign(val<mud::Fog>(object).m_height_min, value); } },
+                    { type<mud::Fog>(), member_address(&mud::Fog::m_height_max), type<float>(), "height_max", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Fog>(object).m_height_max); }, [](Ref object, Ref value) { member_assign(val<mud::Fog>(object).m_height_max, value); } },
+                    { type<mud::Fog>(), member_address(&mud::Fog::m_height_curve), type<float>(), "height_curve", var(float(0.1f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Fog>(object).m_height_curve); }, [](Ref object, Ref value) { member_assign(val<mud::Fog>(object).m_height_curve, value); } },
+                    { type<mud::Fog>(), member_address(&mud::Fog::m_transmit), type<bool>(), "transmit", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Fog>(object).m_transmit); }, [](Ref object, Ref value) { member_assign(val<mud::Fog>(object).m_transmit, value); } },
+                    { type<mud::Fog>(), member_address(&mud::Fog::m_transmit_curve), type<float>(), "transmit_curve", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Fog>(object).m_transmit_curve); }, [](Ref object, Ref value) { member_assign(val<mud::Fog>(object).m_transmit_curve, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Fog>();
+        });
     }
     
     
@@ -1099,31 +1149,33 @@ namespace mud
     // mud::FrameBuffer
     {
         static Meta meta = { type<mud::FrameBuffer>(), &namspc({ "mud" }), "FrameBuffer", sizeof(mud::FrameBuffer), TypeClass::Object };
-        static Class cls = { type<mud::FrameBuffer>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::FrameBuffer>();
+        lazy_class<mud::FrameBuffer>([] {
+            static Class cls = { type<mud::FrameBuffer>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::FrameBuffer>();
+        });
     }
     
     
@@ -1131,37 +1183,39 @@ namespace mud
     // mud::FresnelMaterialBlock
     {
         static Meta meta = { type<mud::FresnelMaterialBlock>(), &namspc({ "mud" }), "FresnelMaterialBlock", sizeof(mud::FresnelMaterialBlock), TypeClass::Struct };
-        static Class cls = { type<mud::FresnelMaterialBlock>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::FresnelMaterialBlock>(), [](Ref ref, Ref other) { new(&val<mud::FresnelMaterialBlock>(ref)) mud::FresnelMaterialBlock(val<mud::FresnelMaterialBlock>(other)); } }
-            },
-            // members
-            {
-                { type<mud::FresnelMaterialBlock>(), member_address(&mud::FresnelMaterialBlock::m_enabled), type<bool>(), "enabled", var(bool(false)), Member::Value, nullptr },
-                { type<mud::FresnelMaterialBlock>(), member_address(&mud::FresnelMaterialBlock::m_value), type<mud::MaterialParam<mud::Colour>>(), "value", var(mud::MaterialParam<mud::Colour>()), Member::Value, nullptr },
-                { type<mud::FresnelMaterialBlock>(), member_address(&mud::FresnelMaterialBlock::m_fresnel_scale), type<float>(), "fresnel_scale", var(float(1.f)), Member::Value, nullptr },
-                { type<mud::FresnelMaterialBlock>(), member_address(&mud::FresnelMaterialBlock::m_fresnel_bias), type<float>(), "fresnel_bias", var(float(0.01f)), Member::Value, nullptr },
-                { type<mud::FresnelMaterialBlock>(), member_address(&mud::FresnelMaterialBlock::m_fresnel_power), type<float>(), "fresnel_power", var(float(5.f)), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::FresnelMaterialBlock>();
+        lazy_class<mud::FresnelMaterialBlock>([] {
+            static Class cls = { type<mud::FresnelMaterialBlock>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::FresnelMaterialBlock>(), [](Ref ref, Ref other) { new(&val<mud::FresnelMaterialBlock>(ref)) mud::FresnelMaterialBlock(val<mud::FresnelMaterialBlock>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::FresnelMaterialBlock>(), member_address(&mud::FresnelMaterialBlock::m_enabled), type<bool>(), "enabled", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::FresnelMaterialBlock>(object).m_enabled); }, [](Ref object, Ref value) { member_assign(val<mud::FresnelMaterialBlock>(object).m_enabled, value); } },
+                    { type<mud::FresnelMaterialBlock>(), member_address(&mud::FresnelMaterialBlock::m_value), type<mud::MaterialParam<mud::Colour>>(), "value", var(mud::MaterialParam<mud::Colour>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::FresnelMaterialBlock>(object).m_value); }, [](Ref object, Ref value) { member_assign(val<mud::FresnelMaterialBlock>(object).m_value, value); } },
+                    { type<mud::FresnelMaterialBlock>(), member_address(&mud::FresnelMaterialBlock::m_fresnel_scale), type<float>(), "fresnel_scale", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::FresnelMaterialBlock>(object).m_fresnel_scale); }, [](Ref object, Ref value) { member_assign(val<mud::FresnelMaterialBlock>(object).m_fresnel_scale, value); } },
+                    { type<mud::FresnelMaterialBlock>(), member_address(&mud::FresnelMaterialBlock::m_fresnel_bias), type<float>(), "fresnel_bias", var(float(0.01f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::FresnelMaterialBlock>(object).m_fresnel_bias); }, [](Ref object, Ref value) { member_assign(val<mud::FresnelMaterialBlock>(object).m_fresnel_bias, value); } },
+                    { type<mud::FresnelMaterialBlock>(), member_address(&mud::FresnelMaterialBlock::m_fresnel_power), type<float>(), "fresnel_power", var(float(5.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::FresnelMaterialBlock>(object).m_fresnel_power); }, [](Ref object, Ref value) { member_assign(val<mud::FresnelMaterialBlock>(object).m_fresnel_power, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::FresnelMaterialBlock>();
+        });
     }
     
     
@@ -1169,37 +1223,39 @@ namespace mud
     // mud::Frustum
     {
         static Meta meta = { type<mud::Frustum>(), &namspc({ "mud" }), "Frustum", sizeof(mud::Frustum), TypeClass::Object };
-        static Class cls = { type<mud::Frustum>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Frustum>(), member_address(&mud::Frustum::m_fov), type<float>(), "fov", var(float(60.f)), Member::Value, nullptr },
-                { type<mud::Frustum>(), member_address(&mud::Frustum::m_aspect), type<float>(), "aspect", var(float(1.f)), Member::Value, nullptr },
-                { type<mud::Frustum>(), member_address(&mud::Frustum::m_near), type<float>(), "near", var(float()), Member::Value, nullptr },
-                { type<mud::Frustum>(), member_address(&mud::Frustum::m_far), type<float>(), "far", var(float()), Member::Value, nullptr },
-                { type<mud::Frustum>(), member_address(&mud::Frustum::m_center), type<mud::vec3>(), "center", var(mud::vec3()), Member::Value, nullptr },
-                { type<mud::Frustum>(), member_address(&mud::Frustum::m_radius), type<float>(), "radius", var(float()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Frustum>();
+        lazy_class<mud::Frustum>([] {
+            static Class cls = { type<mud::Frustum>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Frustum>(), member_address(&mud::Frustum::m_fov), type<float>(), "fov", var(float(60.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Frustum>(object).m_fov); }, [](Ref object, Ref value) { member_assign(val<mud::Frustum>(object).m_fov, value); } },
+                    { type<mud::Frustum>(), member_address(&mud::Frustum::m_aspect), type<float>(), "aspect", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Frustum>(object).m_aspect); }, [](Ref object, Ref value) { member_assign(val<mud::Frustum>(object).m_aspect, value); } },
+                    { type<mud::Frustum>(), member_address(&mud::Frustum::m_near), type<float>(), "near", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Frustum>(object).m_near); }, [](Ref object, Ref value) { member_assign(val<mud::Frustum>(object).m_near, value); } },
+                    { type<mud::Frustum>(), member_address(&mud::Frustum::m_far), type<float>(), "far", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Frustum>(object).m_far); }, [](Ref object, Ref value) { member_assign(val<mud::Frustum>(object).m_far, value); } },
+                    { type<mud::Frustum>(), member_address(&mud::Frustum::m_center), type<mud::vec3>(), "center", var(mud::vec3()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Frustum>(object).m_center); }, [](Ref object, Ref value) { member_assign(val<mud::Frustum>(object).m_center, value); } },
+                    { type<mud::Frustum>(), member_address(&mud::Frustum::m_radius), type<float>(), "radius", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Frustum>(object).m_radius); }, [](Ref object, Ref value) { member_assign(val<mud::Frustum>(object).m_radius, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Frustum>();
+        });
     }
     
     
@@ -1207,32 +1263,34 @@ namespace mud
     // mud::FrustumSlice
     {
         static Meta meta = { type<mud::FrustumSlice>(), &namspc({ "mud" }), "FrustumSlice", sizeof(mud::FrustumSlice), TypeClass::Struct };
-        static Class cls = { type<mud::FrustumSlice>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::FrustumSlice>(), [](Ref ref, Ref other) { new(&val<mud::FrustumSlice>(ref)) mud::FrustumSlice(val<mud::FrustumSlice>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::FrustumSlice>();
+        lazy_class<mud::FrustumSlice>([] {
+            static Class cls = { type<mud::FrustumSlice>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::FrustumSlice>(), [](Ref ref, Ref other) { new(&val<mud::FrustumSlice>(ref)) mud::FrustumSlice(val<mud::FrustumSlice>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::FrustumSlice>();
+        });
     }
     
     
@@ -1240,33 +1298,35 @@ namespace mud
     // mud::GfxBlock
     {
         static Meta meta = { type<mud::GfxBlock>(), &namspc({ "mud" }), "GfxBlock", sizeof(mud::GfxBlock), TypeClass::Object };
-        static Class cls = { type<mud::GfxBlock>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::GfxBlock>(), Address(), type<mud::Type>(), "type", Ref(type<mud::Type>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::GfxBlock>(object).m_type); } },
-                { type<mud::GfxBlock>(), member_address(&mud::GfxBlock::m_index), type<uint8_t>(), "index", var(uint8_t()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::GfxBlock>();
+        lazy_class<mud::GfxBlock>([] {
+            static Class cls = { type<mud::GfxBlock>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::GfxBlock>(), Address(), type<mud::Type>(), "type", Ref(type<mud::Type>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::GfxBlock>(object).m_type); } },
+                    { type<mud::GfxBlock>(), member_address(&mud::GfxBlock::m_index), type<uint8_t>(), "index", var(uint8_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::GfxBlock>(object).m_index); }, [](Ref object, Ref value) { member_assign(val<mud::GfxBlock>(object).m_index, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::GfxBlock>();
+        });
     }
     
     
@@ -1274,31 +1334,33 @@ namespace mud
     // mud::GfxContext
     {
         static Meta meta = { type<mud::GfxContext>(), &namspc({ "mud" }), "GfxContext", sizeof(mud::GfxContext), TypeClass::Object };
-        static Class cls = { type<mud::GfxContext>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::GfxContext>();
+        lazy_class<mud::GfxContext>([] {
+            static Class cls = { type<mud::GfxContext>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::GfxContext>();
+        });
     }
     
     
@@ -1306,40 +1368,42 @@ namespace mud
     // mud::GfxSystem
     {
         static Meta meta = { type<mud::GfxSystem>(), &namspc({ "mud" }), "GfxSystem", sizeof(mud::GfxSystem), TypeClass::Object };
-        static Class cls = { type<mud::GfxSystem>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::GfxSystem>(), member_address(&mud::GfxSystem::textures), type<mud::AssetStore<mud::Texture>>(), "textures", Ref(type<mud::AssetStore<mud::Texture>>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::GfxSystem>(object).textures()); } },
-                { type<mud::GfxSystem>(), member_address(&mud::GfxSystem::programs), type<mud::AssetStore<mud::Program>>(), "programs", Ref(type<mud::AssetStore<mud::Program>>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::GfxSystem>(object).programs()); } },
-                { type<mud::GfxSystem>(), member_address(&mud::GfxSystem::materials), type<mud::AssetStore<mud::Material>>(), "materials", Ref(type<mud::AssetStore<mud::Material>>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::GfxSystem>(object).materials()); } },
-                { type<mud::GfxSystem>(), member_address(&mud::GfxSystem::models), type<mud::AssetStore<mud::Model>>(), "models", Ref(type<mud::AssetStore<mud::Model>>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::GfxSystem>(object).models()); } },
-                { type<mud::GfxSystem>(), member_address(&mud::GfxSystem::particles), type<mud::AssetStore<mud::ParticleGenerator>>(), "particles", Ref(type<mud::AssetStore<mud::ParticleGenerator>>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::GfxSystem>(object).particles()); } },
-                { type<mud::GfxSystem>(), member_address(&mud::GfxSystem::prefabs), type<mud::AssetStore<mud::Prefab>>(), "prefabs", Ref(type<mud::AssetStore<mud::Prefab>>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::GfxSystem>(object).prefabs()); } }
-            },
-            // methods
-            {
-				{ type<mud::GfxSystem>(), "add_resource_path", member_address(&mud::GfxSystem::add_resource_path), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::GfxSystem>(object).add_resource_path(val<cstring>(args[0])); },{ { "path", var(cstring()) } }, Ref() },
-				{ type<mud::GfxSystem>(), "fetch_symbol", member_address(&mud::GfxSystem::fetch_symbol), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::GfxSystem>(object).fetch_symbol(val<mud::Symbol>(args[0]), val<mud::Shape>(args[1]), val<mud::DrawMode>(args[2]))); }, { { "symbol", Ref(type<mud::Symbol>()) }, { "shape", Ref(type<mud::Shape>()) }, { "draw_mode", var(mud::DrawMode()) } }, Ref(type<mud::Model>()) },
-				{ type<mud::GfxSystem>(), "fetch_symbol_material", member_address(&mud::GfxSystem::fetch_symbol_material), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::GfxSystem>(object).fetch_symbol_material(val<mud::Symbol>(args[0]), val<mud::DrawMode>(args[1]))); }, { { "symbol", Ref(type<mud::Symbol>()) }, { "draw_mode", var(mud::DrawMode()) } }, Ref(type<mud::Material>()) }
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::GfxSystem>();
+        lazy_class<mud::GfxSystem>([] {
+            static Class cls = { type<mud::GfxSystem>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::GfxSystem>(), member_address(&mud::GfxSystem::textures), type<mud::AssetStore<mud::Texture>>(), "textures", Ref(type<mud::AssetStore<mud::Texture>>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::GfxSystem>(object).textures()); } },
+                    { type<mud::GfxSystem>(), member_address(&mud::GfxSystem::programs), type<mud::AssetStore<mud::Program>>(), "programs", Ref(type<mud::AssetStore<mud::Program>>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::GfxSystem>(object).programs()); } },
+                    { type<mud::GfxSystem>(), member_address(&mud::GfxSystem::materials), type<mud::AssetStore<mud::Material>>(), "materials", Ref(type<mud::AssetStore<mud::Material>>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::GfxSystem>(object).materials()); } },
+                    { type<mud::GfxSystem>(), member_address(&mud::GfxSystem::models), type<mud::AssetStore<mud::Model>>(), "models", Ref(type<mud::AssetStore<mud::Model>>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::GfxSystem>(object).models()); } },
+                    { type<mud::GfxSystem>(), member_address(&mud::GfxSystem::particles), type<mud::AssetStore<mud::ParticleGenerator>>(), "particles", Ref(type<mud::AssetStore<mud::ParticleGenerator>>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::GfxSystem>(object).particles()); } },
+                    { type<mud::GfxSystem>(), member_address(&mud::GfxSystem::prefabs), type<mud::AssetStore<mud::Prefab>>(), "prefabs", Ref(type<mud::AssetStore<mud::Prefab>>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::GfxSystem>(object).prefabs()); } }
+                },
+                // methods
+                {
+    				{ type<mud::GfxSystem>(), "add_resource_path", member_address(&mud::GfxSystem::add_resource_path), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::GfxSystem>(object).add_resource_path(val<cstring>(args[0])); },{ { "path", var(cstring()) } }, Ref() },
+    				{ type<mud::GfxSystem>(), "fetch_symbol", member_address(&mud::GfxSystem::fetch_symbol), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::GfxSystem>(object).fetch_symbol(val<mud::Symbol>(args[0]), val<mud::Shape>(args[1]), val<mud::DrawMode>(args[2]))); }, { { "symbol", Ref(type<mud::Symbol>()) }, { "shape", Ref(type<mud::Shape>()) }, { "draw_mode", var(mud::DrawMode()) } }, Ref(type<mud::Model>()) },
+    				{ type<mud::GfxSystem>(), "fetch_symbol_material", member_address(&mud::GfxSystem::fetch_symbol_material), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::GfxSystem>(object).fetch_symbol_material(val<mud::Symbol>(args[0]), val<mud::DrawMode>(args[1]))); }, { { "symbol", Ref(type<mud::Symbol>()) }, { "draw_mode", var(mud::DrawMode()) } }, Ref(type<mud::Material>()) }
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::GfxSystem>();
+        });
     }
     
     
@@ -1348,31 +1412,33 @@ namespace mud
     // mud::ImmediateDraw
     {
         static Meta meta = { type<mud::ImmediateDraw>(), &namspc({ "mud" }), "ImmediateDraw", sizeof(mud::ImmediateDraw), TypeClass::Object };
-        static Class cls = { type<mud::ImmediateDraw>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::ImmediateDraw>();
+        lazy_class<mud::ImmediateDraw>([] {
+            static Class cls = { type<mud::ImmediateDraw>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::ImmediateDraw>();
+        });
     }
     
     
@@ -1380,39 +1446,41 @@ namespace mud
     // mud::Item
     {
         static Meta meta = { type<mud::Item>(), &namspc({ "mud" }), "Item", sizeof(mud::Item), TypeClass::Object };
-        static Class cls = { type<mud::Item>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Item>(), Address(), type<mud::Node3>(), "node", Ref(type<mud::Node3>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Item>(object).m_node); } },
-                { type<mud::Item>(), member_address(&mud::Item::m_model), type<mud::Model>(), "model", Ref(type<mud::Model>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::Item>(), member_address(&mud::Item::m_flags), type<uint32_t>(), "flags", var(uint32_t()), Member::Value, nullptr },
-                { type<mud::Item>(), member_address(&mud::Item::m_colour), type<mud::Colour>(), "colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::Item>(), member_address(&mud::Item::m_material), type<mud::Material>(), "material", Ref(type<mud::Material>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::Item>(), member_address(&mud::Item::m_visible), type<bool>(), "visible", var(bool(true)), Member::Value, nullptr },
-                { type<mud::Item>(), member_address(&mud::Item::m_cast_shadows), type<mud::ItemShadow>(), "cast_shadows", var(mud::ItemShadow()), Member::Value, nullptr },
-                { type<mud::Item>(), member_address(&mud::Item::m_rig), type<mud::Rig>(), "rig", Ref(type<mud::Rig>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Item>();
+        lazy_class<mud::Item>([] {
+            static Class cls = { type<mud::Item>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Item>(), Address(), type<mud::Node3>(), "node", Ref(type<mud::Node3>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Item>(object).m_node); } },
+                    { type<mud::Item>(), member_address(&mud::Item::m_model), type<mud::Model>(), "model", Ref(type<mud::Model>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::Item>(), member_address(&mud::Item::m_flags), type<uint32_t>(), "flags", var(uint32_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Item>(object).m_flags); }, [](Ref object, Ref value) { member_assign(val<mud::Item>(object).m_flags, value); } },
+                    { type<mud::Item>(), member_address(&mud::Item::m_colour), type<mud::Colour>(), "colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Item>(object).m_colour); }, [](Ref object, Ref value) { member_assign(val<mud::Item>(object).m_colour, value); } },
+                    { type<mud::Item>(), member_address(&mud::Item::m_material), type<mud::Material>(), "material", Ref(type<mud::Material>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::Item>(), member_address(&mud::Item::m_visible), type<bool>(), "visible", var(bool(true)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Item>(object).m_visible); }, [](Ref object, Ref value) { member_assign(val<mud::Item>(object).m_visible, value); } },
+                    { type<mud::Item>(), member_address(&mud::Item::m_cast_shadows), type<mud::ItemShadow>(), "cast_shadows", var(mud::ItemShadow()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Item>(object).m_cast_shadows); }, [](Ref object, Ref value) { member_assign(val<mud::Item>(object).m_cast_shadows, value); } },
+                    { type<mud::Item>(), member_address(&mud::Item::m_rig), type<mud::Rig>(), "rig", Ref(type<mud::Rig>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Item>();
+        });
     }
     
     
@@ -1420,32 +1488,34 @@ namespace mud
     // mud::Joint
     {
         static Meta meta = { type<mud::Joint>(), &namspc({ "mud" }), "Joint", sizeof(mud::Joint), TypeClass::Struct };
-        static Class cls = { type<mud::Joint>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Joint>(), [](Ref ref, Ref other) { new(&val<mud::Joint>(ref)) mud::Joint(val<mud::Joint>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Joint>();
+        lazy_class<mud::Joint>([] {
+            static Class cls = { type<mud::Joint>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Joint>(), [](Ref ref, Ref other) { new(&val<mud::Joint>(ref)) mud::Joint(val<mud::Joint>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Joint>();
+        });
     }
     
     
@@ -1454,52 +1524,54 @@ namespace mud
     // mud::Light
     {
         static Meta meta = { type<mud::Light>(), &namspc({ "mud" }), "Light", sizeof(mud::Light), TypeClass::Object };
-        static Class cls = { type<mud::Light>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Light>(), Address(), type<mud::Node3>(), "node", Ref(type<mud::Node3>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Light>(object).m_node); } },
-                { type<mud::Light>(), member_address(&mud::Light::m_type), type<mud::LightType>(), "type", var(mud::LightType()), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_visible), type<bool>(), "visible", var(bool(true)), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_colour), type<mud::Colour>(), "colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_range), type<float>(), "range", var(float(1.f)), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_energy), type<float>(), "energy", var(float(1.f)), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_specular), type<float>(), "specular", var(float(0.5f)), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_attenuation), type<float>(), "attenuation", var(float(0.5f)), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_shadows), type<bool>(), "shadows", var(bool(false)), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_shadow_colour), type<mud::Colour>(), "shadow_colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_shadow_range), type<float>(), "shadow_range", var(float(100.f)), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_layers), type<uint32_t>(), "layers", var(uint32_t(0xFFFFFFFF)), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_last_render), type<uint32_t>(), "last_render", var(uint32_t()), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_last_update), type<uint32_t>(), "last_update", var(uint32_t()), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_spot_angle), type<float>(), "spot_angle", var(float(45.f)), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_spot_attenuation), type<float>(), "spot_attenuation", var(float(0.5f)), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_shadow_flags), type<mud::ShadowFlags>(), "shadow_flags", var(mud::ShadowFlags()), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_shadow_num_splits), type<uint8_t>(), "shadow_nusplits", var(uint8_t()), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_shadow_split_distribution), type<float>(), "shadow_split_distribution", var(float(0.6f)), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_shadow_normal_bias), type<float>(), "shadow_normal_bias", var(float(0.1f)), Member::Value, nullptr },
-                { type<mud::Light>(), member_address(&mud::Light::m_shadow_bias), type<float>(), "shadow_bias", var(float(0.f)), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Light>();
+        lazy_class<mud::Light>([] {
+            static Class cls = { type<mud::Light>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Light>(), Address(), type<mud::Node3>(), "node", Ref(type<mud::Node3>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Light>(object).m_node); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_type), type<mud::LightType>(), "type", var(mud::LightType()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_type); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_type, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_visible), type<bool>(), "visible", var(bool(true)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_visible); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_visible, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_colour), type<mud::Colour>(), "colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_colour); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_colour, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_range), type<float>(), "range", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_range); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_range, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_energy), type<float>(), "energy", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_energy); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_energy, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_specular), type<float>(), "specular", var(float(0.5f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_specular); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_specular, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_attenuation), type<float>(), "attenuation", var(float(0.5f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_attenuation); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_attenuation, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_shadows), type<bool>(), "shadows", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_shadows); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_shadows, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_shadow_colour), type<mud::Colour>(), "shadow_colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_shadow_colour); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_shadow_colour, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_shadow_range), type<float>(), "shadow_range", var(float(100.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_shadow_range); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_shadow_range, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_layers), type<uint32_t>(), "layers", var(uint32_t(0xFFFFFFFF)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_layers); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_layers, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_last_render), type<uint32_t>(), "last_render", var(uint32_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_last_render); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_last_render, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_last_update), type<uint32_t>(), "last_update", var(uint32_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_last_update); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_last_update, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_spot_angle), type<float>(), "spot_angle", var(float(45.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_spot_angle); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_spot_angle, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_spot_attenuation), type<float>(), "spot_attenuation", var(float(0.5f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_spot_attenuation); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_spot_attenuation, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_shadow_flags), type<mud::ShadowFlags>(), "shadow_flags", var(mud::ShadowFlags()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_shadow_flags); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_shadow_flags, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_shadow_num_splits), type<uint8_t>(), "shadow_nusplits", var(uint8_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_shadow_num_splits); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_shadow_num_splits, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_shadow_split_distribution), type<float>(), "shadow_split_distribution", var(float(0.6f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_shadow_split_distribution); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_shadow_split_distribution, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_shadow_normal_bias), type<float>(), "shadow_normal_bias", var(float(0.1f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_shadow_normal_bias); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_shadow_normal_bias, value); } },
+                    { type<mud::Light>(), member_address(&mud::Light::m_shadow_bias), type<float>(), "shadow_bias", var(float(0.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Light>(object).m_shadow_bias); }, [](Ref object, Ref value) { member_assign(val<mud::Light>(object).m_shadow_bias, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Light>();
+        });
     }
     
     
@@ -1509,38 +1581,40 @@ namespace mud
     // mud::Material
     {
         static Meta meta = { type<mud::Material>(), &namspc({ "mud" }), "Material", sizeof(mud::Material), TypeClass::Object };
-        static Class cls = { type<mud::Material>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Material>(), member_address(&mud::Material::m_index), type<uint16_t>(), "index", var(uint16_t()), Member::Value, nullptr },
-                { type<mud::Material>(), member_address(&mud::Material::m_builtin), type<bool>(), "builtin", var(bool(false)), Member::Value, nullptr },
-                { type<mud::Material>(), member_address(&mud::Material::m_program), type<mud::Program>(), "program", Ref(type<mud::Program>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::Material>(), member_address(&mud::Material::m_base_block), type<mud::BaseMaterialBlock>(), "base_block", var(mud::BaseMaterialBlock()), Member::Value, nullptr },
-                { type<mud::Material>(), member_address(&mud::Material::m_unshaded_block), type<mud::UnshadedMaterialBlock>(), "unshaded_block", var(mud::UnshadedMaterialBlock()), Member::Value, nullptr },
-                { type<mud::Material>(), member_address(&mud::Material::m_pbr_block), type<mud::PbrMaterialBlock>(), "pbr_block", var(mud::PbrMaterialBlock()), Member::Value, nullptr },
-                { type<mud::Material>(), member_address(&mud::Material::m_fresnel_block), type<mud::FresnelMaterialBlock>(), "fresnel_block", var(mud::FresnelMaterialBlock()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Material>();
+        lazy_class<mud::Material>([] {
+            static Class cls = { type<mud::Material>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Material>(), member_address(&mud::Material::m_index), type<uint16_t>(), "index", var(uint16_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Material>(object).m_index); }, [](Ref object, Ref value) { member_assign(val<mud::Material>(object).m_index, value); } },
+                    { type<mud::Material>(), member_address(&mud::Material::m_builtin), type<bool>(), "builtin", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Material>(object).m_builtin); }, [](Ref object, Ref value) { member_assign(val<mud::Material>(object).m_builtin, value); } },
+                    { type<mud::Material>(), member_address(&mud::Material::m_program), type<mud::Program>(), "program", Ref(type<mud::Program>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::Material>(), member_address(&mud::Material::m_base_block), type<mud::BaseMaterialBlock>(), "base_block", var(mud::BaseMaterialBlock()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Material>(object).m_base_block); }, [](Ref object, Ref value) { member_assign(val<mud::Material>(object).m_base_block, value); } },
+                    { type<mud::Material>(), member_address(&mud::Material::m_unshaded_block), type<mud::UnshadedMaterialBlock>(), "unshaded_block", var(mud::UnshadedMaterialBlock()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Material>(object).m_unshaded_block); }, [](Ref object, Ref value) { member_assign(val<mud::Material>(object).m_unshaded_block, value); } },
+                    { type<mud::Material>(), member_address(&mud::Material::m_pbr_block), type<mud::PbrMaterialBlock>(), "pbr_block", var(mud::PbrMaterialBlock()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Material>(object).m_pbr_block); }, [](Ref object, Ref value) { member_assign(val<mud::Material>(object).m_pbr_block, value); } },
+                    { type<mud::Material>(), member_address(&mud::Material::m_fresnel_block), type<mud::FresnelMaterialBlock>(), "fresnel_block", var(mud::FresnelMaterialBlock()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Material>(object).m_fresnel_block); }, [](Ref object, Ref value) { member_assign(val<mud::Material>(object).m_fresnel_block, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Material>();
+        });
     }
     
     
@@ -1548,35 +1622,37 @@ namespace mud
     // mud::MaterialParam<float>
     {
         static Meta meta = { type<mud::MaterialParam<float>>(), &namspc({ "mud" }), "MaterialParam<float>", sizeof(mud::MaterialParam<float>), TypeClass::Struct };
-        static Class cls = { type<mud::MaterialParam<float>>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::MaterialParam<float>>(), [](Ref ref, Ref other) { new(&val<mud::MaterialParam<float>>(ref)) mud::MaterialParam<float>(val<mud::MaterialParam<float>>(other)); } }
-            },
-            // members
-            {
-                { type<mud::MaterialParam<float>>(), member_address(&mud::MaterialParam<float>::m_value), type<float>(), "value", var(float()), Member::Value, nullptr },
-                { type<mud::MaterialParam<float>>(), member_address(&mud::MaterialParam<float>::m_texture), type<mud::Texture>(), "texture", Ref(type<mud::Texture>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::MaterialParam<float>>(), member_address(&mud::MaterialParam<float>::m_channel), type<mud::TextureChannel>(), "channel", var(mud::TextureChannel()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::MaterialParam<float>>();
+        lazy_class<mud::MaterialParam<float>>([] {
+            static Class cls = { type<mud::MaterialParam<float>>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::MaterialParam<float>>(), [](Ref ref, Ref other) { new(&val<mud::MaterialParam<float>>(ref)) mud::MaterialParam<float>(val<mud::MaterialParam<float>>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::MaterialParam<float>>(), member_address(&mud::MaterialParam<float>::m_value), type<float>(), "value", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<mud::MaterialParam<float>>(object).m_value); }, [](Ref object, Ref value) { member_assign(val<mud::MaterialParam<float>>(object).m_value, value); } },
+                    { type<mud::MaterialParam<float>>(), member_address(&mud::MaterialParam<float>::m_texture), type<mud::Texture>(), "texture", Ref(type<mud::Texture>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::MaterialParam<float>>(), member_address(&mud::MaterialParam<float>::m_channel), type<mud::TextureChannel>(), "channel", var(mud::TextureChannel()), Member::Value, nullptr, [](Ref object) { return var(val<mud::MaterialParam<float>>(object).m_channel); }, [](Ref object, Ref value) { member_assign(val<mud::MaterialParam<float>>(object).m_channel, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::MaterialParam<float>>();
+        });
     }
     
     
@@ -1584,35 +1660,37 @@ namespace mud
     // mud::MaterialParam<mud::Colour>
     {
         static Meta meta = { type<mud::MaterialParam<mud::Colour>>(), &namspc({ "mud" }), "MaterialParam<mud::Colour>", sizeof(mud::MaterialParam<mud::Colour>), TypeClass::Struct };
-        static Class cls = { type<mud::MaterialParam<mud::Colour>>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::MaterialParam<mud::Colour>>(), [](Ref ref, Ref other) { new(&val<mud::MaterialParam<mud::Colour>>(ref)) mud::MaterialParam<mud::Colour>(val<mud::MaterialParam<mud::Colour>>(other)); } }
-            },
-            // members
-            {
-                { type<mud::MaterialParam<mud::Colour>>(), member_address(&mud::MaterialParam<mud::Colour>::m_value), type<mud::Colour>(), "value", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::MaterialParam<mud::Colour>>(), member_address(&mud::MaterialParam<mud::Colour>::m_texture), type<mud::Texture>(), "texture", Ref(type<mud::Texture>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::MaterialParam<mud::Colour>>(), member_address(&mud::MaterialParam<mud::Colour>::m_channel), type<mud::TextureChannel>(), "channel", var(mud::TextureChannel()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::MaterialParam<mud::Colour>>();
+        lazy_class<mud::MaterialParam<mud::Colour>>([] {
+            static Class cls = { type<mud::MaterialParam<mud::Colour>>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::MaterialParam<mud::Colour>>(), [](Ref ref, Ref other) { new(&val<mud::MaterialParam<mud::Colour>>(ref)) mud::MaterialParam<mud::Colour>(val<mud::MaterialParam<mud::Colour>>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::MaterialParam<mud::Colour>>(), member_address(&mud::MaterialParam<mud::Colour>::m_value), type<mud::Colour>(), "value", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::MaterialParam<mud::Colour>>(object).m_value); }, [](Ref object, Ref value) { member_assign(val<mud::MaterialParam<mud::Colour>>(object).m_value, value); } },
+                    { type<mud::MaterialParam<mud::Colour>>(), member_address(&mud::MaterialParam<mud::Colour>::m_texture), type<mud::Texture>(), "texture", Ref(type<mud::Texture>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::MaterialParam<mud::Colour>>(), member_address(&mud::MaterialParam<mud::Colour>::m_channel), type<mud::TextureChannel>(), "channel", var(mud::TextureChannel()), Member::Value, nullptr, [](Ref object) { return var(val<mud::MaterialParam<mud::Colour>>(object).m_channel); }, [](Ref object, Ref value) { member_assign(val<mud::MaterialParam<mud::Colour>>(object).m_channel, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::MaterialParam<mud::Colour>>();
+        });
     }
     
     
@@ -1620,41 +1698,43 @@ namespace mud
     // mud::Mesh
     {
         static Meta meta = { type<mud::Mesh>(), &namspc({ "mud" }), "Mesh", sizeof(mud::Mesh), TypeClass::Object };
-        static Class cls = { type<mud::Mesh>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Mesh>(), member_address(&mud::Mesh::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr },
-                { type<mud::Mesh>(), member_address(&mud::Mesh::m_index), type<uint16_t>(), "index", var(uint16_t()), Member::Value, nullptr },
-                { type<mud::Mesh>(), member_address(&mud::Mesh::m_draw_mode), type<mud::DrawMode>(), "draw_mode", var(mud::DrawMode()), Member::Value, nullptr },
-                { type<mud::Mesh>(), member_address(&mud::Mesh::m_aabb), type<mud::Aabb>(), "aabb", var(mud::Aabb()), Member::Value, nullptr },
-                { type<mud::Mesh>(), member_address(&mud::Mesh::m_radius), type<float>(), "radius", var(float(0.f)), Member::Value, nullptr },
-                { type<mud::Mesh>(), member_address(&mud::Mesh::m_origin), type<mud::vec3>(), "origin", var(mud::vec3()), Member::Value, nullptr },
-                { type<mud::Mesh>(), member_address(&mud::Mesh::m_readback), type<bool>(), "readback", var(bool(false)), Member::Value, nullptr },
-                { type<mud::Mesh>(), member_address(&mud::Mesh::m_vertex_count), type<size_t>(), "vertex_count", var(size_t()), Member::Value, nullptr },
-                { type<mud::Mesh>(), member_address(&mud::Mesh::m_index_count), type<size_t>(), "index_count", var(size_t()), Member::Value, nullptr },
-                { type<mud::Mesh>(), member_address(&mud::Mesh::m_material), type<mud::Material>(), "material", Ref(type<mud::Material>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Mesh>();
+        lazy_class<mud::Mesh>([] {
+            static Class cls = { type<mud::Mesh>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Mesh>(), member_address(&mud::Mesh::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Mesh>(object).m_name); }, [](Ref object, Ref value) { member_assign(val<mud::Mesh>(object).m_name, value); } },
+                    { type<mud::Mesh>(), member_address(&mud::Mesh::m_index), type<uint16_t>(), "index", var(uint16_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Mesh>(object).m_index); }, [](Ref object, Ref value) { member_assign(val<mud::Mesh>(object).m_index, value); } },
+                    { type<mud::Mesh>(), member_address(&mud::Mesh::m_draw_mode), type<mud::DrawMode>(), "draw_mode", var(mud::DrawMode()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Mesh>(object).m_draw_mode); }, [](Ref object, Ref value) { member_assign(val<mud::Mesh>(object).m_draw_mode, value); } },
+                    { type<mud::Mesh>(), member_address(&mud::Mesh::m_aabb), type<mud::Aabb>(), "aabb", var(mud::Aabb()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Mesh>(object).m_aabb); }, [](Ref object, Ref value) { member_assign(val<mud::Mesh>(object).m_aabb, value); } },
+                    { type<mud::Mesh>(), member_address(&mud::Mesh::m_radius), type<float>(), "radius", var(float(0.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Mesh>(object).m_radius); }, [](Ref object, Ref value) { member_assign(val<mud::Mesh>(object).m_radius, value); } },
+                    { type<mud::Mesh>(), member_address(&mud::Mesh::m_origin), type<mud::vec3>(), "origin", var(mud::vec3()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Mesh>(object).m_origin); }, [](Ref object, Ref value) { member_assign(val<mud::Mesh>(object).m_origin, value); } },
+                    { type<mud::Mesh>(), member_address(&mud::Mesh::m_readback), type<bool>(), "readback", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Mesh>(object).m_readback); }, [](Ref object, Ref value) { member_assign(val<mud::Mesh>(object).m_readback, value); } },
+                    { type<mud::Mesh>(), member_address(&mud::Mesh::m_vertex_count), type<size_t>(), "vertex_count", var(size_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Mesh>(object).m_vertex_count); }, [](Ref object, Ref value) { member_assign(val<mud::Mesh>(object).m_vertex_count, value); } },
+                    { type<mud::Mesh>(), member_address(&mud::Mesh::m_index_count), type<size_t>(), "index_count", var(size_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Mesh>(object).m_index_count); }, [](Ref object, Ref value) { member_assign(val<mud::Mesh>(object).m_index_count, value); } },
+                    { type<mud::Mesh>(), member_address(&mud::Mesh::m_material), type<mud::Material>(), "material", Ref(type<mud::Material>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Mesh>();
+        });
     }
     
     
@@ -1663,36 +1743,38 @@ namespace mud
     // mud::Model
     {
         static Meta meta = { type<mud::Model>(), &namspc({ "mud" }), "Model", sizeof(mud::Model), TypeClass::Object };
-        static Class cls = { type<mud::Model>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Model>(), member_address(&mud::Model::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr },
-                { type<mud::Model>(), member_address(&mud::Model::m_index), type<uint16_t>(), "index", var(uint16_t()), Member::Value, nullptr },
-                { type<mud::Model>(), member_address(&mud::Model::m_aabb), type<mud::Aabb>(), "aabb", var(mud::Aabb()), Member::Value, nullptr },
-                { type<mud::Model>(), member_address(&mud::Model::m_radius), type<float>(), "radius", var(float(0.f)), Member::Value, nullptr },
-                { type<mud::Model>(), member_address(&mud::Model::m_origin), type<mud::vec3>(), "origin", var(mud::vec3()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Model>();
+        lazy_class<mud::Model>([] {
+            static Class cls = { type<mud::Model>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Model>(), member_address(&mud::Model::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Model>(object).m_name); }, [](Ref object, Ref value) { member_assign(val<mud::Model>(object).m_name, value); } },
+                    { type<mud::Model>(), member_address(&mud::Model::m_index), type<uint16_t>(), "index", var(uint16_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Model>(object).m_index); }, [](Ref object, Ref value) { member_assign(val<mud::Model>(object).m_index, value); } },
+                    { type<mud::Model>(), member_address(&mud::Model::m_aabb), type<mud::Aabb>(), "aabb", var(mud::Aabb()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Model>(object).m_aabb); }, [](Ref object, Ref value) { member_assign(val<mud::Model>(object).m_aabb, value); } },
+                    { type<mud::Model>(), member_address(&mud::Model::m_radius), type<float>(), "radius", var(float(0.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Model>(object).m_radius); }, [](Ref object, Ref value) { member_assign(val<mud::Model>(object).m_radius, value); } },
+                    { type<mud::Model>(), member_address(&mud::Model::m_origin), type<mud::vec3>(), "origin", var(mud::vec3()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Model>(object).m_origin); }, [](Ref object, Ref value) { member_assign(val<mud::Model>(object).m_origin, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Model>();
+        });
     }
     
     
@@ -1701,37 +1783,39 @@ namespace mud
     // mud::ModelItem
     {
         static Meta meta = { type<mud::ModelItem>(), &namspc({ "mud" }), "ModelItem", sizeof(mud::ModelItem), TypeClass::Struct };
-        static Class cls = { type<mud::ModelItem>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::ModelItem>(), [](Ref ref, Ref other) { new(&val<mud::ModelItem>(ref)) mud::ModelItem(val<mud::ModelItem>(other)); } }
-            },
-            // members
-            {
-                { type<mud::ModelItem>(), member_address(&mud::ModelItem::m_transform), type<mud::mat4>(), "transform", var(mud::mat4()), Member::Value, nullptr },
-                { type<mud::ModelItem>(), member_address(&mud::ModelItem::m_mesh), type<mud::Mesh>(), "mesh", Ref(type<mud::Mesh>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::ModelItem>(), member_address(&mud::ModelItem::m_skin), type<int>(), "skin", var(int()), Member::Value, nullptr },
-                { type<mud::ModelItem>(), member_address(&mud::ModelItem::m_colour), type<mud::Colour>(), "colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::ModelItem>(), member_address(&mud::ModelItem::m_material), type<mud::Material>(), "material", Ref(type<mud::Material>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::ModelItem>();
+        lazy_class<mud::ModelItem>([] {
+            static Class cls = { type<mud::ModelItem>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::ModelItem>(), [](Ref ref, Ref other) { new(&val<mud::ModelItem>(ref)) mud::ModelItem(val<mud::ModelItem>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::ModelItem>(), member_address(&mud::ModelItem::m_transform), type<mud::mat4>(), "transform", var(mud::mat4()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ModelItem>(object).m_transform); }, [](Ref object, Ref value) { member_assign(val<mud::ModelItem>(object).m_transform, value); } },
+                    { type<mud::ModelItem>(), member_address(&mud::ModelItem::m_mesh), type<mud::Mesh>(), "mesh", Ref(type<mud::Mesh>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::ModelItem>(), member_address(&mud::ModelItem::m_skin), type<int>(), "skin", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ModelItem>(object).m_skin); }, [](Ref object, Ref value) { member_assign(val<mud::ModelItem>(object).m_skin, value); } },
+                    { type<mud::ModelItem>(), member_address(&mud::ModelItem::m_colour), type<mud::Colour>(), "colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ModelItem>(object).m_colour); }, [](Ref object, Ref value) { member_assign(val<mud::ModelItem>(object).m_colour, value); } },
+                    { type<mud::ModelItem>(), member_address(&mud::ModelItem::m_material), type<mud::Material>(), "material", Ref(type<mud::Material>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::ModelItem>();
+        });
     }
     
     
@@ -1739,37 +1823,39 @@ namespace mud
     // mud::Node3
     {
         static Meta meta = { type<mud::Node3>(), &namspc({ "mud" }), "Node3", sizeof(mud::Node3), TypeClass::Object };
-        static Class cls = { type<mud::Node3>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Node3>(), member_address(&mud::Node3::m_scene), type<mud::Scene>(), "scene", Ref(type<mud::Scene>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::Node3>(), member_address(&mud::Node3::m_index), type<uint16_t>(), "index", var(uint16_t()), Member::Value, nullptr },
-                { type<mud::Node3>(), member_address(&mud::Node3::m_position), type<mud::vec3>(), "position", var(mud::vec3()), Member::Value, nullptr },
-                { type<mud::Node3>(), member_address(&mud::Node3::m_rotation), type<mud::quat>(), "rotation", var(mud::quat()), Member::Value, nullptr },
-                { type<mud::Node3>(), member_address(&mud::Node3::m_scale), type<mud::vec3>(), "scale", var(mud::vec3()), Member::Value, nullptr },
-                { type<mud::Node3>(), member_address(&mud::Node3::m_visible), type<bool>(), "visible", var(bool(true)), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Node3>();
+        lazy_class<mud::Node3>([] {
+            static Class cls = { type<mud::Node3>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Node3>(), member_address(&mud::Node3::m_scene), type<mud::Scene>(), "scene", Ref(type<mud::Scene>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::Node3>(), member_address(&mud::Node3::m_index), type<uint16_t>(), "index", var(uint16_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Node3>(object).m_index); }, [](Ref object, Ref value) { member_assign(val<mud::Node3>(object).m_index, value); } },
+                    { type<mud::Node3>(), member_address(&mud::Node3::m_position), type<mud::vec3>(), "position", var(mud::vec3()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Node3>(object).m_position); }, [](Ref object, Ref value) { member_assign(val<mud::Node3>(object).m_position, value); } },
+                    { type<mud::Node3>(), member_address(&mud::Node3::m_rotation), type<mud::quat>(), "rotation", var(mud::quat()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Node3>(object).m_rotation); }, [](Ref object, Ref value) { member_assign(val<mud::Node3>(object).m_rotation, value); } },
+                    { type<mud::Node3>(), member_address(&mud::Node3::m_scale), type<mud::vec3>(), "scale", var(mud::vec3()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Node3>(object).m_scale); }, [](Ref object, Ref value) { member_assign(val<mud::Node3>(object).m_scale, value); } },
+                    { type<mud::Node3>(), member_address(&mud::Node3::m_visible), type<bool>(), "visible", var(bool(true)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Node3>(object).m_visible); }, [](Ref object, Ref value) { member_assign(val<mud::Node3>(object).m_visible, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Node3>();
+        });
     }
     
     
@@ -1778,53 +1864,55 @@ namespace mud
     // mud::ParticleGenerator
     {
         static Meta meta = { type<mud::ParticleGenerator>(), &namspc({ "mud" }), "ParticleGenerator", sizeof(mud::ParticleGenerator), TypeClass::Struct };
-        static Class cls = { type<mud::ParticleGenerator>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::ParticleGenerator>(), [](Ref ref, Ref other) { new(&val<mud::ParticleGenerator>(ref)) mud::ParticleGenerator(val<mud::ParticleGenerator>(other)); } }
-            },
-            // members
-            {
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_duration), type<float>(), "duration", var(float(1.f)), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_start_time), type<float>(), "start_time", var(float(0.f)), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_loop), type<bool>(), "loop", var(bool(false)), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_shape), type<mud::ShapeVar>(), "shape", var(mud::ShapeVar()), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_flow), type<mud::EmitterFlow>(), "flow", var(mud::EmitterFlow()), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_billboard), type<bool>(), "billboard", var(bool(true)), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_direction), type<mud::vec3>(), "direction", var(mud::vec3()), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_rotation), type<mud::quat>(), "rotation", var(mud::quat()), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_blend_mode), type<mud::BlendMode>(), "blend_mode", var(mud::BlendMode()), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_volume), type<mud::ValueTrack<float>>(), "volume", var(mud::ValueTrack<float>()), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_rate), type<mud::ValueTrack<uint32_t>>(), "rate", var(mud::ValueTrack<uint32_t>()), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_lifetime), type<mud::ValueTrack<float>>(), "lifetime", var(mud::ValueTrack<float>()), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_gravity), type<mud::ValueTrack<float>>(), "gravity", var(mud::ValueTrack<float>()), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_speed), type<mud::ValueTrack<float>>(), "speed", var(mud::ValueTrack<float>()), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_angle), type<mud::ValueTrack<float>>(), "angle", var(mud::ValueTrack<float>()), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_blend), type<mud::ValueTrack<float>>(), "blend", var(mud::ValueTrack<float>()), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_colour), type<mud::ValueTrack<mud::Colour>>(), "colour", var(mud::ValueTrack<mud::Colour>()), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_scale), type<mud::ValueTrack<float>>(), "scale", var(mud::ValueTrack<float>()), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_sprite_frame), type<mud::ValueTrack<float>>(), "sprite_frame", var(mud::ValueTrack<float>()), Member::Value, nullptr },
-                { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_sprite_name), type<std::string>(), "sprite_name", var(std::string()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
+        lazy_class<mud::ParticleGenerator>([] {
+            static Class cls = { type<mud::ParticleGenerator>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::ParticleGenerator>(), [](Ref ref, Ref other) { new(&val<mud::ParticleGenerator>(ref)) mud::ParticleGenerator(val<mud::ParticleGenerator>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_name); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_name, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_duration), type<float>(), "duration", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_duration); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_duration, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_start_time), type<float>(), "start_time", var(float(0.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_start_time); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_start_time, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_loop), type<bool>(), "loop", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_loop); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_loop, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_shape), type<mud::ShapeVar>(), "shape", var(mud::ShapeVar()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_shape); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_shape, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_flow), type<mud::EmitterFlow>(), "flow", var(mud::EmitterFlow()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_flow); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_flow, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_billboard), type<bool>(), "billboard", var(bool(true)), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_billboard); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_billboard, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_direction), type<mud::vec3>(), "direction", var(mud::vec3()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_direction); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_direction, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_rotation), type<mud::quat>(), "rotation", var(mud::quat()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_rotation); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_rotation, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_blend_mode), type<mud::BlendMode>(), "blend_mode", var(mud::BlendMode()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_blend_mode); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_blend_mode, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_volume), type<mud::ValueTrack<float>>(), "volume", var(mud::ValueTrack<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_volume); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_volume, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_rate), type<mud::ValueTrack<uint32_t>>(), "rate", var(mud::ValueTrack<uint32_t>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_rate); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_rate, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_lifetime), type<mud::ValueTrack<float>>(), "lifetime", var(mud::ValueTrack<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_lifetime); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_lifetime, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_gravity), type<mud::ValueTrack<float>>(), "gravity", var(mud::ValueTrack<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_gravity); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_gravity, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_speed), type<mud::ValueTrack<float>>(), "speed", var(mud::ValueTrack<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_speed); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_speed, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_angle), type<mud::ValueTrack<float>>(), "angle", var(mud::ValueTrack<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_angle); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_angle, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_blend), type<mud::ValueTrack<float>>(), "blend", var(mud::ValueTrack<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_blend); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_blend, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_colour), type<mud::ValueTrack<mud::Colour>>(), "colour", var(mud::ValueTrack<mud::Colour>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_colour); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_colour, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_scale), type<mud::ValueTrack<float>>(), "scale", var(mud::ValueTrack<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_scale); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_scale, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_sprite_frame), type<mud::ValueTrack<float>>(), "sprite_frame", var(mud::ValueTrack<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_sprite_frame); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_sprite_frame, value); } },
+                    { type<mud::ParticleGenerator>(), member_address(&mud::ParticleGenerator::m_sprite_name), type<std::string>(), "sprite_name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ParticleGenerator>(object).m_sprite_name); }, [](Ref object, Ref value) { member_assign(val<mud::ParticleGenerator>(object).m_sprite_name, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        meta_class<mud::ParticleGenerator>();
+            
+            
+            init_class<mud::ParticleGenerator>();
+        });
     }
     
     
@@ -1847,53 +1935,55 @@ namespace mud
     // mud::PbrMaterialBlock
     {
         static Meta meta = { type<mud::PbrMaterialBlock>(), &namspc({ "mud" }), "PbrMaterialBlock", sizeof(mud::PbrMaterialBlock), TypeClass::Struct };
-        static Class cls = { type<mud::PbrMaterialBlock>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::PbrMaterialBlock>(), [](Ref ref, Ref other) { new(&val<mud::PbrMaterialBlock>(ref)) mud::PbrMaterialBlock(val<mud::PbrMaterialBlock>(other)); } }
-            },
-            // members
-            {
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_enabled), type<bool>(), "enabled", var(bool(false)), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_albedo), type<mud::MaterialParam<mud::Colour>>(), "albedo", var(mud::MaterialParam<mud::Colour>()), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_specular), type<float>(), "specular", var(float(0.5f)), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_metallic), type<mud::MaterialParam<float>>(), "metallic", var(mud::MaterialParam<float>()), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_roughness), type<mud::MaterialParam<float>>(), "roughness", var(mud::MaterialParam<float>()), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_emissive), type<mud::MaterialParam<mud::Colour>>(), "emissive", var(mud::MaterialParam<mud::Colour>()), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_emissive_energy), type<float>(), "emissive_energy", var(float(0.f)), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_normal), type<mud::MaterialParam<float>>(), "normal", var(mud::MaterialParam<float>()), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_rim), type<mud::MaterialParam<float>>(), "rim", var(mud::MaterialParam<float>()), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_rim_tint), type<float>(), "ritint", var(float()), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_clearcoat), type<mud::MaterialParam<float>>(), "clearcoat", var(mud::MaterialParam<float>()), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_clearcoat_gloss), type<float>(), "clearcoat_gloss", var(float()), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_anisotropy), type<mud::MaterialParam<float>>(), "anisotropy", var(mud::MaterialParam<float>()), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_subsurface), type<mud::MaterialParam<float>>(), "subsurface", var(mud::MaterialParam<float>()), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_transmission), type<mud::MaterialParam<mud::Colour>>(), "transmission", var(mud::MaterialParam<mud::Colour>()), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_refraction), type<mud::MaterialParam<float>>(), "refraction", var(mud::MaterialParam<float>()), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_ambient_occlusion), type<mud::MaterialParam<float>>(), "ambient_occlusion", var(mud::MaterialParam<float>()), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_depth), type<mud::MaterialParam<float>>(), "depth", var(mud::MaterialParam<float>()), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_deep_parallax), type<bool>(), "deep_parallax", var(bool(false)), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_diffuse_mode), type<mud::PbrDiffuseMode>(), "diffuse_mode", var(mud::PbrDiffuseMode()), Member::Value, nullptr },
-                { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_specular_mode), type<mud::PbrSpecularMode>(), "specular_mode", var(mud::PbrSpecularMode()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::PbrMaterialBlock>();
+        lazy_class<mud::PbrMaterialBlock>([] {
+            static Class cls = { type<mud::PbrMaterialBlock>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::PbrMaterialBlock>(), [](Ref ref, Ref other) { new(&val<mud::PbrMaterialBlock>(ref)) mud::PbrMaterialBlock(val<mud::PbrMaterialBlock>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_enabled), type<bool>(), "enabled", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_enabled); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_enabled, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_albedo), type<mud::MaterialParam<mud::Colour>>(), "albedo", var(mud::MaterialParam<mud::Colour>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_albedo); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_albedo, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_specular), type<float>(), "specular", var(float(0.5f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_specular); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_specular, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_metallic), type<mud::MaterialParam<float>>(), "metallic", var(mud::MaterialParam<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_metallic); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_metallic, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_roughness), type<mud::MaterialParam<float>>(), "roughness", var(mud::MaterialParam<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_roughness); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_roughness, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_emissive), type<mud::MaterialParam<mud::Colour>>(), "emissive", var(mud::MaterialParam<mud::Colour>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_emissive); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_emissive, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_emissive_energy), type<float>(), "emissive_energy", var(float(0.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_emissive_energy); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_emissive_energy, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_normal), type<mud::MaterialParam<float>>(), "normal", var(mud::MaterialParam<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_normal); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_normal, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_rim), type<mud::MaterialParam<float>>(), "rim", var(mud::MaterialParam<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_rim); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_rim, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_rim_tint), type<float>(), "ritint", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_rim_tint); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_rim_tint, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_clearcoat), type<mud::MaterialParam<float>>(), "clearcoat", var(mud::MaterialParam<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_clearcoat); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_clearcoat, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_clearcoat_gloss), type<float>(), "clearcoat_gloss", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_clearcoat_gloss); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_clearcoat_gloss, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_anisotropy), type<mud::MaterialParam<float>>(), "anisotropy", var(mud::MaterialParam<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_anisotropy); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_anisotropy, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_subsurface), type<mud::MaterialParam<float>>(), "subsurface", var(mud::MaterialParam<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_subsurface); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_subsurface, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_transmission), type<mud::MaterialParam<mud::Colour>>(), "transmission", var(mud::MaterialParam<mud::Colour>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_transmission); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_transmission, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_refraction), type<mud::MaterialParam<float>>(), "refraction", var(mud::MaterialParam<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_refraction); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_refraction, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_ambient_occlusion), type<mud::MaterialParam<float>>(), "ambient_occlusion", var(mud::MaterialParam<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_ambient_occlusion); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_ambient_occlusion, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_depth), type<mud::MaterialParam<float>>(), "depth", var(mud::MaterialParam<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_depth); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_depth, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_deep_parallax), type<bool>(), "deep_parallax", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_deep_parallax); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_deep_parallax, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_diffuse_mode), type<mud::PbrDiffuseMode>(), "diffuse_mode", var(mud::PbrDiffuseMode()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_diffuse_mode); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_diffuse_mode, value); } },
+                    { type<mud::PbrMaterialBlock>(), member_address(&mud::PbrMaterialBlock::m_specular_mode), type<mud::PbrSpecularMode>(), "specular_mode", var(mud::PbrSpecularMode()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PbrMaterialBlock>(object).m_specular_mode); }, [](Ref object, Ref value) { member_assign(val<mud::PbrMaterialBlock>(object).m_specular_mode, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::PbrMaterialBlock>();
+        });
     }
     
     
@@ -1905,33 +1995,35 @@ namespace mud
     // mud::Prefab
     {
         static Meta meta = { type<mud::Prefab>(), &namspc({ "mud" }), "Prefab", sizeof(mud::Prefab), TypeClass::Object };
-        static Class cls = { type<mud::Prefab>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Prefab>(), member_address(&mud::Prefab::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr },
-                { type<mud::Prefab>(), member_address(&mud::Prefab::m_node), type<mud::PrefabNode>(), "node", var(mud::PrefabNode()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Prefab>();
+        lazy_class<mud::Prefab>([] {
+            static Class cls = { type<mud::Prefab>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Prefab>(), member_address(&mud::Prefab::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Prefab>(object).m_name); }, [](Ref object, Ref value) { member_assign(val<mud::Prefab>(object).m_name, value); } },
+                    { type<mud::Prefab>(), member_address(&mud::Prefab::m_node), type<mud::PrefabNode>(), "node", var(mud::PrefabNode()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Prefab>(object).m_node); }, [](Ref object, Ref value) { member_assign(val<mud::Prefab>(object).m_node, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Prefab>();
+        });
     }
     
     
@@ -1939,37 +2031,39 @@ namespace mud
     // mud::PrefabNode
     {
         static Meta meta = { type<mud::PrefabNode>(), &namspc({ "mud" }), "PrefabNode", sizeof(mud::PrefabNode), TypeClass::Struct };
-        static Class cls = { type<mud::PrefabNode>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::PrefabNode>(), [](Ref ref, Ref other) { new(&val<mud::PrefabNode>(ref)) mud::PrefabNode(val<mud::PrefabNode>(other)); } }
-            },
-            // members
-            {
-                { type<mud::PrefabNode>(), member_address(&mud::PrefabNode::m_transform), type<mud::Transform>(), "transform", var(mud::Transform()), Member::Value, nullptr },
-                { type<mud::PrefabNode>(), member_address(&mud::PrefabNode::m_object), type<mud::Ref>(), "object", Ref(type<mud::Ref>()), Member::None, nullptr },
-                { type<mud::PrefabNode>(), member_address(&mud::PrefabNode::m_prefab_type), type<mud::PrefabType>(), "prefab_type", var(mud::PrefabType()), Member::Value, nullptr },
-                { type<mud::PrefabNode>(), member_address(&mud::PrefabNode::m_call), type<mud::Call>(), "call", var(mud::Call()), Member::Value, nullptr },
-                { type<mud::PrefabNode>(), member_address(&mud::PrefabNode::m_nodes), type<std::vector<mud::PrefabNode>>(), "nodes", var(std::vector<mud::PrefabNode>()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::PrefabNode>();
+        lazy_class<mud::PrefabNode>([] {
+            static Class cls = { type<mud::PrefabNode>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::PrefabNode>(), [](Ref ref, Ref other) { new(&val<mud::PrefabNode>(ref)) mud::PrefabNode(val<mud::PrefabNode>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::PrefabNode>(), member_address(&mud::PrefabNode::m_transform), type<mud::Transform>(), "transform", var(mud::Transform()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PrefabNode>(object).m_transform); }, [](Ref object, Ref value) { member_assign(val<mud::PrefabNode>(object).m_transform, value); } },
+                    { type<mud::PrefabNode>(), member_address(&mud::PrefabNode::m_object), type<mud::Ref>(), "object", Ref(type<mud::Ref>()), Member::None, nullptr },
+                    { type<mud::PrefabNode>(), member_address(&mud::PrefabNode::m_prefab_type), type<mud::PrefabType>(), "prefab_type", var(mud::PrefabType()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PrefabNode>(object).m_prefab_type); }, [](Ref object, Ref value) { member_assign(val<mud::PrefabNode>(object).m_prefab_type, value); } },
+                    { type<mud::PrefabNode>(), member_address(&mud::PrefabNode::m_call), type<mud::Call>(), "call", var(mud::Call()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PrefabNode>(object).m_call); }, [](Ref object, Ref value) { member_assign(val<mud::PrefabNode>(object).m_call, value); } },
+                    { type<mud::PrefabNode>(), member_address(&mud::PrefabNode::m_nodes), type<std::vector<mud::PrefabNode>>(), "nodes", var(std::vector<mud::PrefabNode>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::PrefabNode>(object).m_nodes); }, [](Ref object, Ref value) { member_assign(val<mud::PrefabNode>(object).m_nodes, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::PrefabNode>();
+        });
     }
     
     
@@ -1978,32 +2072,34 @@ namespace mud
     // mud::Program
     {
         static Meta meta = { type<mud::Program>(), &namspc({ "mud" }), "Program", sizeof(mud::Program), TypeClass::Object };
-        static Class cls = { type<mud::Program>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Program>(), member_address(&mud::Program::name), type<cstring>(), "name", var(cstring()), Member::Value, [](Ref object) { return Ref(val<mud::Program>(object).name()); } }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
+        lazy_class<mud::Program>([] {
+            static Class cls = { type<mud::Program>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Program>(), member_address(&mud::Program::name), type<cstring>(), "name", var(cstring()), Member::Value, [](Ref object) { return Ref(val<mud::Program>(object).name()); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        meta_class<mud::Program>();
+            
+            
+            init_class<mud::Program>();
+        });
     }
     
     
@@ -2013,36 +2109,38 @@ namespace mud
     // mud::Radiance
     {
         static Meta meta = { type<mud::Radiance>(), &namspc({ "mud" }), "Radiance", sizeof(mud::Radiance), TypeClass::Struct };
-        static Class cls = { type<mud::Radiance>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Radiance>(), [](Ref ref, Ref other) { new(&val<mud::Radiance>(ref)) mud::Radiance(val<mud::Radiance>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Radiance>(), member_address(&mud::Radiance::m_energy), type<float>(), "energy", var(float(1.0f)), Member::Value, nullptr },
-                { type<mud::Radiance>(), member_address(&mud::Radiance::m_ambient), type<float>(), "ambient", var(float(1.0f)), Member::Value, nullptr },
-                { type<mud::Radiance>(), member_address(&mud::Radiance::m_colour), type<mud::Colour>(), "colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::Radiance>(), member_address(&mud::Radiance::m_texture), type<mud::Texture>(), "texture", Ref(type<mud::Texture>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Radiance>();
+        lazy_class<mud::Radiance>([] {
+            static Class cls = { type<mud::Radiance>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Radiance>(), [](Ref ref, Ref other) { new(&val<mud::Radiance>(ref)) mud::Radiance(val<mud::Radiance>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Radiance>(), member_address(&mud::Radiance::m_energy), type<float>(), "energy", var(float(1.0f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Radiance>(object).m_energy); }, [](Ref object, Ref value) { member_assign(val<mud::Radiance>(object).m_energy, value); } },
+                    { type<mud::Radiance>(), member_address(&mud::Radiance::m_ambient), type<float>(), "ambient", var(float(1.0f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Radiance>(object).m_ambient); }, [](Ref object, Ref value) { member_assign(val<mud::Radiance>(object).m_ambient, value); } },
+                    { type<mud::Radiance>(), member_address(&mud::Radiance::m_colour), type<mud::Colour>(), "colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Radiance>(object).m_colour); }, [](Ref object, Ref value) { member_assign(val<mud::Radiance>(object).m_colour, value); } },
+                    { type<mud::Radiance>(), member_address(&mud::Radiance::m_texture), type<mud::Texture>(), "texture", Ref(type<mud::Texture>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Radiance>();
+        });
     }
     
     
@@ -2051,32 +2149,34 @@ namespace mud
     // mud::RenderFrame
     {
         static Meta meta = { type<mud::RenderFrame>(), &namspc({ "mud" }), "RenderFrame", sizeof(mud::RenderFrame), TypeClass::Struct };
-        static Class cls = { type<mud::RenderFrame>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::RenderFrame>(), [](Ref ref, Ref other) { new(&val<mud::RenderFrame>(ref)) mud::RenderFrame(val<mud::RenderFrame>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::RenderFrame>();
+        lazy_class<mud::RenderFrame>([] {
+            static Class cls = { type<mud::RenderFrame>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::RenderFrame>(), [](Ref ref, Ref other) { new(&val<mud::RenderFrame>(ref)) mud::RenderFrame(val<mud::RenderFrame>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::RenderFrame>();
+        });
     }
     
     
@@ -2085,32 +2185,34 @@ namespace mud
     // mud::RenderQuad
     {
         static Meta meta = { type<mud::RenderQuad>(), &namspc({ "mud" }), "RenderQuad", sizeof(mud::RenderQuad), TypeClass::Struct };
-        static Class cls = { type<mud::RenderQuad>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::RenderQuad>(), [](Ref ref, Ref other) { new(&val<mud::RenderQuad>(ref)) mud::RenderQuad(val<mud::RenderQuad>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::RenderQuad>();
+        lazy_class<mud::RenderQuad>([] {
+            static Class cls = { type<mud::RenderQuad>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::RenderQuad>(), [](Ref ref, Ref other) { new(&val<mud::RenderQuad>(ref)) mud::RenderQuad(val<mud::RenderQuad>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::RenderQuad>();
+        });
     }
     
     
@@ -2119,31 +2221,33 @@ namespace mud
     // mud::Rig
     {
         static Meta meta = { type<mud::Rig>(), &namspc({ "mud" }), "Rig", sizeof(mud::Rig), TypeClass::Object };
-        static Class cls = { type<mud::Rig>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Rig>();
+        lazy_class<mud::Rig>([] {
+            static Class cls = { type<mud::Rig>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Rig>();
+        });
     }
     
     
@@ -2152,36 +2256,38 @@ namespace mud
     // mud::Scene
     {
         static Meta meta = { type<mud::Scene>(), &namspc({ "mud" }), "Scene", sizeof(mud::Scene), TypeClass::Object };
-        static Class cls = { type<mud::Scene>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Scene>(), member_address(&mud::Scene::m_graph), type<mud::Gnode>(), "graph", Ref(type<mud::Gnode>()), Member::None, nullptr },
-                { type<mud::Scene>(), member_address(&mud::Scene::m_root_node), type<mud::Node3>(), "root_node", Ref(type<mud::Node3>()), Member::None, nullptr },
-                { type<mud::Scene>(), member_address(&mud::Scene::m_environment), type<mud::Environment>(), "environment", var(mud::Environment()), Member::Value, nullptr },
-                { type<mud::Scene>(), member_address(&mud::Scene::m_user), type<mud::Ref>(), "user", Ref(type<mud::Ref>()), Member::None, nullptr }
-            },
-            // methods
-            {
-                { type<mud::Scene>(), "begin", member_address(&mud::Scene::begin), [](Ref object, array<Var> args, Var& result) { UNUSED(args);result = Ref(&val<mud::Scene>(object).begin()); }, {}, Ref(type<mud::Gnode>()) }
-            },
-            // static members
-            {
-            }
-        };
-        
-        
+        lazy_class<mud::Scene>([] {
+            static Class cls = { type<mud::Scene>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Scene>(), member_address(&mud::Scene::m_graph), type<mud::Gnode>(), "graph", Ref(type<mud::Gnode>()), Member::None, nullptr },
+                    { type<mud::Scene>(), member_address(&mud::Scene::m_root_node), type<mud::Node3>(), "root_node", Ref(type<mud::Node3>()), Member::None, nullptr },
+                    { type<mud::Scene>(), member_address(&mud::Scene::m_environment), type<mud::Environment>(), "environment", var(mud::Environment()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Scene>(object).m_environment); }, [](Ref object, Ref value) { member_assign(val<mud::Scene>(object).m_environment, value); } },
+                    { type<mud::Scene>(), member_address(&mud::Scene::m_user), type<mud::Ref>(), "user", Ref(type<mud::Ref>()), Member::None, nullptr }
+                },
+                // methods
+                {
+                    { type<mud::Scene>(), "begin", member_address(&mud::Scene::begin), [](Ref object, array<Var> args, Var& result) { UNUSED(args);result = Ref(&val<mud::Scene>(object).begin()); }, {}, Ref(type<mud::Gnode>()) }
+                },
+                // static members
+                {
+                }
+            };
         
         
-        meta_class<mud::Scene>();
+            
+            
+            init_class<mud::Scene>();
+        });
     }
     
     
@@ -2192,31 +2298,33 @@ namespace mud
     // mud::Shot
     {
         static Meta meta = { type<mud::Shot>(), &namspc({ "mud" }), "Shot", sizeof(mud::Shot), TypeClass::Object };
-        static Class cls = { type<mud::Shot>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Shot>();
+        lazy_class<mud::Shot>([] {
+            static Class cls = { type<mud::Shot>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Shot>();
+        });
     }
     
     
@@ -2224,31 +2332,33 @@ namespace mud
     // mud::Skeleton
     {
         static Meta meta = { type<mud::Skeleton>(), &namspc({ "mud" }), "Skeleton", sizeof(mud::Skeleton), TypeClass::Object };
-        static Class cls = { type<mud::Skeleton>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Skeleton>();
+        lazy_class<mud::Skeleton>([] {
+            static Class cls = { type<mud::Skeleton>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Skeleton>();
+        });
     }
     
     
@@ -2256,31 +2366,33 @@ namespace mud
     // mud::Skin
     {
         static Meta meta = { type<mud::Skin>(), &namspc({ "mud" }), "Skin", sizeof(mud::Skin), TypeClass::Object };
-        static Class cls = { type<mud::Skin>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
+        lazy_class<mud::Skin>([] {
+            static Class cls = { type<mud::Skin>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        
-        meta_class<mud::Skin>();
+            
+            
+            init_class<mud::Skin>();
+        });
     }
     
     
@@ -2290,36 +2402,38 @@ namespace mud
     // mud::Sun
     {
         static Meta meta = { type<mud::Sun>(), &namspc({ "mud" }), "Sun", sizeof(mud::Sun), TypeClass::Struct };
-        static Class cls = { type<mud::Sun>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Sun>(), [](Ref ref, Ref other) { new(&val<mud::Sun>(ref)) mud::Sun(val<mud::Sun>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Sun>(), member_address(&mud::Sun::azimuth), type<float>(), "azimuth", var(float()), Member::Value, nullptr },
-                { type<mud::Sun>(), member_address(&mud::Sun::elevation), type<float>(), "elevation", var(float()), Member::Value, nullptr },
-                { type<mud::Sun>(), member_address(&mud::Sun::m_colour), type<mud::Colour>(), "colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::Sun>(), member_address(&mud::Sun::m_intensity), type<float>(), "intensity", var(float(0.f)), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Sun>();
+        lazy_class<mud::Sun>([] {
+            static Class cls = { type<mud::Sun>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Sun>(), [](Ref ref, Ref other) { new(&val<mud::Sun>(ref)) mud::Sun(val<mud::Sun>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Sun>(), member_address(&mud::Sun::azimuth), type<float>(), "azimuth", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Sun>(object).azimuth); }, [](Ref object, Ref value) { member_assign(val<mud::Sun>(object).azimuth, value); } },
+                    { type<mud::Sun>(), member_address(&mud::Sun::elevation), type<float>(), "elevation", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Sun>(object).elevation); }, [](Ref object, Ref value) { member_assign(val<mud::Sun>(object).elevation, value); } },
+                    { type<mud::Sun>(), member_address(&mud::Sun::m_colour), type<mud::Colour>(), "colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Sun>(object).m_colour); }, [](Ref object, Ref value) { member_assign(val<mud::Sun>(object).m_colour, value); } },
+                    { type<mud::Sun>(), member_address(&mud::Sun::m_intensity), type<float>(), "intensity", var(float(0.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Sun>(object).m_intensity); }, [](Ref object, Ref value) { member_assign(val<mud::Sun>(object).m_intensity, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Sun>();
+        });
     }
     
     
@@ -2329,31 +2443,33 @@ namespace mud
     // mud::SymbolIndex
     {
         static Meta meta = { type<mud::SymbolIndex>(), &namspc({ "mud" }), "SymbolIndex", sizeof(mud::SymbolIndex), TypeClass::Object };
-        static Class cls = { type<mud::SymbolIndex>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::SymbolIndex>();
+        lazy_class<mud::SymbolIndex>([] {
+            static Class cls = { type<mud::SymbolIndex>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::SymbolIndex>();
+        });
     }
     
     
@@ -2361,33 +2477,35 @@ namespace mud
     // mud::Texture
     {
         static Meta meta = { type<mud::Texture>(), &namspc({ "mud" }), "Texture", sizeof(mud::Texture), TypeClass::Object };
-        static Class cls = { type<mud::Texture>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Texture>(), member_address(&mud::Texture::m_width), type<uint16_t>(), "width", var(uint16_t()), Member::Value, nullptr },
-                { type<mud::Texture>(), member_address(&mud::Texture::m_height), type<uint16_t>(), "height", var(uint16_t()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
+        lazy_class<mud::Texture>([] {
+            static Class cls = { type<mud::Texture>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Texture>(), member_address(&mud::Texture::m_width), type<uint16_t>(), "width", var(uint16_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Texture>(object).m_width); }, [](Ref object, Ref value) { member_assign(val<mud::Texture>(object).m_width, value); } },
+                    { type<mud::Texture>(), member_address(&mud::Texture::m_height), type<uint16_t>(), "height", var(uint16_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Texture>(object).m_height); }, [](Ref object, Ref value) { member_assign(val<mud::Texture>(object).m_height, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        
-        meta_class<mud::Texture>();
+            
+            
+            init_class<mud::Texture>();
+        });
     }
     
     
@@ -2456,34 +2574,36 @@ namespace mud
     // mud::UnshadedMaterialBlock
     {
         static Meta meta = { type<mud::UnshadedMaterialBlock>(), &namspc({ "mud" }), "UnshadedMaterialBlock", sizeof(mud::UnshadedMaterialBlock), TypeClass::Struct };
-        static Class cls = { type<mud::UnshadedMaterialBlock>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::UnshadedMaterialBlock>(), [](Ref ref, Ref other) { new(&val<mud::UnshadedMaterialBlock>(ref)) mud::UnshadedMaterialBlock(val<mud::UnshadedMaterialBlock>(other)); } }
-            },
-            // members
-            {
-                { type<mud::UnshadedMaterialBlock>(), member_address(&mud::UnshadedMaterialBlock::m_enabled), type<bool>(), "enabled", var(bool(false)), Member::Value, nullptr },
-                { type<mud::UnshadedMaterialBlock>(), member_address(&mud::UnshadedMaterialBlock::m_colour), type<mud::MaterialParam<mud::Colour>>(), "colour", var(mud::MaterialParam<mud::Colour>()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
+        lazy_class<mud::UnshadedMaterialBlock>([] {
+            static Class cls = { type<mud::UnshadedMaterialBlock>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::UnshadedMaterialBlock>(), [](Ref ref, Ref other) { new(&val<mud::UnshadedMaterialBlock>(ref)) mud::UnshadedMaterialBlock(val<mud::UnshadedMaterialBlock>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::UnshadedMaterialBlock>(), member_address(&mud::UnshadedMaterialBlock::m_enabled), type<bool>(), "enabled", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::UnshadedMaterialBlock>(object).m_enabled); }, [](Ref object, Ref value) { member_assign(val<mud::UnshadedMaterialBlock>(object).m_enabled, value); } },
+                    { type<mud::UnshadedMaterialBlock>(), member_address(&mud::UnshadedMaterialBlock::m_colour), type<mud::MaterialParam<mud::Colour>>(), "colour", var(mud::MaterialParam<mud::Colour>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::UnshadedMaterialBlock>(object).m_colour); }, [](Ref object, Ref value) { member_assign(val<mud::UnshadedMaterialBlock>(object).m_colour, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        
-        meta_class<mud::UnshadedMaterialBlock>();
+            
+            
+            init_class<mud::UnshadedMaterialBlock>();
+        });
     }
     
     
@@ -2494,38 +2614,40 @@ namespace mud
     // mud::Viewport
     {
         static Meta meta = { type<mud::Viewport>(), &namspc({ "mud" }), "Viewport", sizeof(mud::Viewport), TypeClass::Object };
-        static Class cls = { type<mud::Viewport>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Viewport>(), member_address(&mud::Viewport::m_camera), type<mud::Camera>(), "camera", Ref(type<mud::Camera>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::Viewport>(), member_address(&mud::Viewport::m_scene), type<mud::Scene>(), "scene", Ref(type<mud::Scene>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::Viewport>(), member_address(&mud::Viewport::m_index), type<uint16_t>(), "index", var(uint16_t()), Member::Value, nullptr },
-                { type<mud::Viewport>(), member_address(&mud::Viewport::m_rect), type<mud::uvec4>(), "rect", var(mud::uvec4()), Member::Value, nullptr },
-                { type<mud::Viewport>(), member_address(&mud::Viewport::m_scissor), type<bool>(), "scissor", var(bool(false)), Member::Value, nullptr },
-                { type<mud::Viewport>(), member_address(&mud::Viewport::m_clear_colour), type<mud::Colour>(), "clear_colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::Viewport>(), member_address(&mud::Viewport::m_shading), type<mud::Shading>(), "shading", var(mud::Shading()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Viewport>();
+        lazy_class<mud::Viewport>([] {
+            static Class cls = { type<mud::Viewport>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Viewport>(), member_address(&mud::Viewport::m_camera), type<mud::Camera>(), "camera", Ref(type<mud::Camera>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::Viewport>(), member_address(&mud::Viewport::m_scene), type<mud::Scene>(), "scene", Ref(type<mud::Scene>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::Viewport>(), member_address(&mud::Viewport::m_index), type<uint16_t>(), "index", var(uint16_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Viewport>(object).m_index); }, [](Ref object, Ref value) { member_assign(val<mud::Viewport>(object).m_index, value); } },
+                    { type<mud::Viewport>(), member_address(&mud::Viewport::m_rect), type<mud::uvec4>(), "rect", var(mud::uvec4()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Viewport>(object).m_rect); }, [](Ref object, Ref value) { member_assign(val<mud::Viewport>(object).m_rect, value); } },
+                    { type<mud::Viewport>(), member_address(&mud::Viewport::m_scissor), type<bool>(), "scissor", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Viewport>(object).m_scissor); }, [](Ref object, Ref value) { member_assign(val<mud::Viewport>(object).m_scissor, value); } },
+                    { type<mud::Viewport>(), member_address(&mud::Viewport::m_clear_colour), type<mud::Colour>(), "clear_colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Viewport>(object).m_clear_colour); }, [](Ref object, Ref value) { member_assign(val<mud::Viewport>(object).m_clear_colour, value); } },
+                    { type<mud::Viewport>(), member_address(&mud::Viewport::m_shading), type<mud::Shading>(), "shading", var(mud::Shading()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Viewport>(object).m_shading); }, [](Ref object, Ref value) { member_assign(val<mud::Viewport>(object).m_shading, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Viewport>();
+        });
     }
     
     
@@ -2533,31 +2655,33 @@ namespace mud
     // mud::BlockCopy
     {
         static Meta meta = { type<mud::BlockCopy>(), &namspc({ "mud" }), "BlockCopy", sizeof(mud::BlockCopy), TypeClass::Object };
-        static Class cls = { type<mud::BlockCopy>(),
-            // bases
-            { &type<mud::GfxBlock>() },
-            { base_offset<mud::BlockCopy, mud::GfxBlock>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::BlockCopy>();
+        lazy_class<mud::BlockCopy>([] {
+            static Class cls = { type<mud::BlockCopy>(),
+                // bases
+                { &type<mud::GfxBlock>() },
+                { base_offset<mud::BlockCopy, mud::GfxBlock>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::BlockCopy>();
+        });
     }
     
     
@@ -2565,31 +2689,33 @@ namespace mud
     // mud::BlockFilter
     {
         static Meta meta = { type<mud::BlockFilter>(), &namspc({ "mud" }), "BlockFilter", sizeof(mud::BlockFilter), TypeClass::Object };
-        static Class cls = { type<mud::BlockFilter>(),
-            // bases
-            { &type<mud::GfxBlock>() },
-            { base_offset<mud::BlockFilter, mud::GfxBlock>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::BlockFilter>();
+        lazy_class<mud::BlockFilter>([] {
+            static Class cls = { type<mud::BlockFilter>(),
+                // bases
+                { &type<mud::GfxBlock>() },
+                { base_offset<mud::BlockFilter, mud::GfxBlock>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::BlockFilter>();
+        });
     }
     
     
@@ -2597,31 +2723,33 @@ namespace mud
     // mud::BlockParticles
     {
         static Meta meta = { type<mud::BlockParticles>(), &namspc({ "mud" }), "BlockParticles", sizeof(mud::BlockParticles), TypeClass::Object };
-        static Class cls = { type<mud::BlockParticles>(),
-            // bases
-            { &type<mud::GfxBlock>() },
-            { base_offset<mud::BlockParticles, mud::GfxBlock>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::BlockParticles>();
+        lazy_class<mud::BlockParticles>([] {
+            static Class cls = { type<mud::BlockParticles>(),
+                // bases
+                { &type<mud::GfxBlock>() },
+                { base_offset<mud::BlockParticles, mud::GfxBlock>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::BlockParticles>();
+        });
     }
     
     
@@ -2629,31 +2757,33 @@ namespace mud
     // mud::BlockResolve
     {
         static Meta meta = { type<mud::BlockResolve>(), &namspc({ "mud" }), "BlockResolve", sizeof(mud::BlockResolve), TypeClass::Object };
-        static Class cls = { type<mud::BlockResolve>(),
-            // bases
-            { &type<mud::GfxBlock>() },
-            { base_offset<mud::BlockResolve, mud::GfxBlock>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::BlockResolve>();
+        lazy_class<mud::BlockResolve>([] {
+            static Class cls = { type<mud::BlockResolve>(),
+                // bases
+                { &type<mud::GfxBlock>() },
+                { base_offset<mud::BlockResolve, mud::GfxBlock>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::BlockResolve>();
+        });
     }
     
     
@@ -2661,31 +2791,33 @@ namespace mud
     // mud::BlockSky
     {
         static Meta meta = { type<mud::BlockSky>(), &namspc({ "mud" }), "BlockSky", sizeof(mud::BlockSky), TypeClass::Object };
-        static Class cls = { type<mud::BlockSky>(),
-            // bases
-            { &type<mud::GfxBlock>() },
-            { base_offset<mud::BlockSky, mud::GfxBlock>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::BlockSky>();
+        lazy_class<mud::BlockSky>([] {
+            static Class cls = { type<mud::BlockSky>(),
+                // bases
+                { &type<mud::GfxBlock>() },
+                { base_offset<mud::BlockSky, mud::GfxBlock>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::BlockSky>();
+        });
     }
     
     
@@ -2693,31 +2825,33 @@ namespace mud
     // mud::DrawBlock
     {
         static Meta meta = { type<mud::DrawBlock>(), &namspc({ "mud" }), "DrawBlock", sizeof(mud::DrawBlock), TypeClass::Object };
-        static Class cls = { type<mud::DrawBlock>(),
-            // bases
-            { &type<mud::GfxBlock>() },
-            { base_offset<mud::DrawBlock, mud::GfxBlock>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::DrawBlock>();
+        lazy_class<mud::DrawBlock>([] {
+            static Class cls = { type<mud::DrawBlock>(),
+                // bases
+                { &type<mud::GfxBlock>() },
+                { base_offset<mud::DrawBlock, mud::GfxBlock>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::DrawBlock>();
+        });
     }
     
     
@@ -2726,31 +2860,33 @@ namespace mud
     // mud::BlockDepth
     {
         static Meta meta = { type<mud::BlockDepth>(), &namspc({ "mud" }), "BlockDepth", sizeof(mud::BlockDepth), TypeClass::Object };
-        static Class cls = { type<mud::BlockDepth>(),
-            // bases
-            { &type<mud::DrawBlock>() },
-            { base_offset<mud::BlockDepth, mud::DrawBlock>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::BlockDepth>();
+        lazy_class<mud::BlockDepth>([] {
+            static Class cls = { type<mud::BlockDepth>(),
+                // bases
+                { &type<mud::DrawBlock>() },
+                { base_offset<mud::BlockDepth, mud::DrawBlock>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::BlockDepth>();
+        });
     }
     
     
@@ -2758,33 +2894,35 @@ namespace mud
     // mud::Particles
     {
         static Meta meta = { type<mud::Particles>(), &namspc({ "mud" }), "Particles", sizeof(mud::Particles), TypeClass::Struct };
-        static Class cls = { type<mud::Particles>(),
-            // bases
-            { &type<mud::ParticleGenerator>() },
-            { base_offset<mud::Particles, mud::ParticleGenerator>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Particles>(), [](Ref ref, Ref other) { new(&val<mud::Particles>(ref)) mud::Particles(val<mud::Particles>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Particles>(), member_address(&mud::Particles::m_node), type<mud::Node3>(), "node", Ref(type<mud::Node3>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Particles>();
+        lazy_class<mud::Particles>([] {
+            static Class cls = { type<mud::Particles>(),
+                // bases
+                { &type<mud::ParticleGenerator>() },
+                { base_offset<mud::Particles, mud::ParticleGenerator>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Particles>(), [](Ref ref, Ref other) { new(&val<mud::Particles>(ref)) mud::Particles(val<mud::Particles>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Particles>(), member_address(&mud::Particles::m_node), type<mud::Node3>(), "node", Ref(type<mud::Node3>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Particles>();
+        });
     }
     
     
@@ -2792,31 +2930,33 @@ namespace mud
     // mud::RenderTarget
     {
         static Meta meta = { type<mud::RenderTarget>(), &namspc({ "mud" }), "RenderTarget", sizeof(mud::RenderTarget), TypeClass::Object };
-        static Class cls = { type<mud::RenderTarget>(),
-            // bases
-            { &type<mud::FrameBuffer>() },
-            { base_offset<mud::RenderTarget, mud::FrameBuffer>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::RenderTarget>();
+        lazy_class<mud::RenderTarget>([] {
+            static Class cls = { type<mud::RenderTarget>(),
+                // bases
+                { &type<mud::FrameBuffer>() },
+                { base_offset<mud::RenderTarget, mud::FrameBuffer>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::RenderTarget>();
+        });
     }
     
     
@@ -2824,31 +2964,33 @@ namespace mud
     // mud::Gnode
     {
         static Meta meta = { type<mud::Gnode>(), &namspc({ "mud" }), "Gnode", sizeof(mud::Gnode), TypeClass::Object };
-        static Class cls = { type<mud::Gnode>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Gnode>();
+        lazy_class<mud::Gnode>([] {
+            static Class cls = { type<mud::Gnode>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Gnode>();
+        });
     }
     
 
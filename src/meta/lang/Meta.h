@@ -38,31 +38,33 @@ namespace mud
     // mud::Interpreter
     {
         static Meta meta = { type<mud::Interpreter>(), &namspc({ "mud" }), "Interpreter", sizeof(mud::Interpreter), TypeClass::Object };
-        static Class cls = { type<mud::Interpreter>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Interpreter>();
+        lazy_class<mud::Interpreter>([] {
+            static Class cls = { type<mud::Interpreter>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Interpreter>();
+        });
     }
     
     
@@ -70,31 +72,33 @@ namespace mud
     // mud::Pipe
     {
         static Meta meta = { type<mud::Pipe>(), &namspc({ "mud" }), "Pipe", sizeof(mud::Pipe), TypeClass::Object };
-        static Class cls = { type<mud::Pipe>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Pipe>();
+        lazy_class<mud::Pipe>([] {
+            static Class cls = { type<mud::Pipe>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Pipe>();
+        });
     }
     
     
@@ -102,32 +106,34 @@ namespace mud
     // mud::Process
     {
         static Meta meta = { type<mud::Process>(), &namspc({ "mud" }), "Process", sizeof(mud::Process), TypeClass::Object };
-        static Class cls = { type<mud::Process>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Process>(), Address(), type<mud::Type>(), "type", Ref(type<mud::Type>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Process>(object).m_type); } }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Process>();
+        lazy_class<mud::Process>([] {
+            static Class cls = { type<mud::Process>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Process>(), Address(), type<mud::Type>(), "type", Ref(type<mud::Type>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Process>(object).m_type); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Process>();
+        });
     }
     
     
@@ -135,34 +141,36 @@ namespace mud
     // mud::ScriptClass
     {
         static Meta meta = { type<mud::ScriptClass>(), &namspc({ "mud" }), "ScriptClass", sizeof(mud::ScriptClass), TypeClass::Object };
-        static Class cls = { type<mud::ScriptClass>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::ScriptClass>(), [](Ref ref, array<Var> args) { new(&val<mud::ScriptClass>(ref)) mud::ScriptClass( val<std::string>(args[0]), val<std::vector<mud::Type*>>(args[1]) ); }, { { "name", var(std::string()) }, { "parts", var(std::vector<mud::Type*>()) } } }
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::ScriptClass>(), member_address(&mud::ScriptClass::m_type), type<mud::Type>(), "type", Ref(type<mud::Type>()), Member::None, nullptr },
-                //{ type<mud::ScriptClass>(), member_address(&mud::ScriptClass::m_class), type<mud::Class>(), "class", Ref(type<mud::Class>()), Member::None, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        //init_pool<mud::ScriptClass>(); 
-        
-        meta_class<mud::ScriptClass>();
+        lazy_class<mud::ScriptClass>([] {
+            static Class cls = { type<mud::ScriptClass>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::ScriptClass>(), [](Ref ref, array<Var> args) { new(&val<mud::ScriptClass>(ref)) mud::ScriptClass( val<std::string>(args[0]), val<std::vector<mud::Type*>>(args[1]) ); }, { { "name", var(std::string()) }, { "parts", var(std::vector<mud::Type*>()) } } }
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::ScriptClass>(), member_address(&mud::ScriptClass::m_type), type<mud::Type>(), "type", Ref(type<mud::Type>()), Member::None, nullptr },
+                    //{ type<mud::ScriptClass>(), member_address(&mud::ScriptClass::m_class), type<mud::Class>(), "class", Ref(type<mud::Class>()), Member::None, nullptr }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            //init_pool<mud::ScriptClass>(); 
+            
+            init_class<mud::ScriptClass>();
+        });
     }
     
     
@@ -170,31 +178,33 @@ namespace mud
     // mud::StreamBranch
     {
         static Meta meta = { type<mud::StreamBranch>(), &namspc({ "mud" }), "StreamBranch", sizeof(mud::StreamBranch), TypeClass::Object };
-        static Class cls = { type<mud::StreamBranch>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::StreamBranch>();
+        lazy_class<mud::StreamBranch>([] {
+            static Class cls = { type<mud::StreamBranch>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::StreamBranch>();
+        });
     }
     
     
@@ -226,31 +236,33 @@ namespace mud
     // mud::Valve
     {
         static Meta meta = { type<mud::Valve>(), &namspc({ "mud" }), "Valve", sizeof(mud::Valve), TypeClass::Object };
-        static Class cls = { type<mud::Valve>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Valve>();
+        lazy_class<mud::Valve>([] {
+            static Class cls = { type<mud::Valve>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Valve>();
+        });
     }
     
     
@@ -258,35 +270,37 @@ namespace mud
     // mud::Script
     {
         static Meta meta = { type<mud::Script>(), &namspc({ "mud" }), "Script", sizeof(mud::Script), TypeClass::Object };
-        static Class cls = { type<mud::Script>(),
-            // bases
-            { &type<mud::Callable>() },
-            { base_offset<mud::Script, mud::Callable>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Script>(), member_address(&mud::Script::m_index), type<uint32_t>(), "index", var(uint32_t()), Member::Value, nullptr },
-                { type<mud::Script>(), Address(), type<mud::Type>(), "type", Ref(type<mud::Type>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Script>(object).m_type); } },
-                { type<mud::Script>(), member_address(&mud::Script::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr },
-                { type<mud::Script>(), member_address(&mud::Script::m_locked), type<bool>(), "locked", var(bool()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Script>();
+        lazy_class<mud::Script>([] {
+            static Class cls = { type<mud::Script>(),
+                // bases
+                { &type<mud::Callable>() },
+                { base_offset<mud::Script, mud::Callable>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Script>(), member_address(&mud::Script::m_index), type<uint32_t>(), "index", var(uint32_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Script>(object).m_index); }, [](Ref object, Ref value) { member_assign(val<mud::Script>(object).m_index, value); } },
+                    { type<mud::Script>(), Address(), type<mud::Type>(), "type", Ref(type<mud::Type>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Script>(object).m_type); } },
+                    { type<mud::Script>(), member_address(&mud::Script::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Script>(object).m_name); }, [](Ref object, Ref value) { member_assign(val<mud::Script>(object).m_name, value); } },
+                    { type<mud::Script>(), member_address(&mud::Script::m_locked), type<bool>(), "locked", var(bool()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Script>(object).m_locked); }, [](Ref object, Ref value) { member_assign(val<mud::Script>(object).m_locked, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Script>();
+        });
     }
     
     
@@ -294,31 +308,33 @@ namespace mud
     // mud::Stream
     {
         static Meta meta = { type<mud::Stream>(), &namspc({ "mud" }), "Stream", sizeof(mud::Stream), TypeClass::Object };
-        static Class cls = { type<mud::Stream>(),
-            // bases
-            { &type<mud::StreamBranch>() },
-            { base_offset<mud::Stream, mud::StreamBranch>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Stream>();
+        lazy_class<mud::Stream>([] {
+            static Class cls = { type<mud::Stream>(),
+                // bases
+                { &type<mud::StreamBranch>() },
+                { base_offset<mud::Stream, mud::StreamBranch>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Stream>();
+        });
     }
     
     
@@ -326,31 +342,33 @@ namespace mud
     // mud::LuaInterpreter
     {
         static Meta meta = { type<mud::LuaInterpreter>(), &namspc({ "mud" }), "LuaInterpreter", sizeof(mud::LuaInterpreter), TypeClass::Object };
-        static Class cls = { type<mud::LuaInterpreter>(),
-            // bases
-            { &type<mud::Interpreter>() },
-            { base_offset<mud::LuaInterpreter, mud::Interpreter>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::LuaInterpreter>();
+        lazy_class<mud::LuaInterpreter>([] {
+            static Class cls = { type<mud::LuaInterpreter>(),
+                // bases
+                { &type<mud::Interpreter>() },
+                { base_offset<mud::LuaInterpreter, mud::Interpreter>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::LuaInterpreter>();
+        });
     }
     
     
@@ -358,31 +376,33 @@ namespace mud
     // mud::WrenInterpreter
     {
         static Meta meta = { type<mud::WrenInterpreter>(), &namspc({ "mud" }), "WrenInterpreter", sizeof(mud::WrenInterpreter), TypeClass::Object };
-        static Class cls = { type<mud::WrenInterpreter>(),
-            // bases
-            { &type<mud::Interpreter>() },
-            { base_offset<mud::WrenInterpreter, mud::Interpreter>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::WrenInterpreter>();
+        lazy_class<mud::WrenInterpreter>([] {
+            static Class cls = { type<mud::WrenInterpreter>(),
+                // bases
+                { &type<mud::Interpreter>() },
+                { base_offset<mud::WrenInterpreter, mud::Interpreter>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::WrenInterpreter>();
+        });
     }
     
     
@@ -390,34 +410,36 @@ namespace mud
     // mud::TextScript
     {
         static Meta meta = { type<mud::TextScript>(), &namspc({ "mud" }), "TextScript", sizeof(mud::TextScript), TypeClass::Object };
-        static Class cls = { type<mud::TextScript>(),
-            // bases
-            { &type<mud::Script>() },
-            { base_offset<mud::TextScript, mud::Script>() },
-            // constructors
-            {
-                { type<mud::TextScript>(), [](Ref ref, array<Var> args) { new(&val<mud::TextScript>(ref)) mud::TextScript( val<cstring>(args[0]), val<mud::Language>(args[1]), val<mud::Signature>(args[2]) ); }, { { "name", var(cstring()) }, { "language", var(mud::Language()) }, { "signature", Ref(type<mud::Signature>()), Param::Default } } }
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::TextScript>(), member_address(&mud::TextScript::m_language), type<mud::Language>(), "language", var(mud::Language()), Member::Value, nullptr },
-                { type<mud::TextScript>(), member_address(&mud::TextScript::m_script), type<std::string>(), "script", var(std::string()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        init_pool<mud::TextScript>(); 
-        
-        meta_class<mud::TextScript>();
+        lazy_class<mud::TextScript>([] {
+            static Class cls = { type<mud::TextScript>(),
+                // bases
+                { &type<mud::Script>() },
+                { base_offset<mud::TextScript, mud::Script>() },
+                // constructors
+                {
+                    { type<mud::TextScript>(), [](Ref ref, array<Var> args) { new(&val<mud::TextScript>(ref)) mud::TextScript( val<cstring>(args[0]), val<mud::Language>(args[1]), val<mud::Signature>(args[2]) ); }, { { "name", var(cstring()) }, { "language", var(mud::Language()) }, { "signature", Ref(type<mud::Signature>()), Param::Default } } }
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::TextScript>(), member_address(&mud::TextScript::m_language), type<mud::Language>(), "language", var(mud::Language()), Member::Value, nullptr, [](Ref object) { return var(val<mud::TextScript>(object).m_language); }, [](Ref object, Ref value) { member_assign(val<mud::TextScript>(object).m_language, value); } },
+                    { type<mud::TextScript>(), member_address(&mud::TextScript::m_script), type<std::string>(), "script", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<mud::TextScript>(object).m_script); }, [](Ref object, Ref value) { member_assign(val<mud::TextScript>(object).m_script, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            init_pool<mud::TextScript>(); 
+            
+            init_class<mud::TextScript>();
+        });
     }
     
     
@@ -425,32 +447,34 @@ namespace mud
     // mud::VisualScript
     {
         static Meta meta = { type<mud::VisualScript>(), &namspc({ "mud" }), "VisualScript", sizeof(mud::VisualScript), TypeClass::Object };
-        static Class cls = { type<mud::VisualScript>(),
-            // bases
-            { &type<mud::Script>() },
-            { base_offset<mud::VisualScript, mud::Script>() },
-            // constructors
-            {
-                { type<mud::VisualScript>(), [](Ref ref, array<Var> args) { new(&val<mud::VisualScript>(ref)) mud::VisualScript( val<cstring>(args[0]), val<mud::Signature>(args[1]) ); }, { { "name", var(cstring()) }, { "signature", Ref(type<mud::Signature>()), Param::Default } } }
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        init_pool<mud::VisualScript>(); 
-        
-        meta_class<mud::VisualScript>();
+        lazy_class<mud::VisualScript>([] {
+            static Class cls = { type<mud::VisualScript>(),
+                // bases
+                { &type<mud::Script>() },
+                { base_offset<mud::VisualScript, mud::Script>() },
+                // constructors
+                {
+                    { type<mud::VisualScript>(), [](Ref ref, array<Var> args) { new(&val<mud::VisualScript>(ref)) mud::VisualScript( val<cstring>(args[0]), val<mud::Signature>(args[1]) ); }, { { "name", var(cstring()) }, { "signature", Ref(type<mud::Signature>()), Param::Default } } }
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            init_pool<mud::VisualScript>(); 
+            
+            init_class<mud::VisualScript>();
+        });
     }
     
     
@@ -458,32 +482,34 @@ namespace mud
     // mud::ProcessFunction
     {
         static Meta meta = { type<mud::ProcessFunction>(), &namspc({ "mud" }), "ProcessFunction", sizeof(mud::ProcessFunction), TypeClass::Object };
-        static Class cls = { type<mud::ProcessFunction>(),
-            // bases
-            { &type<mud::ProcessCallable>() },
-            { base_offset<mud::ProcessFunction, mud::ProcessCallable>() },
-            // constructors
-            {
-                { type<mud::ProcessFunction>(), [](Ref ref, array<Var> args) { new(&val<mud::ProcessFunction>(ref)) mud::ProcessFunction( val<mud::VisualScript>(args[0]), val<mud::Function>(args[1]) ); }, { { "script", Ref(type<mud::VisualScript>()) }, { "function", Ref(type<mud::Function>()) } } }
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        init_pool<mud::ProcessFunction>(); 
-        
-        meta_class<mud::ProcessFunction>();
+        lazy_class<mud::ProcessFunction>([] {
+            static Class cls = { type<mud::ProcessFunction>(),
+                // bases
+                { &type<mud::ProcessCallable>() },
+                { base_offset<mud::ProcessFunction, mud::ProcessCallable>() },
+                // constructors
+                {
+                    { type<mud::ProcessFunction>(), [](Ref ref, array<Var> args) { new(&val<mud::ProcessFunction>(ref)) mud::ProcessFunction( val<mud::VisualScript>(args[0]), val<mud::Function>(args[1]) ); }, { { "script", Ref(type<mud::VisualScript>()) }, { "function", Ref(type<mud::Function>()) } } }
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            init_pool<mud::ProcessFunction>(); 
+            
+            init_class<mud::ProcessFunction>();
+        });
     }
     
     
@@ -491,32 +517,34 @@ namespace mud
     // mud::ProcessMethod
     {
         static Meta meta = { type<mud::ProcessMethod>(), &namspc({ "mud" }), "ProcessMethod", sizeof(mud::ProcessMethod), TypeClass::Object };
-        static Class cls = { type<mud::ProcessMethod>(),
-            // bases
-            { &type<mud::ProcessCallable>() },
-            { base_offset<mud::ProcessMethod, mud::ProcessCallable>() },
-            // constructors
-            {
-                { type<mud::ProcessMethod>(), [](Ref ref, array<Var> args) { new(&val<mud::ProcessMethod>(ref)) mud::ProcessMethod( val<mud::VisualScript>(args[0]), val<mud::Method>(args[1]) ); }, { { "script", Ref(type<mud::VisualScript>()) }, { "method", Ref(type<mud::Method>()) } } }
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        init_pool<mud::ProcessMethod>(); 
-        
-        meta_class<mud::ProcessMethod>();
+        lazy_class<mud::ProcessMethod>([] {
+            static Class cls = { type<mud::ProcessMethod>(),
+                // bases
+                { &type<mud::ProcessCallable>() },
+                { base_offset<mud::ProcessMethod, mud::ProcessCallable>() },
+                // constructors
+                {
+                    { type<mud::ProcessMethod>(), [](Ref ref, array<Var> args) { new(&val<mud::ProcessMethod>(ref)) mud::ProcessMethod( val<mud::VisualScript>(args[0]), val<mud::Method>(args[1]) ); }, { { "script", Ref(type<mud::VisualScript>()) }, { "method", Ref(type<mud::Method>()) } } }
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            init_pool<mud::ProcessMethod>(); 
+            
+            init_class<mud::ProcessMethod>();
+        });
     }
     
     
@@ -524,32 +552,34 @@ namespace mud
     // mud::ProcessScript
     {
         static Meta meta = { type<mud::ProcessScript>(), &namspc({ "mud" }), "ProcessScript", sizeof(mud::ProcessScript), TypeClass::Object };
-        static Class cls = { type<mud::ProcessScript>(),
-            // bases
-            { &type<mud::ProcessCallable>() },
-            { base_offset<mud::ProcessScript, mud::ProcessCallable>() },
-            // constructors
-            {
-                { type<mud::ProcessScript>(), [](Ref ref, array<Var> args) { new(&val<mud::ProcessScript>(ref)) mud::ProcessScript( val<mud::VisualScript>(args[0]), val<mud::VisualScript>(args[1]) ); }, { { "script", Ref(type<mud::VisualScript>()) }, { "target", Ref(type<mud::VisualScript>()) } } }
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        init_pool<mud::ProcessScript>(); 
-        
-        meta_class<mud::ProcessScript>();
+        lazy_class<mud::ProcessScript>([] {
+            static Class cls = { type<mud::ProcessScript>(),
+                // bases
+                { &type<mud::ProcessCallable>() },
+                { base_offset<mud::ProcessScript, mud::ProcessCallable>() },
+                // constructors
+                {
+                    { type<mud::ProcessScript>(), [](Ref ref, array<Var> args) { new(&val<mud::ProcessScript>(ref)) mud::ProcessScript( val<mud::VisualScript>(args[0]), val<mud::VisualScript>(args[1]) ); }, { { "script", Ref(type<mud::VisualScript>()) }, { "target", Ref(type<mud::VisualScript>()) } } }
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            init_pool<mud::ProcessScript>(); 
+            
+            init_class<mud::ProcessScript>();
+        });
     }
     
     
@@ -557,32 +587,34 @@ namespace mud
     // mud::ProcessCallable
     {
         static Meta meta = { type<mud::ProcessCallable>(), &namspc({ "mud" }), "ProcessCallable", sizeof(mud::ProcessCallable), TypeClass::Object };
-        static Class cls = { type<mud::ProcessCallable>(),
-            // bases
-            { &type<mud::Process>() },
-            { base_offset<mud::ProcessCallable, mud::Process>() },
-            // constructors
-            {
-                { type<mud::ProcessCallable>(), [](Ref ref, array<Var> args) { new(&val<mud::ProcessCallable>(ref)) mud::ProcessCallable( val<mud::VisualScript>(args[0]), val<mud::Callable>(args[1]) ); }, { { "script", Ref(type<mud::VisualScript>()) }, { "callable", Ref(type<mud::Callable>()) } } }
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        init_pool<mud::ProcessCallable>(); 
-        
-        meta_class<mud::ProcessCallable>();
+        lazy_class<mud::ProcessCallable>([] {
+            static Class cls = { type<mud::ProcessCallable>(),
+                // bases
+                { &type<mud::Process>() },
+                { base_offset<mud::ProcessCallable, mud::Process>() },
+                // constructors
+                {
+                    { type<mud::ProcessCallable>(), [](Ref ref, array<Var> args) { new(&val<mud::ProcessCallable>(ref)) mud::ProcessCallable( val<mud::VisualScript>(args[0]), val<mud::Callable>(args[1]) ); }, { { "script", Ref(type<mud::VisualScript>()) }, { "callable", Ref(type<mud::Callable>()) } } }
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            init_pool<mud::ProcessCallable>(); 
+            
+            init_class<mud::ProcessCallable>();
+        });
     }
     
     
@@ -590,32 +622,34 @@ namespace mud
     // mud::ProcessCreate
     {
         static Meta meta = { type<mud::ProcessCreate>(), &namspc({ "mud" }), "ProcessCreate", sizeof(mud::ProcessCreate), TypeClass::Object };
-        static Class cls = { type<mud::ProcessCreate>(),
-            // bases
-            { &type<mud::Process>() },
-            { base_offset<mud::ProcessCreate, mud::Process>() },
-            // constructors
-            {
-                { type<mud::ProcessCreate>(), [](Ref ref, array<Var> args) { new(&val<mud::ProcessCreate>(ref)) mud::ProcessCreate( val<mud::VisualScript>(args[0]), val<mud::Type>(args[1]), val<mud::Constructor>(args[2]) ); }, { { "script", Ref(type<mud::VisualScript>()) }, { "type", Ref(type<mud::Type>()) }, { "constructor", Ref(type<mud::Constructor>()) } } }
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        init_pool<mud::ProcessCreate>(); 
-        
-        meta_class<mud::ProcessCreate>();
+        lazy_class<mud::ProcessCreate>([] {
+            static Class cls = { type<mud::ProcessCreate>(),
+                // bases
+                { &type<mud::Process>() },
+                { base_offset<mud::ProcessCreate, mud::Process>() },
+                // constructors
+                {
+                    { type<mud::ProcessCreate>(), [](Ref ref, array<Var> args) { new(&val<mud::ProcessCreate>(ref)) mud::ProcessCreate( val<mud::VisualScript>(args[0]), val<mud::Type>(args[1]), val<mud::Constructor>(args[2]) ); }, { { "script", Ref(type<mud::VisualScript>()) }, { "type", Ref(type<mud::Type>()) }, { "constructor", Ref(type<mud::Constructor>()) } } }
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            init_pool<mud::ProcessCreate>(); 
+            
+            init_class<mud::ProcessCreate>();
+        });
     }
     
     
@@ -623,31 +657,33 @@ namespace mud
     // mud::ProcessDisplay
     {
         static Meta meta = { type<mud::ProcessDisplay>(), &namspc({ "mud" }), "ProcessDisplay", sizeof(mud::ProcessDisplay), TypeClass::Object };
-        static Class cls = { type<mud::ProcessDisplay>(),
-            // bases
-            { &type<mud::Process>() },
-            { base_offset<mud::ProcessDisplay, mud::Process>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::ProcessDisplay>();
+        lazy_class<mud::ProcessDisplay>([] {
+            static Class cls = { type<mud::ProcessDisplay>(),
+                // bases
+                { &type<mud::Process>() },
+                { base_offset<mud::ProcessDisplay, mud::Process>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::ProcessDisplay>();
+        });
     }
     
     
@@ -655,32 +691,34 @@ namespace mud
     // mud::ProcessGetMember
     {
         static Meta meta = { type<mud::ProcessGetMember>(), &namspc({ "mud" }), "ProcessGetMember", sizeof(mud::ProcessGetMember), TypeClass::Object };
-        static Class cls = { type<mud::ProcessGetMember>(),
-            // bases
-            { &type<mud::Process>() },
-            { base_offset<mud::ProcessGetMember, mud::Process>() },
-            // constructors
-            {
-                { type<mud::ProcessGetMember>(), [](Ref ref, array<Var> args) { new(&val<mud::ProcessGetMember>(ref)) mud::ProcessGetMember( val<mud::VisualScript>(args[0]), val<mud::Member>(args[1]) ); }, { { "script", Ref(type<mud::VisualScript>()) }, { "member", Ref(type<mud::Member>()) } } }
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        init_pool<mud::ProcessGetMember>(); 
-        
-        meta_class<mud::ProcessGetMember>();
+        lazy_class<mud::ProcessGetMember>([] {
+            static Class cls = { type<mud::ProcessGetMember>(),
+                // bases
+                { &type<mud::Process>() },
+                { base_offset<mud::ProcessGetMember, mud::Process>() },
+                // constructors
+                {
+                    { type<mud::ProcessGetMember>(), [](Ref ref, array<Var> args) { new(&val<mud::ProcessGetMember>(ref)) mud::ProcessGetMember( val<mud::VisualScript>(args[0]), val<mud::Member>(args[1]) ); }, { { "script", Ref(type<mud::VisualScript>()) }, { "member", Ref(type<mud::Member>()) } } }
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            init_pool<mud::ProcessGetMember>(); 
+            
+            init_class<mud::ProcessGetMember>();
+        });
     }
     
     
@@ -688,32 +726,34 @@ namespace mud
     // mud::ProcessSetMember
     {
         static Meta meta = { type<mud::ProcessSetMember>(), &namspc({ "mud" }), "ProcessSetMember", sizeof(mud::ProcessSetMember), TypeClass::Object };
-        static Class cls = { type<mud::ProcessSetMember>(),
-            // bases
-            { &type<mud::Process>() },
-            { base_offset<mud::ProcessSetMember, mud::Process>() },
-            // constructors
-            {
-                { type<mud::ProcessSetMember>(), [](Ref ref, array<Var> args) { new(&val<mud::ProcessSetMember>(ref)) mud::ProcessSetMember( val<mud::VisualScript>(args[0]), val<mud::Member>(args[1]) ); }, { { "script", Ref(type<mud::VisualScript>()) }, { "member", Ref(type<mud::Member>()) } } }
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        init_pool<mud::ProcessSetMember>(); 
-        
-        meta_class<mud::ProcessSetMember>();
+        lazy_class<mud::ProcessSetMember>([] {
+            static Class cls = { type<mud::ProcessSetMember>(),
+                // bases
+                { &type<mud::Process>() },
+                { base_offset<mud::ProcessSetMember, mud::Process>() },
+                // constructors
+                {
+                    { type<mud::ProcessSetMember>(), [](Ref ref, array<Var> args) { new(&val<mud::ProcessSetMember>(ref)) mud::ProcessSetMember( val<mud::VisualScript>(args[0]), val<mud::Member>(args[1]) ); }, { { "script", Ref(type<mud::VisualScript>()) }, { "member", Ref(type<mud::Member>()) } } }
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            init_pool<mud::ProcessSetMember>(); 
+            
+            init_class<mud::ProcessSetMember>();
+        });
     }
     
     
@@ -721,32 +761,34 @@ namespace mud
     // mud::ProcessValue
     {
         static Meta meta = { type<mud::ProcessValue>(), &namspc({ "mud" }), "ProcessValue", sizeof(mud::ProcessValue), TypeClass::Object };
-        static Class cls = { type<mud::ProcessValue>(),
-            // bases
-            { &type<mud::Process>() },
-            { base_offset<mud::ProcessValue, mud::Process>() },
-            // constructors
-            {
-                { type<mud::ProcessValue>(), [](Ref ref, array<Var> args) { new(&val<mud::ProcessValue>(ref)) mud::ProcessValue( val<mud::VisualScript>(args[0]), val<mud::Var>(args[1]) ); }, { { "script", Ref(type<mud::VisualScript>()) }, { "value", Ref(type<mud::Var>()) } } }
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        init_pool<mud::ProcessValue>(); 
-        
-        meta_class<mud::ProcessValue>();
+        lazy_class<mud::ProcessValue>([] {
+            static Class cls = { type<mud::ProcessValue>(),
+                // bases
+                { &type<mud::Process>() },
+                { base_offset<mud::ProcessValue, mud::Process>() },
+                // constructors
+                {
+                    { type<mud::ProcessValue>(), [](Ref ref, array<Var> args) { new(&val<mud::ProcessValue>(ref)) mud::ProcessValue( val<mud::VisualScript>(args[0]), val<mud::Var>(args[1]) ); }, { { "script", Ref(type<mud::VisualScript>()) }, { "value", Ref(type<mud::Var>()) } } }
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            init_pool<mud::ProcessValue>(); 
+            
+            init_class<mud::ProcessValue>();
+        });
     }
     
     
@@ -754,31 +796,33 @@ namespace mud
     // mud::ProcessInput
     {
         static Meta meta = { type<mud::ProcessInput>(), &namspc({ "mud" }), "ProcessInput", sizeof(mud::ProcessInput), TypeClass::Object };
-        static Class cls = { type<mud::ProcessInput>(),
-            // bases
-            { &type<mud::Process>(), &type<mud::Param>() },
-            { base_offset<mud::ProcessInput, mud::Process>(), base_offset<mud::ProcessInput, mud::Param>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::ProcessInput>();
+        lazy_class<mud::ProcessInput>([] {
+            static Class cls = { type<mud::ProcessInput>(),
+                // bases
+                { &type<mud::Process>(), &type<mud::Param>() },
+                { base_offset<mud::ProcessInput, mud::Process>(), base_offset<mud::ProcessInput, mud::Param>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::ProcessInput>();
+        });
     }
     
     
@@ -786,31 +830,33 @@ namespace mud
     // mud::ProcessOutput
     {
         static Meta meta = { type<mud::ProcessOutput>(), &namspc({ "mud" }), "ProcessOutput", sizeof(mud::ProcessOutput), TypeClass::Object };
-        static Class cls = { type<mud::ProcessOutput>(),
-            // bases
-            { &type<mud::Process>(), &type<mud::Param>() },
-            { base_offset<mud::ProcessOutput, mud::Process>(), base_offset<mud::ProcessOutput, mud::Param>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::ProcessOutput>();
+        lazy_class<mud::ProcessOutput>([] {
+            static Class cls = { type<mud::ProcessOutput>(),
+                // bases
+                { &type<mud::Process>(), &type<mud::Param>() },
+                { base_offset<mud::ProcessOutput, mud::Process>(), base_offset<mud::ProcessOutput, mud::Param>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::ProcessOutput>();
+        });
     }
     
 
@@ -102,9 +102,11 @@ namespace mud
     // Sequences
     {
         static Meta meta = { type<std::vector<mud::Ref>>(), &namspc({}), "std::vector<mud::Ref>", sizeof(std::vector<mud::Ref>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<mud::Ref>>() };
-        cls.m_content = &type<mud::Ref>();
-        meta_sequence<std::vector<mud::Ref>, mud::Ref>();
+        lazy_class<std::vector<mud::Ref>>([] {
+            static Class cls = { type<std::vector<mud::Ref>>() };
+            cls.m_content = &type<mud::Ref>();
+            init_vector<std::vector<mud::Ref>, mud::Ref>();
+        });
     }
     
     
@@ -117,33 +119,35 @@ namespace mud
     // mud::Index
     {
         static Meta meta = { type<mud::Index>(), &namspc({ "mud" }), "Index", sizeof(mud::Index), TypeClass::Object };
-        static Class cls = { type<mud::Index>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-                { type<mud::Index>(), "indexer", member_address(&mud::Index::indexer), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::Index>(object).indexer(val<mud::Type>(args[0]))); }, { { "type", Ref(type<mud::Type>()) } }, Ref(type<mud::Indexer>()) }
-            },
-            // static members
-            {
-                { type<mud::Index>(), "me", Ref(&mud::Index::me) }
-            }
-        };
+        lazy_class<mud::Index>([] {
+            static Class cls = { type<mud::Index>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                    { type<mud::Index>(), "indexer", member_address(&mud::Index::indexer), [](Ref object, array<Var> args, Var& result) { result = Ref(&val<mud::Index>(object).indexer(val<mud::Type>(args[0]))); }, { { "type", Ref(type<mud::Type>()) } }, Ref(type<mud::Indexer>()) }
+                },
+                // static members
+                {
+                    { type<mud::Index>(), "me", Ref(&mud::Index::me) }
+                }
+            };
         
         
-        
-        
-        meta_class<mud::Index>();
+            
+            
+            init_class<mud::Index>();
+        });
     }
     
     
@@ -151,33 +155,35 @@ namespace mud
     // mud::Indexer
     {
         static Meta meta = { type<mud::Indexer>(), &namspc({ "mud" }), "Indexer", sizeof(mud::Indexer), TypeClass::Object };
-        static Class cls = { type<mud::Indexer>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Indexer>(), Address(), type<mud::Type>(), "type", Ref(type<mud::Type>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Indexer>(object).m_type); } },
-                { type<mud::Indexer>(), member_address(&mud::Indexer::m_objects), type<std::vector<mud::Ref>>(), "objects", var(std::vector<mud::Ref>()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
+        lazy_class<mud::Indexer>([] {
+            static Class cls = { type<mud::Indexer>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Indexer>(), Address(), type<mud::Type>(), "type", Ref(type<mud::Type>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Indexer>(object).m_type); } },
+                    { type<mud::Indexer>(), member_address(&mud::Indexer::m_objects), type<std::vector<mud::Ref>>(), "objects", var(std::vector<mud::Ref>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Indexer>(object).m_objects); }, [](Ref object, Ref value) { member_assign(val<mud::Indexer>(object).m_objects, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        meta_class<mud::Indexer>();
+            
+            
+            init_class<mud::Indexer>();
+        });
     }
     
     
@@ -185,31 +191,33 @@ namespace mud
     // mud::None
     {
         static Meta meta = { type<mud::None>(), &namspc({ "mud" }), "None", sizeof(mud::None), TypeClass::Object };
-        static Class cls = { type<mud::None>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
+        lazy_class<mud::None>([] {
+            static Class cls = { type<mud::None>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        meta_class<mud::None>();
+            
+            
+            init_class<mud::None>();
+        });
     }
     
     
@@ -217,31 +225,33 @@ namespace mud
     // mud::Ref
     {
         static Meta meta = { type<mud::Ref>(), &namspc({ "mud" }), "Ref", sizeof(mud::Ref), TypeClass::Object };
-        static Class cls = { type<mud::Ref>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
+        lazy_class<mud::Ref>([] {
+            static Class cls = { type<mud::Ref>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        
-        meta_class<mud::Ref>();
+            
+            
+            init_class<mud::Ref>();
+        });
     }
     
     
@@ -249,34 +259,36 @@ namespace mud
     // mud::Type
     {
         static Meta meta = { type<mud::Type>(), &namspc({ "mud" }), "Type", sizeof(mud::Type), TypeClass::Object };
-        static Class cls = { type<mud::Type>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Type>(), member_address(&mud::Type::m_id), type<mud::Id>(), "id", var(mud::Id()), Member::Value, nullptr },
-                { type<mud::Type>(), member_address(&mud::Type::m_name), type<cstring>(), "name", var(cstring()), Member::Value, nullptr },
-                { type<mud::Type>(), member_address(&mud::Type::m_base), type<mud::Type>(), "base", Ref(type<mud::Type>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
+        lazy_class<mud::Type>([] {
+            static Class cls = { type<mud::Type>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Type>(), member_address(&mud::Type::m_id), type<mud::Id>(), "id", var(mud::Id()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Type>(object).m_id); }, [](Ref object, Ref value) { member_assign(val<mud::Type>(object).m_id, value); } },
+                    { type<mud::Type>(), member_address(&mud::Type::m_name), type<cstring>(), "name", var(cstring()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Type>(object).m_name); }, [](Ref object, Ref value) { member_assign(val<mud::Type>(object).m_name, value); } },
+                    { type<mud::Type>(), member_address(&mud::Type::m_base), type<mud::Type>(), "base", Ref(type<mud::Type>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        meta_class<mud::Type>();
+            
+            
+            init_class<mud::Type>();
+        });
     }
     
     
@@ -292,31 +304,33 @@ namespace mud
     // mud::Var
     {
         static Meta meta = { type<mud::Var>(), &namspc({ "mud" }), "Var", sizeof(mud::Var), TypeClass::Object };
-        static Class cls = { type<mud::Var>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
+        lazy_class<mud::Var>([] {
+            static Class cls = { type<mud::Var>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        meta_class<mud::Var>();
+            
+            
+            init_class<mud::Var>();
+        });
     }
     
 
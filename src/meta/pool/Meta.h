@@ -28,31 +28,33 @@ namespace mud
     // mud::Pool
     {
         static Meta meta = { type<mud::Pool>(), &namspc({ "mud" }), "Pool", sizeof(mud::Pool), TypeClass::Object };
-        static Class cls = { type<mud::Pool>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
+        lazy_class<mud::Pool>([] {
+            static Class cls = { type<mud::Pool>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        
-        meta_class<mud::Pool>();
+            
+            
+            init_class<mud::Pool>();
+        });
     }
     
     
@@ -99,9 +99,11 @@ namespace mud
     // Sequences
     {
         static Meta meta = { type<std::vector<mud::Image256>>(), &namspc({}), "std::vector<mud::Image256>", sizeof(std::vector<mud::Image256>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<mud::Image256>>() };
-        cls.m_content = &type<mud::Image256>();
-        meta_sequence<std::vector<mud::Image256>, mud::Image256>();
+        lazy_class<std::vector<mud::Image256>>([] {
+            static Class cls = { type<std::vector<mud::Image256>>() };
+            cls.m_content = &type<mud::Image256>();
+            init_vector<std::vector<mud::Image256>, mud::Image256>();
+        });
     }
     
     
@@ -111,34 +113,36 @@ namespace mud
     // mud::Circlifier
     {
         static Meta meta = { type<mud::Circlifier>(), &namspc({ "mud" }), "Circlifier", sizeof(mud::Circlifier), TypeClass::Struct };
-        static Class cls = { type<mud::Circlifier>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::Circlifier>(), [](Ref ref, array<Var> args) { new(&val<mud::Circlifier>(ref)) mud::Circlifier( val<mud::Image256>(args[0]) ); }, { { "image", var(mud::Image256()) } } }
-            },
-            // copy constructor
-            {
-                { type<mud::Circlifier>(), [](Ref ref, Ref other) { new(&val<mud::Circlifier>(ref)) mud::Circlifier(val<mud::Circlifier>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-                { type<mud::Circlifier>(), "compute", member_address(&mud::Circlifier::compute), [](Ref object, array<Var> args, Var& result) { val<std::vector<mud::Circle>>(result) = val<mud::Circlifier>(object).compute(val<mud::Colour>(args[0]), val<float>(args[1])); }, { { "colour", var(mud::Colour()) }, { "scale", var(float(1.f)), Param::Default } }, var(std::vector<mud::Circle>()) }
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Circlifier>();
+        lazy_class<mud::Circlifier>([] {
+            static Class cls = { type<mud::Circlifier>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::Circlifier>(), [](Ref ref, array<Var> args) { new(&val<mud::Circlifier>(ref)) mud::Circlifier( val<mud::Image256>(args[0]) ); }, { { "image", var(mud::Image256()) } } }
+                },
+                // copy constructor
+                {
+                    { type<mud::Circlifier>(), [](Ref ref, Ref other) { new(&val<mud::Circlifier>(ref)) mud::Circlifier(val<mud::Circlifier>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                    { type<mud::Circlifier>(), "compute", member_address(&mud::Circlifier::compute), [](Ref object, array<Var> args, Var& result) { val<std::vector<mud::Circle>>(result) = val<mud::Circlifier>(object).compute(val<mud::Colour>(args[0]), val<float>(args[1])); }, { { "colour", var(mud::Colour()) }, { "scale", var(float(1.f)), Param::Default } }, var(std::vector<mud::Circle>()) }
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Circlifier>();
+        });
     }
     
     
@@ -147,38 +151,40 @@ namespace mud
     // mud::Fract
     {
         static Meta meta = { type<mud::Fract>(), &namspc({ "mud" }), "Fract", sizeof(mud::Fract), TypeClass::Object };
-        static Class cls = { type<mud::Fract>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::Fract>(), [](Ref ref, array<Var> args) { new(&val<mud::Fract>(ref)) mud::Fract( val<size_t>(args[0]) ); }, { { "num_tabs", var(size_t()), Param::Default } } }
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Fract>(), member_address(&mud::Fract::m_num_tabs), type<size_t>(), "nutabs", var(size_t()), Member::Value, nullptr }
-            },
-            // methods
-            {
-                { type<mud::Fract>(), "generate", member_address(&mud::Fract::generate), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Fract>(object).generate(val<size_t>(args[0])); }, { { "num_tabs", var(size_t()), Param::Default } }, Var() },
-                { type<mud::Fract>(), "regen", member_address(&mud::Fract::regen), [](Ref object, array<Var> args, Var& result) { UNUSED(result); UNUSED(args);val<mud::Fract>(object).regen(); }, {}, Var() },
-                { type<mud::Fract>(), "render", member_address(&mud::Fract::render), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Fract>(object).render(val<mud::Rect>(args[0]), val<mud::Pattern>(args[1]), val<mud::uvec2>(args[2]), val<mud::Image256>(args[3])); }, { { "rect", var(mud::Rect()) }, { "pattern", var(mud::Pattern()) }, { "resolution", var(mud::uvec2()) }, { "output_image", var(mud::Image256()), Param::Output } }, Var() },
-                { type<mud::Fract>(), "render_whole", member_address(&mud::Fract::render_whole), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Fract>(object).render_whole(val<mud::Pattern>(args[0]), val<mud::uvec2>(args[1]), val<mud::Image256>(args[2])); }, { { "pattern", var(mud::Pattern()) }, { "resolution", var(mud::uvec2()) }, { "output_image", var(mud::Image256()), Param::Output } }, Var() },
-                { type<mud::Fract>(), "render_grid", member_address(&mud::Fract::render_grid), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Fract>(object).render_grid(val<mud::uvec2>(args[0]), val<mud::Pattern>(args[1]), val<mud::uvec2>(args[2]), val<std::vector<mud::Image256>>(args[3])); }, { { "size", var(mud::uvec2()) }, { "pattern", var(mud::Pattern()) }, { "resolution", var(mud::uvec2()) }, { "output_images", var(std::vector<mud::Image256>()), Param::Output } }, Var() }
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        init_pool<mud::Fract>(); 
-        
-        meta_class<mud::Fract>();
+        lazy_class<mud::Fract>([] {
+            static Class cls = { type<mud::Fract>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::Fract>(), [](Ref ref, array<Var> args) { new(&val<mud::Fract>(ref)) mud::Fract( val<size_t>(args[0]) ); }, { { "num_tabs", var(size_t()), Param::Default } } }
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Fract>(), member_address(&mud::Fract::m_num_tabs), type<size_t>(), "nutabs", var(size_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Fract>(object).m_num_tabs); }, [](Ref object, Ref value) { member_assign(val<mud::Fract>(object).m_num_tabs, value); } }
+                },
+                // methods
+                {
+                    { type<mud::Fract>(), "generate", member_address(&mud::Fract::generate), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Fract>(object).generate(val<size_t>(args[0])); }, { { "num_tabs", var(size_t()), Param::Default } }, Var() },
+                    { type<mud::Fract>(), "regen", member_address(&mud::Fract::regen), [](Ref object, array<Var> args, Var& result) { UNUSED(result); UNUSED(args);val<mud::Fract>(object).regen(); }, {}, Var() },
+                    { type<mud::Fract>(), "render", member_address(&mud::Fract::render), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Fract>(object).render(val<mud::Rect>(args[0]), val<mud::Pattern>(args[1]), val<mud::uvec2>(args[2]), val<mud::Image256>(args[3])); }, { { "rect", var(mud::Rect()) }, { "pattern", var(mud::Pattern()) }, { "resolution", var(mud::uvec2()) }, { "output_image", var(mud::Image256()), Param::Output } }, Var() },
+                    { type<mud::Fract>(), "render_whole", member_address(&mud::Fract::render_whole), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Fract>(object).render_whole(val<mud::Pattern>(args[0]), val<mud::uvec2>(args[1]), val<mud::Image256>(args[2])); }, { { "pattern", var(mud::Pattern()) }, { "resolution", var(mud::uvec2()) }, { "output_image", var(mud::Image256()), Param::Output } }, Var() },
+                    { type<mud::Fract>(), "render_grid", member_address(&mud::Fract::render_grid), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Fract>(object).render_grid(val<mud::uvec2>(args[0]), val<mud::Pattern>(args[1]), val<mud::uvec2>(args[2]), val<std::vector<mud::Image256>>(args[3])); }, { { "size", var(mud::uvec2()) }, { "pattern", var(mud::Pattern()) }, { "resolution", var(mud::uvec2()) }, { "output_images", var(std::vector<mud::Image256>()), Param::Output } }, Var() }
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            init_pool<mud::Fract>(); 
+            
+            init_class<mud::Fract>();
+        });
     }
     
     
@@ -186,36 +192,38 @@ namespace mud
     // mud::FractSample
     {
         static Meta meta = { type<mud::FractSample>(), &namspc({ "mud" }), "FractSample", sizeof(mud::FractSample), TypeClass::Object };
-        static Class cls = { type<mud::FractSample>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::FractSample>(), [](Ref ref, array<Var> args) { new(&val<mud::FractSample>(ref)) mud::FractSample( val<mud::Fract>(args[0]), val<mud::Rect>(args[1]), val<mud::uvec2>(args[2]) ); }, { { "fract", Ref(type<mud::Fract>()) }, { "rect", var(mud::Rect()) }, { "resolution", var(mud::uvec2()) } } }
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::FractSample>(), Address(), type<mud::Fract>(), "fract", Ref(type<mud::Fract>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::FractSample>(object).m_fract); } },
-                { type<mud::FractSample>(), member_address(&mud::FractSample::m_rect), type<mud::Rect>(), "rect", var(mud::Rect()), Member::Value, nullptr },
-                { type<mud::FractSample>(), member_address(&mud::FractSample::m_resolution), type<mud::uvec2>(), "resolution", var(mud::uvec2()), Member::Value, nullptr }
-            },
-            // methods
-            {
-                { type<mud::FractSample>(), "render", member_address(&mud::FractSample::render), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::FractSample>(object).render(val<mud::Pattern>(args[0]), val<mud::Image256>(args[1])); }, { { "pattern", var(mud::Pattern()) }, { "outputImage", var(mud::Image256()), Param::Output } }, Var() }
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        init_pool<mud::FractSample>(); 
-        
-        meta_class<mud::FractSample>();
+        lazy_class<mud::FractSample>([] {
+            static Class cls = { type<mud::FractSample>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::FractSample>(), [](Ref ref, array<Var> args) { new(&val<mud::FractSample>(ref)) mud::FractSample( val<mud::Fract>(args[0]), val<mud::Rect>(args[1]), val<mud::uvec2>(args[2]) ); }, { { "fract", Ref(type<mud::Fract>()) }, { "rect", var(mud::Rect()) }, { "resolution", var(mud::uvec2()) } } }
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::FractSample>(), Address(), type<mud::Fract>(), "fract", Ref(type<mud::Fract>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::FractSample>(object).m_fract); } },
+                    { type<mud::FractSample>(), member_address(&mud::FractSample::m_rect), type<mud::Rect>(), "rect", var(mud::Rect()), Member::Value, nullptr, [](Ref object) { return var(val<mud::FractSample>(object).m_rect); }, [](Ref object, Ref value) { member_assign(val<mud::FractSample>(object).m_rect, value); } },
+                    { type<mud::FractSample>(), member_address(&mud::FractSample::m_resolution), type<mud::uvec2>(), "resolution", var(mud::uvec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::FractSample>(object).m_resolution); }, [](Ref object, Ref value) { member_assign(val<mud::FractSample>(object).m_resolution, value); } }
+                },
+                // methods
+                {
+                    { type<mud::FractSample>(), "render", member_address(&mud::FractSample::render), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::FractSample>(object).render(val<mud::Pattern>(args[0]), val<mud::Image256>(args[1])); }, { { "pattern", var(mud::Pattern()) }, { "outputImage", var(mud::Image256()), Param::Output } }, Var() }
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            init_pool<mud::FractSample>(); 
+            
+            init_class<mud::FractSample>();
+        });
     }
     
     
@@ -223,32 +231,34 @@ namespace mud
     // mud::FractTab
     {
         static Meta meta = { type<mud::FractTab>(), &namspc({ "mud" }), "FractTab", sizeof(mud::FractTab), TypeClass::Struct };
-        static Class cls = { type<mud::FractTab>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::FractTab>(), [](Ref ref, Ref other) { new(&val<mud::FractTab>(ref)) mud::FractTab(val<mud::FractTab>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::FractTab>();
+        lazy_class<mud::FractTab>([] {
+            static Class cls = { type<mud::FractTab>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::FractTab>(), [](Ref ref, Ref other) { new(&val<mud::FractTab>(ref)) mud::FractTab(val<mud::FractTab>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::FractTab>();
+        });
     }
     
     
@@ -256,31 +266,33 @@ namespace mud
     // mud::Noise
     {
         static Meta meta = { type<mud::Noise>(), &namspc({ "mud" }), "Noise", sizeof(mud::Noise), TypeClass::Object };
-        static Class cls = { type<mud::Noise>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Noise>();
+        lazy_class<mud::Noise>([] {
+            static Class cls = { type<mud::Noise>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Noise>();
+        });
     }
     
     
@@ -289,34 +301,36 @@ namespace mud
     // mud::Pattern
     {
         static Meta meta = { type<mud::Pattern>(), &namspc({ "mud" }), "Pattern", sizeof(mud::Pattern), TypeClass::Struct };
-        static Class cls = { type<mud::Pattern>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::Pattern>(), [](Ref ref, array<Var> args) { new(&val<mud::Pattern>(ref)) mud::Pattern( val<mud::Palette>(args[0]), val<mud::PatternSampling>(args[1]), val<float>(args[2]), val<size_t>(args[3]) ); }, { { "palette", var(mud::Palette()) }, { "sampling", var(mud::PatternSampling()) }, { "precision", var(float(1.f)), Param::Default }, { "step", var(size_t()), Param::Default } } },
-                { type<mud::Pattern>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Pattern>(ref)) mud::Pattern(  ); }, {} }
-            },
-            // copy constructor
-            {
-                { type<mud::Pattern>(), [](Ref ref, Ref other) { new(&val<mud::Pattern>(ref)) mud::Pattern(val<mud::Pattern>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Pattern>();
+        lazy_class<mud::Pattern>([] {
+            static Class cls = { type<mud::Pattern>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::Pattern>(), [](Ref ref, array<Var> args) { new(&val<mud::Pattern>(ref)) mud::Pattern( val<mud::Palette>(args[0]), val<mud::PatternSampling>(args[1]), val<float>(args[2]), val<size_t>(args[3]) ); }, { { "palette", var(mud::Palette()) }, { "sampling", var(mud::PatternSampling()) }, { "precision", var(float(1.f)), Param::Default }, { "step", var(size_t()), Param::Default } } },
+                    { type<mud::Pattern>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Pattern>(ref)) mud::Pattern(  ); }, {} }
+                },
+                // copy constructor
+                {
+                    { type<mud::Pattern>(), [](Ref ref, Ref other) { new(&val<mud::Pattern>(ref)) mud::Pattern(val<mud::Pattern>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Pattern>();
+        });
     }
     
     
@@ -327,37 +341,39 @@ namespace mud
     // mud::Tile
     {
         static Meta meta = { type<mud::Tile>(), &namspc({ "mud" }), "Tile", sizeof(mud::Tile), TypeClass::Struct };
-        static Class cls = { type<mud::Tile>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Tile>(), [](Ref ref, Ref other) { new(&val<mud::Tile>(ref)) mud::Tile(val<mud::Tile>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Tile>(), member_address(&mud::Tile::m_index), type<size_t>(), "index", var(size_t()), Member::Value, nullptr },
-                { type<mud::Tile>(), member_address(&mud::Tile::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr },
-                { type<mud::Tile>(), member_address(&mud::Tile::m_symmetry), type<char>(), "symmetry", var(char()), Member::Value, nullptr },
-                { type<mud::Tile>(), member_address(&mud::Tile::m_cardinality), type<int>(), "cardinality", var(int()), Member::Value, nullptr },
-                { type<mud::Tile>(), member_address(&mud::Tile::m_profile), type<int>(), "profile", var(int()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Tile>();
+        lazy_class<mud::Tile>([] {
+            static Class cls = { type<mud::Tile>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Tile>(), [](Ref ref, Ref other) { new(&val<mud::Tile>(ref)) mud::Tile(val<mud::Tile>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Tile>(), member_address(&mud::Tile::m_index), type<size_t>(), "index", var(size_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Tile>(object).m_index); }, [](Ref object, Ref value) { member_assign(val<mud::Tile>(object).m_index, value); } },
+                    { type<mud::Tile>(), member_address(&mud::Tile::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Tile>(object).m_name); }, [](Ref object, Ref value) { member_assign(val<mud::Tile>(object).m_name, value); } },
+                    { type<mud::Tile>(), member_address(&mud::Tile::m_symmetry), type<char>(), "symmetry", var(char()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Tile>(object).m_symmetry); }, [](Ref object, Ref value) { member_assign(val<mud::Tile>(object).m_symmetry, value); } },
+                    { type<mud::Tile>(), member_address(&mud::Tile::m_cardinality), type<int>(), "cardinality", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Tile>(object).m_cardinality); }, [](Ref object, Ref value) { member_assign(val<mud::Tile>(object).m_cardinality, value); } },
+                    { type<mud::Tile>(), member_address(&mud::Tile::m_profile), type<int>(), "profile", var(int()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Tile>(object).m_profile); }, [](Ref object, Ref value) { member_assign(val<mud::Tile>(object).m_profile, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Tile>();
+        });
     }
     
     
@@ -365,37 +381,39 @@ namespace mud
     // mud::Tileset
     {
         static Meta meta = { type<mud::Tileset>(), &namspc({ "mud" }), "Tileset", sizeof(mud::Tileset), TypeClass::Struct };
-        static Class cls = { type<mud::Tileset>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::Tileset>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Tileset>(ref)) mud::Tileset(  ); }, {} }
-            },
-            // copy constructor
-            {
-                { type<mud::Tileset>(), [](Ref ref, Ref other) { new(&val<mud::Tileset>(ref)) mud::Tileset(val<mud::Tileset>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Tileset>(), member_address(&mud::Tileset::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr },
-                { type<mud::Tileset>(), member_address(&mud::Tileset::m_tile_size), type<mud::vec3>(), "tile_size", var(mud::vec3()), Member::Value, nullptr },
-                { type<mud::Tileset>(), member_address(&mud::Tileset::m_tile_scale), type<mud::vec3>(), "tile_scale", var(mud::vec3()), Member::Value, nullptr },
-                { type<mud::Tileset>(), member_address(&mud::Tileset::m_num_tiles), type<uint16_t>(), "nutiles", var(uint16_t()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Tileset>();
+        lazy_class<mud::Tileset>([] {
+            static Class cls = { type<mud::Tileset>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::Tileset>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Tileset>(ref)) mud::Tileset(  ); }, {} }
+                },
+                // copy constructor
+                {
+                    { type<mud::Tileset>(), [](Ref ref, Ref other) { new(&val<mud::Tileset>(ref)) mud::Tileset(val<mud::Tileset>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Tileset>(), member_address(&mud::Tileset::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Tileset>(object).m_name); }, [](Ref object, Ref value) { member_assign(val<mud::Tileset>(object).m_name, value); } },
+                    { type<mud::Tileset>(), member_address(&mud::Tileset::m_tile_size), type<mud::vec3>(), "tile_size", var(mud::vec3()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Tileset>(object).m_tile_size); }, [](Ref object, Ref value) { member_assign(val<mud::Tileset>(object).m_tile_size, value); } },
+                    { type<mud::Tileset>(), member_address(&mud::Tileset::m_tile_scale), type<mud::vec3>(), "tile_scale", var(mud::vec3()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Tileset>(object).m_tile_scale); }, [](Ref object, Ref value) { member_assign(val<mud::Tileset>(object).m_tile_scale, value); } },
+                    { type<mud::Tileset>(), member_address(&mud::Tileset::m_num_tiles), type<uint16_t>(), "nutiles", var(uint16_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Tileset>(object).m_num_tiles); }, [](Ref object, Ref value) { member_assign(val<mud::Tileset>(object).m_num_tiles, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Tileset>();
+        });
     }
     
     
@@ -416,33 +434,35 @@ namespace mud
     // mud::Wave
     {
         static Meta meta = { type<mud::Wave>(), &namspc({ "mud" }), "Wave", sizeof(mud::Wave), TypeClass::Struct };
-        static Class cls = { type<mud::Wave>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Wave>(), [](Ref ref, Ref other) { new(&val<mud::Wave>(ref)) mud::Wave(val<mud::Wave>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-                { type<mud::Wave>(), "solve", member_address(&mud::Wave::solve), [](Ref object, array<Var> args, Var& result) { val<mud::Result>(result) = val<mud::Wave>(object).solve(val<size_t>(args[0])); }, { { "limit", var(size_t()) } }, var(mud::Result()) }
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Wave>();
+        lazy_class<mud::Wave>([] {
+            static Class cls = { type<mud::Wave>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Wave>(), [](Ref ref, Ref other) { new(&val<mud::Wave>(ref)) mud::Wave(val<mud::Wave>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                    { type<mud::Wave>(), "solve", member_address(&mud::Wave::solve), [](Ref object, array<Var> args, Var& result) { val<mud::Result>(result) = val<mud::Wave>(object).solve(val<size_t>(args[0])); }, { { "limit", var(size_t()) } }, var(mud::Result()) }
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Wave>();
+        });
     }
     
     
@@ -450,33 +470,35 @@ namespace mud
     // mud::TileWave
     {
         static Meta meta = { type<mud::TileWave>(), &namspc({ "mud" }), "TileWave", sizeof(mud::TileWave), TypeClass::Struct };
-        static Class cls = { type<mud::TileWave>(),
-            // bases
-            { &type<mud::Wave>() },
-            { base_offset<mud::TileWave, mud::Wave>() },
-            // constructors
-            {
-                { type<mud::TileWave>(), [](Ref ref, array<Var> args) { new(&val<mud::TileWave>(ref)) mud::TileWave( val<mud::WaveTileset>(args[0]), val<uint16_t>(args[1]), val<uint16_t>(args[2]), val<uint16_t>(args[3]), val<bool>(args[4]) ); }, { { "tileset", var(mud::WaveTileset()) }, { "width", var(uint16_t()) }, { "height", var(uint16_t()) }, { "depth", var(uint16_t()) }, { "periodic", var(bool()) } } }
-            },
-            // copy constructor
-            {
-                { type<mud::TileWave>(), [](Ref ref, Ref other) { new(&val<mud::TileWave>(ref)) mud::TileWave(val<mud::TileWave>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::TileWave>();
+        lazy_class<mud::TileWave>([] {
+            static Class cls = { type<mud::TileWave>(),
+                // bases
+                { &type<mud::Wave>() },
+                { base_offset<mud::TileWave, mud::Wave>() },
+                // constructors
+                {
+                    { type<mud::TileWave>(), [](Ref ref, array<Var> args) { new(&val<mud::TileWave>(ref)) mud::TileWave( val<mud::WaveTileset>(args[0]), val<uint16_t>(args[1]), val<uint16_t>(args[2]), val<uint16_t>(args[3]), val<bool>(args[4]) ); }, { { "tileset", var(mud::WaveTileset()) }, { "width", var(uint16_t()) }, { "height", var(uint16_t()) }, { "depth", var(uint16_t()) }, { "periodic", var(bool()) } } }
+                },
+                // copy constructor
+                {
+                    { type<mud::TileWave>(), [](Ref ref, Ref other) { new(&val<mud::TileWave>(ref)) mud::TileWave(val<mud::TileWave>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::TileWave>();
+        });
     }
     
     
@@ -484,33 +506,35 @@ namespace mud
     // mud::WaveTileset
     {
         static Meta meta = { type<mud::WaveTileset>(), &namspc({ "mud" }), "WaveTileset", sizeof(mud::WaveTileset), TypeClass::Struct };
-        static Class cls = { type<mud::WaveTileset>(),
-            // bases
-            { &type<mud::Tileset>() },
-            { base_offset<mud::WaveTileset, mud::Tileset>() },
-            // constructors
-            {
-                { type<mud::WaveTileset>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::WaveTileset>(ref)) mud::WaveTileset(  ); }, {} }
-            },
-            // copy constructor
-            {
-                { type<mud::WaveTileset>(), [](Ref ref, Ref other) { new(&val<mud::WaveTileset>(ref)) mud::WaveTileset(val<mud::WaveTileset>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::WaveTileset>();
+        lazy_class<mud::WaveTileset>([] {
+            static Class cls = { type<mud::WaveTileset>(),
+                // bases
+                { &type<mud::Tileset>() },
+                { base_offset<mud::WaveTileset, mud::Tileset>() },
+                // constructors
+                {
+                    { type<mud::WaveTileset>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::WaveTileset>(ref)) mud::WaveTileset(  ); }, {} }
+                },
+                // copy constructor
+                {
+                    { type<mud::WaveTileset>(), [](Ref ref, Ref other) { new(&val<mud::WaveTileset>(ref)) mud::WaveTileset(val<mud::WaveTileset>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::WaveTileset>();
+        });
     }
     
     
@@ -518,32 +542,34 @@ namespace mud
     // mud::array_3d<float>
     {
         static Meta meta = { type<mud::array_3d<float>>(), &namspc({ "mud" }), "array_3d<float>", sizeof(mud::array_3d<float>), TypeClass::Struct };
-        static Class cls = { type<mud::array_3d<float>>(),
-            // bases
-            { &type<std::vector<float>>() },
-            { base_offset<mud::array_3d<float>, std::vector<float>>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::array_3d<float>>(), [](Ref ref, Ref other) { new(&val<mud::array_3d<float>>(ref)) mud::array_3d<float>(val<mud::array_3d<float>>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::array_3d<float>>();
+        lazy_class<mud::array_3d<float>>([] {
+            static Class cls = { type<mud::array_3d<float>>(),
+                // bases
+                { &type<std::vector<float>>() },
+                { base_offset<mud::array_3d<float>, std::vector<float>>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::array_3d<float>>(), [](Ref ref, Ref other) { new(&val<mud::array_3d<float>>(ref)) mud::array_3d<float>(val<mud::array_3d<float>>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::array_3d<float>>();
+        });
     }
     
 
@@ -33,30 +33,38 @@ namespace mud
     // Sequences
     {
         static Meta meta = { type<std::vector<mud::Function*>>(), &namspc({}), "std::vector<mud::Function*>", sizeof(std::vector<mud::Function*>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<mud::Function*>>() };
-        cls.m_content = &type<mud::Function>();
-        meta_sequence<std::vector<mud::Function*>, mud::Function*>();
+        lazy_class<std::vector<mud::Function*>>([] {
+            static Class cls = { type<std::vector<mud::Function*>>() };
+            cls.m_content = &type<mud::Function>();
+            init_vector<std::vector<mud::Function*>, mud::Function*>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<mud::Module*>>(), &namspc({}), "std::vector<mud::Module*>", sizeof(std::vector<mud::Module*>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<mud::Module*>>() };
-        cls.m_content = &type<mud::Module>();
-        meta_sequence<std::vector<mud::Module*>, mud::Module*>();
+        lazy_class<std::vector<mud::Module*>>([] {
+            static Class cls = { type<std::vector<mud::Module*>>() };
+            cls.m_content = &type<mud::Module>();
+            init_vector<std::vector<mud::Module*>, mud::Module*>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<mud::Type*>>(), &namspc({}), "std::vector<mud::Type*>", sizeof(std::vector<mud::Type*>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<mud::Type*>>() };
-        cls.m_content = &type<mud::Type>();
-        meta_sequence<std::vector<mud::Type*>, mud::Type*>();
+        lazy_class<std::vector<mud::Type*>>([] {
+            static Class cls = { type<std::vector<mud::Type*>>() };
+            cls.m_content = &type<mud::Type>();
+            init_vector<std::vector<mud::Type*>, mud::Type*>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<mud::Var>>(), &namspc({}), "std::vector<mud::Var>", sizeof(std::vector<mud::Var>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<mud::Var>>() };
-        cls.m_content = &type<mud::Var>();
-        meta_sequence<std::vector<mud::Var>, mud::Var>();
+        lazy_class<std::vector<mud::Var>>([] {
+            static Class cls = { type<std::vector<mud::Var>>() };
+            cls.m_content = &type<mud::Var>();
+            init_vector<std::vector<mud::Var>, mud::Var>();
+        });
     }
     
     
@@ -66,36 +74,38 @@ namespace mud
     // mud::Call
     {
         static Meta meta = { type<mud::Call>(), &namspc({ "mud" }), "Call", sizeof(mud::Call), TypeClass::Struct };
-        static Class cls = { type<mud::Call>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::Call>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Call>(ref)) mud::Call(  ); }, {} },
-                { type<mud::Call>(), [](Ref ref, array<Var> args) { new(&val<mud::Call>(ref)) mud::Call( val<mud::Callable>(args[0]), val<std::vector<mud::Var>>(args[1]) ); }, { { "callable", Ref(type<mud::Callable>()) }, { "arguments", var(std::vector<mud::Var>()) } } }
-            },
-            // copy constructor
-            {
-                { type<mud::Call>(), [](Ref ref, Ref other) { new(&val<mud::Call>(ref)) mud::Call(val<mud::Call>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Call>(), member_address(&mud::Call::m_arguments), type<std::vector<mud::Var>>(), "arguments", var(std::vector<mud::Var>()), Member::Value, nullptr },
-                { type<mud::Call>(), member_address(&mud::Call::m_result), type<mud::Var>(), "result", Ref(type<mud::Var>()), Member::None, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Call>();
+        lazy_class<mud::Call>([] {
+            static Class cls = { type<mud::Call>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::Call>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Call>(ref)) mud::Call(  ); }, {} },
+                    { type<mud::Call>(), [](Ref ref, array<Var> args) { new(&val<mud::Call>(ref)) mud::Call( val<mud::Callable>(args[0]), val<std::vector<mud::Var>>(args[1]) ); }, { { "callable", Ref(type<mud::Callable>()) }, { "arguments", var(std::vector<mud::Var>()) } } }
+                },
+                // copy constructor
+                {
+                    { type<mud::Call>(), [](Ref ref, Ref other) { new(&val<mud::Call>(ref)) mud::Call(val<mud::Call>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Call>(), member_address(&mud::Call::m_arguments), type<std::vector<mud::Var>>(), "arguments", var(std::vector<mud::Var>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Call>(object).m_arguments); }, [](Ref object, Ref value) { member_assign(val<mud::Call>(object).m_arguments, value); } },
+                    { type<mud::Call>(), member_address(&mud::Call::m_result), type<mud::Var>(), "result", Ref(type<mud::Var>()), Member::None, nullptr }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Call>();
+        });
     }
     
     
@@ -103,31 +113,33 @@ namespace mud
     // mud::Callable
     {
         static Meta meta = { type<mud::Callable>(), &namspc({ "mud" }), "Callable", sizeof(mud::Callable), TypeClass::Object };
-        static Class cls = { type<mud::Callable>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Callable>();
+        lazy_class<mud::Callable>([] {
+            static Class cls = { type<mud::Callable>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Callable>();
+        });
     }
     
     
@@ -135,31 +147,33 @@ namespace mud
     // mud::Class
     {
         static Meta meta = { type<mud::Class>(), &namspc({ "mud" }), "Class", sizeof(mud::Class), TypeClass::Object };
-        static Class cls = { type<mud::Class>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Class>();
+        lazy_class<mud::Class>([] {
+            static Class cls = { type<mud::Class>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Class>();
+        });
     }
     
     
@@ -167,31 +181,33 @@ namespace mud
     // mud::Convert
     {
         static Meta meta = { type<mud::Convert>(), &namspc({ "mud" }), "Convert", sizeof(mud::Convert), TypeClass::Object };
-        static Class cls = { type<mud::Convert>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Convert>();
+        lazy_class<mud::Convert>([] {
+            static Class cls = { type<mud::Convert>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Convert>();
+        });
     }
     
     
@@ -199,35 +215,37 @@ namespace mud
     // mud::Creator
     {
         static Meta meta = { type<mud::Creator>(), &namspc({ "mud" }), "Creator", sizeof(mud::Creator), TypeClass::Object };
-        static Class cls = { type<mud::Creator>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Creator>(), Address(), type<mud::Type>(), "type", Ref(type<mud::Type>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Creator>(object).m_type); } },
-                { type<mud::Creator>(), member_address(&mud::Creator::m_construct), type<bool>(), "construct", var(bool()), Member::Value, nullptr },
-                { type<mud::Creator>(), member_address(&mud::Creator::m_prototype), type<mud::Type>(), "prototype", Ref(type<mud::Type>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::Creator>(), member_address(&mud::Creator::injector), type<mud::Injector>(), "injector", Ref(type<mud::Injector>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Creator>(object).injector()); } }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Creator>();
+        lazy_class<mud::Creator>([] {
+            static Class cls = { type<mud::Creator>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Creator>(), Address(), type<mud::Type>(), "type", Ref(type<mud::Type>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Creator>(object).m_type); } },
+                    { type<mud::Creator>(), member_address(&mud::Creator::m_construct), type<bool>(), "construct", var(bool()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Creator>(object).m_construct); }, [](Ref object, Ref value) { member_assign(val<mud::Creator>(object).m_construct, value); } },
+                    { type<mud::Creator>(), member_address(&mud::Creator::m_prototype), type<mud::Type>(), "prototype", Ref(type<mud::Type>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::Creator>(), member_address(&mud::Creator::injector), type<mud::Injector>(), "injector", Ref(type<mud::Injector>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Creator>(object).injector()); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Creator>();
+        });
     }
     
     
@@ -235,31 +253,33 @@ namespace mud
     // mud::Enum
     {
         static Meta meta = { type<mud::Enum>(), &namspc({ "mud" }), "Enum", sizeof(mud::Enum), TypeClass::Object };
-        static Class cls = { type<mud::Enum>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Enum>();
+        lazy_class<mud::Enum>([] {
+            static Class cls = { type<mud::Enum>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Enum>();
+        });
     }
     
     
@@ -268,31 +288,33 @@ namespace mud
     // mud::Member
     {
         static Meta meta = { type<mud::Member>(), &namspc({ "mud" }), "Member", sizeof(mud::Member), TypeClass::Object };
-        static Class cls = { type<mud::Member>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Member>();
+        lazy_class<mud::Member>([] {
+            static Class cls = { type<mud::Member>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Member>();
+        });
     }
     
     
@@ -300,31 +322,33 @@ namespace mud
     // mud::Meta
     {
         static Meta meta = { type<mud::Meta>(), &namspc({ "mud" }), "Meta", sizeof(mud::Meta), TypeClass::Object };
-        static Class cls = { type<mud::Meta>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Meta>();
+        lazy_class<mud::Meta>([] {
+            static Class cls = { type<mud::Meta>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Meta>();
+        });
     }
     
     
@@ -332,35 +356,37 @@ namespace mud
     // mud::Module
     {
         static Meta meta = { type<mud::Module>(), &namspc({ "mud" }), "Module", sizeof(mud::Module), TypeClass::Object };
-        static Class cls = { type<mud::Module>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Module>(), member_address(&mud::Module::m_name), type<cstring>(), "name", var(cstring()), Member::Value, nullptr },
-                { type<mud::Module>(), member_address(&mud::Module::m_types), type<std::vector<mud::Type*>>(), "types", var(std::vector<mud::Type*>()), Member::Value, nullptr },
-                { type<mud::Module>(), member_address(&mud::Module::m_functions), type<std::vector<mud::Function*>>(), "functions", var(std::vector<mud::Function*>()), Member::Value, nullptr },
-                { type<mud::Module>(), member_address(&mud::Module::m_path), type<cstring>(), "path", var(cstring()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Module>();
+        lazy_class<mud::Module>([] {
+            static Class cls = { type<mud::Module>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Module>(), member_address(&mud::Module::m_name), type<cstring>(), "name", var(cstring()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Module>(object).m_name); }, [](Ref object, Ref value) { member_assign(val<mud::Module>(object).m_name, value); } },
+                    { type<mud::Module>(), member_address(&mud::Module::m_types), type<std::vector<mud::Type*>>(), "types", var(std::vector<mud::Type*>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Module>(object).m_types); }, [](Ref object, Ref value) { member_assign(val<mud::Module>(object).m_types, value); } },
+                    { type<mud::Module>(), member_address(&mud::Module::m_functions), type<std::vector<mud::Function*>>(), "functions", var(std::vector<mud::Function*>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Module>(object).m_functions); }, [](Ref object, Ref value) { member_assign(val<mud::Module>(object).m_functions, value); } },
+                    { type<mud::Module>(), member_address(&mud::Module::m_path), type<cstring>(), "path", var(cstring()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Module>(object).m_path); }, [](Ref object, Ref value) { member_assign(val<mud::Module>(object).m_path, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Module>();
+        });
     }
     
     
@@ -368,31 +394,33 @@ namespace mud
     // mud::Namespace
     {
         static Meta meta = { type<mud::Namespace>(), &namspc({ "mud" }), "Namespace", sizeof(mud::Namespace), TypeClass::Object };
-        static Class cls = { type<mud::Namespace>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Namespace>();
+        lazy_class<mud::Namespace>([] {
+            static Class cls = { type<mud::Namespace>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Namespace>();
+        });
     }
     
     
@@ -400,31 +428,33 @@ namespace mud
     // mud::Param
     {
         static Meta meta = { type<mud::Param>(), &namspc({ "mud" }), "Param", sizeof(mud::Param), TypeClass::Object };
-        static Class cls = { type<mud::Param>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Param>();
+        lazy_class<mud::Param>([] {
+            static Class cls = { type<mud::Param>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Param>();
+        });
     }
     
     
@@ -433,31 +463,33 @@ namespace mud
     // mud::Signature
     {
         static Meta meta = { type<mud::Signature>(), &namspc({ "mud" }), "Signature", sizeof(mud::Signature), TypeClass::Object };
-        static Class cls = { type<mud::Signature>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Signature>();
+        lazy_class<mud::Signature>([] {
+            static Class cls = { type<mud::Signature>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Signature>();
+        });
     }
     
     
@@ -465,31 +497,33 @@ namespace mud
     // mud::Static
     {
         static Meta meta = { type<mud::Static>(), &namspc({ "mud" }), "Static", sizeof(mud::Static), TypeClass::Object };
-        static Class cls = { type<mud::Static>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Static>();
+        lazy_class<mud::Static>([] {
+            static Class cls = { type<mud::Static>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Static>();
+        });
     }
     
     
@@ -497,34 +531,36 @@ namespace mud
     // mud::System
     {
         static Meta meta = { type<mud::System>(), &namspc({ "mud" }), "System", sizeof(mud::System), TypeClass::Object };
-        static Class cls = { type<mud::System>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::System>(), member_address(&mud::System::m_modules), type<std::vector<mud::Module*>>(), "modules", var(std::vector<mud::Module*>()), Member::Value, nullptr },
-                { type<mud::System>(), member_address(&mud::System::m_types), type<std::vector<mud::Type*>>(), "types", var(std::vector<mud::Type*>()), Member::Value, nullptr },
-                { type<mud::System>(), member_address(&mud::System::m_functions), type<std::vector<mud::Function*>>(), "functions", var(std::vector<mud::Function*>()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::System>();
+        lazy_class<mud::System>([] {
+            static Class cls = { type<mud::System>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::System>(), member_address(&mud::System::m_modules), type<std::vector<mud::Module*>>(), "modules", var(std::vector<mud::Module*>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::System>(object).m_modules); }, [](Ref object, Ref value) { member_assign(val<mud::System>(object).m_modules, value); } },
+                    { type<mud::System>(), member_address(&mud::System::m_types), type<std::vector<mud::Type*>>(), "types", var(std::vector<mud::Type*>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::System>(object).m_types); }, [](Ref object, Ref value) { member_assign(val<mud::System>(object).m_types, value); } },
+                    { type<mud::System>(), member_address(&mud::System::m_functions), type<std::vector<mud::Function*>>(), "functions", var(std::vector<mud::Function*>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::System>(object).m_functions); }, [](Ref object, Ref value) { member_assign(val<mud::System>(object).m_functions, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::System>();
+        });
     }
     
     
@@ -553,31 +589,33 @@ namespace mud
     // mud::Constructor
     {
         static Meta meta = { type<mud::Constructor>(), &namspc({ "mud" }), "Constructor", sizeof(mud::Constructor), TypeClass::Object };
-        static Class cls = { type<mud::Constructor>(),
-            // bases
-            { &type<mud::Callable>() },
-            { base_offset<mud::Constructor, mud::Callable>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Constructor>();
+        lazy_class<mud::Constructor>([] {
+            static Class cls = { type<mud::Constructor>(),
+                // bases
+                { &type<mud::Callable>() },
+                { base_offset<mud::Constructor, mud::Callable>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Constructor>();
+        });
     }
     
     
@@ -585,31 +623,33 @@ namespace mud
     // mud::CopyConstructor
     {
         static Meta meta = { type<mud::CopyConstructor>(), &namspc({ "mud" }), "CopyConstructor", sizeof(mud::CopyConstructor), TypeClass::Object };
-        static Class cls = { type<mud::CopyConstructor>(),
-            // bases
-            { &type<mud::Callable>() },
-            { base_offset<mud::CopyConstructor, mud::Callable>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::CopyConstructor>();
+        lazy_class<mud::CopyConstructor>([] {
+            static Class cls = { type<mud::CopyConstructor>(),
+                // bases
+                { &type<mud::Callable>() },
+                { base_offset<mud::CopyConstructor, mud::Callable>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::CopyConstructor>();
+        });
     }
     
     
@@ -617,31 +657,33 @@ namespace mud
     // mud::Destructor
     {
         static Meta meta = { type<mud::Destructor>(), &namspc({ "mud" }), "Destructor", sizeof(mud::Destructor), TypeClass::Object };
-        static Class cls = { type<mud::Destructor>(),
-            // bases
-            { &type<mud::Callable>() },
-            { base_offset<mud::Destructor, mud::Callable>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Destructor>();
+        lazy_class<mud::Destructor>([] {
+            static Class cls = { type<mud::Destructor>(),
+                // bases
+                { &type<mud::Callable>() },
+                { base_offset<mud::Destructor, mud::Callable>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Destructor>();
+        });
     }
     
     
@@ -649,31 +691,33 @@ namespace mud
     // mud::Function
     {
         static Meta meta = { type<mud::Function>(), &namspc({ "mud" }), "Function", sizeof(mud::Function), TypeClass::Object };
-        static Class cls = { type<mud::Function>(),
-            // bases
-            { &type<mud::Callable>() },
-            { base_offset<mud::Function, mud::Callable>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Function>();
+        lazy_class<mud::Function>([] {
+            static Class cls = { type<mud::Function>(),
+                // bases
+                { &type<mud::Callable>() },
+                { base_offset<mud::Function, mud::Callable>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Function>();
+        });
     }
     
     
@@ -681,31 +725,33 @@ namespace mud
     // mud::Method
     {
         static Meta meta = { type<mud::Method>(), &namspc({ "mud" }), "Method", sizeof(mud::Method), TypeClass::Object };
-        static Class cls = { type<mud::Method>(),
-            // bases
-            { &type<mud::Callable>() },
-            { base_offset<mud::Method, mud::Callable>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Method>();
+        lazy_class<mud::Method>([] {
+            static Class cls = { type<mud::Method>(),
+                // bases
+                { &type<mud::Callable>() },
+                { base_offset<mud::Method, mud::Callable>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Method>();
+        });
     }
     
     
@@ -713,31 +759,33 @@ namespace mud
     // mud::Injector
     {
         static Meta meta = { type<mud::Injector>(), &namspc({ "mud" }), "Injector", sizeof(mud::Injector), TypeClass::Object };
-        static Class cls = { type<mud::Injector>(),
-            // bases
-            { &type<mud::Call>() },
-            { base_offset<mud::Injector, mud::Call>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Injector>();
+        lazy_class<mud::Injector>([] {
+            static Class cls = { type<mud::Injector>(),
+                // bases
+                { &type<mud::Call>() },
+                { base_offset<mud::Injector, mud::Call>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Injector>();
+        });
     }
     
 
@@ -39,41 +39,43 @@ namespace mud
     // mud::EditContext
     {
         static Meta meta = { type<mud::EditContext>(), &namspc({ "mud" }), "EditContext", sizeof(mud::EditContext), TypeClass::Object };
-        static Class cls = { type<mud::EditContext>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::EditContext>(), member_address(&mud::EditContext::m_undo_tool), type<mud::UndoTool>(), "undo_tool", Ref(type<mud::UndoTool>()), Member::None, nullptr },
-                { type<mud::EditContext>(), member_address(&mud::EditContext::m_redo_tool), type<mud::RedoTool>(), "redo_tool", Ref(type<mud::RedoTool>()), Member::None, nullptr },
-                { type<mud::EditContext>(), member_address(&mud::EditContext::m_work_plane), type<mud::Plane>(), "work_plane", var(mud::Plane()), Member::Value, nullptr },
-                { type<mud::EditContext>(), member_address(&mud::EditContext::m_translate_tool), type<mud::TranslateTool>(), "translate_tool", Ref(type<mud::TranslateTool>()), Member::None, nullptr },
-                { type<mud::EditContext>(), member_address(&mud::EditContext::m_rotate_tool), type<mud::RotateTool>(), "rotate_tool", Ref(type<mud::RotateTool>()), Member::None, nullptr },
-                { type<mud::EditContext>(), member_address(&mud::EditContext::m_scale_tool), type<mud::ScaleTool>(), "scale_tool", Ref(type<mud::ScaleTool>()), Member::None, nullptr },
-                { type<mud::EditContext>(), member_address(&mud::EditContext::m_viewer), type<mud::Viewer>(), "viewer", Ref(type<mud::Viewer>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::EditContext>(), member_address(&mud::EditContext::m_tool), type<mud::ViewportTool>(), "tool", Ref(type<mud::ViewportTool>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::EditContext>(), member_address(&mud::EditContext::m_spatial_tool), type<mud::SpatialTool>(), "spatial_tool", Ref(type<mud::SpatialTool>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::EditContext>(), member_address(&mud::EditContext::m_brush), type<mud::Brush>(), "brush", Ref(type<mud::Brush>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::EditContext>();
+        lazy_class<mud::EditContext>([] {
+            static Class cls = { type<mud::EditContext>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::EditContext>(), member_address(&mud::EditContext::m_undo_tool), type<mud::UndoTool>(), "undo_tool", Ref(type<mud::UndoTool>()), Member::None, nullptr },
+                    { type<mud::EditContext>(), member_address(&mud::EditContext::m_redo_tool), type<mud::RedoTool>(), "redo_tool", Ref(type<mud::RedoTool>()), Member::None, nullptr },
+                    { type<mud::EditContext>(), member_address(&mud::EditContext::m_work_plane), type<mud::Plane>(), "work_plane", var(mud::Plane()), Member::Value, nullptr, [](Ref object) { return var(val<mud::EditContext>(object).m_work_plane); }, [](Ref object, Ref value) { member_assign(val<mud::EditContext>(object).m_work_plane, value); } },
+                    { type<mud::EditContext>(), member_address(&mud::EditContext::m_translate_tool), type<mud::TranslateTool>(), "translate_tool", Ref(type<mud::TranslateTool>()), Member::None, nullptr },
+                    { type<mud::EditContext>(), member_address(&mud::EditContext::m_rotate_tool), type<mud::RotateTool>(), "rotate_tool", Ref(type<mud::RotateTool>()), Member::None, nullptr },
+                    { type<mud::EditContext>(), member_address(&mud::EditContext::m_scale_tool), type<mud::ScaleTool>(), "scale_tool", Ref(type<mud::ScaleTool>()), Member::None, nullptr },
+                    { type<mud::EditContext>(), member_address(&mud::EditContext::m_viewer), type<mud::Viewer>(), "viewer", Ref(type<mud::Viewer>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::EditContext>(), member_address(&mud::EditContext::m_tool), type<mud::ViewportTool>(), "tool", Ref(type<mud::ViewportTool>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::EditContext>(), member_address(&mud::EditContext::m_spatial_tool), type<mud::SpatialTool>(), "spatial_tool", Ref(type<mud::SpatialTool>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::EditContext>(), member_address(&mud::EditContext::m_brush), type<mud::Brush>(), "brush", Ref(type<mud::Brush>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::EditContext>();
+        });
     }
     
     
@@ -81,31 +83,33 @@ namespace mud
     // mud::EditorAction
     {
         static Meta meta = { type<mud::EditorAction>(), &namspc({ "mud" }), "EditorAction", sizeof(mud::EditorAction), TypeClass::Object };
-        static Class cls = { type<mud::EditorAction>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::EditorAction>();
+        lazy_class<mud::EditorAction>([] {
+            static Class cls = { type<mud::EditorAction>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::EditorAction>();
+        });
     }
     
     
@@ -113,32 +117,34 @@ namespace mud
     // mud::Gizmo
     {
         static Meta meta = { type<mud::Gizmo>(), &namspc({ "mud" }), "Gizmo", sizeof(mud::Gizmo), TypeClass::Struct };
-        static Class cls = { type<mud::Gizmo>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Gizmo>(), [](Ref ref, Ref other) { new(&val<mud::Gizmo>(ref)) mud::Gizmo(val<mud::Gizmo>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Gizmo>();
+        lazy_class<mud::Gizmo>([] {
+            static Class cls = { type<mud::Gizmo>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Gizmo>(), [](Ref ref, Ref other) { new(&val<mud::Gizmo>(ref)) mud::Gizmo(val<mud::Gizmo>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Gizmo>();
+        });
     }
     
     
@@ -146,35 +152,37 @@ namespace mud
     // mud::Tool
     {
         static Meta meta = { type<mud::Tool>(), &namspc({ "mud" }), "Tool", sizeof(mud::Tool), TypeClass::Object };
-        static Class cls = { type<mud::Tool>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Tool>(), Address(), type<mud::Type>(), "type", Ref(type<mud::Type>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Tool>(object).m_type); } },
-                { type<mud::Tool>(), Address(), type<mud::ToolContext>(), "context", var(mud::ToolContext()), Member::Flags(Member::Value|Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Tool>(object).m_context); } },
-                { type<mud::Tool>(), member_address(&mud::Tool::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr },
-                { type<mud::Tool>(), member_address(&mud::Tool::m_state), type<mud::ToolState>(), "state", var(mud::ToolState()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Tool>();
+        lazy_class<mud::Tool>([] {
+            static Class cls = { type<mud::Tool>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Tool>(), Address(), type<mud::Type>(), "type", Ref(type<mud::Type>()), Member::Flags(Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Tool>(object).m_type); } },
+                    { type<mud::Tool>(), Address(), type<mud::ToolContext>(), "context", var(mud::ToolContext()), Member::Flags(Member::Value|Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Tool>(object).m_context); } },
+                    { type<mud::Tool>(), member_address(&mud::Tool::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Tool>(object).m_name); }, [](Ref object, Ref value) { member_assign(val<mud::Tool>(object).m_name, value); } },
+                    { type<mud::Tool>(), member_address(&mud::Tool::m_state), type<mud::ToolState>(), "state", var(mud::ToolState()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Tool>(object).m_state); }, [](Ref object, Ref value) { member_assign(val<mud::Tool>(object).m_state, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Tool>();
+        });
     }
     
     
@@ -182,32 +190,34 @@ namespace mud
     // mud::ToolContext
     {
         static Meta meta = { type<mud::ToolContext>(), &namspc({ "mud" }), "ToolContext", sizeof(mud::ToolContext), TypeClass::Struct };
-        static Class cls = { type<mud::ToolContext>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::ToolContext>(), [](Ref ref, Ref other) { new(&val<mud::ToolContext>(ref)) mud::ToolContext(val<mud::ToolContext>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::ToolContext>();
+        lazy_class<mud::ToolContext>([] {
+            static Class cls = { type<mud::ToolContext>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::ToolContext>(), [](Ref ref, Ref other) { new(&val<mud::ToolContext>(ref)) mud::ToolContext(val<mud::ToolContext>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::ToolContext>();
+        });
     }
     
     
@@ -215,31 +225,33 @@ namespace mud
     // mud::ToolOption
     {
         static Meta meta = { type<mud::ToolOption>(), &namspc({ "mud" }), "ToolOption", sizeof(mud::ToolOption), TypeClass::Object };
-        static Class cls = { type<mud::ToolOption>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::ToolOption>();
+        lazy_class<mud::ToolOption>([] {
+            static Class cls = { type<mud::ToolOption>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::ToolOption>();
+        });
     }
     
     
@@ -278,31 +290,33 @@ namespace mud
     // mud::TransformAction
     {
         static Meta meta = { type<mud::TransformAction>(), &namspc({ "mud" }), "TransformAction", sizeof(mud::TransformAction), TypeClass::Object };
-        static Class cls = { type<mud::TransformAction>(),
-            // bases
-            { &type<mud::EditorAction>() },
-            { base_offset<mud::TransformAction, mud::EditorAction>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::TransformAction>();
+        lazy_class<mud::TransformAction>([] {
+            static Class cls = { type<mud::TransformAction>(),
+                // bases
+                { &type<mud::EditorAction>() },
+                { base_offset<mud::TransformAction, mud::EditorAction>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::TransformAction>();
+        });
     }
     
     
@@ -310,31 +324,33 @@ namespace mud
     // mud::ViewAction
     {
         static Meta meta = { type<mud::ViewAction>(), &namspc({ "mud" }), "ViewAction", sizeof(mud::ViewAction), TypeClass::Object };
-        static Class cls = { type<mud::ViewAction>(),
-            // bases
-            { &type<mud::EditorAction>() },
-            { base_offset<mud::ViewAction, mud::EditorAction>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::ViewAction>();
+        lazy_class<mud::ViewAction>([] {
+            static Class cls = { type<mud::ViewAction>(),
+                // bases
+                { &type<mud::EditorAction>() },
+                { base_offset<mud::ViewAction, mud::EditorAction>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::ViewAction>();
+        });
     }
     
     
@@ -342,31 +358,33 @@ namespace mud
     // mud::WorkPlaneAction
     {
         static Meta meta = { type<mud::WorkPlaneAction>(), &namspc({ "mud" }), "WorkPlaneAction", sizeof(mud::WorkPlaneAction), TypeClass::Object };
-        static Class cls = { type<mud::WorkPlaneAction>(),
-            // bases
-            { &type<mud::EditorAction>() },
-            { base_offset<mud::WorkPlaneAction, mud::EditorAction>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::WorkPlaneAction>();
+        lazy_class<mud::WorkPlaneAction>([] {
+            static Class cls = { type<mud::WorkPlaneAction>(),
+                // bases
+                { &type<mud::EditorAction>() },
+                { base_offset<mud::WorkPlaneAction, mud::EditorAction>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::WorkPlaneAction>();
+        });
     }
     
     
@@ -374,31 +392,33 @@ namespace mud
     // mud::PlaneSnapOption
     {
         static Meta meta = { type<mud::PlaneSnapOption>(), &namspc({ "mud" }), "PlaneSnapOption", sizeof(mud::PlaneSnapOption), TypeClass::Object };
-        static Class cls = { type<mud::PlaneSnapOption>(),
-            // bases
-            { &type<mud::ToolOption>() },
-            { base_offset<mud::PlaneSnapOption, mud::ToolOption>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::PlaneSnapOption>();
+        lazy_class<mud::PlaneSnapOption>([] {
+            static Class cls = { type<mud::PlaneSnapOption>(),
+                // bases
+                { &type<mud::ToolOption>() },
+                { base_offset<mud::PlaneSnapOption, mud::ToolOption>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::PlaneSnapOption>();
+        });
     }
     
     
@@ -406,31 +426,33 @@ namespace mud
     // mud::WorldSnapOption
     {
         static Meta meta = { type<mud::WorldSnapOption>(), &namspc({ "mud" }), "WorldSnapOption", sizeof(mud::WorldSnapOption), TypeClass::Object };
-        static Class cls = { type<mud::WorldSnapOption>(),
-            // bases
-            { &type<mud::ToolOption>() },
-            { base_offset<mud::WorldSnapOption, mud::ToolOption>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::WorldSnapOption>();
+        lazy_class<mud::WorldSnapOption>([] {
+            static Class cls = { type<mud::WorldSnapOption>(),
+                // bases
+                { &type<mud::ToolOption>() },
+                { base_offset<mud::WorldSnapOption, mud::ToolOption>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::WorldSnapOption>();
+        });
     }
     
     
@@ -438,31 +460,33 @@ namespace mud
     // mud::RedoTool
     {
         static Meta meta = { type<mud::RedoTool>(), &namspc({ "mud" }), "RedoTool", sizeof(mud::RedoTool), TypeClass::Object };
-        static Class cls = { type<mud::RedoTool>(),
-            // bases
-            { &type<mud::Tool>() },
-            { base_offset<mud::RedoTool, mud::Tool>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::RedoTool>();
+        lazy_class<mud::RedoTool>([] {
+            static Class cls = { type<mud::RedoTool>(),
+                // bases
+                { &type<mud::Tool>() },
+                { base_offset<mud::RedoTool, mud::Tool>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::RedoTool>();
+        });
     }
     
     
@@ -470,31 +494,33 @@ namespace mud
     // mud::UndoTool
     {
         static Meta meta = { type<mud::UndoTool>(), &namspc({ "mud" }), "UndoTool", sizeof(mud::UndoTool), TypeClass::Object };
-        static Class cls = { type<mud::UndoTool>(),
-            // bases
-            { &type<mud::Tool>() },
-            { base_offset<mud::UndoTool, mud::Tool>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::UndoTool>();
+        lazy_class<mud::UndoTool>([] {
+            static Class cls = { type<mud::UndoTool>(),
+                // bases
+                { &type<mud::Tool>() },
+                { base_offset<mud::UndoTool, mud::Tool>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::UndoTool>();
+        });
     }
     
     
@@ -502,31 +528,33 @@ namespace mud
     // mud::ViewportTool
     {
         static Meta meta = { type<mud::ViewportTool>(), &namspc({ "mud" }), "ViewportTool", sizeof(mud::ViewportTool), TypeClass::Object };
-        static Class cls = { type<mud::ViewportTool>(),
-            // bases
-            { &type<mud::Tool>() },
-            { base_offset<mud::ViewportTool, mud::Tool>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::ViewportTool>();
+        lazy_class<mud::ViewportTool>([] {
+            static Class cls = { type<mud::ViewportTool>(),
+                // bases
+                { &type<mud::Tool>() },
+                { base_offset<mud::ViewportTool, mud::Tool>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::ViewportTool>();
+        });
     }
     
     
@@ -534,31 +562,33 @@ namespace mud
     // mud::WorkPlaneTool
     {
         static Meta meta = { type<mud::WorkPlaneTool>(), &namspc({ "mud" }), "WorkPlaneTool", sizeof(mud::WorkPlaneTool), TypeClass::Object };
-        static Class cls = { type<mud::WorkPlaneTool>(),
-            // bases
-            { &type<mud::Tool>() },
-            { base_offset<mud::WorkPlaneTool, mud::Tool>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::WorkPlaneTool>();
+        lazy_class<mud::WorkPlaneTool>([] {
+            static Class cls = { type<mud::WorkPlaneTool>(),
+                // bases
+                { &type<mud::Tool>() },
+                { base_offset<mud::WorkPlaneTool, mud::Tool>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::WorkPlaneTool>();
+        });
     }
     
     
@@ -566,31 +596,33 @@ namespace mud
     // mud::Brush
     {
         static Meta meta = { type<mud::Brush>(), &namspc({ "mud" }), "Brush", sizeof(mud::Brush), TypeClass::Object };
-        static Class cls = { type<mud::Brush>(),
-            // bases
-            { &type<mud::SpatialTool>() },
-            { base_offset<mud::Brush, mud::SpatialTool>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Brush>();
+        lazy_class<mud::Brush>([] {
+            static Class cls = { type<mud::Brush>(),
+                // bases
+                { &type<mud::SpatialTool>() },
+                { base_offset<mud::Brush, mud::SpatialTool>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Brush>();
+        });
     }
     
     
@@ -598,31 +630,33 @@ namespace mud
     // mud::TransformTool
     {
         static Meta meta = { type<mud::TransformTool>(), &namspc({ "mud" }), "TransformTool", sizeof(mud::TransformTool), TypeClass::Object };
-        static Class cls = { type<mud::TransformTool>(),
-            // bases
-            { &type<mud::SpatialTool>() },
-            { base_offset<mud::TransformTool, mud::SpatialTool>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::TransformTool>();
+        lazy_class<mud::TransformTool>([] {
+            static Class cls = { type<mud::TransformTool>(),
+                // bases
+                { &type<mud::SpatialTool>() },
+                { base_offset<mud::TransformTool, mud::SpatialTool>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::TransformTool>();
+        });
     }
     
     
@@ -630,31 +664,33 @@ namespace mud
     // mud::RotateAction
     {
         static Meta meta = { type<mud::RotateAction>(), &namspc({ "mud" }), "RotateAction", sizeof(mud::RotateAction), TypeClass::Object };
-        static Class cls = { type<mud::RotateAction>(),
-            // bases
-            { &type<mud::TransformAction>() },
-            { base_offset<mud::RotateAction, mud::TransformAction>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::RotateAction>();
+        lazy_class<mud::RotateAction>([] {
+            static Class cls = { type<mud::RotateAction>(),
+                // bases
+                { &type<mud::TransformAction>() },
+                { base_offset<mud::RotateAction, mud::TransformAction>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::RotateAction>();
+        });
     }
     
     
@@ -662,31 +698,33 @@ namespace mud
     // mud::ScaleAction
     {
         static Meta meta = { type<mud::ScaleAction>(), &namspc({ "mud" }), "ScaleAction", sizeof(mud::ScaleAction), TypeClass::Object };
-        static Class cls = { type<mud::ScaleAction>(),
-            // bases
-            { &type<mud::TransformAction>() },
-            { base_offset<mud::ScaleAction, mud::TransformAction>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::ScaleAction>();
+        lazy_class<mud::ScaleAction>([] {
+            static Class cls = { type<mud::ScaleAction>(),
+                // bases
+                { &type<mud::TransformAction>() },
+                { base_offset<mud::ScaleAction, mud::TransformAction>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::ScaleAction>();
+        });
     }
     
     
@@ -694,31 +732,33 @@ namespace mud
     // mud::TranslateAction
     {
         static Meta meta = { type<mud::TranslateAction>(), &namspc({ "mud" }), "TranslateAction", sizeof(mud::TranslateAction), TypeClass::Object };
-        static Class cls = { type<mud::TranslateAction>(),
-            // bases
-            { &type<mud::TransformAction>() },
-            { base_offset<mud::TranslateAction, mud::TransformAction>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::TranslateAction>();
+        lazy_class<mud::TranslateAction>([] {
+            static Class cls = { type<mud::TranslateAction>(),
+                // bases
+                { &type<mud::TransformAction>() },
+                { base_offset<mud::TranslateAction, mud::TransformAction>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::TranslateAction>();
+        });
     }
     
     
@@ -726,31 +766,33 @@ namespace mud
     // mud::CopyTool
     {
         static Meta meta = { type<mud::CopyTool>(), &namspc({ "mud" }), "CopyTool", sizeof(mud::CopyTool), TypeClass::Object };
-        static Class cls = { type<mud::CopyTool>(),
-            // bases
-            { &type<mud::TransformTool>() },
-            { base_offset<mud::CopyTool, mud::TransformTool>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::CopyTool>();
+        lazy_class<mud::CopyTool>([] {
+            static Class cls = { type<mud::CopyTool>(),
+                // bases
+                { &type<mud::TransformTool>() },
+                { base_offset<mud::CopyTool, mud::TransformTool>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::CopyTool>();
+        });
     }
     
     
@@ -758,31 +800,33 @@ namespace mud
     // mud::RotateTool
     {
         static Meta meta = { type<mud::RotateTool>(), &namspc({ "mud" }), "RotateTool", sizeof(mud::RotateTool), TypeClass::Object };
-        static Class cls = { type<mud::RotateTool>(),
-            // bases
-            { &type<mud::TransformTool>() },
-            { base_offset<mud::RotateTool, mud::TransformTool>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::RotateTool>();
+        lazy_class<mud::RotateTool>([] {
+            static Class cls = { type<mud::RotateTool>(),
+                // bases
+                { &type<mud::TransformTool>() },
+                { base_offset<mud::RotateTool, mud::TransformTool>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::RotateTool>();
+        });
     }
     
     
@@ -790,31 +834,33 @@ namespace mud
     // mud::ScaleTool
     {
         static Meta meta = { type<mud::ScaleTool>(), &namspc({ "mud" }), "ScaleTool", sizeof(mud::ScaleTool), TypeClass::Object };
-        static Class cls = { type<mud::ScaleTool>(),
-            // bases
-            { &type<mud::TransformTool>() },
-            { base_offset<mud::ScaleTool, mud::TransformTool>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::ScaleTool>();
+        lazy_class<mud::ScaleTool>([] {
+            static Class cls = { type<mud::ScaleTool>(),
+                // bases
+                { &type<mud::TransformTool>() },
+                { base_offset<mud::ScaleTool, mud::TransformTool>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::ScaleTool>();
+        });
     }
     
     
@@ -822,31 +868,33 @@ namespace mud
     // mud::TranslateTool
     {
         static Meta meta = { type<mud::TranslateTool>(), &namspc({ "mud" }), "TranslateTool", sizeof(mud::TranslateTool), TypeClass::Object };
-        static Class cls = { type<mud::TranslateTool>(),
-            // bases
-            { &type<mud::TransformTool>() },
-            { base_offset<mud::TranslateTool, mud::TransformTool>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::TranslateTool>();
+        lazy_class<mud::TranslateTool>([] {
+            static Class cls = { type<mud::TranslateTool>(),
+                // bases
+                { &type<mud::TransformTool>() },
+                { base_offset<mud::TranslateTool, mud::TransformTool>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::TranslateTool>();
+        });
     }
     
     
@@ -854,31 +902,33 @@ namespace mud
     // mud::FrameViewTool
     {
         static Meta meta = { type<mud::FrameViewTool>(), &namspc({ "mud" }), "FrameViewTool", sizeof(mud::FrameViewTool), TypeClass::Object };
-        static Class cls = { type<mud::FrameViewTool>(),
-            // bases
-            { &type<mud::ViewportTool>() },
-            { base_offset<mud::FrameViewTool, mud::ViewportTool>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::FrameViewTool>();
+        lazy_class<mud::FrameViewTool>([] {
+            static Class cls = { type<mud::FrameViewTool>(),
+                // bases
+                { &type<mud::ViewportTool>() },
+                { base_offset<mud::FrameViewTool, mud::ViewportTool>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::FrameViewTool>();
+        });
     }
     
     
@@ -886,31 +936,33 @@ namespace mud
     // mud::SpatialTool
     {
         static Meta meta = { type<mud::SpatialTool>(), &namspc({ "mud" }), "SpatialTool", sizeof(mud::SpatialTool), TypeClass::Object };
-        static Class cls = { type<mud::SpatialTool>(),
-            // bases
-            { &type<mud::ViewportTool>() },
-            { base_offset<mud::SpatialTool, mud::ViewportTool>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::SpatialTool>();
+        lazy_class<mud::SpatialTool>([] {
+            static Class cls = { type<mud::SpatialTool>(),
+                // bases
+                { &type<mud::ViewportTool>() },
+                { base_offset<mud::SpatialTool, mud::ViewportTool>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::SpatialTool>();
+        });
     }
     
     
@@ -918,31 +970,33 @@ namespace mud
     // mud::ViewTool
     {
         static Meta meta = { type<mud::ViewTool>(), &namspc({ "mud" }), "ViewTool", sizeof(mud::ViewTool), TypeClass::Object };
-        static Class cls = { type<mud::ViewTool>(),
-            // bases
-            { &type<mud::ViewportTool>() },
-            { base_offset<mud::ViewTool, mud::ViewportTool>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::ViewTool>();
+        lazy_class<mud::ViewTool>([] {
+            static Class cls = { type<mud::ViewTool>(),
+                // bases
+                { &type<mud::ViewportTool>() },
+                { base_offset<mud::ViewTool, mud::ViewportTool>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::ViewTool>();
+        });
     }
     
     
@@ -950,35 +1004,37 @@ namespace mud
     // mud::CircleBrush
     {
         static Meta meta = { type<mud::CircleBrush>(), &namspc({ "mud" }), "CircleBrush", sizeof(mud::CircleBrush), TypeClass::Object };
-        static Class cls = { type<mud::CircleBrush>(),
-            // bases
-            { &type<mud::Brush>() },
-            { base_offset<mud::CircleBrush, mud::Brush>() },
-            // constructors
-            {
-                { type<mud::CircleBrush>(), [](Ref ref, array<Var> args) { new(&val<mud::CircleBrush>(ref)) mud::CircleBrush( val<mud::ToolContext>(args[0]) ); }, { { "context", var(mud::ToolContext()) } } }
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::CircleBrush>(), member_address(&mud::CircleBrush::m_creator), type<mud::Creator>(), "creator", Ref(type<mud::Creator>()), Member::None, nullptr },
-                { type<mud::CircleBrush>(), member_address(&mud::CircleBrush::m_radius), type<float>(), "radius", var(float()), Member::Value, nullptr },
-                { type<mud::CircleBrush>(), member_address(&mud::CircleBrush::m_maxSpotRadius), type<float>(), "maxSpotRadius", var(float()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        init_pool<mud::CircleBrush>(); 
-        
-        meta_class<mud::CircleBrush>();
+        lazy_class<mud::CircleBrush>([] {
+            static Class cls = { type<mud::CircleBrush>(),
+                // bases
+                { &type<mud::Brush>() },
+                { base_offset<mud::CircleBrush, mud::Brush>() },
+                // constructors
+                {
+                    { type<mud::CircleBrush>(), [](Ref ref, array<Var> args) { new(&val<mud::CircleBrush>(ref)) mud::CircleBrush( val<mud::ToolContext>(args[0]) ); }, { { "context", var(mud::ToolContext()) } } }
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::CircleBrush>(), member_address(&mud::CircleBrush::m_creator), type<mud::Creator>(), "creator", Ref(type<mud::Creator>()), Member::None, nullptr },
+                    { type<mud::CircleBrush>(), member_address(&mud::CircleBrush::m_radius), type<float>(), "radius", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<mud::CircleBrush>(object).m_radius); }, [](Ref object, Ref value) { member_assign(val<mud::CircleBrush>(object).m_radius, value); } },
+                    { type<mud::CircleBrush>(), member_address(&mud::CircleBrush::m_maxSpotRadius), type<float>(), "maxSpotRadius", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<mud::CircleBrush>(object).m_maxSpotRadius); }, [](Ref object, Ref value) { member_assign(val<mud::CircleBrush>(object).m_maxSpotRadius, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            init_pool<mud::CircleBrush>(); 
+            
+            init_class<mud::CircleBrush>();
+        });
     }
     
     
@@ -986,33 +1042,35 @@ namespace mud
     // mud::PlaceBrush
     {
         static Meta meta = { type<mud::PlaceBrush>(), &namspc({ "mud" }), "PlaceBrush", sizeof(mud::PlaceBrush), TypeClass::Object };
-        static Class cls = { type<mud::PlaceBrush>(),
-            // bases
-            { &type<mud::Brush>() },
-            { base_offset<mud::PlaceBrush, mud::Brush>() },
-            // constructors
-            {
-                { type<mud::PlaceBrush>(), [](Ref ref, array<Var> args) { new(&val<mud::PlaceBrush>(ref)) mud::PlaceBrush( val<mud::ToolContext>(args[0]) ); }, { { "context", var(mud::ToolContext()) } } }
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::PlaceBrush>(), member_address(&mud::PlaceBrush::m_creator), type<mud::Creator>(), "creator", Ref(type<mud::Creator>()), Member::None, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        init_pool<mud::PlaceBrush>(); 
-        
-        meta_class<mud::PlaceBrush>();
+        lazy_class<mud::PlaceBrush>([] {
+            static Class cls = { type<mud::PlaceBrush>(),
+                // bases
+                { &type<mud::Brush>() },
+                { base_offset<mud::PlaceBrush, mud::Brush>() },
+                // constructors
+                {
+                    { type<mud::PlaceBrush>(), [](Ref ref, array<Var> args) { new(&val<mud::PlaceBrush>(ref)) mud::PlaceBrush( val<mud::ToolContext>(args[0]) ); }, { { "context", var(mud::ToolContext()) } } }
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::PlaceBrush>(), member_address(&mud::PlaceBrush::m_creator), type<mud::Creator>(), "creator", Ref(type<mud::Creator>()), Member::None, nullptr }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            init_pool<mud::PlaceBrush>(); 
+            
+            init_class<mud::PlaceBrush>();
+        });
     }
     
     
@@ -1020,33 +1078,35 @@ namespace mud
     // mud::ScriptedBrush
     {
         static Meta meta = { type<mud::ScriptedBrush>(), &namspc({ "mud" }), "ScriptedBrush", sizeof(mud::ScriptedBrush), TypeClass::Object };
-        static Class cls = { type<mud::ScriptedBrush>(),
-            // bases
-            { &type<mud::Brush>() },
-            { base_offset<mud::ScriptedBrush, mud::Brush>() },
-            // constructors
-            {
-                { type<mud::ScriptedBrush>(), [](Ref ref, array<Var> args) { new(&val<mud::ScriptedBrush>(ref)) mud::ScriptedBrush( val<mud::ToolContext>(args[0]), val<mud::Script>(args[1]) ); }, { { "context", var(mud::ToolContext()) }, { "script", Ref(type<mud::Script>()) } } }
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::ScriptedBrush>(), member_address(&mud::ScriptedBrush::m_call), type<mud::Call>(), "call", var(mud::Call()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        init_pool<mud::ScriptedBrush>(); 
-        
-        meta_class<mud::ScriptedBrush>();
+        lazy_class<mud::ScriptedBrush>([] {
+            static Class cls = { type<mud::ScriptedBrush>(),
+                // bases
+                { &type<mud::Brush>() },
+                { base_offset<mud::ScriptedBrush, mud::Brush>() },
+                // constructors
+                {
+                    { type<mud::ScriptedBrush>(), [](Ref ref, array<Var> args) { new(&val<mud::ScriptedBrush>(ref)) mud::ScriptedBrush( val<mud::ToolContext>(args[0]), val<mud::Script>(args[1]) ); }, { { "context", var(mud::ToolContext()) }, { "script", Ref(type<mud::Script>()) } } }
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::ScriptedBrush>(), member_address(&mud::ScriptedBrush::m_call), type<mud::Call>(), "call", var(mud::Call()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ScriptedBrush>(object).m_call); }, [](Ref object, Ref value) { member_assign(val<mud::ScriptedBrush>(object).m_call, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            init_pool<mud::ScriptedBrush>(); 
+            
+            init_class<mud::ScriptedBrush>();
+        });
     }
     
     
@@ -1054,31 +1114,33 @@ namespace mud
     // mud::CopyAction
     {
         static Meta meta = { type<mud::CopyAction>(), &namspc({ "mud" }), "CopyAction", sizeof(mud::CopyAction), TypeClass::Object };
-        static Class cls = { type<mud::CopyAction>(),
-            // bases
-            { &type<mud::TranslateAction>() },
-            { base_offset<mud::CopyAction, mud::TranslateAction>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::CopyAction>();
+        lazy_class<mud::CopyAction>([] {
+            static Class cls = { type<mud::CopyAction>(),
+                // bases
+                { &type<mud::TranslateAction>() },
+                { base_offset<mud::CopyAction, mud::TranslateAction>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::CopyAction>();
+        });
     }
     
 
@@ -165,30 +165,38 @@ namespace mud
     // Sequences
     {
         static Meta meta = { type<array<cstring>>(), &namspc({}), "array<cstring>", sizeof(array<cstring>), TypeClass::Sequence };
-        static Class cls = { type<array<cstring>>() };
-        cls.m_content = &type<cstring>();
-        meta_sequence<array<cstring>, cstring>();
+        lazy_class<array<cstring>>([] {
+            static Class cls = { type<array<cstring>>() };
+            cls.m_content = &type<cstring>();
+            init_vector<array<cstring>, cstring>();
+        });
     }
     
     {
         static Meta meta = { type<array<float>>(), &namspc({}), "array<float>", sizeof(array<float>), TypeClass::Sequence };
-        static Class cls = { type<array<float>>() };
-        cls.m_content = &type<float>();
-        meta_sequence<array<float>, float>();
+        lazy_class<array<float>>([] {
+            static Class cls = { type<array<float>>() };
+            cls.m_content = &type<float>();
+            init_vector<array<float>, float>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<mud::Space>>(), &namspc({}), "std::vector<mud::Space>", sizeof(std::vector<mud::Space>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<mud::Space>>() };
-        cls.m_content = &type<mud::Space>();
-        meta_sequence<std::vector<mud::Space>, mud::Space>();
+        lazy_class<std::vector<mud::Space>>([] {
+            static Class cls = { type<std::vector<mud::Space>>() };
+            cls.m_content = &type<mud::Space>();
+            init_vector<std::vector<mud::Space>, mud::Space>();
+        });
     }
     
     {
         static Meta meta = { type<std::vector<std::string>>(), &namspc({}), "std::vector<std::string>", sizeof(std::vector<std::string>), TypeClass::Sequence };
-        static Class cls = { type<std::vector<std::string>>() };
-        cls.m_content = &type<std::string>();
-        meta_sequence<std::vector<std::string>, std::string>();
+        lazy_class<std::vector<std::string>>([] {
+            static Class cls = { type<std::vector<std::string>>() };
+            cls.m_content = &type<std::string>();
+            init_vector<std::vector<std::string>, std::string>();
+        });
     }
     
     
@@ -199,32 +207,34 @@ namespace mud
     // mud::CanvasConnect
     {
         static Meta meta = { type<mud::CanvasConnect>(), &namspc({ "mud" }), "CanvasConnect", sizeof(mud::CanvasConnect), TypeClass::Struct };
-        static Class cls = { type<mud::CanvasConnect>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::CanvasConnect>(), [](Ref ref, Ref other) { new(&val<mud::CanvasConnect>(ref)) mud::CanvasConnect(val<mud::CanvasConnect>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
+        lazy_class<mud::CanvasConnect>([] {
+            static Class cls = { type<mud::CanvasConnect>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::CanvasConnect>(), [](Ref ref, Ref other) { new(&val<mud::CanvasConnect>(ref)) mud::CanvasConnect(val<mud::CanvasConnect>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        meta_class<mud::CanvasConnect>();
+            
+            
+            init_class<mud::CanvasConnect>();
+        });
     }
     
     
@@ -235,36 +245,38 @@ namespace mud
     // mud::Dim2<bool>
     {
         static Meta meta = { type<mud::Dim2<bool>>(), &namspc({ "mud" }), "Dim2<bool>", sizeof(mud::Dim2<bool>), TypeClass::Struct };
-        static Class cls = { type<mud::Dim2<bool>>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::Dim2<bool>>(), [](Ref ref, array<Var> args) { new(&val<mud::Dim2<bool>>(ref)) mud::Dim2<bool>( val<bool>(args[0]), val<bool>(args[1]) ); }, { { "a", var(bool()) }, { "b", var(bool()) } } },
-                { type<mud::Dim2<bool>>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Dim2<bool>>(ref)) mud::Dim2<bool>(  ); }, {} }
-            },
-            // copy constructor
-            {
-                { type<mud::Dim2<bool>>(), [](Ref ref, Ref other) { new(&val<mud::Dim2<bool>>(ref)) mud::Dim2<bool>(val<mud::Dim2<bool>>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Dim2<bool>>(), member_address(&mud::Dim2<bool>::x), type<bool>(), "x", var(bool()), Member::Value, nullptr },
-                { type<mud::Dim2<bool>>(), member_address(&mud::Dim2<bool>::y), type<bool>(), "y", var(bool()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        init_string<mud::Dim2<bool>>(); 
-        meta_class<mud::Dim2<bool>>();
+        lazy_class<mud::Dim2<bool>>([] {
+            static Class cls = { type<mud::Dim2<bool>>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::Dim2<bool>>(), [](Ref ref, array<Var> args) { new(&val<mud::Dim2<bool>>(ref)) mud::Dim2<bool>( val<bool>(args[0]), val<bool>(args[1]) ); }, { { "a", var(bool()) }, { "b", var(bool()) } } },
+                    { type<mud::Dim2<bool>>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Dim2<bool>>(ref)) mud::Dim2<bool>(  ); }, {} }
+                },
+                // copy constructor
+                {
+                    { type<mud::Dim2<bool>>(), [](Ref ref, Ref other) { new(&val<mud::Dim2<bool>>(ref)) mud::Dim2<bool>(val<mud::Dim2<bool>>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Dim2<bool>>(), member_address(&mud::Dim2<bool>::x), type<bool>(), "x", var(bool()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Dim2<bool>>(object).x); }, [](Ref object, Ref value) { member_assign(val<mud::Dim2<bool>>(object).x, value); } },
+                    { type<mud::Dim2<bool>>(), member_address(&mud::Dim2<bool>::y), type<bool>(), "y", var(bool()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Dim2<bool>>(object).y); }, [](Ref object, Ref value) { member_assign(val<mud::Dim2<bool>>(object).y, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            init_string<mud::Dim2<bool>>(); 
+            init_class<mud::Dim2<bool>>();
+        });
     }
     
     
@@ -272,36 +284,38 @@ namespace mud
     // mud::Dim2<mud::Align>
     {
         static Meta meta = { type<mud::Dim2<mud::Align>>(), &namspc({ "mud" }), "Dim2<mud::Align>", sizeof(mud::Dim2<mud::Align>), TypeClass::Struct };
-        static Class cls = { type<mud::Dim2<mud::Align>>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::Dim2<mud::Align>>(), [](Ref ref, array<Var> args) { new(&val<mud::Dim2<mud::Align>>(ref)) mud::Dim2<mud::Align>( val<mud::Align>(args[0]), val<mud::Align>(args[1]) ); }, { { "a", var(mud::Align()) }, { "b", var(mud::Align()) } } },
-                { type<mud::Dim2<mud::Align>>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Dim2<mud::Align>>(ref)) mud::Dim2<mud::Align>(  ); }, {} }
-            },
-            // copy constructor
-            {
-                { type<mud::Dim2<mud::Align>>(), [](Ref ref, Ref other) { new(&val<mud::Dim2<mud::Align>>(ref)) mud::Dim2<mud::Align>(val<mud::Dim2<mud::Align>>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Dim2<mud::Align>>(), member_address(&mud::Dim2<mud::Align>::x), type<mud::Align>(), "x", var(mud::Align()), Member::Value, nullptr },
-                { type<mud::Dim2<mud::Align>>(), member_address(&mud::Dim2<mud::Align>::y), type<mud::Align>(), "y", var(mud::Align()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        init_string<mud::Dim2<mud::Align>>(); 
-        meta_class<mud::Dim2<mud::Align>>();
+        lazy_class<mud::Dim2<mud::Align>>([] {
+            static Class cls = { type<mud::Dim2<mud::Align>>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::Dim2<mud::Align>>(), [](Ref ref, array<Var> args) { new(&val<mud::Dim2<mud::Align>>(ref)) mud::Dim2<mud::Align>( val<mud::Align>(args[0]), val<mud::Align>(args[1]) ); }, { { "a", var(mud::Align()) }, { "b", var(mud::Align()) } } },
+                    { type<mud::Dim2<mud::Align>>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Dim2<mud::Align>>(ref)) mud::Dim2<mud::Align>(  ); }, {} }
+                },
+                // copy constructor
+                {
+                    { type<mud::Dim2<mud::Align>>(), [](Ref ref, Ref other) { new(&val<mud::Dim2<mud::Align>>(ref)) mud::Dim2<mud::Align>(val<mud::Dim2<mud::Align>>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Dim2<mud::Align>>(), member_address(&mud::Dim2<mud::Align>::x), type<mud::Align>(), "x", var(mud::Align()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Dim2<mud::Align>>(object).x); }, [](Ref object, Ref value) { member_assign(val<mud::Dim2<mud::Align>>(object).x, value); } },
+                    { type<mud::Dim2<mud::Align>>(), member_address(&mud::Dim2<mud::Align>::y), type<mud::Align>(), "y", var(mud::Align()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Dim2<mud::Align>>(object).y); }, [](Ref object, Ref value) { member_assign(val<mud::Dim2<mud::Align>>(object).y, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            init_string<mud::Dim2<mud::Align>>(); 
+            init_class<mud::Dim2<mud::Align>>();
+        });
     }
     
     
@@ -309,36 +323,38 @@ namespace mud
     // mud::Dim2<mud::AutoLayout>
     {
         static Meta meta = { type<mud::Dim2<mud::AutoLayout>>(), &namspc({ "mud" }), "Dim2<mud::AutoLayout>", sizeof(mud::Dim2<mud::AutoLayout>), TypeClass::Struct };
-        static Class cls = { type<mud::Dim2<mud::AutoLayout>>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::Dim2<mud::AutoLayout>>(), [](Ref ref, array<Var> args) { new(&val<mud::Dim2<mud::AutoLayout>>(ref)) mud::Dim2<mud::AutoLayout>( val<mud::AutoLayout>(args[0]), val<mud::AutoLayout>(args[1]) ); }, { { "a", var(mud::AutoLayout()) }, { "b", var(mud::AutoLayout()) } } },
-                { type<mud::Dim2<mud::AutoLayout>>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Dim2<mud::AutoLayout>>(ref)) mud::Dim2<mud::AutoLayout>(  ); }, {} }
-            },
-            // copy constructor
-            {
-                { type<mud::Dim2<mud::AutoLayout>>(), [](Ref ref, Ref other) { new(&val<mud::Dim2<mud::AutoLayout>>(ref)) mud::Dim2<mud::AutoLayout>(val<mud::Dim2<mud::AutoLayout>>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Dim2<mud::AutoLayout>>(), member_address(&mud::Dim2<mud::AutoLayout>::x), type<mud::AutoLayout>(), "x", var(mud::AutoLayout()), Member::Value, nullptr },
-                { type<mud::Dim2<mud::AutoLayout>>(), member_address(&mud::Dim2<mud::AutoLayout>::y), type<mud::AutoLayout>(), "y", var(mud::AutoLayout()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        init_string<mud::Dim2<mud::AutoLayout>>(); 
-        meta_class<mud::Dim2<mud::AutoLayout>>();
+        lazy_class<mud::Dim2<mud::AutoLayout>>([] {
+            static Class cls = { type<mud::Dim2<mud::AutoLayout>>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::Dim2<mud::AutoLayout>>(), [](Ref ref, array<Var> args) { new(&val<mud::Dim2<mud::AutoLayout>>(ref)) mud::Dim2<mud::AutoLayout>( val<mud::AutoLayout>(args[0]), val<mud::AutoLayout>(args[1]) ); }, { { "a", var(mud::AutoLayout()) }, { "b", var(mud::AutoLayout()) } } },
+                    { type<mud::Dim2<mud::AutoLayout>>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Dim2<mud::AutoLayout>>(ref)) mud::Dim2<mud::AutoLayout>(  ); }, {} }
+                },
+                // copy constructor
+                {
+                    { type<mud::Dim2<mud::AutoLayout>>(), [](Ref ref, Ref other) { new(&val<mud::Dim2<mud::AutoLayout>>(ref)) mud::Dim2<mud::AutoLayout>(val<mud::Dim2<mud::AutoLayout>>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Dim2<mud::AutoLayout>>(), member_address(&mud::Dim2<mud::AutoLayout>::x), type<mud::AutoLayout>(), "x", var(mud::AutoLayout()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Dim2<mud::AutoLayout>>(object).x); }, [](Ref object, Ref value) { member_assign(val<mud::Dim2<mud::AutoLayout>>(object).x, value); } },
+                    { type<mud::Dim2<mud::AutoLayout>>(), member_address(&mud::Dim2<mud::AutoLayout>::y), type<mud::AutoLayout>(), "y", var(mud::AutoLayout()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Dim2<mud::AutoLayout>>(object).y); }, [](Ref object, Ref value) { member_assign(val<mud::Dim2<mud::AutoLayout>>(object).y, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            init_string<mud::Dim2<mud::AutoLayout>>(); 
+            init_class<mud::Dim2<mud::AutoLayout>>();
+        });
     }
     
     
@@ -346,36 +362,38 @@ namespace mud
     // mud::Dim2<mud::Pivot>
     {
         static Meta meta = { type<mud::Dim2<mud::Pivot>>(), &namspc({ "mud" }), "Dim2<mud::Pivot>", sizeof(mud::Dim2<mud::Pivot>), TypeClass::Struct };
-        static Class cls = { type<mud::Dim2<mud::Pivot>>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::Dim2<mud::Pivot>>(), [](Ref ref, array<Var> args) { new(&val<mud::Dim2<mud::Pivot>>(ref)) mud::Dim2<mud::Pivot>( val<mud::Pivot>(args[0]), val<mud::Pivot>(args[1]) ); }, { { "a", var(mud::Pivot()) }, { "b", var(mud::Pivot()) } } },
-                { type<mud::Dim2<mud::Pivot>>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Dim2<mud::Pivot>>(ref)) mud::Dim2<mud::Pivot>(  ); }, {} }
-            },
-            // copy constructor
-            {
-                { type<mud::Dim2<mud::Pivot>>(), [](Ref ref, Ref other) { new(&val<mud::Dim2<mud::Pivot>>(ref)) mud::Dim2<mud::Pivot>(val<mud::Dim2<mud::Pivot>>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Dim2<mud::Pivot>>(), member_address(&mud::Dim2<mud::Pivot>::x), type<mud::Pivot>(), "x", var(mud::Pivot()), Member::Value, nullptr },
-                { type<mud::Dim2<mud::Pivot>>(), member_address(&mud::Dim2<mud::Pivot>::y), type<mud::Pivot>(), "y", var(mud::Pivot()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        init_string<mud::Dim2<mud::Pivot>>(); 
-        meta_class<mud::Dim2<mud::Pivot>>();
+        lazy_class<mud::Dim2<mud::Pivot>>([] {
+            static Class cls = { type<mud::Dim2<mud::Pivot>>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::Dim2<mud::Pivot>>(), [](Ref ref, array<Var> args) { new(&val<mud::Dim2<mud::Pivot>>(ref)) mud::Dim2<mud::Pivot>( val<mud::Pivot>(args[0]), val<mud::Pivot>(args[1]) ); }, { { "a", var(mud::Pivot()) }, { "b", var(mud::Pivot()) } } },
+                    { type<mud::Dim2<mud::Pivot>>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Dim2<mud::Pivot>>(ref)) mud::Dim2<mud::Pivot>(  ); }, {} }
+                },
+                // copy constructor
+                {
+                    { type<mud::Dim2<mud::Pivot>>(), [](Ref ref, Ref other) { new(&val<mud::Dim2<mud::Pivot>>(ref)) mud::Dim2<mud::Pivot>(val<mud::Dim2<mud::Pivot>>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Dim2<mud::Pivot>>(), member_address(&mud::Dim2<mud::Pivot>::x), type<mud::Pivot>(), "x", var(mud::Pivot()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Dim2<mud::Pivot>>(object).x); }, [](Ref object, Ref value) { member_assign(val<mud::Dim2<mud::Pivot>>(object).x, value); } },
+                    { type<mud::Dim2<mud::Pivot>>(), member_address(&mud::Dim2<mud::Pivot>::y), type<mud::Pivot>(), "y", var(mud::Pivot()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Dim2<mud::Pivot>>(object).y); }, [](Ref object, Ref value) { member_assign(val<mud::Dim2<mud::Pivot>>(object).y, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            init_string<mud::Dim2<mud::Pivot>>(); 
+            init_class<mud::Dim2<mud::Pivot>>();
+        });
     }
     
     
@@ -383,36 +401,38 @@ namespace mud
     // mud::Dim2<mud::Sizing>
     {
         static Meta meta = { type<mud::Dim2<mud::Sizing>>(), &namspc({ "mud" }), "Dim2<mud::Sizing>", sizeof(mud::Dim2<mud::Sizing>), TypeClass::Struct };
-        static Class cls = { type<mud::Dim2<mud::Sizing>>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::Dim2<mud::Sizing>>(), [](Ref ref, array<Var> args) { new(&val<mud::Dim2<mud::Sizing>>(ref)) mud::Dim2<mud::Sizing>( val<mud::Sizing>(args[0]), val<mud::Sizing>(args[1]) ); }, { { "a", var(mud::Sizing()) }, { "b", var(mud::Sizing()) } } },
-                { type<mud::Dim2<mud::Sizing>>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Dim2<mud::Sizing>>(ref)) mud::Dim2<mud::Sizing>(  ); }, {} }
-            },
-            // copy constructor
-            {
-                { type<mud::Dim2<mud::Sizing>>(), [](Ref ref, Ref other) { new(&val<mud::Dim2<mud::Sizing>>(ref)) mud::Dim2<mud::Sizing>(val<mud::Dim2<mud::Sizing>>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Dim2<mud::Sizing>>(), member_address(&mud::Dim2<mud::Sizing>::x), type<mud::Sizing>(), "x", var(mud::Sizing()), Member::Value, nullptr },
-                { type<mud::Dim2<mud::Sizing>>(), member_address(&mud::Dim2<mud::Sizing>::y), type<mud::Sizing>(), "y", var(mud::Sizing()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        init_string<mud::Dim2<mud::Sizing>>(); 
-        meta_class<mud::Dim2<mud::Sizing>>();
+        lazy_class<mud::Dim2<mud::Sizing>>([] {
+            static Class cls = { type<mud::Dim2<mud::Sizing>>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::Dim2<mud::Sizing>>(), [](Ref ref, array<Var> args) { new(&val<mud::Dim2<mud::Sizing>>(ref)) mud::Dim2<mud::Sizing>( val<mud::Sizing>(args[0]), val<mud::Sizing>(args[1]) ); }, { { "a", var(mud::Sizing()) }, { "b", var(mud::Sizing()) } } },
+                    { type<mud::Dim2<mud::Sizing>>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Dim2<mud::Sizing>>(ref)) mud::Dim2<mud::Sizing>(  ); }, {} }
+                },
+                // copy constructor
+                {
+                    { type<mud::Dim2<mud::Sizing>>(), [](Ref ref, Ref other) { new(&val<mud::Dim2<mud::Sizing>>(ref)) mud::Dim2<mud::Sizing>(val<mud::Dim2<mud::Sizing>>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Dim2<mud::Sizing>>(), member_address(&mud::Dim2<mud::Sizing>::x), type<mud::Sizing>(), "x", var(mud::Sizing()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Dim2<mud::Sizing>>(object).x); }, [](Ref object, Ref value) { member_assign(val<mud::Dim2<mud::Sizing>>(object).x, value); } },
+                    { type<mud::Dim2<mud::Sizing>>(), member_address(&mud::Dim2<mud::Sizing>::y), type<mud::Sizing>(), "y", var(mud::Sizing()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Dim2<mud::Sizing>>(object).y); }, [](Ref object, Ref value) { member_assign(val<mud::Dim2<mud::Sizing>>(object).y, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            init_string<mud::Dim2<mud::Sizing>>(); 
+            init_class<mud::Dim2<mud::Sizing>>();
+        });
     }
     
     
@@ -420,36 +440,38 @@ namespace mud
     // mud::Dim2<size_t>
     {
         static Meta meta = { type<mud::Dim2<size_t>>(), &namspc({ "mud" }), "Dim2<size_t>", sizeof(mud::Dim2<size_t>), TypeClass::Struct };
-        static Class cls = { type<mud::Dim2<size_t>>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::Dim2<size_t>>(), [](Ref ref, array<Var> args) { new(&val<mud::Dim2<size_t>>(ref)) mud::Dim2<size_t>( val<size_t>(args[0]), val<size_t>(args[1]) ); }, { { "a", var(size_t()) }, { "b", var(size_t()) } } },
-                { type<mud::Dim2<size_t>>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Dim2<size_t>>(ref)) mud::Dim2<size_t>(  ); }, {} }
-            },
-            // copy constructor
-            {
-                { type<mud::Dim2<size_t>>(), [](Ref ref, Ref other) { new(&val<mud::Dim2<size_t>>(ref)) mud::Dim2<size_t>(val<mud::Dim2<size_t>>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Dim2<size_t>>(), member_address(&mud::Dim2<size_t>::x), type<size_t>(), "x", var(size_t()), Member::Value, nullptr },
-                { type<mud::Dim2<size_t>>(), member_address(&mud::Dim2<size_t>::y), type<size_t>(), "y", var(size_t()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        init_string<mud::Dim2<size_t>>(); 
-        meta_class<mud::Dim2<size_t>>();
+        lazy_class<mud::Dim2<size_t>>([] {
+            static Class cls = { type<mud::Dim2<size_t>>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::Dim2<size_t>>(), [](Ref ref, array<Var> args) { new(&val<mud::Dim2<size_t>>(ref)) mud::Dim2<size_t>( val<size_t>(args[0]), val<size_t>(args[1]) ); }, { { "a", var(size_t()) }, { "b", var(size_t()) } } },
+                    { type<mud::Dim2<size_t>>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Dim2<size_t>>(ref)) mud::Dim2<size_t>(  ); }, {} }
+                },
+                // copy constructor
+                {
+                    { type<mud::Dim2<size_t>>(), [](Ref ref, Ref other) { new(&val<mud::Dim2<size_t>>(ref)) mud::Dim2<size_t>(val<mud::Dim2<size_t>>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Dim2<size_t>>(), member_address(&mud::Dim2<size_t>::x), type<size_t>(), "x", var(size_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Dim2<size_t>>(object).x); }, [](Ref object, Ref value) { member_assign(val<mud::Dim2<size_t>>(object).x, value); } },
+                    { type<mud::Dim2<size_t>>(), member_address(&mud::Dim2<size_t>::y), type<size_t>(), "y", var(size_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Dim2<size_t>>(object).y); }, [](Ref object, Ref value) { member_assign(val<mud::Dim2<size_t>>(object).y, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            init_string<mud::Dim2<size_t>>(); 
+            init_class<mud::Dim2<size_t>>();
+        });
     }
     
     
@@ -457,32 +479,34 @@ namespace mud
     // mud::Dock
     {
         static Meta meta = { type<mud::Dock>(), &namspc({ "mud" }), "Dock", sizeof(mud::Dock), TypeClass::Struct };
-        static Class cls = { type<mud::Dock>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Dock>(), [](Ref ref, Ref other) { new(&val<mud::Dock>(ref)) mud::Dock(val<mud::Dock>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Dock>();
+        lazy_class<mud::Dock>([] {
+            static Class cls = { type<mud::Dock>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Dock>(), [](Ref ref, Ref other) { new(&val<mud::Dock>(ref)) mud::Dock(val<mud::Dock>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Dock>();
+        });
     }
     
     
@@ -491,31 +515,33 @@ namespace mud
     // mud::Docksystem
     {
         static Meta meta = { type<mud::Docksystem>(), &namspc({ "mud" }), "Docksystem", sizeof(mud::Docksystem), TypeClass::Object };
-        static Class cls = { type<mud::Docksystem>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
+        lazy_class<mud::Docksystem>([] {
+            static Class cls = { type<mud::Docksystem>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        
-        meta_class<mud::Docksystem>();
+            
+            
+            init_class<mud::Docksystem>();
+        });
     }
     
     
@@ -529,34 +555,36 @@ namespace mud
     // mud::Gradient
     {
         static Meta meta = { type<mud::Gradient>(), &namspc({ "mud" }), "Gradient", sizeof(mud::Gradient), TypeClass::Struct };
-        static Class cls = { type<mud::Gradient>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Gradient>(), [](Ref ref, Ref other) { new(&val<mud::Gradient>(ref)) mud::Gradient(val<mud::Gradient>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Gradient>(), member_address(&mud::Gradient::m_start), type<mud::Colour>(), "start", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::Gradient>(), member_address(&mud::Gradient::m_end), type<mud::Colour>(), "end", var(mud::Colour()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Gradient>();
+        lazy_class<mud::Gradient>([] {
+            static Class cls = { type<mud::Gradient>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Gradient>(), [](Ref ref, Ref other) { new(&val<mud::Gradient>(ref)) mud::Gradient(val<mud::Gradient>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Gradient>(), member_address(&mud::Gradient::m_start), type<mud::Colour>(), "start", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Gradient>(object).m_start); }, [](Ref object, Ref value) { member_assign(val<mud::Gradient>(object).m_start, value); } },
+                    { type<mud::Gradient>(), member_address(&mud::Gradient::m_end), type<mud::Colour>(), "end", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Gradient>(object).m_end); }, [](Ref object, Ref value) { member_assign(val<mud::Gradient>(object).m_end, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Gradient>();
+        });
     }
     
     
@@ -564,31 +592,33 @@ namespace mud
     // mud::GridSolver
     {
         static Meta meta = { type<mud::GridSolver>(), &namspc({ "mud" }), "GridSolver", sizeof(mud::GridSolver), TypeClass::Object };
-        static Class cls = { type<mud::GridSolver>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::GridSolver>();
+        lazy_class<mud::GridSolver>([] {
+            static Class cls = { type<mud::GridSolver>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::GridSolver>();
+        });
     }
     
     
@@ -597,40 +627,42 @@ namespace mud
     // mud::ImageSkin
     {
         static Meta meta = { type<mud::ImageSkin>(), &namspc({ "mud" }), "ImageSkin", sizeof(mud::ImageSkin), TypeClass::Struct };
-        static Class cls = { type<mud::ImageSkin>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::ImageSkin>(), [](Ref ref, array<Var> args) { new(&val<mud::ImageSkin>(ref)) mud::ImageSkin( val<mud::Image>(args[0]), val<int>(args[1]), val<int>(args[2]), val<int>(args[3]), val<int>(args[4]), val<int>(args[5]), val<mud::Dim>(args[6]) ); }, { { "image", var(mud::Image()) }, { "left", var(int()) }, { "top", var(int()) }, { "right", var(int()) }, { "bottom", var(int()) }, { "margin", var(int(0)), Param::Default }, { "stretch", var(mud::Dim()), Param::Default } } }
-            },
-            // copy constructor
-            {
-                { type<mud::ImageSkin>(), [](Ref ref, Ref other) { new(&val<mud::ImageSkin>(ref)) mud::ImageSkin(val<mud::ImageSkin>(other)); } }
-            },
-            // members
-            {
-                { type<mud::ImageSkin>(), member_address(&mud::ImageSkin::d_image), type<mud::Image>(), "d_image", Ref(type<mud::Image>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::ImageSkin>(), member_address(&mud::ImageSkin::d_left), type<int>(), "d_left", var(int(0)), Member::Value, nullptr },
-                { type<mud::ImageSkin>(), member_address(&mud::ImageSkin::d_top), type<int>(), "d_top", var(int(0)), Member::Value, nullptr },
-                { type<mud::ImageSkin>(), member_address(&mud::ImageSkin::d_right), type<int>(), "d_right", var(int(0)), Member::Value, nullptr },
-                { type<mud::ImageSkin>(), member_address(&mud::ImageSkin::d_bottom), type<int>(), "d_bottom", var(int(0)), Member::Value, nullptr },
-                { type<mud::ImageSkin>(), member_address(&mud::ImageSkin::m_margin), type<int>(), "margin", var(int(0)), Member::Value, nullptr },
-                { type<mud::ImageSkin>(), member_address(&mud::ImageSkin::d_stretch), type<mud::Dim>(), "d_stretch", var(mud::Dim()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::ImageSkin>();
+        lazy_class<mud::ImageSkin>([] {
+            static Class cls = { type<mud::ImageSkin>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::ImageSkin>(), [](Ref ref, array<Var> args) { new(&val<mud::ImageSkin>(ref)) mud::ImageSkin( val<mud::Image>(args[0]), val<int>(args[1]), val<int>(args[2]), val<int>(args[3]), val<int>(args[4]), val<int>(args[5]), val<mud::Dim>(args[6]) ); }, { { "image", var(mud::Image()) }, { "left", var(int()) }, { "top", var(int()) }, { "right", var(int()) }, { "bottom", var(int()) }, { "margin", var(int(0)), Param::Default }, { "stretch", var(mud::Dim()), Param::Default } } }
+                },
+                // copy constructor
+                {
+                    { type<mud::ImageSkin>(), [](Ref ref, Ref other) { new(&val<mud::ImageSkin>(ref)) mud::ImageSkin(val<mud::ImageSkin>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::ImageSkin>(), member_address(&mud::ImageSkin::d_image), type<mud::Image>(), "d_image", Ref(type<mud::Image>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::ImageSkin>(), member_address(&mud::ImageSkin::d_left), type<int>(), "d_left", var(int(0)), Member::Value, nullptr, [](Ref object) { return var(val<mud::ImageSkin>(object).d_left); }, [](Ref object, Ref value) { member_assign(val<mud::ImageSkin>(object).d_left, value); } },
+                    { type<mud::ImageSkin>(), member_address(&mud::ImageSkin::d_top), type<int>(), "d_top", var(int(0)), Member::Value, nullptr, [](Ref object) { return var(val<mud::ImageSkin>(object).d_top); }, [](Ref object, Ref value) { member_assign(val<mud::ImageSkin>(object).d_top, value); } },
+                    { type<mud::ImageSkin>(), member_address(&mud::ImageSkin::d_right), type<int>(), "d_right", var(int(0)), Member::Value, nullptr, [](Ref object) { return var(val<mud::ImageSkin>(object).d_right); }, [](Ref object, Ref value) { member_assign(val<mud::ImageSkin>(object).d_right, value); } },
+                    { type<mud::ImageSkin>(), member_address(&mud::ImageSkin::d_bottom), type<int>(), "d_bottom", var(int(0)), Member::Value, nullptr, [](Ref object) { return var(val<mud::ImageSkin>(object).d_bottom); }, [](Ref object, Ref value) { member_assign(val<mud::ImageSkin>(object).d_bottom, value); } },
+                    { type<mud::ImageSkin>(), member_address(&mud::ImageSkin::m_margin), type<int>(), "margin", var(int(0)), Member::Value, nullptr, [](Ref object) { return var(val<mud::ImageSkin>(object).m_margin); }, [](Ref object, Ref value) { member_assign(val<mud::ImageSkin>(object).m_margin, value); } },
+                    { type<mud::ImageSkin>(), member_address(&mud::ImageSkin::d_stretch), type<mud::Dim>(), "d_stretch", var(mud::Dim()), Member::Value, nullptr, [](Ref object) { return var(val<mud::ImageSkin>(object).d_stretch); }, [](Ref object, Ref value) { member_assign(val<mud::ImageSkin>(object).d_stretch, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::ImageSkin>();
+        });
     }
     
     
@@ -638,60 +670,62 @@ namespace mud
     // mud::InkStyle
     {
         static Meta meta = { type<mud::InkStyle>(), &namspc({ "mud" }), "InkStyle", sizeof(mud::InkStyle), TypeClass::Struct };
-        static Class cls = { type<mud::InkStyle>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::InkStyle>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::InkStyle>(ref)) mud::InkStyle(  ); }, {} },
-                { type<mud::InkStyle>(), [](Ref ref, array<Var> args) { new(&val<mud::InkStyle>(ref)) mud::InkStyle( val<cstring>(args[0]) ); }, { { "name", var(cstring()) } } }
-            },
-            // copy constructor
-            {
-                { type<mud::InkStyle>(), [](Ref ref, Ref other) { new(&val<mud::InkStyle>(ref)) mud::InkStyle(val<mud::InkStyle>(other)); } }
-            },
-            // members
-            {
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_empty), type<bool>(), "empty", var(bool(true)), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_background_colour), type<mud::Colour>(), "background_colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_border_colour), type<mud::Colour>(), "border_colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_image_colour), type<mud::Colour>(), "image_colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_text_colour), type<mud::Colour>(), "text_colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_text_font), type<std::string>(), "text_font", var(std::string()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_text_size), type<float>(), "text_size", var(float(14.f)), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_text_break), type<bool>(), "text_break", var(bool(false)), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_text_wrap), type<bool>(), "text_wrap", var(bool(false)), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_border_width), type<mud::vec4>(), "border_width", var(mud::vec4()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_corner_radius), type<mud::vec4>(), "corner_radius", var(mud::vec4()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_weak_corners), type<bool>(), "weak_corners", var(bool(false)), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_padding), type<mud::vec4>(), "padding", var(mud::vec4()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_margin), type<mud::vec4>(), "margin", var(mud::vec4()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_align), type<mud::Dim2<mud::Align>>(), "align", var(mud::Dim2<mud::Align>()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_linear_gradient), type<mud::vec2>(), "linear_gradient", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_linear_gradient_dim), type<mud::Dim>(), "linear_gradient_dim", var(mud::Dim()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_stretch), type<mud::Dim2<bool>>(), "stretch", var(mud::Dim2<bool>()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_image), type<mud::Image>(), "image", Ref(type<mud::Image>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_overlay), type<mud::Image>(), "overlay", Ref(type<mud::Image>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_tile), type<mud::Image>(), "tile", Ref(type<mud::Image>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_image_skin), type<mud::ImageSkin>(), "image_skin", var(mud::ImageSkin()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_shadow), type<mud::Shadow>(), "shadow", var(mud::Shadow()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_shadow_colour), type<mud::Colour>(), "shadow_colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_hover_cursor), type<mud::Style>(), "hover_cursor", Ref(type<mud::Style>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::InkStyle>();
+        lazy_class<mud::InkStyle>([] {
+            static Class cls = { type<mud::InkStyle>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::InkStyle>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::InkStyle>(ref)) mud::InkStyle(  ); }, {} },
+                    { type<mud::InkStyle>(), [](Ref ref, array<Var> args) { new(&val<mud::InkStyle>(ref)) mud::InkStyle( val<cstring>(args[0]) ); }, { { "name", var(cstring()) } } }
+                },
+                // copy constructor
+                {
+                    { type<mud::InkStyle>(), [](Ref ref, Ref other) { new(&val<mud::InkStyle>(ref)) mud::InkStyle(val<mud::InkStyle>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_name); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_name, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_empty), type<bool>(), "empty", var(bool(true)), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_empty); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_empty, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_background_colour), type<mud::Colour>(), "background_colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_background_colour); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_background_colour, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_border_colour), type<mud::Colour>(), "border_colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_border_colour); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_border_colour, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_image_colour), type<mud::Colour>(), "image_colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_image_colour); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_image_colour, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_text_colour), type<mud::Colour>(), "text_colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_text_colour); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_text_colour, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_text_font), type<std::string>(), "text_font", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_text_font); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_text_font, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_text_size), type<float>(), "text_size", var(float(14.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_text_size); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_text_size, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_text_break), type<bool>(), "text_break", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_text_break); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_text_break, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_text_wrap), type<bool>(), "text_wrap", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_text_wrap); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_text_wrap, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_border_width), type<mud::vec4>(), "border_width", var(mud::vec4()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_border_width); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_border_width, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_corner_radius), type<mud::vec4>(), "corner_radius", var(mud::vec4()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_corner_radius); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_corner_radius, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_weak_corners), type<bool>(), "weak_corners", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_weak_corners); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_weak_corners, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_padding), type<mud::vec4>(), "padding", var(mud::vec4()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_padding); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_padding, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_margin), type<mud::vec4>(), "margin", var(mud::vec4()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_margin); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_margin, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_align), type<mud::Dim2<mud::Align>>(), "align", var(mud::Dim2<mud::Align>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_align); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_align, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_linear_gradient), type<mud::vec2>(), "linear_gradient", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_linear_gradient); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_linear_gradient, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_linear_gradient_dim), type<mud::Dim>(), "linear_gradient_dim", var(mud::Dim()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_linear_gradient_dim); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_linear_gradient_dim, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_stretch), type<mud::Dim2<bool>>(), "stretch", var(mud::Dim2<bool>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_stretch); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_stretch, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_image), type<mud::Image>(), "image", Ref(type<mud::Image>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_overlay), type<mud::Image>(), "overlay", Ref(type<mud::Image>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_tile), type<mud::Image>(), "tile", Ref(type<mud::Image>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_image_skin), type<mud::ImageSkin>(), "image_skin", var(mud::ImageSkin()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_image_skin); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_image_skin, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_shadow), type<mud::Shadow>(), "shadow", var(mud::Shadow()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_shadow); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_shadow, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_shadow_colour), type<mud::Colour>(), "shadow_colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::InkStyle>(object).m_shadow_colour); }, [](Ref object, Ref value) { member_assign(val<mud::InkStyle>(object).m_shadow_colour, value); } },
+                    { type<mud::InkStyle>(), member_address(&mud::InkStyle::m_hover_cursor), type<mud::Style>(), "hover_cursor", Ref(type<mud::Style>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::InkStyle>();
+        });
     }
     
     
@@ -701,31 +735,33 @@ namespace mud
     // mud::Layer
     {
         static Meta meta = { type<mud::Layer>(), &namspc({ "mud" }), "Layer", sizeof(mud::Layer), TypeClass::Object };
-        static Class cls = { type<mud::Layer>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Layer>();
+        lazy_class<mud::Layer>([] {
+            static Class cls = { type<mud::Layer>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Layer>();
+        });
     }
     
     
@@ -733,53 +769,55 @@ namespace mud
     // mud::Layout
     {
         static Meta meta = { type<mud::Layout>(), &namspc({ "mud" }), "Layout", sizeof(mud::Layout), TypeClass::Struct };
-        static Class cls = { type<mud::Layout>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::Layout>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Layout>(ref)) mud::Layout(  ); }, {} },
-                { type<mud::Layout>(), [](Ref ref, array<Var> args) { new(&val<mud::Layout>(ref)) mud::Layout( val<cstring>(args[0]) ); }, { { "name", var(cstring()) } } }
-            },
-            // copy constructor
-            {
-                { type<mud::Layout>(), [](Ref ref, Ref other) { new(&val<mud::Layout>(ref)) mud::Layout(val<mud::Layout>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Layout>(), member_address(&mud::Layout::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_solver), type<mud::LayoutSolver>(), "solver", var(mud::LayoutSolver()), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_layout), type<mud::Dim2<mud::AutoLayout>>(), "layout", var(mud::Dim2<mud::AutoLayout>()), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_flow), type<mud::Flow>(), "flow", var(mud::Flow()), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_space), type<mud::Space>(), "space", var(mud::Space()), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_clipping), type<mud::Clipping>(), "clipping", var(mud::Clipping()), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_opacity), type<mud::Opacity>(), "opacity", var(mud::Opacity()), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_align), type<mud::Dim2<mud::Align>>(), "align", var(mud::Dim2<mud::Align>()), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_span), type<mud::vec2>(), "span", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_size), type<mud::vec2>(), "size", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_padding), type<mud::vec4>(), "padding", var(mud::vec4()), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_margin), type<mud::vec2>(), "margin", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_spacing), type<mud::vec2>(), "spacing", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_pivot), type<mud::Dim2<mud::Pivot>>(), "pivot", var(mud::Dim2<mud::Pivot>()), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_zorder), type<int>(), "zorder", var(int(0)), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_no_grid), type<bool>(), "no_grid", var(bool(false)), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_grid_division), type<std::vector<mud::Space>>(), "grid_division", var(std::vector<mud::Space>()), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_table_division), type<std::vector<float>>(), "table_division", var(std::vector<float>()), Member::Value, nullptr },
-                { type<mud::Layout>(), member_address(&mud::Layout::m_updated), type<size_t>(), "updated", var(size_t()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Layout>();
+        lazy_class<mud::Layout>([] {
+            static Class cls = { type<mud::Layout>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::Layout>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Layout>(ref)) mud::Layout(  ); }, {} },
+                    { type<mud::Layout>(), [](Ref ref, array<Var> args) { new(&val<mud::Layout>(ref)) mud::Layout( val<cstring>(args[0]) ); }, { { "name", var(cstring()) } } }
+                },
+                // copy constructor
+                {
+                    { type<mud::Layout>(), [](Ref ref, Ref other) { new(&val<mud::Layout>(ref)) mud::Layout(val<mud::Layout>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_name), type<std::string>(), "name", var(std::string()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_name); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_name, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_solver), type<mud::LayoutSolver>(), "solver", var(mud::LayoutSolver()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_solver); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_solver, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_layout), type<mud::Dim2<mud::AutoLayout>>(), "layout", var(mud::Dim2<mud::AutoLayout>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_layout); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_layout, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_flow), type<mud::Flow>(), "flow", var(mud::Flow()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_flow); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_flow, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_space), type<mud::Space>(), "space", var(mud::Space()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_space); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_space, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_clipping), type<mud::Clipping>(), "clipping", var(mud::Clipping()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_clipping); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_clipping, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_opacity), type<mud::Opacity>(), "opacity", var(mud::Opacity()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_opacity); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_opacity, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_align), type<mud::Dim2<mud::Align>>(), "align", var(mud::Dim2<mud::Align>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_align); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_align, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_span), type<mud::vec2>(), "span", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_span); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_span, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_size), type<mud::vec2>(), "size", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_size); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_size, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_padding), type<mud::vec4>(), "padding", var(mud::vec4()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_padding); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_padding, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_margin), type<mud::vec2>(), "margin", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_margin); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_margin, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_spacing), type<mud::vec2>(), "spacing", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_spacing); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_spacing, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_pivot), type<mud::Dim2<mud::Pivot>>(), "pivot", var(mud::Dim2<mud::Pivot>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_pivot); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_pivot, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_zorder), type<int>(), "zorder", var(int(0)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_zorder); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_zorder, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_no_grid), type<bool>(), "no_grid", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_no_grid); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_no_grid, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_grid_division), type<std::vector<mud::Space>>(), "grid_division", var(std::vector<mud::Space>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_grid_division); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_grid_division, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_table_division), type<std::vector<float>>(), "table_division", var(std::vector<float>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_table_division); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_table_division, value); } },
+                    { type<mud::Layout>(), member_address(&mud::Layout::m_updated), type<size_t>(), "updated", var(size_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Layout>(object).m_updated); }, [](Ref object, Ref value) { member_assign(val<mud::Layout>(object).m_updated, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Layout>();
+        });
     }
     
     
@@ -788,32 +826,34 @@ namespace mud
     // mud::NodeConnection
     {
         static Meta meta = { type<mud::NodeConnection>(), &namspc({ "mud" }), "NodeConnection", sizeof(mud::NodeConnection), TypeClass::Struct };
-        static Class cls = { type<mud::NodeConnection>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::NodeConnection>(), [](Ref ref, Ref other) { new(&val<mud::NodeConnection>(ref)) mud::NodeConnection(val<mud::NodeConnection>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
+        lazy_class<mud::NodeConnection>([] {
+            static Class cls = { type<mud::NodeConnection>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::NodeConnection>(), [](Ref ref, Ref other) { new(&val<mud::NodeConnection>(ref)) mud::NodeConnection(val<mud::NodeConnection>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        
-        meta_class<mud::NodeConnection>();
+            
+            
+            init_class<mud::NodeConnection>();
+        });
     }
     
     
@@ -823,35 +863,37 @@ namespace mud
     // mud::Paint
     {
         static Meta meta = { type<mud::Paint>(), &namspc({ "mud" }), "Paint", sizeof(mud::Paint), TypeClass::Struct };
-        static Class cls = { type<mud::Paint>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Paint>(), [](Ref ref, Ref other) { new(&val<mud::Paint>(ref)) mud::Paint(val<mud::Paint>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Paint>(), member_address(&mud::Paint::m_fill_colour), type<mud::Colour>(), "fill_colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::Paint>(), member_address(&mud::Paint::m_stroke_colour), type<mud::Colour>(), "stroke_colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::Paint>(), member_address(&mud::Paint::m_stroke_width), type<float>(), "stroke_width", var(float()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Paint>();
+        lazy_class<mud::Paint>([] {
+            static Class cls = { type<mud::Paint>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Paint>(), [](Ref ref, Ref other) { new(&val<mud::Paint>(ref)) mud::Paint(val<mud::Paint>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Paint>(), member_address(&mud::Paint::m_fill_colour), type<mud::Colour>(), "fill_colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Paint>(object).m_fill_colour); }, [](Ref object, Ref value) { member_assign(val<mud::Paint>(object).m_fill_colour, value); } },
+                    { type<mud::Paint>(), member_address(&mud::Paint::m_stroke_colour), type<mud::Colour>(), "stroke_colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Paint>(object).m_stroke_colour); }, [](Ref object, Ref value) { member_assign(val<mud::Paint>(object).m_stroke_colour, value); } },
+                    { type<mud::Paint>(), member_address(&mud::Paint::m_stroke_width), type<float>(), "stroke_width", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Paint>(object).m_stroke_width); }, [](Ref object, Ref value) { member_assign(val<mud::Paint>(object).m_stroke_width, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Paint>();
+        });
     }
     
     
@@ -860,39 +902,41 @@ namespace mud
     // mud::Shadow
     {
         static Meta meta = { type<mud::Shadow>(), &namspc({ "mud" }), "Shadow", sizeof(mud::Shadow), TypeClass::Struct };
-        static Class cls = { type<mud::Shadow>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-                { type<mud::Shadow>(), [](Ref ref, array<Var> args) { new(&val<mud::Shadow>(ref)) mud::Shadow( val<float>(args[0]), val<float>(args[1]), val<float>(args[2]), val<float>(args[3]), val<mud::Colour>(args[4]) ); }, { { "xpos", var(float()) }, { "ypos", var(float()) }, { "blur", var(float()) }, { "spread", var(float()) }, { "colour", var(mud::Colour::AlphaBlack), Param::Default } } },
-                { type<mud::Shadow>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Shadow>(ref)) mud::Shadow(  ); }, {} }
-            },
-            // copy constructor
-            {
-                { type<mud::Shadow>(), [](Ref ref, Ref other) { new(&val<mud::Shadow>(ref)) mud::Shadow(val<mud::Shadow>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Shadow>(), member_address(&mud::Shadow::d_xpos), type<float>(), "d_xpos", var(float()), Member::Value, nullptr },
-                { type<mud::Shadow>(), member_address(&mud::Shadow::d_ypos), type<float>(), "d_ypos", var(float()), Member::Value, nullptr },
-                { type<mud::Shadow>(), member_address(&mud::Shadow::d_blur), type<float>(), "d_blur", var(float()), Member::Value, nullptr },
-                { type<mud::Shadow>(), member_address(&mud::Shadow::d_spread), type<float>(), "d_spread", var(float()), Member::Value, nullptr },
-                { type<mud::Shadow>(), member_address(&mud::Shadow::d_colour), type<mud::Colour>(), "d_colour", var(mud::Colour()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Shadow>();
+        lazy_class<mud::Shadow>([] {
+            static Class cls = { type<mud::Shadow>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                    { type<mud::Shadow>(), [](Ref ref, array<Var> args) { new(&val<mud::Shadow>(ref)) mud::Shadow( val<float>(args[0]), val<float>(args[1]), val<float>(args[2]), val<float>(args[3]), val<mud::Colour>(args[4]) ); }, { { "xpos", var(float()) }, { "ypos", var(float()) }, { "blur", var(float()) }, { "spread", var(float()) }, { "colour", var(mud::Colour::AlphaBlack), Param::Default } } },
+                    { type<mud::Shadow>(), [](Ref ref, array<Var> args) { UNUSED(args);new(&val<mud::Shadow>(ref)) mud::Shadow(  ); }, {} }
+                },
+                // copy constructor
+                {
+                    { type<mud::Shadow>(), [](Ref ref, Ref other) { new(&val<mud::Shadow>(ref)) mud::Shadow(val<mud::Shadow>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Shadow>(), member_address(&mud::Shadow::d_xpos), type<float>(), "d_xpos", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Shadow>(object).d_xpos); }, [](Ref object, Ref value) { member_assign(val<mud::Shadow>(object).d_xpos, value); } },
+                    { type<mud::Shadow>(), member_address(&mud::Shadow::d_ypos), type<float>(), "d_ypos", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Shadow>(object).d_ypos); }, [](Ref object, Ref value) { member_assign(val<mud::Shadow>(object).d_ypos, value); } },
+                    { type<mud::Shadow>(), member_address(&mud::Shadow::d_blur), type<float>(), "d_blur", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Shadow>(object).d_blur); }, [](Ref object, Ref value) { member_assign(val<mud::Shadow>(object).d_blur, value); } },
+                    { type<mud::Shadow>(), member_address(&mud::Shadow::d_spread), type<float>(), "d_spread", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Shadow>(object).d_spread); }, [](Ref object, Ref value) { member_assign(val<mud::Shadow>(object).d_spread, value); } },
+                    { type<mud::Shadow>(), member_address(&mud::Shadow::d_colour), type<mud::Colour>(), "d_colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Shadow>(object).d_colour); }, [](Ref object, Ref value) { member_assign(val<mud::Shadow>(object).d_colour, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Shadow>();
+        });
     }
     
     
@@ -902,35 +946,37 @@ namespace mud
     // mud::Space
     {
         static Meta meta = { type<mud::Space>(), &namspc({ "mud" }), "Space", sizeof(mud::Space), TypeClass::Struct };
-        static Class cls = { type<mud::Space>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::Space>(), [](Ref ref, Ref other) { new(&val<mud::Space>(ref)) mud::Space(val<mud::Space>(other)); } }
-            },
-            // members
-            {
-                { type<mud::Space>(), member_address(&mud::Space::direction), type<mud::FlowAxis>(), "direction", var(mud::FlowAxis()), Member::Value, nullptr },
-                { type<mud::Space>(), member_address(&mud::Space::sizingLength), type<mud::Sizing>(), "sizingLength", var(mud::Sizing()), Member::Value, nullptr },
-                { type<mud::Space>(), member_address(&mud::Space::sizingDepth), type<mud::Sizing>(), "sizingDepth", var(mud::Sizing()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Space>();
+        lazy_class<mud::Space>([] {
+            static Class cls = { type<mud::Space>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::Space>(), [](Ref ref, Ref other) { new(&val<mud::Space>(ref)) mud::Space(val<mud::Space>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::Space>(), member_address(&mud::Space::direction), type<mud::FlowAxis>(), "direction", var(mud::FlowAxis()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Space>(object).direction); }, [](Ref object, Ref value) { member_assign(val<mud::Space>(object).direction, value); } },
+                    { type<mud::Space>(), member_address(&mud::Space::sizingLength), type<mud::Sizing>(), "sizingLength", var(mud::Sizing()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Space>(object).sizingLength); }, [](Ref object, Ref value) { member_assign(val<mud::Space>(object).sizingLength, value); } },
+                    { type<mud::Space>(), member_address(&mud::Space::sizingDepth), type<mud::Sizing>(), "sizingDepth", var(mud::Sizing()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Space>(object).sizingDepth); }, [](Ref object, Ref value) { member_assign(val<mud::Space>(object).sizingDepth, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Space>();
+        });
     }
     
     
@@ -938,35 +984,37 @@ namespace mud
     // mud::Style
     {
         static Meta meta = { type<mud::Style>(), &namspc({ "mud" }), "Style", sizeof(mud::Style), TypeClass::Object };
-        static Class cls = { type<mud::Style>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Style>(), member_address(&mud::Style::m_base), type<mud::Style>(), "base", Ref(type<mud::Style>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
-                { type<mud::Style>(), member_address(&mud::Style::name), type<cstring>(), "name", var(cstring()), Member::Value, [](Ref object) { return Ref(val<mud::Style>(object).name()); } },
-                { type<mud::Style>(), member_address(&mud::Style::layout), type<mud::Layout>(), "layout", var(mud::Layout()), Member::Flags(Member::Value|Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Style>(object).layout()); } },
-                { type<mud::Style>(), member_address(&mud::Style::skin), type<mud::InkStyle>(), "skin", var(mud::InkStyle()), Member::Flags(Member::Value|Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Style>(object).skin()); } }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Style>();
+        lazy_class<mud::Style>([] {
+            static Class cls = { type<mud::Style>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Style>(), member_address(&mud::Style::m_base), type<mud::Style>(), "base", Ref(type<mud::Style>()), Member::Flags(Member::Pointer|Member::Link), nullptr },
+                    { type<mud::Style>(), member_address(&mud::Style::name), type<cstring>(), "name", var(cstring()), Member::Value, [](Ref object) { return Ref(val<mud::Style>(object).name()); } },
+                    { type<mud::Style>(), member_address(&mud::Style::layout), type<mud::Layout>(), "layout", var(mud::Layout()), Member::Flags(Member::Value|Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Style>(object).layout()); } },
+                    { type<mud::Style>(), member_address(&mud::Style::skin), type<mud::InkStyle>(), "skin", var(mud::InkStyle()), Member::Flags(Member::Value|Member::NonMutable|Member::Link), [](Ref object) { return Ref(&val<mud::Style>(object).skin()); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Style>();
+        });
     }
     
     
@@ -974,31 +1022,33 @@ namespace mud
     // mud::Styler
     {
         static Meta meta = { type<mud::Styler>(), &namspc({ "mud" }), "Styler", sizeof(mud::Styler), TypeClass::Object };
-        static Class cls = { type<mud::Styler>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
+        lazy_class<mud::Styler>([] {
+            static Class cls = { type<mud::Styler>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        meta_class<mud::Styler>();
+            
+            
+            init_class<mud::Styler>();
+        });
     }
     
     
@@ -1008,31 +1058,33 @@ namespace mud
     // mud::TableSolver
     {
         static Meta meta = { type<mud::TableSolver>(), &namspc({ "mud" }), "TableSolver", sizeof(mud::TableSolver), TypeClass::Object };
-        static Class cls = { type<mud::TableSolver>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::TableSolver>();
+        lazy_class<mud::TableSolver>([] {
+            static Class cls = { type<mud::TableSolver>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::TableSolver>();
+        });
     }
     
     
@@ -1041,31 +1093,33 @@ namespace mud
     // mud::Text
     {
         static Meta meta = { type<mud::Text>(), &namspc({ "mud" }), "Text", sizeof(mud::Text), TypeClass::Object };
-        static Class cls = { type<mud::Text>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Text>();
+        lazy_class<mud::Text>([] {
+            static Class cls = { type<mud::Text>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Text>();
+        });
     }
     
     
@@ -1073,32 +1127,34 @@ namespace mud
     // mud::TextCursor
     {
         static Meta meta = { type<mud::TextCursor>(), &namspc({ "mud" }), "TextCursor", sizeof(mud::TextCursor), TypeClass::Struct };
-        static Class cls = { type<mud::TextCursor>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::TextCursor>(), [](Ref ref, Ref other) { new(&val<mud::TextCursor>(ref)) mud::TextCursor(val<mud::TextCursor>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::TextCursor>();
+        lazy_class<mud::TextCursor>([] {
+            static Class cls = { type<mud::TextCursor>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::TextCursor>(), [](Ref ref, Ref other) { new(&val<mud::TextCursor>(ref)) mud::TextCursor(val<mud::TextCursor>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::TextCursor>();
+        });
     }
     
     
@@ -1107,38 +1163,40 @@ namespace mud
     // mud::TextPaint
     {
         static Meta meta = { type<mud::TextPaint>(), &namspc({ "mud" }), "TextPaint", sizeof(mud::TextPaint), TypeClass::Struct };
-        static Class cls = { type<mud::TextPaint>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::TextPaint>(), [](Ref ref, Ref other) { new(&val<mud::TextPaint>(ref)) mud::TextPaint(val<mud::TextPaint>(other)); } }
-            },
-            // members
-            {
-                { type<mud::TextPaint>(), member_address(&mud::TextPaint::m_font), type<cstring>(), "font", var(cstring()), Member::Value, nullptr },
-                { type<mud::TextPaint>(), member_address(&mud::TextPaint::m_colour), type<mud::Colour>(), "colour", var(mud::Colour()), Member::Value, nullptr },
-                { type<mud::TextPaint>(), member_address(&mud::TextPaint::m_size), type<float>(), "size", var(float()), Member::Value, nullptr },
-                { type<mud::TextPaint>(), member_address(&mud::TextPaint::m_align), type<mud::Dim2<mud::Align>>(), "align", var(mud::Dim2<mud::Align>()), Member::Value, nullptr },
-                { type<mud::TextPaint>(), member_address(&mud::TextPaint::m_text_break), type<bool>(), "text_break", var(bool()), Member::Value, nullptr },
-                { type<mud::TextPaint>(), member_address(&mud::TextPaint::m_text_wrap), type<bool>(), "text_wrap", var(bool()), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::TextPaint>();
+        lazy_class<mud::TextPaint>([] {
+            static Class cls = { type<mud::TextPaint>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::TextPaint>(), [](Ref ref, Ref other) { new(&val<mud::TextPaint>(ref)) mud::TextPaint(val<mud::TextPaint>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::TextPaint>(), member_address(&mud::TextPaint::m_font), type<cstring>(), "font", var(cstring()), Member::Value, nullptr, [](Ref object) { return var(val<mud::TextPaint>(object).m_font); }, [](Ref object, Ref value) { member_assign(val<mud::TextPaint>(object).m_font, value); } },
+                    { type<mud::TextPaint>(), member_address(&mud::TextPaint::m_colour), type<mud::Colour>(), "colour", var(mud::Colour()), Member::Value, nullptr, [](Ref object) { return var(val<mud::TextPaint>(object).m_colour); }, [](Ref object, Ref value) { member_assign(val<mud::TextPaint>(object).m_colour, value); } },
+                    { type<mud::TextPaint>(), member_address(&mud::TextPaint::m_size), type<float>(), "size", var(float()), Member::Value, nullptr, [](Ref object) { return var(val<mud::TextPaint>(object).m_size); }, [](Ref object, Ref value) { member_assign(val<mud::TextPaint>(object).m_size, value); } },
+                    { type<mud::TextPaint>(), member_address(&mud::TextPaint::m_align), type<mud::Dim2<mud::Align>>(), "align", var(mud::Dim2<mud::Align>()), Member::Value, nullptr, [](Ref object) { return var(val<mud::TextPaint>(object).m_align); }, [](Ref object, Ref value) { member_assign(val<mud::TextPaint>(object).m_align, value); } },
+                    { type<mud::TextPaint>(), member_address(&mud::TextPaint::m_text_break), type<bool>(), "text_break", var(bool()), Member::Value, nullptr, [](Ref object) { return var(val<mud::TextPaint>(object).m_text_break); }, [](Ref object, Ref value) { member_assign(val<mud::TextPaint>(object).m_text_break, value); } },
+                    { type<mud::TextPaint>(), member_address(&mud::TextPaint::m_text_wrap), type<bool>(), "text_wrap", var(bool()), Member::Value, nullptr, [](Ref object) { return var(val<mud::TextPaint>(object).m_text_wrap); }, [](Ref object, Ref value) { member_assign(val<mud::TextPaint>(object).m_text_wrap, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::TextPaint>();
+        });
     }
     
     
@@ -1147,32 +1205,34 @@ namespace mud
     // mud::TextSelection
     {
         static Meta meta = { type<mud::TextSelection>(), &namspc({ "mud" }), "TextSelection", sizeof(mud::TextSelection), TypeClass::Struct };
-        static Class cls = { type<mud::TextSelection>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::TextSelection>(), [](Ref ref, Ref other) { new(&val<mud::TextSelection>(ref)) mud::TextSelection(val<mud::TextSelection>(other)); } }
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
+        lazy_class<mud::TextSelection>([] {
+            static Class cls = { type<mud::TextSelection>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::TextSelection>(), [](Ref ref, Ref other) { new(&val<mud::TextSelection>(ref)) mud::TextSelection(val<mud::TextSelection>(other)); } }
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        meta_class<mud::TextSelection>();
+            
+            
+            init_class<mud::TextSelection>();
+        });
     }
     
     
@@ -1232,37 +1292,39 @@ namespace mud
     // mud::UiRect
     {
         static Meta meta = { type<mud::UiRect>(), &namspc({ "mud" }), "UiRect", sizeof(mud::UiRect), TypeClass::Struct };
-        static Class cls = { type<mud::UiRect>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-                { type<mud::UiRect>(), [](Ref ref, Ref other) { new(&val<mud::UiRect>(ref)) mud::UiRect(val<mud::UiRect>(other)); } }
-            },
-            // members
-            {
-                { type<mud::UiRect>(), member_address(&mud::UiRect::m_position), type<mud::vec2>(), "position", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::UiRect>(), member_address(&mud::UiRect::m_size), type<mud::vec2>(), "size", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::UiRect>(), member_address(&mud::UiRect::m_content), type<mud::vec2>(), "content", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::UiRect>(), member_address(&mud::UiRect::m_span), type<mud::vec2>(), "span", var(mud::vec2()), Member::Value, nullptr },
-                { type<mud::UiRect>(), member_address(&mud::UiRect::m_scale), type<float>(), "scale", var(float(1.f)), Member::Value, nullptr }
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::UiRect>();
+        lazy_class<mud::UiRect>([] {
+            static Class cls = { type<mud::UiRect>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                    { type<mud::UiRect>(), [](Ref ref, Ref other) { new(&val<mud::UiRect>(ref)) mud::UiRect(val<mud::UiRect>(other)); } }
+                },
+                // members
+                {
+                    { type<mud::UiRect>(), member_address(&mud::UiRect::m_position), type<mud::vec2>(), "position", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::UiRect>(object).m_position); }, [](Ref object, Ref value) { member_assign(val<mud::UiRect>(object).m_position, value); } },
+                    { type<mud::UiRect>(), member_address(&mud::UiRect::m_size), type<mud::vec2>(), "size", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::UiRect>(object).m_size); }, [](Ref object, Ref value) { member_assign(val<mud::UiRect>(object).m_size, value); } },
+                    { type<mud::UiRect>(), member_address(&mud::UiRect::m_content), type<mud::vec2>(), "content", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::UiRect>(object).m_content); }, [](Ref object, Ref value) { member_assign(val<mud::UiRect>(object).m_content, value); } },
+                    { type<mud::UiRect>(), member_address(&mud::UiRect::m_span), type<mud::vec2>(), "span", var(mud::vec2()), Member::Value, nullptr, [](Ref object) { return var(val<mud::UiRect>(object).m_span); }, [](Ref object, Ref value) { member_assign(val<mud::UiRect>(object).m_span, value); } },
+                    { type<mud::UiRect>(), member_address(&mud::UiRect::m_scale), type<float>(), "scale", var(float(1.f)), Member::Value, nullptr, [](Ref object) { return var(val<mud::UiRect>(object).m_scale); }, [](Ref object, Ref value) { member_assign(val<mud::UiRect>(object).m_scale, value); } }
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::UiRect>();
+        });
     }
     
     
@@ -1271,31 +1333,33 @@ namespace mud
     // mud::UiWindow
     {
         static Meta meta = { type<mud::UiWindow>(), &namspc({ "mud" }), "UiWindow", sizeof(mud::UiWindow), TypeClass::Object };
-        static Class cls = { type<mud::UiWindow>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::UiWindow>();
+        lazy_class<mud::UiWindow>([] {
+            static Class cls = { type<mud::UiWindow>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::UiWindow>();
+        });
     }
     
     
@@ -1303,31 +1367,33 @@ namespace mud
     // mud::User
     {
         static Meta meta = { type<mud::User>(), &namspc({ "mud" }), "User", sizeof(mud::User), TypeClass::Object };
-        static Class cls = { type<mud::User>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
+        lazy_class<mud::User>([] {
+            static Class cls = { type<mud::User>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        
-        meta_class<mud::User>();
+            
+            
+            init_class<mud::User>();
+        });
     }
     
     
@@ -1337,31 +1403,33 @@ namespace mud
     // mud::Frame
     {
         static Meta meta = { type<mud::Frame>(), &namspc({ "mud" }), "Frame", sizeof(mud::Frame), TypeClass::Object };
-        static Class cls = { type<mud::Frame>(),
-            // bases
-            { &type<mud::UiRect>() },
-            { base_offset<mud::Frame, mud::UiRect>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Frame>();
+        lazy_class<mud::Frame>([] {
+            static Class cls = { type<mud::Frame>(),
+                // bases
+                { &type<mud::UiRect>() },
+                { base_offset<mud::Frame, mud::UiRect>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Frame>();
+        });
     }
     
     
@@ -1369,31 +1437,33 @@ namespace mud
     // mud::FrameSolver
     {
         static Meta meta = { type<mud::FrameSolver>(), &namspc({ "mud" }), "FrameSolver", sizeof(mud::FrameSolver), TypeClass::Object };
-        static Class cls = { type<mud::FrameSolver>(),
-            // bases
-            { &type<mud::UiRect>() },
-            { base_offset<mud::FrameSolver, mud::UiRect>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::FrameSolver>();
+        lazy_class<mud::FrameSolver>([] {
+            static Class cls = { type<mud::FrameSolver>(),
+                // bases
+                { &type<mud::UiRect>() },
+                { base_offset<mud::FrameSolver, mud::UiRect>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::FrameSolver>();
+        });
     }
     
     
@@ -1401,31 +1471,33 @@ namespace mud
     // mud::Canvas
     {
         static Meta meta = { type<mud::Canvas>(), &namspc({ "mud" }), "Canvas", sizeof(mud::Canvas), TypeClass::Object };
-        static Class cls = { type<mud::Canvas>(),
-            // bases
-            { &type<mud::Widget>() },
-            { base_offset<mud::Canvas, mud::Widget>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Canvas>();
+        lazy_class<mud::Canvas>([] {
+            static Class cls = { type<mud::Canvas>(),
+                // bases
+                { &type<mud::Widget>() },
+                { base_offset<mud::Canvas, mud::Widget>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Canvas>();
+        });
     }
     
     
@@ -1433,31 +1505,33 @@ namespace mud
     // mud::Dockable
     {
         static Meta meta = { type<mud::Dockable>(), &namspc({ "mud" }), "Dockable", sizeof(mud::Dockable), TypeClass::Object };
-        static Class cls = { type<mud::Dockable>(),
-            // bases
-            { &type<mud::Widget>() },
-            { base_offset<mud::Dockable, mud::Widget>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Dockable>();
+        lazy_class<mud::Dockable>([] {
+            static Class cls = { type<mud::Dockable>(),
+                // bases
+                { &type<mud::Widget>() },
+                { base_offset<mud::Dockable, mud::Widget>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Dockable>();
+        });
     }
     
     
@@ -1465,31 +1539,33 @@ namespace mud
     // mud::Docker
     {
         static Meta meta = { type<mud::Docker>(), &namspc({ "mud" }), "Docker", sizeof(mud::Docker), TypeClass::Object };
-        static Class cls = { type<mud::Docker>(),
-            // bases
-            { &type<mud::Widget>() },
-            { base_offset<mud::Docker, mud::Widget>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Docker>();
+        lazy_class<mud::Docker>([] {
+            static Class cls = { type<mud::Docker>(),
+                // bases
+                { &type<mud::Widget>() },
+                { base_offset<mud::Docker, mud::Widget>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Docker>();
+        });
     }
     
     
@@ -1497,31 +1573,33 @@ namespace mud
     // mud::Expandbox
     {
         static Meta meta = { type<mud::Expandbox>(), &namspc({ "mud" }), "Expandbox", sizeof(mud::Expandbox), TypeClass::Object };
-        static Class cls = { type<mud::Expandbox>(),
-            // bases
-            { &type<mud::Widget>() },
-            { base_offset<mud::Expandbox, mud::Widget>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Expandbox>();
+        lazy_class<mud::Expandbox>([] {
+            static Class cls = { type<mud::Expandbox>(),
+                // bases
+                { &type<mud::Widget>() },
+                { base_offset<mud::Expandbox, mud::Widget>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Expandbox>();
+        });
     }
     
     
@@ -1529,31 +1607,33 @@ namespace mud
     // mud::Node
     {
         static Meta meta = { type<mud::Node>(), &namspc({ "mud" }), "Node", sizeof(mud::Node), TypeClass::Object };
-        static Class cls = { type<mud::Node>(),
-            // bases
-            { &type<mud::Widget>() },
-            { base_offset<mud::Node, mud::Widget>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Node>();
+        lazy_class<mud::Node>([] {
+            static Class cls = { type<mud::Node>(),
+                // bases
+                { &type<mud::Widget>() },
+                { base_offset<mud::Node, mud::Widget>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Node>();
+        });
     }
     
     
@@ -1561,31 +1641,33 @@ namespace mud
     // mud::NodePlug
     {
         static Meta meta = { type<mud::NodePlug>(), &namspc({ "mud" }), "NodePlug", sizeof(mud::NodePlug), TypeClass::Object };
-        static Class cls = { type<mud::NodePlug>(),
-            // bases
-            { &type<mud::Widget>() },
-            { base_offset<mud::NodePlug, mud::Widget>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::NodePlug>();
+        lazy_class<mud::NodePlug>([] {
+            static Class cls = { type<mud::NodePlug>(),
+                // bases
+                { &type<mud::Widget>() },
+                { base_offset<mud::NodePlug, mud::Widget>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::NodePlug>();
+        });
     }
     
     
@@ -1593,31 +1675,33 @@ namespace mud
     // mud::ScrollSheet
     {
         static Meta meta = { type<mud::ScrollSheet>(), &namspc({ "mud" }), "ScrollSheet", sizeof(mud::ScrollSheet), TypeClass::Object };
-        static Class cls = { type<mud::ScrollSheet>(),
-            // bases
-            { &type<mud::Widget>() },
-            { base_offset<mud::ScrollSheet, mud::Widget>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::ScrollSheet>();
+        lazy_class<mud::ScrollSheet>([] {
+            static Class cls = { type<mud::ScrollSheet>(),
+                // bases
+                { &type<mud::Widget>() },
+                { base_offset<mud::ScrollSheet, mud::Widget>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::ScrollSheet>();
+        });
     }
     
     
@@ -1625,31 +1709,33 @@ namespace mud
     // mud::ui::Sequence
     {
         static Meta meta = { type<mud::ui::Sequence>(), &namspc({ "mud", "ui" }), "Sequence", sizeof(mud::ui::Sequence), TypeClass::Object };
-        static Class cls = { type<mud::ui::Sequence>(),
-            // bases
-            { &type<mud::Widget>() },
-            { base_offset<mud::ui::Sequence, mud::Widget>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::ui::Sequence>();
+        lazy_class<mud::ui::Sequence>([] {
+            static Class cls = { type<mud::ui::Sequence>(),
+                // bases
+                { &type<mud::Widget>() },
+                { base_offset<mud::ui::Sequence, mud::Widget>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::ui::Sequence>();
+        });
     }
     
     
@@ -1657,31 +1743,33 @@ namespace mud
     // mud::Tabber
     {
         static Meta meta = { type<mud::Tabber>(), &namspc({ "mud" }), "Tabber", sizeof(mud::Tabber), TypeClass::Object };
-        static Class cls = { type<mud::Tabber>(),
-            // bases
-            { &type<mud::Widget>() },
-            { base_offset<mud::Tabber, mud::Widget>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Tabber>();
+        lazy_class<mud::Tabber>([] {
+            static Class cls = { type<mud::Tabber>(),
+                // bases
+                { &type<mud::Widget>() },
+                { base_offset<mud::Tabber, mud::Widget>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Tabber>();
+        });
     }
     
     
@@ -1689,31 +1777,33 @@ namespace mud
     // mud::Table
     {
         static Meta meta = { type<mud::Table>(), &namspc({ "mud" }), "Table", sizeof(mud::Table), TypeClass::Object };
-        static Class cls = { type<mud::Table>(),
-            // bases
-            { &type<mud::Widget>() },
-            { base_offset<mud::Table, mud::Widget>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Table>();
+        lazy_class<mud::Table>([] {
+            static Class cls = { type<mud::Table>(),
+                // bases
+                { &type<mud::Widget>() },
+                { base_offset<mud::Table, mud::Widget>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Table>();
+        });
     }
     
     
@@ -1721,31 +1811,33 @@ namespace mud
     // mud::TextEdit
     {
         static Meta meta = { type<mud::TextEdit>(), &namspc({ "mud" }), "TextEdit", sizeof(mud::TextEdit), TypeClass::Object };
-        static Class cls = { type<mud::TextEdit>(),
-            // bases
-            { &type<mud::Widget>() },
-            { base_offset<mud::TextEdit, mud::Widget>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::TextEdit>();
+        lazy_class<mud::TextEdit>([] {
+            static Class cls = { type<mud::TextEdit>(),
+                // bases
+                { &type<mud::Widget>() },
+                { base_offset<mud::TextEdit, mud::Widget>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::TextEdit>();
+        });
     }
     
     
@@ -1753,31 +1845,33 @@ namespace mud
     // mud::TreeNode
     {
         static Meta meta = { type<mud::TreeNode>(), &namspc({ "mud" }), "TreeNode", sizeof(mud::TreeNode), TypeClass::Object };
-        static Class cls = { type<mud::TreeNode>(),
-            // bases
-            { &type<mud::Widget>() },
-            { base_offset<mud::TreeNode, mud::Widget>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::TreeNode>();
+        lazy_class<mud::TreeNode>([] {
+            static Class cls = { type<mud::TreeNode>(),
+                // bases
+                { &type<mud::Widget>() },
+                { base_offset<mud::TreeNode, mud::Widget>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::TreeNode>();
+        });
     }
     
     
@@ -1785,32 +1879,34 @@ namespace mud
     // mud::Ui
     {
         static Meta meta = { type<mud::Ui>(), &namspc({ "mud" }), "Ui", sizeof(mud::Ui), TypeClass::Object };
-        static Class cls = { type<mud::Ui>(),
-            // bases
-            { &type<mud::Widget>() },
-            { base_offset<mud::Ui, mud::Widget>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-                { type<mud::Ui>(), "begin", member_address(&mud::Ui::begin), [](Ref object, array<Var> args, Var& result) { UNUSED(args);result = Ref(&val<mud::Ui>(object).begin()); }, {}, Ref(type<mud::Widget>()) }
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Ui>();
+        lazy_class<mud::Ui>([] {
+            static Class cls = { type<mud::Ui>(),
+                // bases
+                { &type<mud::Widget>() },
+                { base_offset<mud::Ui, mud::Widget>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                    { type<mud::Ui>(), "begin", member_address(&mud::Ui::begin), [](Ref object, array<Var> args, Var& result) { UNUSED(args);result = Ref(&val<mud::Ui>(object).begin()); }, {}, Ref(type<mud::Widget>()) }
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Ui>();
+        });
     }
     
     
@@ -1818,31 +1914,33 @@ namespace mud
     // mud::RowSolver
     {
         static Meta meta = { type<mud::RowSolver>(), &namspc({ "mud" }), "RowSolver", sizeof(mud::RowSolver), TypeClass::Object };
-        static Class cls = { type<mud::RowSolver>(),
-            // bases
-            { &type<mud::FrameSolver>() },
-            { base_offset<mud::RowSolver, mud::FrameSolver>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::RowSolver>();
+        lazy_class<mud::RowSolver>([] {
+            static Class cls = { type<mud::RowSolver>(),
+                // bases
+                { &type<mud::FrameSolver>() },
+                { base_offset<mud::RowSolver, mud::FrameSolver>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::RowSolver>();
+        });
     }
     
     
@@ -1851,31 +1949,33 @@ namespace mud
     // mud::LineSolver
     {
         static Meta meta = { type<mud::LineSolver>(), &namspc({ "mud" }), "LineSolver", sizeof(mud::LineSolver), TypeClass::Object };
-        static Class cls = { type<mud::LineSolver>(),
-            // bases
-            { &type<mud::RowSolver>() },
-            { base_offset<mud::LineSolver, mud::RowSolver>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::LineSolver>();
+        lazy_class<mud::LineSolver>([] {
+            static Class cls = { type<mud::LineSolver>(),
+                // bases
+                { &type<mud::RowSolver>() },
+                { base_offset<mud::LineSolver, mud::RowSolver>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::LineSolver>();
+        });
     }
     
     
@@ -1883,31 +1983,33 @@ namespace mud
     // mud::Window
     {
         static Meta meta = { type<mud::Window>(), &namspc({ "mud" }), "Window", sizeof(mud::Window), TypeClass::Object };
-        static Class cls = { type<mud::Window>(),
-            // bases
-            { &type<mud::Dockable>() },
-            { base_offset<mud::Window, mud::Dockable>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Window>();
+        lazy_class<mud::Window>([] {
+            static Class cls = { type<mud::Window>(),
+                // bases
+                { &type<mud::Dockable>() },
+                { base_offset<mud::Window, mud::Dockable>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Window>();
+        });
     }
     
     
@@ -1915,31 +2017,33 @@ namespace mud
     // mud::Dockbar
     {
         static Meta meta = { type<mud::Dockbar>(), &namspc({ "mud" }), "Dockbar", sizeof(mud::Dockbar), TypeClass::Object };
-        static Class cls = { type<mud::Dockbar>(),
-            // bases
-            { &type<mud::Docker>() },
-            { base_offset<mud::Dockbar, mud::Docker>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Dockbar>();
+        lazy_class<mud::Dockbar>([] {
+            static Class cls = { type<mud::Dockbar>(),
+                // bases
+                { &type<mud::Docker>() },
+                { base_offset<mud::Dockbar, mud::Docker>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Dockbar>();
+        });
     }
     
     
@@ -1947,31 +2051,33 @@ namespace mud
     // mud::Dockspace
     {
         static Meta meta = { type<mud::Dockspace>(), &namspc({ "mud" }), "Dockspace", sizeof(mud::Dockspace), TypeClass::Object };
-        static Class cls = { type<mud::Dockspace>(),
-            // bases
-            { &type<mud::Docker>() },
-            { base_offset<mud::Dockspace, mud::Docker>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Dockspace>();
+        lazy_class<mud::Dockspace>([] {
+            static Class cls = { type<mud::Dockspace>(),
+                // bases
+                { &type<mud::Docker>() },
+                { base_offset<mud::Dockspace, mud::Docker>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Dockspace>();
+        });
     }
     
     
@@ -1979,59 +2085,61 @@ namespace mud
     // mud::Widget
     {
         static Meta meta = { type<mud::Widget>(), &namspc({ "mud" }), "Widget", sizeof(mud::Widget), TypeClass::Object };
-        static Class cls = { type<mud::Widget>(),
-            // bases
-            { &type<mud::ControlNode>() },
-            { base_offset<mud::Widget, mud::ControlNode>() },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-                { type<mud::Widget>(), member_address(&mud::Widget::m_frame), type<mud::Frame>(), "frame", Ref(type<mud::Frame>()), Member::None, nullptr },
-                { type<mud::Widget>(), member_address(&mud::Widget::m_state), type<mud::WidgetState>(), "state", var(mud::WidgetState()), Member::Value, nullptr },
-                { type<mud::Widget>(), member_address(&mud::Widget::m_switch), type<uint32_t>(), "switch", var(uint32_t()), Member::Value, nullptr },
-                { type<mud::Widget>(), member_address(&mud::Widget::m_index), type<size_t>(), "index", var(size_t()), Member::Value, nullptr },
-                { type<mud::Widget>(), member_address(&mud::Widget::m_open), type<bool>(), "open", var(bool(false)), Member::Value, nullptr },
-                { type<mud::Widget>(), member_address(&mud::Widget::m_body), type<mud::Widget>(), "body", Ref(type<mud::Widget>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
-            },
-            // methods
-            {
-				{ type<mud::Widget>(), "focused", member_address(&mud::Widget::focused), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<bool>(result) = val<mud::Widget>(object).focused(); },{}, var(bool()) },
-				{ type<mud::Widget>(), "hovered", member_address(&mud::Widget::hovered), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<bool>(result) = val<mud::Widget>(object).hovered(); },{}, var(bool()) },
-				{ type<mud::Widget>(), "pressed", member_address(&mud::Widget::pressed), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<bool>(result) = val<mud::Widget>(object).pressed(); },{}, var(bool()) },
-				{ type<mud::Widget>(), "activated", member_address(&mud::Widget::activated), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<bool>(result) = val<mud::Widget>(object).activated(); },{}, var(bool()) },
-				{ type<mud::Widget>(), "selected", member_address(&mud::Widget::selected), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<bool>(result) = val<mud::Widget>(object).selected(); },{}, var(bool()) },
-				{ type<mud::Widget>(), "modal", member_address(&mud::Widget::modal), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<bool>(result) = val<mud::Widget>(object).modal(); },{}, var(bool()) },
-				{ type<mud::Widget>(), "closed", member_address(&mud::Widget::closed), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<bool>(result) = val<mud::Widget>(object).closed(); },{}, var(bool()) },
-                { type<mud::Widget>(), "ui_window", member_address(&mud::Widget::ui_window), [](Ref object, array<Var> args, Var& result) { UNUSED(args);result = Ref(&val<mud::Widget>(object).ui_window()); }, {}, Ref(type<mud::UiWindow>()) },
-                { type<mud::Widget>(), "ui", member_address(&mud::Widget::ui), [](Ref object, array<Var> args, Var& result) { UNUSED(args);result = Ref(&val<mud::Widget>(object).ui()); }, {}, Ref(type<mud::Ui>()) },
-                { type<mud::Widget>(), "parent_modal", member_address(&mud::Widget::parent_modal), [](Ref object, array<Var> args, Var& result) { UNUSED(args);result = Ref(&val<mud::Widget>(object).parent_modal()); }, {}, Ref(type<mud::Widget>()) },
-                { type<mud::Widget>(), "toggle_state", member_address(&mud::Widget::toggle_state), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Widget>(object).toggle_state(val<mud::WidgetState>(args[0])); }, { { "state", var(mud::WidgetState()) } }, Var() },
-                { type<mud::Widget>(), "disable_state", member_address(&mud::Widget::disable_state), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Widget>(object).disable_state(val<mud::WidgetState>(args[0])); }, { { "state", var(mud::WidgetState()) } }, Var() },
-                { type<mud::Widget>(), "set_state", member_address(&mud::Widget::set_state), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Widget>(object).set_state(val<mud::WidgetState>(args[0]), val<bool>(args[1])); }, { { "state", var(mud::WidgetState()) }, { "enabled", var(bool()) } }, Var() },
-                { type<mud::Widget>(), "enable_state", member_address(&mud::Widget::enable_state), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Widget>(object).enable_state(val<mud::WidgetState>(args[0])); }, { { "state", var(mud::WidgetState()) } }, Var() },
-                { type<mud::Widget>(), "clear_focus", member_address(&mud::Widget::clear_focus), [](Ref object, array<Var> args, Var& result) { UNUSED(result); UNUSED(args);val<mud::Widget>(object).clear_focus(); }, {}, Var() },
-                { type<mud::Widget>(), "take_focus", member_address(&mud::Widget::take_focus), [](Ref object, array<Var> args, Var& result) { UNUSED(result); UNUSED(args);val<mud::Widget>(object).take_focus(); }, {}, Var() },
-                { type<mud::Widget>(), "yield_focus", member_address(&mud::Widget::yield_focus), [](Ref object, array<Var> args, Var& result) { UNUSED(result); UNUSED(args);val<mud::Widget>(object).yield_focus(); }, {}, Var() },
-                { type<mud::Widget>(), "take_modal", member_address(&mud::Widget::take_modal), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Widget>(object).take_modal(val<uint32_t>(args[0])); }, { { "device_filter", var(uint32_t()) } }, Var() },
-                { type<mud::Widget>(), "yield_modal", member_address(&mud::Widget::yield_modal), [](Ref object, array<Var> args, Var& result) { UNUSED(result); UNUSED(args);val<mud::Widget>(object).yield_modal(); }, {}, Var() },
-                { type<mud::Widget>(), "key_event", member_address(&mud::Widget::key_event), [](Ref object, array<Var> args, Var& result) { val<mud::KeyEvent>(result) = val<mud::Widget>(object).key_event(val<mud::Key>(args[0]), val<mud::EventType>(args[1]), val<mud::InputMod>(args[2])); }, { { "code", var(mud::Key()) }, { "event_type", var(mud::EventType()) }, { "modifier", var(mud::InputMod()), Param::Default } }, var(mud::KeyEvent()) },
-                { type<mud::Widget>(), "key_stroke", member_address(&mud::Widget::key_stroke), [](Ref object, array<Var> args, Var& result) { val<mud::KeyEvent>(result) = val<mud::Widget>(object).key_stroke(val<mud::Key>(args[0]), val<mud::InputMod>(args[1])); }, { { "code", var(mud::Key()) }, { "modifier", var(mud::InputMod()), Param::Default } }, var(mud::KeyEvent()) },
-                { type<mud::Widget>(), "mouse_event", member_address(&mud::Widget::mouse_event), [](Ref object, array<Var> args, Var& result) { val<mud::MouseEvent>(result) = val<mud::Widget>(object).mouse_event(val<mud::DeviceType>(args[0]), val<mud::EventType>(args[1]), val<mud::InputMod>(args[2]), val<bool>(args[3])); }, { { "device", var(mud::DeviceType()) }, { "event_type", var(mud::EventType()) }, { "modifier", var(mud::InputMod()), Param::Default }, { "consume", var(bool(true)), Param::Default } }, var(mud::MouseEvent()) }
-            },
-            // static members
-            {
-            }
-        };
-        
-        
-        
-        
-        meta_class<mud::Widget>();
+        lazy_class<mud::Widget>([] {
+            static Class cls = { type<mud::Widget>(),
+                // bases
+                { &type<mud::ControlNode>() },
+                { base_offset<mud::Widget, mud::ControlNode>() },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                    { type<mud::Widget>(), member_address(&mud::Widget::m_frame), type<mud::Frame>(), "frame", Ref(type<mud::Frame>()), Member::None, nullptr },
+                    { type<mud::Widget>(), member_address(&mud::Widget::m_state), type<mud::WidgetState>(), "state", var(mud::WidgetState()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Widget>(object).m_state); }, [](Ref object, Ref value) { member_assign(val<mud::Widget>(object).m_state, value); } },
+                    { type<mud::Widget>(), member_address(&mud::Widget::m_switch), type<uint32_t>(), "switch", var(uint32_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Widget>(object).m_switch); }, [](Ref object, Ref value) { member_assign(val<mud::Widget>(object).m_switch, value); } },
+                    { type<mud::Widget>(), member_address(&mud::Widget::m_index), type<size_t>(), "index", var(size_t()), Member::Value, nullptr, [](Ref object) { return var(val<mud::Widget>(object).m_index); }, [](Ref object, Ref value) { member_assign(val<mud::Widget>(object).m_index, value); } },
+                    { type<mud::Widget>(), member_address(&mud::Widget::m_open), type<bool>(), "open", var(bool(false)), Member::Value, nullptr, [](Ref object) { return var(val<mud::Widget>(object).m_open); }, [](Ref object, Ref value) { member_assign(val<mud::Widget>(object).m_open, value); } },
+                    { type<mud::Widget>(), member_address(&mud::Widget::m_body), type<mud::Widget>(), "body", Ref(type<mud::Widget>()), Member::Flags(Member::Pointer|Member::Link), nullptr }
+                },
+                // methods
+                {
+    				{ type<mud::Widget>(), "focused", member_address(&mud::Widget::focused), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<bool>(result) = val<mud::Widget>(object).focused(); },{}, var(bool()) },
+    				{ type<mud::Widget>(), "hovered", member_address(&mud::Widget::hovered), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<bool>(result) = val<mud::Widget>(object).hovered(); },{}, var(bool()) },
+    				{ type<mud::Widget>(), "pressed", member_address(&mud::Widget::pressed), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<bool>(result) = val<mud::Widget>(object).pressed(); },{}, var(bool()) },
+    				{ type<mud::Widget>(), "activated", member_address(&mud::Widget::activated), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<bool>(result) = val<mud::Widget>(object).activated(); },{}, var(bool()) },
+    				{ type<mud::Widget>(), "selected", member_address(&mud::Widget::selected), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<bool>(result) = val<mud::Widget>(object).selected(); },{}, var(bool()) },
+    				{ type<mud::Widget>(), "modal", member_address(&mud::Widget::modal), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<bool>(result) = val<mud::Widget>(object).modal(); },{}, var(bool()) },
+    				{ type<mud::Widget>(), "closed", member_address(&mud::Widget::closed), [](Ref object, array<Var> args, Var& result) { UNUSED(args); val<bool>(result) = val<mud::Widget>(object).closed(); },{}, var(bool()) },
+                    { type<mud::Widget>(), "ui_window", member_address(&mud::Widget::ui_window), [](Ref object, array<Var> args, Var& result) { UNUSED(args);result = Ref(&val<mud::Widget>(object).ui_window()); }, {}, Ref(type<mud::UiWindow>()) },
+                    { type<mud::Widget>(), "ui", member_address(&mud::Widget::ui), [](Ref object, array<Var> args, Var& result) { UNUSED(args);result = Ref(&val<mud::Widget>(object).ui()); }, {}, Ref(type<mud::Ui>()) },
+                    { type<mud::Widget>(), "parent_modal", member_address(&mud::Widget::parent_modal), [](Ref object, array<Var> args, Var& result) { UNUSED(args);result = Ref(&val<mud::Widget>(object).parent_modal()); }, {}, Ref(type<mud::Widget>()) },
+                    { type<mud::Widget>(), "toggle_state", member_address(&mud::Widget::toggle_state), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Widget>(object).toggle_state(val<mud::WidgetState>(args[0])); }, { { "state", var(mud::WidgetState()) } }, Var() },
+                    { type<mud::Widget>(), "disable_state", member_address(&mud::Widget::disable_state), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Widget>(object).disable_state(val<mud::WidgetState>(args[0])); }, { { "state", var(mud::WidgetState()) } }, Var() },
+                    { type<mud::Widget>(), "set_state", member_address(&mud::Widget::set_state), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Widget>(object).set_state(val<mud::WidgetState>(args[0]), val<bool>(args[1])); }, { { "state", var(mud::WidgetState()) }, { "enabled", var(bool()) } }, Var() },
+                    { type<mud::Widget>(), "enable_state", member_address(&mud::Widget::enable_state), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Widget>(object).enable_state(val<mud::WidgetState>(args[0])); }, { { "state", var(mud::WidgetState()) } }, Var() },
+                    { type<mud::Widget>(), "clear_focus", member_address(&mud::Widget::clear_focus), [](Ref object, array<Var> args, Var& result) { UNUSED(result); UNUSED(args);val<mud::Widget>(object).clear_focus(); }, {}, Var() },
+                    { type<mud::Widget>(), "take_focus", member_address(&mud::Widget::take_focus), [](Ref object, array<Var> args, Var& result) { UNUSED(result); UNUSED(args);val<mud::Widget>(object).take_focus(); }, {}, Var() },
+                    { type<mud::Widget>(), "yield_focus", member_address(&mud::Widget::yield_focus), [](Ref object, array<Var> args, Var& result) { UNUSED(result); UNUSED(args);val<mud::Widget>(object).yield_focus(); }, {}, Var() },
+                    { type<mud::Widget>(), "take_modal", member_address(&mud::Widget::take_modal), [](Ref object, array<Var> args, Var& result) { UNUSED(result); val<mud::Widget>(object).take_modal(val<uint32_t>(args[0])); }, { { "device_filter", var(uint32_t()) } }, Var() },
+                    { type<mud::Widget>(), "yield_modal", member_address(&mud::Widget::yield_modal), [](Ref object, array<Var> args, Var& result) { UNUSED(result); UNUSED(args);val<mud::Widget>(object).yield_modal(); }, {}, Var() },
+                    { type<mud::Widget>(), "key_event", member_address(&mud::Widget::key_event), [](Ref object, array<Var> args, Var& result) { val<mud::KeyEvent>(result) = val<mud::Widget>(object).key_event(val<mud::Key>(args[0]), val<mud::EventType>(args[1]), val<mud::InputMod>(args[2])); }, { { "code", var(mud::Key()) }, { "event_type", var(mud::EventType()) }, { "modifier", var(mud::InputMod()), Param::Default } }, var(mud::KeyEvent()) },
+                    { type<mud::Widget>(), "key_stroke", member_address(&mud::Widget::key_stroke), [](Ref object, array<Var> args, Var& result) { val<mud::KeyEvent>(result) = val<mud::Widget>(object).key_stroke(val<mud::Key>(args[0]), val<mud::InputMod>(args[1])); }, { { "code", var(mud::Key()) }, { "modifier", var(mud::InputMod()), Param::Default } }, var(mud::KeyEvent()) },
+                    { type<mud::Widget>(), "mouse_event", member_address(&mud::Widget::mouse_event), [](Ref object, array<Var> args, Var& result) { val<mud::MouseEvent>(result) = val<mud::Widget>(object).mouse_event(val<mud::DeviceType>(args[0]), val<mud::EventType>(args[1]), val<mud::InputMod>(args[2]), val<bool>(args[3])); }, { { "device", var(mud::DeviceType()) }, { "event_type", var(mud::EventType()) }, { "modifier", var(mud::InputMod()), Param::Default }, { "consume", var(bool(true)), Param::Default } }, var(mud::MouseEvent()) }
+                },
+                // static members
+                {
+                }
+            };
+        
+        
+            
+            
+            init_class<mud::Widget>();
+        });
     }
     
 
@@ -53,31 +53,33 @@ namespace mud
     // mud::ScriptEditor
     {
         static Meta meta = { type<mud::ScriptEditor>(), &namspc({ "mud" }), "ScriptEditor", sizeof(mud::ScriptEditor), TypeClass::Object };
-        static Class cls = { type<mud::ScriptEditor>(),
-            // bases
-            {  },
-            {  },
-            // constructors
-            {
-            },
-            // copy constructor
-            {
-            },
-            // members
-            {
-            },
-            // methods
-            {
-            },
-            // static members
-            {
-            }
-        };
-        
-        
+        lazy_class<mud::ScriptEditor>([] {
+            static Class cls = { type<mud::ScriptEditor>(),
+                // bases
+                {  },
+                {  },
+                // constructors
+                {
+                },
+                // copy constructor
+                {
+                },
+                // members
+                {
+                },
+                // methods
+                {
+                },
+                // static members
+                {
+                }
+            };
         
         
-        meta_class<mud::ScriptEditor>();
+            
+            
+            init_class<mud::ScriptEditor>();
+        });
     }
     
     
@@ -16,6 +16,6 @@ namespace mud
 {
 	Val::Val()
 		: m_type(&type<None>())
-		, m_any(make_unique<TAny<None>>())
+		, m_any(new (m_buffer) TAny<None>())
 	{}
 }
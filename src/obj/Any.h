@@ -67,6 +67,8 @@ namespace mud
 	class TAny : public Any
 	{
 	public:
+		static constexpr bool Trivial = std::is_trivially_copyable<T>::value;
+
 		template <class U>
 		TAny(U&& value) : m_content(any_copy<T>(std::forward<U>(value))) {}
 		TAny() : m_content() {}
@@ -75,9 +77,13 @@ namespace mud
 		virtual void assign(Ref ref) { any_assign<T>(m_content, val<T>(ref)); }
 		virtual void assign(const Any& other) { any_assign<T>(m_content, static_cast<const TAny<T>&>(other).m_content); }
 		virtual bool compare(const Any& other) const { return any_compare<T>(m_content, static_cast<const TAny<T>&>(other).m_content); }
-		virtual unique_ptr<Any> clone() const { return make_unique<TAny<T>>(any_copy<T>(m_content)); }
+		virtual Any* clone(void* buffer) const { return this->clone(buffer, std::integral_constant<bool, Val::fits<TAny<T>>()>()); }
 
 		T m_content;
+
+	private:
+		Any* clone(void* buffer, std::true_type) const { return new (buffer) TAny<T>(any_copy<T>(m_content)); }
+		Any* clone(void* buffer, std::false_type) const { UNUSED(buffer); return new TAny<T>(any_copy<T>(m_content)); }
 	};
 
 	export_ template <class T>
@@ -110,7 +116,7 @@ namespace mud
 		set(Var& var, U&& value) { set(var.m_ref, std::forward<U>(value)); }
 
 	export_ template <class T, class U>
-	inline Var make_val(U&& value) { return Val{ type<T>(), make_unique<TAny<T>>(std::forward<U>(value)) }; }
+	inline Var make_val(U&& value) { return Val::make<TAny<T>>(type<T>(), std::forward<U>(value)); }
 
 	export_ template <class T, class U>
 	inline typename enable_if<ValueSemantic<T>::value, Var>::type
@@ -8,46 +8,125 @@
 #include <obj/Type.h>
 
 #ifndef MUD_CPP_20
+#include <cstdint>
 #include <vector>
 #include <functional>
+#include <type_traits>
 #endif
 
 namespace mud
 {
+	// functions called depending on the type of a Ref : most dispatches only handle a few types
+	// so the table from type id to branch only grows up to the highest type id handled, and holds 16 bit indices into the branches
+	// a branch is a plain function pointer called through a thunk, only closures are stored in a std::function
 	export_ template <class T_Return, class... T_Args>
 	class Dispatch
 	{
 	public:
+		using Function = std::function<T_Return(Ref, T_Args...)>;
+		using Pointer = void(*)();
+
+		struct Branch;
+		using Thunk = T_Return(*)(const Dispatch& dispatch, const Branch& branch, Ref ref, T_Args... args);
+
+		struct Branch
+		{
+			Thunk m_thunk;
+			Pointer m_pointer;
+			uint32_t m_closure;
+		};
+
 		Dispatch()
-			: m_branches(c_max_types)
+			: m_branches(1, Branch{ &Dispatch::missing, nullptr, 0 })
 		{}
 
-		void function(Type& type, const std::function<T_Return(Ref, T_Args...)>& func)
+		template <class T_Function>
+		void function(Type& type, T_Function func)
+		{
+			this->add(type, func, std::is_convertible<T_Function, T_Return(*)(Ref, T_Args...)>());
+		}
+
+		template <class T, class T_Function>
+		void function(T_Function func)
+		{
+			this->function(type<T>(), func);
+		}
+
+		// sets the branch of a type : a branch already set is replaced
+		void branch(Type& type, Thunk thunk, Pointer pointer, uint32_t closure = 0)
+		{
+			if(type.m_id >= m_index.size())
+				m_index.resize(type.m_id + 1U, 0);
+
+			uint16_t& index = m_index[type.m_id];
+			if(index == 0)
+			{
+				index = uint16_t(m_branches.size());
+				m_branches.push_back({});
+			}
+			m_branches[index] = { thunk, pointer, closure };
+		}
+
+		void closure(Type& type, Function func)
+		{
+			m_closures.push_back(std::move(func));
+			this->branch(type, &Dispatch::call_closure, nullptr, uint32_t(m_closures.size() - 1));
+		}
+
+		T_Return dispatch(Ref ref, T_Args... args) const
+		{
+			const Branch& branch = m_branches[this->index(*ref.m_type)];
+			return branch.m_thunk(*this, branch, ref, std::forward<T_Args>(args)...);
+		}
+
+		bool check(Type& type) const
 		{
-			m_branches[type.m_id] = func;
+			return this->index(type) != 0;
 		}
 
-		template <class T>
-		void function(const std::function<T_Return(Ref, T_Args...)>& func)
+		bool check(Ref ref) const
 		{
-			m_branches[type<T>().m_id] = func;
+			return this->index(*ref.m_type) != 0;
 		}
 
-		T_Return dispatch(Ref ref, T_Args... args)
+		// bytes used by the tables, not counting what the closures capture
+		size_t memory() const
 		{
-			return m_branches[ref.m_type->m_id](ref, std::forward<T_Args>(args)...);
+			return sizeof(*this) + m_index.capacity() * sizeof(uint16_t) + m_branches.capacity() * sizeof(Branch) + m_closures.capacity() * sizeof(Function);
 		}
 
-		bool check(Type& type)
+		std::vector<uint16_t> m_index;
+		std::vector<Branch> m_branches;
+		std::vector<Function> m_closures;
+
+	private:
+		uint16_t index(Type& type) const { return type.m_id < m_index.size() ? m_index[type.m_id] : 0; }
+
+		void add(Type& type, T_Return(*func)(Ref, T_Args...), std::true_type)
 		{
-			return m_branches[type.m_id] != nullptr;
+			this->branch(type, &Dispatch::call_pointer, reinterpret_cast<Pointer>(func));
 		}
 
-		bool check(Ref ref)
+		template <class T_Function>
+		void add(Type& type, T_Function func, std::false_type)
 		{
-			return m_branches[ref.m_type->m_id] != nullptr;
+			this->closure(type, Function(func));
 		}
 
-		std::vector<std::function<T_Return(Ref, T_Args...)>> m_branches;
+		static T_Return call_pointer(const Dispatch&, const Branch& branch, Ref ref, T_Args... args)
+		{
+			return reinterpret_cast<T_Return(*)(Ref, T_Args...)>(branch.m_pointer)(ref, std::forward<T_Args>(args)...);
+		}
+
+		static T_Return call_closure(const Dispatch& dispatch, const Branch& branch, Ref ref, T_Args... args)
+		{
+			return dispatch.m_closures[branch.m_closure](ref, std::forward<T_Args>(args)...);
+		}
+
+		// like calling an empty std::function, which the branches used to be
+		static T_Return missing(const Dispatch&, const Branch&, Ref, T_Args...)
+		{
+			throw std::bad_function_call();
+		}
 	};
 }
@@ -10,16 +10,39 @@
 
 namespace mud
 {
+	namespace detail
+	{
+		template <class T, class T_Return, class... T_Args>
+		T_Return call_branch(const Dispatch<T_Return, T_Args...>&, const typename Dispatch<T_Return, T_Args...>::Branch& branch, Ref ref, T_Args... args)
+		{
+			return reinterpret_cast<T_Return(*)(T&, T_Args...)>(branch.m_pointer)(val<T>(ref), std::forward<T_Args>(args)...);
+		}
+
+		// plain functions and captureless lambdas are stored as function pointers, anything else as a closure
+		template <class T, class T_Function, class T_Return, class... T_Args>
+		void dispatch_branch(Dispatch<T_Return, T_Args...>& dispatch, T_Function func, std::true_type)
+		{
+			T_Return(*pointer)(T&, T_Args...) = func;
+			dispatch.branch(type<T>(), &call_branch<T, T_Return, T_Args...>, reinterpret_cast<typename Dispatch<T_Return, T_Args...>::Pointer>(pointer));
+		}
+
+		template <class T, class T_Function, class T_Return, class... T_Args>
+		void dispatch_branch(Dispatch<T_Return, T_Args...>& dispatch, T_Function func, std::false_type)
+		{
+			dispatch.closure(type<T>(), [func](Ref ref, T_Args... args) -> T_Return { return func(val<T>(ref), std::forward<T_Args>(args)...); });
+		}
+	}
+
 	export_ template <class T, class T_Function, class T_Return, class... T_Args>
 	void dispatch_branch(Dispatch<T_Return, T_Args...>& dispatch, T_Function func)
 	{
-		dispatch.m_branches[type<T>().m_id] = [func](Ref ref, T_Args... args) -> T_Return { return func(val<T>(ref), std::forward<T_Args>(args)...); };
+		detail::dispatch_branch<T>(dispatch, func, std::is_convertible<T_Function, T_Return(*)(T&, T_Args...)>());
 	}
 
 	export_ template <class T, class T_Function, class T_Return, class... T_Args>
 	void dispatch_ref_branch(Dispatch<T_Return, T_Args...>& dispatch, T_Function func)
 	{
-		dispatch.m_branches[type<T>().m_id] = [func](Ref ref, T_Args... args) -> T_Return { return func(ref, val<T>(ref), std::forward<T_Args>(args)...); };
+		dispatch.closure(type<T>(), [func](Ref ref, T_Args... args) -> T_Return { return func(ref, val<T>(ref), std::forward<T_Args>(args)...); });
 	}
 
 	export_ template <class T_First, class T_Second, void(*func)(T_First&, T_Second&)>
@@ -46,10 +46,12 @@ namespace mud
 	export_ class refl_ MUD_OBJ_EXPORT Index : public NonCopy
 	{
 	public:
-		Index() : m_indexers(c_max_types) {}
+		Index() {}
 
 		meth_ Indexer& indexer(Type& type)
 		{
+			if(type.m_id >= m_indexers.size())
+				m_indexers.resize(type.m_id + 1U);
 			if(!m_indexers[type.m_id])
 				m_indexers[type.m_id] = make_unique<Indexer>(type);
 			return *m_indexers[type.m_id];
@@ -37,9 +37,8 @@ namespace mud
 		inline void iterate_objects(T_Func func)
 		{
 			VecPool<T>* pool = this->pool<T>().m_vec_pool.get();
-			for(; pool; pool = pool->m_next.get())
-				for(T* object : pool->m_objects)
-					func(*object);
+			if(pool)
+				pool->iterate(func);
 		}
 
 		template <class T>
@@ -9,8 +9,19 @@
 #include <obj/Unique.h>
 #include <obj/TypeUtils.h>
 
+#ifndef MUD_CPP_20
+#include <cstdint>
+#endif
+
+#if defined _MSC_VER
+#include <intrin.h>
+#endif
+
 namespace mud
 {
+	// objects are allocated in fixed chunks, so that their address never changes : a full chunk chains to a new one twice as large
+	// each slot stores its index in the live objects list, so that freeing is a swap-remove, and an occupancy bitmap
+	// allows iterating the live objects in memory order
 	export_ template<class T>
 	class VecPool : public NonCopy
 	{
@@ -20,6 +31,8 @@ namespace mud
 			, m_chunk(operator new(size * sizeof(T)))
 			, m_memory((T*)m_chunk)
 			, m_last(m_memory + size - 1)
+			, m_slots(size, UINT32_MAX)
+			, m_occupied((size + 63) / 64, 0)
 		{
 			++s_count;
 			//printf("VecPool for type %s, count %u, size %u\n", type<T>().name().c_str(), s_count, size * sizeof(T));
@@ -27,8 +40,8 @@ namespace mud
 			m_available.reserve(size);
 			m_objects.reserve(size);
 
-			for(size_t i = 0; i < size; ++i)
-				m_available.push_back(&m_memory[i]);
+			for(size_t i = size; i > 0; --i)
+				m_available.push_back(&m_memory[i - 1]);
 		}
 
 		~VecPool()
@@ -49,6 +62,10 @@ namespace mud
 
 			T* object = m_available.back();
 			m_available.pop_back();
+
+			const size_t slot = object - m_memory;
+			m_slots[slot] = uint32_t(m_objects.size());
+			m_occupied[slot / 64] |= 1ULL << (slot % 64);
 			m_objects.push_back(object);
 			return object;
 		}
@@ -64,8 +81,41 @@ namespace mud
 			if(object < m_memory || object > m_last)
 				return m_next->free(object);
 
+			const size_t slot = object - m_memory;
+			const uint32_t index = m_slots[slot];
+			T* moved = m_objects.back();
+			m_objects[index] = moved;
+			m_slots[moved - m_memory] = index;
+			m_objects.pop_back();
+
+			m_slots[slot] = UINT32_MAX;
+			m_occupied[slot / 64] &= ~(1ULL << (slot % 64));
 			m_available.push_back(object);
-			vector_remove(m_objects, object);
+		}
+
+		size_t count() const
+		{
+			return m_objects.size() + (m_next ? m_next->count() : 0);
+		}
+
+		// visits the live objects of this pool and the chained ones, in memory order
+		// func can free the object it is given, but objects allocated meanwhile might not be visited
+		template <class T_Func>
+		void iterate(T_Func func)
+		{
+			for(size_t word = 0; word < m_occupied.size(); ++word)
+			{
+				uint64_t bits = m_occupied[word];
+				while(bits)
+				{
+					const size_t bit = bit_index(bits);
+					bits &= bits - 1;
+					func(m_memory[word * 64 + bit]);
+				}
+			}
+
+			if(m_next)
+				m_next->iterate(func);
 		}
 
 	public:
@@ -77,6 +127,18 @@ namespace mud
 			return *at;
 		}
 
+	private:
+		static size_t bit_index(uint64_t bits)
+		{
+#if defined _MSC_VER
+			unsigned long index;
+			_BitScanForward64(&index, bits);
+			return index;
+#else
+			return __builtin_ctzll(bits);
+#endif
+		}
+
 	public:
 		size_t m_size;
 		std::vector<T*> m_available;
@@ -85,6 +147,10 @@ namespace mud
 		T* m_memory;
 		T* m_last;
 
+		// index in m_objects of the object in each slot, and one bit per occupied slot
+		std::vector<uint32_t> m_slots;
+		std::vector<uint64_t> m_occupied;
+
 		unique_ptr<VecPool<T>> m_next;
 
 		static int s_count;
@@ -0,0 +1,335 @@
+#pragma once
+
+#include <infra/Vector.h>
+#include <proto/Forward.h>
+#include <proto/ECS/ECS.h>
+
+#include <cassert>
+#include <cstring>
+#include <new>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+namespace mud
+{
+	// type-erased operations to store components of one type in raw chunk memory
+	struct ComponentType
+	{
+		size_t m_size = 0;
+		size_t m_align = 1;
+		void(*m_move)(void* dest, void* source) = nullptr;
+		void(*m_destroy)(void* dest) = nullptr;
+
+		template <class T>
+		static ComponentType create()
+		{
+			ComponentType type;
+			type.m_size = sizeof(T);
+			type.m_align = alignof(T);
+			type.m_move = [](void* dest, void* source) { new (dest) T(std::move(*static_cast<T*>(source))); };
+			type.m_destroy = [](void* dest) { static_cast<T*>(dest)->~T(); };
+			return type;
+		}
+	};
+
+	struct ArchetypeChunk
+	{
+		static const size_t Size = 16 * 1024;
+		static const size_t Align = 16;
+
+		alignas(Align) uint8_t m_data[Size];
+		uint32_t m_count = 0;
+	};
+
+	// all entities sharing one component signature, in fixed-size chunks
+	// each chunk holds the entity handles, followed by one contiguous column per component type
+	class Archetype
+	{
+	public:
+		struct Column
+		{
+			uint32_t m_type;
+			size_t m_offset;
+			size_t m_size;
+		};
+
+		EntFlags m_signature;
+		const ComponentType* m_types;
+
+		std::vector<Column> m_columns;
+		int8_t m_column_index[64];
+
+		uint32_t m_capacity = 0;
+		uint32_t m_count = 0;
+		std::vector<std::unique_ptr<ArchetypeChunk>> m_chunks;
+
+	public:
+		Archetype(EntFlags signature, const ComponentType* types)
+			: m_signature(signature)
+			, m_types(types)
+		{
+			memset(m_column_index, -1, sizeof(m_column_index));
+
+			size_t row = sizeof(uint32_t);
+			size_t padding = 0;
+			for(uint32_t i = 0; i < 64; ++i)
+				if(signature & (1ULL << i))
+				{
+					m_column_index[i] = int8_t(m_columns.size());
+					m_columns.push_back({ i, 0, types[i].m_size });
+					row += types[i].m_size;
+					padding += types[i].m_align - 1;
+				}
+
+			// a chunk must hold at least one entity : signatures with rows larger than a chunk are not supported
+			assert(padding + row <= ArchetypeChunk::Size);
+			m_capacity = padding + row <= ArchetypeChunk::Size ? uint32_t((ArchetypeChunk::Size - padding) / row) : 0;
+
+			size_t offset = m_capacity * sizeof(uint32_t);
+			for(Column& column : m_columns)
+			{
+				const size_t align = types[column.m_type].m_align;
+				offset = (offset + align - 1) & ~(align - 1);
+				column.m_offset = offset;
+				offset += m_capacity * column.m_size;
+			}
+		}
+
+		~Archetype()
+		{
+			for(uint32_t index = 0; index < m_count; ++index)
+				for(uint32_t column = 0; column < m_columns.size(); ++column)
+					m_types[m_columns[column].m_type].m_destroy(this->Component(column, index));
+		}
+
+		bool HasColumn(uint32_t type) const { return m_column_index[type] >= 0; }
+
+		uint32_t* Handles(ArchetypeChunk& chunk) { return reinterpret_cast<uint32_t*>(chunk.m_data); }
+
+		template <class T>
+		T* Data(ArchetypeChunk& chunk)
+		{
+			const Column& column = m_columns[m_column_index[TypedBuffer<T>::index()]];
+			return reinterpret_cast<T*>(chunk.m_data + column.m_offset);
+		}
+
+		uint32_t& Handle(uint32_t index)
+		{
+			return this->Handles(*m_chunks[index / m_capacity])[index % m_capacity];
+		}
+
+		void* Component(uint32_t column, uint32_t index)
+		{
+			const Column& col = m_columns[column];
+			return m_chunks[index / m_capacity]->m_data + col.m_offset + (index % m_capacity) * col.m_size;
+		}
+
+		void* ComponentOf(uint32_t type, uint32_t index)
+		{
+			return this->Component(m_column_index[type], index);
+		}
+
+		// reserves a slot at the end : the caller is responsible for constructing every column
+		uint32_t Add(uint32_t handle)
+		{
+			assert(m_capacity > 0);
+			const uint32_t index = m_count++;
+			if(index / m_capacity >= m_chunks.size())
+				m_chunks.emplace_back(new ArchetypeChunk);
+			ArchetypeChunk& chunk = *m_chunks[index / m_capacity];
+			this->Handles(chunk)[index % m_capacity] = handle;
+			chunk.m_count++;
+			return index;
+		}
+
+		// destroys the components in the slot, and fills it with the last entity : returns its handle, or UINT32_MAX if none moved
+		uint32_t Remove(uint32_t index)
+		{
+			const uint32_t last = --m_count;
+			for(uint32_t column = 0; column < m_columns.size(); ++column)
+			{
+				const ComponentType& type = m_types[m_columns[column].m_type];
+				type.m_destroy(this->Component(column, index));
+				if(index != last)
+				{
+					type.m_move(this->Component(column, index), this->Component(column, last));
+					type.m_destroy(this->Component(column, last));
+				}
+			}
+
+			uint32_t moved = UINT32_MAX;
+			if(index != last)
+			{
+				moved = this->Handle(last);
+				this->Handle(index) = moved;
+			}
+
+			m_chunks[last / m_capacity]->m_count--;
+			return moved;
+		}
+	};
+
+	// alternative storage to EntityRegistry : components of an entity are stored together with all entities of the same signature
+	// queries walk only the matching archetypes, chunk by chunk, with no per entity test or indirection
+	class ArchetypeRegistry
+	{
+	public:
+		struct Location
+		{
+			Archetype* m_archetype;
+			uint32_t m_index;
+		};
+
+		std::vector<ComponentType> m_types;
+		std::vector<std::unique_ptr<Archetype>> m_archetypes;
+		std::unordered_map<EntFlags, Archetype*> m_signatures;
+
+		std::vector<EntityData> m_entities;
+		std::vector<Location> m_locations;
+		std::vector<uint32_t> m_available;
+
+	public:
+		ArchetypeRegistry(int capacity = 1 << 10)
+			: m_types(64)
+		{
+			m_entities.reserve(capacity);
+			m_locations.reserve(capacity);
+		}
+
+		ArchetypeRegistry(const ArchetypeRegistry& other) = delete;
+		ArchetypeRegistry& operator=(const ArchetypeRegistry& other) = delete;
+
+		template <class T>
+		void AddType()
+		{
+			static_assert(alignof(T) <= ArchetypeChunk::Align, "component aligned beyond what the chunks guarantee");
+			static_assert(sizeof(uint32_t) + sizeof(T) + alignof(T) - 1 <= ArchetypeChunk::Size, "component too large to fit in a chunk");
+			m_types[TypedBuffer<T>::index()] = ComponentType::create<T>();
+		}
+
+		Archetype& FindArchetype(EntFlags signature)
+		{
+			auto it = m_signatures.find(signature);
+			if(it != m_signatures.end())
+				return *it->second;
+
+			m_archetypes.emplace_back(std::make_unique<Archetype>(signature, m_types.data()));
+			Archetype& archetype = *m_archetypes.back();
+			m_signatures[signature] = &archetype;
+			return archetype;
+		}
+
+		uint32_t CreateEntity()
+		{
+			Archetype& archetype = this->FindArchetype(0);
+
+			uint32_t handle;
+			if(m_available.size() > 0)
+				handle = vector_pop(m_available);
+			else
+			{
+				handle = uint32_t(m_entities.size());
+				m_entities.push_back({});
+				m_locations.push_back({});
+			}
+
+			m_entities[handle] = {};
+			m_locations[handle] = { &archetype, archetype.Add(handle) };
+			return handle;
+		}
+
+		void DeleteEntity(uint32_t handle)
+		{
+			Location& location = m_locations[handle];
+			this->Detach(location);
+			m_entities[handle] = {};
+			location = {};
+			m_available.push_back(handle);
+		}
+
+		template <class T>
+		void AddComponent(uint32_t handle, T component = T())
+		{
+			EntityData& entity = m_entities[handle];
+			const uint32_t type = uint32_t(TypedBuffer<T>::index());
+			if((entity.m_flags & (1ULL << type)) != 0)
+			{
+				this->GetComponent<T>(handle) = std::move(component);
+				return;
+			}
+
+			const uint32_t index = this->Migrate(handle, entity.m_flags | (1ULL << type));
+			new (m_locations[handle].m_archetype->ComponentOf(type, index)) T(std::move(component));
+		}
+
+		template <class T>
+		void RemoveComponent(uint32_t handle)
+		{
+			EntityData& entity = m_entities[handle];
+			this->Migrate(handle, entity.m_flags & ~(1ULL << TypedBuffer<T>::index()));
+		}
+
+		template <class T>
+		bool HasComponent(uint32_t handle)
+		{
+			return (m_entities[handle].m_flags & (1ULL << TypedBuffer<T>::index())) != 0;
+		}
+
+		template <class T>
+		T& GetComponent(uint32_t handle)
+		{
+			const Location& location = m_locations[handle];
+			return *static_cast<T*>(location.m_archetype->ComponentOf(uint32_t(TypedBuffer<T>::index()), location.m_index));
+		}
+
+		template <class... Ts, class T_Function>
+		void Loop(T_Function action)
+		{
+			const EntFlags flags = TypeFlags<Ts...>();
+			for(auto& archetype : m_archetypes)
+				if((archetype->m_signature & flags) == flags)
+					for(auto& chunk : archetype->m_chunks)
+						LoopChunk(action, archetype->Handles(*chunk), chunk->m_count, archetype->Data<Ts>(*chunk)...);
+		}
+
+	private:
+		template <class T_Function, class... Ts>
+		static void LoopChunk(T_Function& action, const uint32_t* handles, uint32_t count, Ts*... columns)
+		{
+			for(uint32_t i = 0; i < count; ++i)
+				action(handles[i], columns[i]...);
+		}
+
+		void Detach(const Location& location)
+		{
+			const uint32_t moved = location.m_archetype->Remove(location.m_index);
+			if(moved != UINT32_MAX)
+				m_locations[moved].m_index = location.m_index;
+		}
+
+		// moves the entity components to the archetype of the new signature : components missing from the source are left for the caller to construct
+		uint32_t Migrate(uint32_t handle, EntFlags signature)
+		{
+			Location& location = m_locations[handle];
+			Archetype& source = *location.m_archetype;
+			Archetype& dest = this->FindArchetype(signature);
+			if(&source == &dest)
+				return location.m_index;
+
+			const uint32_t index = dest.Add(handle);
+			for(uint32_t column = 0; column < dest.m_columns.size(); ++column)
+			{
+				const uint32_t type = dest.m_columns[column].m_type;
+				if(source.HasColumn(type))
+					m_types[type].m_move(dest.Component(column, index), source.ComponentOf(type, location.m_index));
+			}
+
+			this->Detach(location);
+
+			location = { &dest, index };
+			m_entities[handle].m_flags = signature;
+			return index;
+		}
+	};
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <infra/Config.h>
+#include <proto/ECS/ECS.h>
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace mud
+{
+	class EntityRegistry;
+
+	using CommandFunc = void(*)(EntityRegistry* registry, uint32_t handle, void* data);
+
+	// applies the command, or only releases its data when registry is null
+	template <class T>
+	void AddCommand(EntityRegistry* registry, uint32_t handle, void* data);
+
+	template <class T>
+	void RemoveCommand(EntityRegistry* registry, uint32_t handle, void* data);
+
+	// records structural changes to play them back later on the registry, at a sync point
+	// entities created through a command buffer get a pending handle, which can be used by the following commands of the same buffer
+	class EntityCommands
+	{
+	public:
+		static const uint32_t PendingBit = 0x80000000;
+
+		enum class Op : uint8_t
+		{
+			Create,
+			Delete,
+			Component
+		};
+
+		struct Command
+		{
+			Op m_op;
+			uint32_t m_handle;
+			void* m_data;
+			CommandFunc m_func;
+		};
+
+		struct Block
+		{
+			static const size_t Size = 16 * 1024;
+			static const size_t Align = 16;
+			alignas(Align) uint8_t m_data[Size];
+		};
+
+		std::vector<Command> m_commands;
+		uint32_t m_num_created = 0;
+
+	public:
+		EntityCommands() {}
+		EntityCommands(EntityCommands&& other) = default;
+		~EntityCommands() { this->Clear(); }
+
+		bool Empty() const { return m_commands.empty(); }
+
+		uint32_t Create()
+		{
+			m_commands.push_back({ Op::Create, PendingBit | m_num_created, nullptr, nullptr });
+			return PendingBit | m_num_created++;
+		}
+
+		void Delete(uint32_t handle)
+		{
+			m_commands.push_back({ Op::Delete, handle, nullptr, nullptr });
+		}
+
+		template <class T>
+		void Add(uint32_t handle, T component = T())
+		{
+			static_assert(sizeof(T) <= Block::Size, "component too large to be recorded");
+			static_assert(alignof(T) <= Block::Align, "component aligned beyond what the command blocks guarantee");
+			void* data = this->Allocate(sizeof(T), alignof(T));
+			new (data) T(std::move(component));
+			m_commands.push_back({ Op::Component, handle, data, &AddCommand<T> });
+		}
+
+		template <class T>
+		void Remove(uint32_t handle)
+		{
+			m_commands.push_back({ Op::Component, handle, nullptr, &RemoveCommand<T> });
+		}
+
+		// drops the commands without applying them
+		void Clear()
+		{
+			for(Command& command : m_commands)
+				if(command.m_data)
+					command.m_func(nullptr, command.m_handle, command.m_data);
+			this->Reset();
+		}
+
+		// forgets the commands once played back, keeping the blocks for the next recording
+		void Reset()
+		{
+			m_commands.clear();
+			m_num_created = 0;
+			m_block = 0;
+			m_offset = 0;
+		}
+
+		void* Allocate(size_t size, size_t align)
+		{
+			m_offset = (m_offset + align - 1) & ~(align - 1);
+			if(m_blocks.empty() || m_offset + size > Block::Size)
+			{
+				if(!m_blocks.empty())
+					m_block++;
+				if(m_block == m_blocks.size())
+					m_blocks.emplace_back(new Block);
+				m_offset = 0;
+			}
+
+			void* data = m_blocks[m_block]->m_data + m_offset;
+			m_offset += size;
+			return data;
+		}
+
+	private:
+		std::vector<std::unique_ptr<Block>> m_blocks;
+		size_t m_block = 0;
+		size_t m_offset = 0;
+	};
+}
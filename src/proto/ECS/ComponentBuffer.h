@@ -5,65 +5,54 @@
 #include <proto/Forward.h>
 #include <proto/ECS/ECS.h>
 #include <proto/ECS/SparseBuffer.h>
+#include <proto/ECS/Snapshot.h>
 
 #include <vector>
+#include <algorithm>
 
 namespace mud
 {
-	template <class T_Key, class T_Value, class T_Indices, class T_Greater>
-	void quicksort(array<T_Key> keys, array<T_Value> values, T_Indices& indices, T_Greater greater, const size_t left, const size_t right)
+	// stable LSD radix sort on 8-bit digits, least significant first : keys[i] is the key of element order[i], both are sorted together
+	// the keys move along with the elements so that each pass reads them linearly, and digits identical for all keys are skipped
+	template <class T_Key>
+	void radix_sort(std::vector<T_Key>& keys, std::vector<uint32_t>& order, std::vector<T_Key>& temp_keys, std::vector<uint32_t>& temp_order)
 	{
-		auto swap = [&](size_t first, size_t second)
-		{
-			std::swap(keys[first], keys[second]);
-			std::swap(values[first], values[second]);
-			std::swap(indices[keys[first]], indices[keys[second]]);
-		};
-
-		auto partition = [&](const size_t left, const size_t right)
-		{
-			const size_t mid = left + (right - left) / 2;
-			const T_Key pivot = keys[mid];
-			// move the mid point value to the front.
-			swap(mid, left);
-			size_t i = left + 1;
-			size_t j = right;
-			while(i <= j)
-			{
-				while(i <= j && !greater(keys[i], pivot))
-					i++;
-
-				while(i <= j && greater(keys[j], pivot))
-					j--;
+		static const size_t NumDigits = sizeof(T_Key);
+		const uint32_t count = uint32_t(keys.size());
+		if(count == 0)
+			return;
 
-				if(i < j)
-					swap(i, j);
-			}
-			swap(i - 1, left);
-			return i - 1;
-		};
+		uint32_t histograms[NumDigits][256] = {};
+		for(uint32_t i = 0; i < count; ++i)
+			for(size_t d = 0; d < NumDigits; ++d)
+				histograms[d][(keys[i] >> (d * 8)) & 0xff]++;
 
-		size_t part = partition(left, right);
+		temp_keys.resize(count);
+		temp_order.resize(count);
+		for(size_t d = 0; d < NumDigits; ++d)
+		{
+			uint32_t* histogram = histograms[d];
+			if(histogram[(keys[0] >> (d * 8)) & 0xff] == count)
+				continue;
 
-		if(int(left) < int(part) - 1)
-			quicksort(keys, values, indices, greater, left, part - 1);
-		if(part + 1 < right)
-			quicksort(keys, values, indices, greater, part + 1, right);
-	}
+			uint32_t offset = 0;
+			for(size_t b = 0; b < 256; ++b)
+			{
+				const uint32_t size = histogram[b];
+				histogram[b] = offset;
+				offset += size;
+			}
 
-	template <class T_Key, class T_Value, class T_Indices, class T_Greater>
-	void quicksort(array<T_Key> keys, array<T_Value> values, T_Indices& indices, T_Greater greater)
-	{
-		if(keys.size() > 0)
-			quicksort(keys, values, indices, greater, 0, keys.size() - 1);
-	}
+			for(uint32_t i = 0; i < count; ++i)
+			{
+				const uint32_t at = histogram[(keys[i] >> (d * 8)) & 0xff]++;
+				temp_keys[at] = keys[i];
+				temp_order[at] = order[i];
+			}
 
-	template <class T_Key, class T_Value, class T_Indices>
-	void quicksort(array<T_Key> keys, array<T_Value> values, T_Indices& indices)
-	{
-		auto greater = [](T_Key a, T_Key b) { return a > b; };
-		if(keys.size() > 0)
-			quicksort(keys, values, indices, greater, 0, keys.size() - 1);
+			std::swap(keys, temp_keys);
+			std::swap(order, temp_order);
+		}
 	}
 
 	class ComponentBufferBase
@@ -72,19 +61,84 @@ namespace mud
 		EntFlags m_flag;
 		bool m_sparse;
 
+		// incremented when a key is added or removed, or the signature of one of its entities changes
+		// the buffer is sorted again before the next loop if it was sorted at an older version
+		uint32_t m_version = 1;
+		uint32_t m_sorted = 0;
+
+		// tick at which each component was last written, in buffer order, and the max of each block of components
+		// block versions are upper bounds : they let change queries skip whole blocks of untouched components
+		static const size_t VersionBlock = 64;
+		std::vector<uint32_t> m_versions;
+		std::vector<uint32_t> m_block_versions;
+
+		// entities which gained or lost this component since the events were last cleared
+		std::vector<uint32_t> m_added;
+		std::vector<uint32_t> m_removed;
+
+		virtual ~ComponentBufferBase() {}
+
+		void Stamp(size_t index, uint32_t tick)
+		{
+			m_versions[index] = tick;
+			uint32_t& block = m_block_versions[index / VersionBlock];
+			block = std::max(block, tick);
+		}
+
+		void StampRange(size_t begin, size_t end, uint32_t tick)
+		{
+			std::fill(m_versions.begin() + begin, m_versions.begin() + end, tick);
+			for(size_t block = begin / VersionBlock; block * VersionBlock < end; ++block)
+				m_block_versions[block] = std::max(m_block_versions[block], tick);
+		}
+
+		void ClearEvents()
+		{
+			m_added.clear();
+			m_removed.clear();
+		}
+
+		void UpdateBlockVersions()
+		{
+			m_block_versions.assign((m_versions.size() + VersionBlock - 1) / VersionBlock, 0);
+			for(size_t i = 0; i < m_versions.size(); ++i)
+			{
+				uint32_t& block = m_block_versions[i / VersionBlock];
+				block = std::max(block, m_versions[i]);
+			}
+		}
+
 		virtual void SetCapacity(size_t capacity) = 0;
 
 		virtual void SortComponents(const std::vector<EntityData>& entities) = 0;
 		virtual void SortComponents() = 0;
 		virtual void RemoveComponent(uint32_t handle, EntityData& entity) = 0;
+		// removes the component of each of the entities that has one, in a single call
+		virtual void RemoveComponents(array<uint32_t> handles, std::vector<EntityData>& entities) = 0;
+
+		// drops all components, without touching the entity flags
+		virtual void Clear() = 0;
+
+		// snapshots store the handles, versions and components as three raw blocks : false if the components can't be snapshot
+		virtual bool Snapshot(SnapshotWriter& writer) = 0;
+		virtual bool Restore(SnapshotReader& reader) = 0;
 	};
 
 	template <class T, bool dense = true>
 	class ComponentBuffer : public ComponentBufferBase, public MappedBuffer<T, dense>
 	{
-	private:
+	public:
 		std::vector<EntitySlice> m_slices;
 
+		// sort scratch
+		std::vector<uint32_t> m_order;
+		std::vector<uint32_t> m_temp;
+		std::vector<uint32_t> m_sort_handles;
+		std::vector<uint32_t> m_sort_handles_temp;
+		std::vector<uint64_t> m_sort_flags;
+		std::vector<uint64_t> m_sort_flags_temp;
+		std::vector<uint32_t> m_sort_versions;
+
 	public:
 		ComponentBuffer() {}
 		ComponentBuffer(int bufferIndex, int initialSize = 1 << 10)
@@ -100,10 +154,16 @@ namespace mud
 			MappedBuffer<T, dense>::SetCapacity(capacity);
 		}
 
-		void AddComponent(int handle, T component, EntityData& entity)
+		void AddComponent(int handle, T component, EntityData& entity, uint32_t tick = 0)
 		{
 			this->AddKey(handle, std::move(component));
 			entity.m_flags |= m_flag;
+
+			m_versions.push_back(0);
+			if(m_block_versions.size() * VersionBlock < m_versions.size())
+				m_block_versions.push_back(0);
+			this->Stamp(m_versions.size() - 1, tick);
+			m_added.push_back(uint32_t(handle));
 		}
 
 		void UpdateSlices(const std::vector<EntityData>& entities)
@@ -124,27 +184,178 @@ namespace mud
 			m_slices.push_back({ slice.m_prototype, slice.m_begin, keys.size() });
 		}
 
+		// sorts by (entity flags, handle) : being stable, sorting by handle then by flags gives the combined order
 		virtual void SortComponents(const std::vector<EntityData>& entities) override
 		{
-			auto greater = [&](uint32_t a, uint32_t b)
+			if(this->Sorted(entities))
 			{
-				if(entities[a].m_flags == entities[b].m_flags)
-					return a > b;
-				return entities[a].m_flags > entities[b].m_flags;
-			};
-			quicksort(to_array(this->m_keys), to_array(this->m_data), this->m_indices, greater);
+				this->UpdateSlices(entities);
+				return;
+			}
+
+			this->SortHandles();
+
+			m_sort_flags.resize(m_order.size());
+			for(size_t i = 0; i < m_order.size(); ++i)
+				m_sort_flags[i] = entities[this->m_keys[m_order[i]]].m_flags;
+			radix_sort(m_sort_flags, m_order, m_sort_flags_temp, m_temp);
+
+			this->Permute();
 			this->UpdateSlices(entities);
 		}
 
 		virtual void SortComponents() override
 		{
-			quicksort(to_array(this->m_keys), to_array(this->m_data), this->m_indices);
+			this->SortHandles();
+			this->Permute();
+		}
+
+		bool Sorted(const std::vector<EntityData>& entities)
+		{
+			const std::vector<uint32_t>& keys = this->m_keys;
+			for(size_t i = 1; i < keys.size(); ++i)
+			{
+				const EntFlags previous = entities[keys[i - 1]].m_flags;
+				const EntFlags flags = entities[keys[i]].m_flags;
+				if(flags < previous || (flags == previous && keys[i] < keys[i - 1]))
+					return false;
+			}
+			return true;
+		}
+
+		void SortHandles()
+		{
+			const size_t count = this->m_keys.size();
+			m_order.resize(count);
+			for(uint32_t i = 0; i < count; ++i)
+				m_order[i] = i;
+
+			m_sort_handles = this->m_keys;
+			radix_sort(m_sort_handles, m_order, m_sort_handles_temp, m_temp);
+		}
+
+		// gathers the components, keys and versions in sorted order, then rebuilds the indices in one linear pass
+		// the components are gathered in a temporary vector, so that the buffer never holds two copies of its components between sorts
+		// the handles and versions targets are kept between sorts, so that they don't allocate
+		void Permute()
+		{
+			const size_t count = m_order.size();
+
+			std::vector<T> data;
+			data.reserve(this->m_data.capacity());
+			for(size_t i = 0; i < count; ++i)
+				data.emplace_back(std::move(this->m_data[m_order[i]]));
+			this->m_data.swap(data);
+
+			m_sort_handles.resize(count);
+			m_sort_versions.resize(count);
+			for(size_t i = 0; i < count; ++i)
+			{
+				m_sort_handles[i] = this->m_keys[m_order[i]];
+				m_sort_versions[i] = m_versions[m_order[i]];
+			}
+			this->m_keys.swap(m_sort_handles);
+			m_versions.swap(m_sort_versions);
+
+			for(size_t i = 0; i < count; ++i)
+				this->m_indices[this->m_keys[i]] = uint32_t(i);
+
+			this->UpdateBlockVersions();
 		}
 
 		virtual void RemoveComponent(uint32_t handle, EntityData& entity) override
 		{
+			this->Remove(handle, entity);
+		}
+
+		virtual void RemoveComponents(array<uint32_t> handles, std::vector<EntityData>& entities) override
+		{
+			for(uint32_t handle : handles)
+				if((entities[handle].m_flags & m_flag) != 0)
+					this->Remove(handle, entities[handle]);
+		}
+
+		void Remove(uint32_t handle, EntityData& entity)
+		{
+			// the last component is moved in place of the removed one : its block keeps an upper bound of its version
+			const size_t index = this->m_indices.find(handle);
+			const uint32_t last = m_versions.back();
+			m_versions.pop_back();
+			if(index < m_versions.size())
+				this->Stamp(index, last);
+			m_block_versions.resize((m_versions.size() + VersionBlock - 1) / VersionBlock);
+
 			this->RemoveKey(handle);
 			entity.m_flags ^= m_flag;
+			m_removed.push_back(handle);
+		}
+
+		virtual void Clear() override
+		{
+			for(uint32_t handle : this->m_keys)
+				this->m_indices.erase(handle);
+			this->m_data.clear();
+			this->m_keys.clear();
+			m_versions.clear();
+			m_block_versions.clear();
+			m_slices.clear();
+			m_sorted = 0;
+			this->ClearEvents();
+		}
+
+		virtual bool Snapshot(SnapshotWriter& writer) override
+		{
+			return this->Snapshot(writer, std::integral_constant<bool, ComponentSnapshot<T>::Enabled>());
+		}
+
+		// the buffer is left empty if the snapshot is truncated : the caller resets the registry anyway
+		virtual bool Restore(SnapshotReader& reader) override
+		{
+			this->Clear();
+			const bool valid = this->Restore(reader, std::integral_constant<bool, ComponentSnapshot<T>::Enabled>());
+			if(!valid)
+			{
+				this->m_data.clear();
+				this->m_keys.clear();
+				m_versions.clear();
+				return false;
+			}
+
+			for(uint32_t i = 0; i < this->m_keys.size(); ++i)
+				this->m_indices[this->m_keys[i]] = i;
+			this->UpdateBlockVersions();
+			return true;
+		}
+
+		bool Snapshot(SnapshotWriter& writer, std::true_type)
+		{
+			writer.Write(uint32_t(this->m_keys.size()));
+			writer.WriteArray(this->m_keys.data(), this->m_keys.size());
+			writer.WriteArray(m_versions.data(), m_versions.size());
+			ComponentSnapshot<T>::Write(writer, this->m_data);
+			return true;
+		}
+
+		bool Snapshot(SnapshotWriter& writer, std::false_type) { UNUSED(writer); return false; }
+
+		bool Restore(SnapshotReader& reader, std::true_type)
+		{
+			uint32_t count = 0;
+			return reader.Read(count)
+				&& reader.ReadVector(this->m_keys, count)
+				&& reader.ReadVector(m_versions, count)
+				&& ComponentSnapshot<T>::Read(reader, this->m_data, count)
+				&& this->m_data.size() == count;
+		}
+
+		bool Restore(SnapshotReader& reader, std::false_type) { UNUSED(reader); return false; }
+
+		// slices are sorted by prototype, after SortComponents(entities)
+		auto* SliceData(EntFlags prototype)
+		{
+			auto less = [](const EntitySlice& slice, EntFlags prototype) { return slice.m_prototype < prototype; };
+			auto it = std::lower_bound(m_slices.begin(), m_slices.end(), prototype, less);
+			return &this->m_data[it->m_begin];
 		}
 
 		std::vector<EntitySlice> slices(EntFlags prototype)
@@ -1,7 +1,12 @@
 ﻿
 #pragma once
 
+#include <infra/Generic.h>
+
 #include <cstdint>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
 
 namespace mud
 {
@@ -12,6 +17,8 @@ namespace mud
 	{
 		EntFlags m_flags = 0;
 		//EntTags m_tags = 0;
+		// cleared when the entity is deleted, until its handle is reused
+		bool m_alive = true;
 
 		EntityData() {}
 		EntityData(EntFlags flags) : m_flags(flags) {}
@@ -26,4 +33,17 @@ namespace mud
 		size_t m_begin;
 		size_t m_end;
 	};
+
+	template <class T>
+	struct TypedBuffer
+	{};
+
+	template <class... Ts>
+	inline EntFlags TypeFlags()
+	{
+		EntFlags flags = 0;
+		for(size_t index : std::initializer_list<size_t>{ size_t(TypedBuffer<typename std::remove_const<Ts>::type>::index())... })
+			flags |= (1ULL << index);
+		return flags;
+	}
 }
\ No newline at end of file
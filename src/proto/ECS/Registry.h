@@ -1,9 +1,14 @@
 ﻿#pragma once
 
 #include <infra/Vector.h>
+#include <infra/File.h>
+#include <infra/Job.h>
+#include <infra/JobLoop.h>
 #include <proto/Forward.h>
 #include <proto/ECS/ECS.h>
 #include <proto/ECS/ComponentBuffer.h>
+#include <proto/ECS/Commands.h>
+#include <proto/ECS/Snapshot.h>
 
 #include <memory>
 #include <functional>
@@ -19,10 +24,6 @@ namespace mud
 		Dense,
 	};
 
-	template <class T>
-	struct TypedBuffer
-	{};
-
 	class EntityRegistry
 	{
 	public:
@@ -31,9 +32,24 @@ namespace mud
 		std::vector<EntityData> m_entities;
 		std::vector<uint32_t> m_available;
 
+		// current tick, stamped on components when they are added or written
+		uint32_t m_tick = 1;
+
+		// capacity of the buffers sparse indices, grown geometrically with the number of entities
+		size_t m_capacity = 0;
+
+		// one command buffer per thread, played back in order
+		std::vector<EntityCommands> m_commands;
+
+		static const size_t ParallelBatch = 256;
+
+		static const uint32_t SnapshotMagic = 0x5343454d; // MECS
+		static const uint32_t SnapshotVersion = 2;
+
 	public:
 		EntityRegistry(int capacity = 1 << 10)
 			: m_buffers(64)
+			, m_commands(1)
 		{
 			m_entities.reserve(capacity);
 		}
@@ -41,13 +57,16 @@ namespace mud
 		template <class T>
 		auto& buffer()
 		{
-			return static_cast<typename TypedBuffer<T>::type&>(*m_buffers[TypedBuffer<T>::index()]);
+			using Type = typename std::remove_const<T>::type;
+			return static_cast<typename TypedBuffer<Type>::type&>(*m_buffers[TypedBuffer<Type>::index()]);
 		}
 
 		template <class T>
 		void AddBuffer()
 		{
 			m_buffers[TypedBuffer<T>::index()] = std::make_unique<typename TypedBuffer<T>::type>(TypedBuffer<T>::index());
+			if(m_capacity > 0)
+				m_buffers[TypedBuffer<T>::index()]->SetCapacity(m_capacity);
 		}
 		
 		void UpdateSize()
@@ -55,23 +74,84 @@ namespace mud
 			for(auto& buffer : m_buffers)
 				if(buffer)
 				{
-					buffer->SetCapacity(m_entities.size());
+					buffer->SetCapacity(m_capacity);
 				}
 		}
 
+		void Reserve(size_t count)
+		{
+			if(count <= m_capacity)
+				return;
+			m_capacity = std::max(count, m_capacity * 2);
+			m_entities.reserve(m_capacity);
+			UpdateSize();
+		}
+
 		uint32_t CreateEntity(EntTags tags = 0)
 		{
 			UNUSED(tags);
 			if(m_available.size() > 0)
-				return vector_pop(m_available);
+			{
+				uint32_t handle = vector_pop(m_available);
+				m_entities[handle].m_alive = true;
+				return handle;
+			}
 			uint32_t handle = m_entities.size();
 			m_entities.push_back({});
-			UpdateSize();
+			Reserve(m_entities.size());
 			return handle;
 		}
 
+		// creates count entities with default constructed Ts components, growing the buffers once
+		template <class... Ts>
+		std::vector<uint32_t> CreateEntities(size_t count)
+		{
+			std::vector<uint32_t> handles(count);
+
+			const size_t reused = std::min(count, m_available.size());
+			for(size_t i = 0; i < reused; ++i)
+			{
+				handles[i] = vector_pop(m_available);
+				m_entities[handles[i]].m_alive = true;
+			}
+
+			const uint32_t first = uint32_t(m_entities.size());
+			for(size_t i = reused; i < count; ++i)
+				handles[i] = first + uint32_t(i - reused);
+
+			m_entities.resize(m_entities.size() + count - reused);
+			Reserve(m_entities.size());
+
+			swallow{ (this->AddComponents<Ts>(handles), 1)... };
+			this->Touch(TypeFlags<Ts...>());
+			return handles;
+		}
+
+		// removes the components buffer by buffer, and marks each buffer for sorting once
+		void DeleteEntities(array<uint32_t> handles)
+		{
+			EntFlags flags = 0;
+			for(uint32_t handle : handles)
+				flags |= m_entities[handle].m_flags;
+
+			this->Touch(flags);
+			for(auto& buffer : m_buffers)
+				if(buffer && (buffer->m_flag & flags) != 0)
+					buffer->RemoveComponents(handles, m_entities);
+
+			for(uint32_t handle : handles)
+			{
+				EntityData& entity = m_entities[handle];
+				if(!entity.m_alive)
+					continue;
+				entity.m_alive = false;
+				m_available.push_back(handle);
+			}
+		}
+
 		void ClearEntity(uint32_t handle, EntityData& entity)
 		{
+			this->Touch(entity.m_flags);
 			for(auto& buffer : m_buffers)
 				if(buffer)
 					if((buffer->m_flag & entity.m_flags) != 0)
@@ -87,13 +167,119 @@ namespace mud
 			entity.m_flags = 0;
 		}
 
+		bool Alive(uint32_t handle) const
+		{
+			return handle < m_entities.size() && m_entities[handle].m_alive;
+		}
+
+		// deleting an entity twice does nothing : its handle is made available only once
 		void DeleteEntity(uint32_t handle)
 		{
 			EntityData& entity = m_entities[handle];
+			if(!entity.m_alive)
+				return;
 			ClearEntity(handle, entity);
+			entity.m_alive = false;
 			m_available.push_back(handle);
 		}
 
+		// the command buffer of a thread : call ReserveCommands() beforehand when recording from job workers
+		EntityCommands& Commands(uint32_t thread = 0) { return m_commands[thread]; }
+
+		void ReserveCommands(uint32_t threads)
+		{
+			if(m_commands.size() < threads)
+				m_commands.resize(threads);
+		}
+
+		// applies the commands recorded by all threads : the entities are created first, with a single growth of the buffers
+		void Playback()
+		{
+			std::vector<std::vector<uint32_t>> created(m_commands.size());
+			size_t count = 0;
+			for(EntityCommands& commands : m_commands)
+				count += commands.m_num_created;
+
+			if(count > m_available.size())
+				Reserve(m_entities.size() + count - m_available.size());
+
+			for(size_t i = 0; i < m_commands.size(); ++i)
+				for(EntityCommands::Command& command : m_commands[i].m_commands)
+					if(command.m_op == EntityCommands::Op::Create)
+						created[i].push_back(this->CreateEntity());
+
+			for(size_t i = 0; i < m_commands.size(); ++i)
+				this->Playback(m_commands[i], created[i]);
+		}
+
+		// writes the entities and the components as raw blocks, one per array : the snapshot should be taken at a sync point, with no pending commands
+		// buffers of components that can't be snapshot (see ComponentSnapshot) are left out, and restored empty
+		void Snapshot(std::vector<uint8_t>& data)
+		{
+			data.clear();
+			SnapshotWriter writer(data);
+			writer.Write(uint32_t(SnapshotMagic));
+			writer.Write(uint32_t(SnapshotVersion));
+			writer.Write(m_tick);
+			writer.Write(uint32_t(m_entities.size()));
+			writer.Write(uint32_t(m_available.size()));
+			writer.WriteArray(m_entities.data(), m_entities.size());
+			writer.WriteArray(m_available.data(), m_available.size());
+
+			for(uint32_t index = 0; index < m_buffers.size(); ++index)
+				if(m_buffers[index])
+				{
+					// each buffer is prefixed by its size, so that a registry which lacks the buffer can skip it
+					writer.Align();
+					const size_t header = data.size();
+					writer.Write(index);
+					writer.Write(uint64_t(0));
+					if(!m_buffers[index]->Snapshot(writer))
+					{
+						data.resize(header);
+						continue;
+					}
+					const uint64_t size = data.size() - header - sizeof(uint32_t) - sizeof(uint64_t);
+					memcpy(data.data() + header + sizeof(uint32_t), &size, sizeof(uint64_t));
+				}
+			writer.Align();
+		}
+
+		// replaces the whole registry content : the data must be 16 bytes aligned, doesn't need to outlive the call, and can be a mapped file
+		// components whose buffer isn't in the snapshot are removed, and on failure the registry is left empty
+		bool Restore(const uint8_t* data, size_t size)
+		{
+			for(EntityCommands& commands : m_commands)
+				commands.Clear();
+			for(auto& buffer : m_buffers)
+				if(buffer)
+					buffer->m_version++;
+
+			if(!this->RestoreSnapshot(data, size))
+			{
+				for(auto& buffer : m_buffers)
+					if(buffer)
+						buffer->Clear();
+				m_entities.clear();
+				m_available.clear();
+				return false;
+			}
+			return true;
+		}
+
+		bool SaveSnapshot(cstring path)
+		{
+			std::vector<uint8_t> data;
+			this->Snapshot(data);
+			return write_binary_file(path, data.data(), data.size());
+		}
+
+		bool LoadSnapshot(cstring path)
+		{
+			MappedFile file(path);
+			return file.m_data != nullptr && this->Restore(file.m_data, file.m_size);
+		}
+
 		template <class T>
 		T& Deref(T& component) { return component; }
 
@@ -105,7 +291,8 @@ namespace mud
 		{
 			EntityData& entity = m_entities[handle];
 			auto& buffer = this->buffer<T>();
-			buffer.AddComponent(handle, std::move(component), entity);
+			buffer.AddComponent(handle, std::move(component), entity, m_tick);
+			this->Touch(entity.m_flags);
 		}
 
 		template <class T>
@@ -113,13 +300,15 @@ namespace mud
 		{
 			EntityData& entity = m_entities[handle];
 			auto& buffer = this->buffer<T>();
-			buffer.AddComponent(handle, component, entity);
+			buffer.AddComponent(handle, component, entity, m_tick);
+			this->Touch(entity.m_flags);
 		}
 
 		template <class T>
 		void RemoveComponent(uint32_t handle)
 		{
 			EntityData& entity = m_entities[handle];
+			this->Touch(entity.m_flags);
 			auto& buffer = this->buffer<T>();
 			buffer.RemoveComponent(handle, entity);
 		}
@@ -132,226 +321,332 @@ namespace mud
 			return (entity.m_flags & buffer.m_flag) != 0;
 		}
 
+		// read-only access : use WriteComponent() to modify a component, so that change queries see it
 		template <class T>
-		T& GetComponent(uint32_t handle)
+		const T& GetComponent(uint32_t handle)
 		{
 			auto& buffer = this->buffer<T>();
-			int index = buffer.m_indices[handle];
+			const uint32_t index = buffer.m_indices.find(handle);
 			return Deref(buffer.m_data[index]);
 		}
 
-		void SortComponents()
+		// starts a new tick : the added and removed events of the previous one are cleared
+		void Tick()
 		{
+			m_tick++;
 			for(auto& buffer : m_buffers)
 				if(buffer)
-				{
-					buffer->SortComponents(m_entities);
-				}
+					buffer->ClearEvents();
 		}
 
-		template <class T0, class T_Function>
-		void Loop(T_Function action)
+		// mutable access which marks the component as changed at the current tick
+		template <class T>
+		T& WriteComponent(uint32_t handle)
 		{
-			auto& b0 = this->buffer<T0>();
-			size_t last = b0.m_data.size() - 1;
-			auto& handles = b0.m_keys;
-			auto& components = b0.m_data;
-			for(int i = last; i >= 0; i--)
-			{
-				uint32_t handle = handles[i];
-				T0& component0 = Deref(components[i]);
-				action(handle, component0);
-			}
+			auto& buffer = this->buffer<T>();
+			const uint32_t index = buffer.m_indices.find(handle);
+			buffer.Stamp(index, m_tick);
+			return Deref(buffer.m_data[index]);
 		}
 
-		template <class T0, class T1, class T_Function>
-		void Loop(T_Function action)
+		template <class T>
+		void MarkChanged(uint32_t handle)
 		{
-			auto& b0 = this->buffer<T0>();
-			auto& b1 = this->buffer<T1>();
-			size_t last = b0.m_data.size() - 1;
-			auto& handles = b0.m_keys;
-			auto& components = b0.m_data;
-			EntFlags flags = b1.m_flag;
+			auto& buffer = this->buffer<T>();
+			buffer.Stamp(buffer.m_indices.find(handle), m_tick);
+		}
+
+		template <class T>
+		const std::vector<uint32_t>& Added() { return this->buffer<T>().m_added; }
+
+		template <class T>
+		const std::vector<uint32_t>& Removed() { return this->buffer<T>().m_removed; }
+
+		// visits the components written or added after the since tick, skipping the blocks with no such component
+		// a system typically passes the tick at which it last ran
+		// components are stamped by every mutable access : AddComponent(), WriteComponent(), MarkChanged(), and the loops on their non-const
+		// types. loop on const types (e.g. Loop<const Position, Velocity>) to only read a component without marking it as changed
+		template <class T, class T_Function>
+		void LoopChanged(uint32_t since, T_Function action)
+		{
+			auto& buffer = this->buffer<T>();
+			const size_t size = buffer.m_data.size();
+			const size_t block_size = ComponentBufferBase::VersionBlock;
 
-			for(int i = last; i >= 0; i--)
+			for(size_t block = 0; block < buffer.m_block_versions.size(); ++block)
 			{
-				uint32_t handle = handles[i];
-				EntityData& entity = m_entities[handle];
+				if(buffer.m_block_versions[block] <= since)
+					continue;
+
+				const size_t end = std::min(size, (block + 1) * block_size);
+				for(size_t i = block * block_size; i < end; ++i)
+					if(buffer.m_versions[i] > since)
+					{
+						const T& component = Deref(buffer.m_data[i]);
+						action(buffer.m_keys[i], component);
+					}
+			}
+		}
 
-				if((entity.m_flags & flags) == flags)
+		void SortComponents()
+		{
+			for(auto& buffer : m_buffers)
+				if(buffer)
 				{
-					T0& component0 = Deref(components[i]);
-					int index1 = b1.m_indices[handle];
-					T1& component1 = Deref(b1.m_data[index1]);
-					action(handle, component0, component1);
+					buffer->SortComponents(m_entities);
+					buffer->m_sorted = buffer->m_version;
 				}
-			}
 		}
 
+		// sorts only the given buffers, if entity signatures changed since they were last sorted
+		template <class... Ts>
+		void SortBuffers()
+		{
+			swallow{ (this->SortBuffer(this->buffer<Ts>()), 1)... };
+		}
 
-		template <class T0, class T1, class T2, class T_Function>
+		// loops walk the buffers sorted by entity signature : only the slices containing all the requested components are visited,
+		// and since every buffer has the same slices in the same order, the components of each entity line up by index
+		// the action must not add or remove entities or components while the loop runs : it can record them in Commands()
+		// the components of the non-const types are stamped as changed at the current tick
+		template <class... Ts, class T_Function>
 		void Loop(T_Function action)
 		{
-			auto& b0 = this->buffer<T0>();
-			auto& b1 = this->buffer<T1>();
-			auto& b2 = this->buffer<T2>();
-			size_t last = b0.m_data.size() - 1;
-			auto& handles = b0.m_keys;
-			auto& components = b0.m_data;
-			EntFlags flags = b1.m_flag | b2.m_flag;
+			this->SortBuffers<Ts...>();
+			this->LoopSlices(action, TypeFlags<Ts...>(), this->buffer<Ts>()...);
+			swallow{ (this->StampSlices<Ts>(TypeFlags<Ts...>()), 1)... };
+		}
+
+		// parallel loops walk the same slices as the serial ones, split in ranges processed by the job system workers
+		// the action must not add or remove entities or components while the loop runs : it can record them in Commands(js.thread())
+		template <class... Ts, class T_Function>
+		void ParallelLoop(JobSystem& js, T_Function action)
+		{
+			this->SortBuffers<Ts...>();
+			this->ReserveCommands(js.threads());
+			this->ParallelSlices(js, action, TypeFlags<Ts...>(), this->buffer<Ts>()...);
+			swallow{ (this->StampSlices<Ts>(TypeFlags<Ts...>()), 1)... };
+		}
+
+		// the action receives the scratch of the worker running it as first argument : scratch is resized to one element per worker,
+		// so that systems can accumulate results without atomics and reduce them after the loop
+		template <class... Ts, class T_Scratch, class T_Function>
+		void ParallelLoop(JobSystem& js, std::vector<T_Scratch>& scratch, T_Function action)
+		{
+			scratch.resize(js.threads());
 
-			for(int i = last; i >= 0; i--)
+			auto loop = [&](uint32_t handle, auto&... components)
 			{
-				uint32_t handle = handles[i];;
-				EntityData& entity = m_entities[handle];
+				action(scratch[js.thread()], handle, components...);
+			};
 
-				if((entity.m_flags & flags) == flags)
-				{
-					T0& component0 = Deref(components[i]);
-					int index1 = b1.m_indices[handle];
-					T1& component1 = Deref(b1.m_data[index1]);
-					int index2 = b2.m_indices[handle];
-					T2& component2 = Deref(b2.m_data[index2]);
-					action(handle, component0, component1, component2);
-				}
-			}
+			this->ParallelLoop<Ts...>(js, loop);
 		}
 
-		template <class T0, class T1, class T2, class T3, class T_Function>
-		void Loop(T_Function action)
+	private:
+		template <class T>
+		void AddComponents(const std::vector<uint32_t>& handles)
 		{
-			auto& b0 = this->buffer<T0>();
-			auto& b1 = this->buffer<T1>();
-			auto& b2 = this->buffer<T2>();
-			auto& b3 = this->buffer<T3>();
-			size_t last = b0.m_data.size() - 1;
-			auto& handles = b0.m_keys;
-			auto& components = b0.m_data;
+			auto& buffer = this->buffer<T>();
+			buffer.Reserve(buffer.m_data.size() + handles.size());
+			for(uint32_t handle : handles)
+				buffer.AddComponent(handle, T(), m_entities[handle], m_tick);
+		}
 
-			EntFlags flags = b1.m_flag | b2.m_flag | b3.m_flag;
+		void Playback(EntityCommands& commands, const std::vector<uint32_t>& created)
+		{
+			auto resolve = [&](uint32_t handle)
+			{
+				return (handle & EntityCommands::PendingBit) ? created[handle & ~EntityCommands::PendingBit] : handle;
+			};
 
-			for(int i = last; i >= 0; i--)
+			for(EntityCommands::Command& command : commands.m_commands)
 			{
-				uint32_t handle = handles[i];
-				EntityData& entity = m_entities[handle];
+				if(command.m_op == EntityCommands::Op::Create)
+					continue;
 
-				if((entity.m_flags & flags) == flags)
+				// the entity might have been deleted by an earlier command, of this buffer or of another one
+				const uint32_t handle = resolve(command.m_handle);
+				if(!this->Alive(handle))
 				{
-					T0& component0 = Deref(components[i]);
-					int index1 = b1.m_indices[handle];
-					T1& component1 = Deref(b1.m_data[index1]);
-					int index2 = b2.m_indices[handle];
-					T2& component2 = Deref(b2.m_data[index2]);
-					int index3 = b3.m_indices[handle];
-					T3& component3 = Deref(b3.m_data[index3]);
-					action(handle, component0, component1, component2, component3);
+					if(command.m_data)
+						command.m_func(nullptr, handle, command.m_data);
+					continue;
 				}
+
+				if(command.m_op == EntityCommands::Op::Delete)
+					this->DeleteEntity(handle);
+				else if(command.m_op == EntityCommands::Op::Component)
+					command.m_func(this, handle, command.m_data);
 			}
+
+			commands.Reset();
 		}
 
-		template <class T0, class T_Function>
-		void LoopFast(T_Function action)
+		bool RestoreSnapshot(const uint8_t* data, size_t size)
 		{
-			EntFlags prototype = (1ULL << TypedBuffer<T0>::index());
-			auto& buffer0 = this->buffer<T0>();
-			auto slices0 = buffer0.slices(prototype);
-
-			for(size_t slice = 0; slice < slices0.size(); ++slice)
+			SnapshotReader reader(data, size);
+			uint32_t magic = 0, version = 0, num_entities = 0, num_available = 0;
+			if(!reader.Read(magic) || magic != SnapshotMagic || !reader.Read(version) || version != SnapshotVersion)
+				return false;
+			if(!reader.Read(m_tick) || !reader.Read(num_entities) || !reader.Read(num_available))
+				return false;
+			if(!reader.ReadVector(m_entities, num_entities) || !reader.ReadVector(m_available, num_available))
+				return false;
+
+			this->Reserve(m_entities.size());
+
+			EntFlags restored = 0;
+			while(true)
 			{
-				const EntitySlice slice0 = slices0[slice];
-				for(size_t i = 0; i < slice0.m_end - slice0.m_begin; ++i)
-				{
-					uint32_t handle = 0;
-					T0& component0 = Deref(buffer0.m_data[slice0.m_begin + i]);
-					action(handle, component0);
-				}
+				reader.Align();
+				if(!reader.m_valid)
+					return false;
+				if(reader.m_cursor == reader.m_end)
+					break;
+
+				uint32_t index = 0;
+				uint64_t buffer_size = 0;
+				if(!reader.Read(index) || !reader.Read(buffer_size) || index >= m_buffers.size())
+					return false;
+
+				const uint8_t* buffer_data = reader.Skip(size_t(buffer_size));
+				if(!buffer_data)
+					return false;
+				if(!m_buffers[index])
+					continue;
+
+				// offsets in the buffer block are relative to the snapshot start : the reader covers the snapshot up to the block end
+				SnapshotReader buffer_reader(reader.m_begin, size_t(reader.m_cursor - reader.m_begin));
+				buffer_reader.m_cursor = buffer_data;
+				if(!m_buffers[index]->Restore(buffer_reader))
+					return false;
+				restored |= m_buffers[index]->m_flag;
 			}
+
+			for(auto& buffer : m_buffers)
+				if(buffer && (buffer->m_flag & restored) == 0)
+					buffer->Clear();
+			for(EntityData& entity : m_entities)
+				entity.m_flags &= restored;
+			return true;
 		}
 
-		template <class T0, class T1, class T_Function>
-		void LoopFast(T_Function action)
+		template <class T>
+		void StampSlices(EntFlags prototype)
 		{
-			EntFlags prototype = (1ULL << TypedBuffer<T0>::index()) | (1ULL << TypedBuffer<T1>::index());
-			auto& buffer0 = this->buffer<T0>();
-			auto& buffer1 = this->buffer<T1>();
-			auto slices0 = buffer0.slices(prototype);
-			auto slices1 = buffer1.slices(prototype);
+			this->StampSlices<T>(prototype, std::integral_constant<bool, !std::is_const<T>::value>());
+		}
 
-			for(size_t slice = 0; slice < slices0.size(); ++slice)
-			{
-				const EntitySlice slice0 = slices0[slice];
-				const EntitySlice slice1 = slices1[slice];
-				for(size_t i = 0; i < slice0.m_end - slice0.m_begin; ++i)
-				{
-					uint32_t handle = 0;
-					T0& component0 = Deref(buffer0.m_data[slice0.m_begin + i]);
-					T1& component1 = Deref(buffer1.m_data[slice1.m_begin + i]);
-					action(handle, component0, component1);
-				}
-			}
+		template <class T>
+		void StampSlices(EntFlags prototype, std::true_type)
+		{
+			auto& buffer = this->buffer<T>();
+			for(const EntitySlice& slice : buffer.m_slices)
+				if((slice.m_prototype & prototype) == prototype)
+					buffer.StampRange(slice.m_begin, slice.m_end, m_tick);
 		}
 
+		template <class T>
+		void StampSlices(EntFlags prototype, std::false_type) { UNUSED(prototype); }
 
-		template <class T0, class T1, class T2, class T_Function>
-		void LoopFast(T_Function action)
+		// the signature of entities having these flags changed : the slices of their buffers are stale
+		void Touch(EntFlags flags)
 		{
-			EntFlags prototype = (1ULL << TypedBuffer<T0>::index()) | (1ULL << TypedBuffer<T1>::index()) | (1ULL << TypedBuffer<T2>::index());
-			auto& buffer0 = this->buffer<T0>();
-			auto& buffer1 = this->buffer<T1>();
-			auto& buffer2 = this->buffer<T2>();
-			auto slices0 = buffer0.slices(prototype);
-			auto slices1 = buffer1.slices(prototype);
-			auto slices2 = buffer2.slices(prototype);
+			for(size_t index = 0; flags != 0; ++index, flags >>= 1)
+				if((flags & 1) != 0 && m_buffers[index])
+					m_buffers[index]->m_version++;
+		}
 
-			for(size_t slice = 0; slice < slices0.size(); ++slice)
+		void SortBuffer(ComponentBufferBase& buffer)
+		{
+			if(buffer.m_sorted != buffer.m_version)
 			{
-				const EntitySlice slice0 = slices0[slice];
-				const EntitySlice slice1 = slices1[slice];
-				const EntitySlice slice2 = slices2[slice];
-				for(size_t i = 0; i < slice0.m_end - slice0.m_begin; ++i)
+				buffer.SortComponents(m_entities);
+				buffer.m_sorted = buffer.m_version;
+			}
+		}
+
+		template <class T_Function, class T_Buffer0, class... T_Buffers>
+		void LoopSlices(T_Function& action, EntFlags prototype, T_Buffer0& buffer0, T_Buffers&... buffers)
+		{
+			for(const EntitySlice& slice : buffer0.m_slices)
+				if((slice.m_prototype & prototype) == prototype)
 				{
-					uint32_t handle = 0;
-					T0& component0 = Deref(buffer0.m_data[slice0.m_begin + i]);
-					T1& component1 = Deref(buffer1.m_data[slice1.m_begin + i]);
-					T2& component2 = Deref(buffer2.m_data[slice2.m_begin + i]);
-					action(handle, component0, component1, component2);
+					const size_t count = slice.m_end - slice.m_begin;
+					LoopSlice(action, count, &buffer0.m_keys[slice.m_begin], &buffer0.m_data[slice.m_begin], buffers.SliceData(slice.m_prototype)...);
 				}
-			}
 		}
 
-		template <class T0, class T1, class T2, class T3, class T_Function>
-		void LoopFast(T_Function action)
+		template <class T_Function, class... T_Data>
+		void LoopSlice(T_Function& action, size_t count, const uint32_t* handles, T_Data*... data)
+		{
+			for(size_t i = 0; i < count; ++i)
+				action(handles[i], Deref(data[i])...);
+		}
+
+		// the matching slices are laid end to end, and that range is split across jobs : a job range can span several slices
+		template <class T_Function, class T_Buffer0, class... T_Buffers>
+		void ParallelSlices(JobSystem& js, T_Function& action, EntFlags prototype, T_Buffer0& buffer0, T_Buffers&... buffers)
 		{
-			EntFlags prototype = (1ULL << TypedBuffer<T0>::index()) | (1ULL << TypedBuffer<T1>::index()) | (1ULL << TypedBuffer<T2>::index()) | (1ULL << TypedBuffer<T3>::index());
-			auto& buffer0 = this->buffer<T0>();
-			auto& buffer1 = this->buffer<T1>();
-			auto& buffer2 = this->buffer<T2>();
-			auto& buffer3 = this->buffer<T3>();
-			auto slices0 = buffer0.slices(prototype);
-			auto slices1 = buffer1.slices(prototype);
-			auto slices2 = buffer2.slices(prototype);
-			auto slices3 = buffer3.slices(prototype);
+			std::vector<const EntitySlice*> slices;
+			std::vector<size_t> offsets;
+			size_t total = 0;
+			for(const EntitySlice& slice : buffer0.m_slices)
+				if((slice.m_prototype & prototype) == prototype)
+				{
+					slices.push_back(&slice);
+					offsets.push_back(total);
+					total += slice.m_end - slice.m_begin;
+				}
 
-			for(size_t slice = 0; slice < slices0.size(); ++slice)
+			if(total == 0)
+				return;
+
+			auto range = [&](size_t start, size_t end)
 			{
-				const EntitySlice slice0 = slices0[slice];
-				const EntitySlice slice1 = slices1[slice];
-				const EntitySlice slice2 = slices2[slice];
-				const EntitySlice slice3 = slices3[slice];
-				for(size_t i = 0; i < slice0.m_end - slice0.m_begin; ++i)
+				size_t index = size_t(std::upper_bound(offsets.begin(), offsets.end(), start) - offsets.begin()) - 1;
+				for(; index < slices.size() && offsets[index] < end; ++index)
 				{
-					uint32_t handle = 0;
-					T0& component0 = Deref(buffer0.m_data[slice0.m_begin + i]);
-					T1& component1 = Deref(buffer1.m_data[slice1.m_begin + i]);
-					T2& component2 = Deref(buffer2.m_data[slice2.m_begin + i]);
-					T3& component3 = Deref(buffer3.m_data[slice3.m_begin + i]);
-					action(handle, component0, component1, component2, component3);
+					const EntitySlice& slice = *slices[index];
+					const size_t first = std::max(start, offsets[index]) - offsets[index];
+					const size_t last = std::min(end, offsets[index] + slice.m_end - slice.m_begin) - offsets[index];
+					const size_t begin = slice.m_begin + first;
+					LoopSlice(action, last - first, &buffer0.m_keys[begin], &buffer0.m_data[begin], (buffers.SliceData(slice.m_prototype) + first)...);
 				}
-			}
+			};
+
+			// the job functor only holds a reference to the range, to fit in the job padding
+			auto loop = [&range](JobSystem& js, Job* job, size_t start, size_t count)
+			{
+				UNUSED(js); UNUSED(job);
+				range(start, start + count);
+			};
+
+			// at most 2^8 ranges, so that large buffers don't exhaust the job pool
+			Job* job = jobs(js, nullptr, 0, uint32_t(total), loop, CountSplitter<ParallelBatch, 8>());
+			js.complete(job);
 		}
 	};
 
+	template <class T>
+	void AddCommand(EntityRegistry* registry, uint32_t handle, void* data)
+	{
+		T& component = *static_cast<T*>(data);
+		if(registry)
+			registry->AddComponent<T>(handle, std::move(component));
+		component.~T();
+	}
+
+	template <class T>
+	void RemoveCommand(EntityRegistry* registry, uint32_t handle, void* data)
+	{
+		UNUSED(data);
+		// the component might have been removed by an earlier command
+		if(registry && registry->HasComponent<T>(handle))
+			registry->RemoveComponent<T>(handle);
+	}
+
 	export_ extern MUD_PROTO_EXPORT EntityRegistry s_registry;
 
 	struct MUD_PROTO_EXPORT Entity
@@ -366,7 +661,7 @@ namespace mud
 	inline bool is(Entity& entity) { return s_registry.HasComponent<T>(entity.m_handle); }
 
 	export_ template <class T>
-	inline T& as(Entity& entity) { return s_registry.GetComponent<T>(entity.m_handle); }
+	inline T& as(Entity& entity) { return s_registry.WriteComponent<T>(entity.m_handle); }
 
 	export_ template <class T>
 	inline T* try_as(Entity& entity) { if(is<T>(entity)) return &as<T>(entity); else return nullptr; }
@@ -382,7 +677,7 @@ namespace mud
 
 		explicit operator bool() const { return m_handle != UINT32_MAX; }
 
-		operator T&() { return s_registry.GetComponent<T>(m_handle); }
+		operator T&() { return s_registry.WriteComponent<T>(m_handle); }
 		operator const T&() const { return s_registry.GetComponent<T>(m_handle); }
 		T* operator->() { return &((T&)*this); }
 		T& operator*() { return *this; }
@@ -407,7 +702,7 @@ namespace mud
 
 		operator ComponentHandle<T>() const { return { m_handle }; }
 
-		operator T&() { return s_registry.GetComponent<T>(m_handle); }
+		operator T&() { return s_registry.WriteComponent<T>(m_handle); }
 		operator const T&() const { return s_registry.GetComponent<T>(m_handle); }
 		T* operator->() { return &((T&)*this); }
 		T& operator*() { return *this; }
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <proto/ECS/ECS.h>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace mud
+{
+	// appends raw values to a byte buffer : arrays start on a 16 bytes boundary, so that they can be read in place from a mapped file
+	class SnapshotWriter
+	{
+	public:
+		static const size_t Alignment = 16;
+
+		SnapshotWriter(std::vector<uint8_t>& data) : m_data(data) {}
+
+		std::vector<uint8_t>& m_data;
+
+		void Align()
+		{
+			m_data.resize((m_data.size() + Alignment - 1) & ~(Alignment - 1), 0);
+		}
+
+		void Write(const void* data, size_t size)
+		{
+			const size_t offset = m_data.size();
+			m_data.resize(offset + size);
+			if(size > 0)
+				memcpy(m_data.data() + offset, data, size);
+		}
+
+		template <class T>
+		void Write(const T& value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values can be written raw");
+			this->Write(&value, sizeof(T));
+		}
+
+		template <class T>
+		void WriteArray(const T* values, size_t count)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values can be written raw");
+			this->Align();
+			this->Write(values, count * sizeof(T));
+		}
+	};
+
+	// reads back what a SnapshotWriter wrote, from memory it doesn't own : every read is bounds checked, and fails the reader
+	class SnapshotReader
+	{
+	public:
+		SnapshotReader(const uint8_t* data, size_t size) : m_begin(data), m_cursor(data), m_end(data + size) {}
+
+		const uint8_t* m_begin;
+		const uint8_t* m_cursor;
+		const uint8_t* m_end;
+		bool m_valid = true;
+
+		void Align()
+		{
+			const size_t offset = size_t(m_cursor - m_begin);
+			this->Skip(((offset + SnapshotWriter::Alignment - 1) & ~(SnapshotWriter::Alignment - 1)) - offset);
+		}
+
+		// returns the skipped bytes, or null if there are not enough left
+		const uint8_t* Skip(size_t size)
+		{
+			if(!m_valid || size > size_t(m_end - m_cursor))
+			{
+				m_valid = false;
+				return nullptr;
+			}
+			const uint8_t* data = m_cursor;
+			m_cursor += size;
+			return data;
+		}
+
+		template <class T>
+		bool Read(T& value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values can be read raw");
+			const uint8_t* data = this->Skip(sizeof(T));
+			if(data)
+				memcpy(&value, data, sizeof(T));
+			return data != nullptr;
+		}
+
+		// the array is not copied : the pointer is into the snapshot memory, aligned if the snapshot memory is
+		template <class T>
+		const T* ReadArray(size_t count)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values can be read raw");
+			this->Align();
+			if(m_valid && count > size_t(m_end - m_cursor) / sizeof(T))
+				m_valid = false;
+			return reinterpret_cast<const T*>(this->Skip(count * sizeof(T)));
+		}
+
+		template <class T>
+		bool ReadVector(std::vector<T>& values, size_t count)
+		{
+			const T* data = this->ReadArray<T>(count);
+			if(!data)
+				return false;
+			values.assign(data, data + count);
+			return true;
+		}
+	};
+
+	// how a component column is written to and read from a snapshot : trivially copyable components are copied as one raw block
+	// other components are left out of snapshots, unless this is specialized with Enabled set and both functions implemented
+	template <class T>
+	struct ComponentSnapshot
+	{
+		static const bool Enabled = std::is_trivially_copyable<T>::value && !std::is_pointer<T>::value;
+
+		static void Write(SnapshotWriter& writer, const std::vector<T>& components)
+		{
+			writer.WriteArray(components.data(), components.size());
+		}
+
+		static bool Read(SnapshotReader& reader, std::vector<T>& components, size_t count)
+		{
+			return reader.ReadVector(components, count);
+		}
+	};
+}
@@ -4,24 +4,69 @@
 
 #include <vector>
 #include <algorithm>
-#include <unordered_map>
+#include <memory>
 
 namespace mud
 {
+	// indices in 4 KiB pages, allocated when a key in their range is first assigned
+	// pages with no key all point to a single shared page filled with UINT32_MAX
 	template <bool dense = false>
 	class SparseIndices
 	{
 	public:
-		SparseIndices(size_t capacity = 1 << 10) : m_indices(4) { UNUSED(capacity); }
+		static const size_t PageSize = 1024;
 
-		void erase(uint32_t handle) { m_indices.erase(handle); }
+		SparseIndices(size_t capacity = 1 << 10) { this->ensure(capacity); }
 
-		void ensure(size_t capacity) { UNUSED(capacity); }
+		void erase(uint32_t handle)
+		{
+			uint32_t* page = m_pages[handle / PageSize];
+			if(page != null_page())
+				page[handle % PageSize] = UINT32_MAX;
+		}
 
-		uint32_t& operator[](uint32_t at) { return m_indices[at]; }
+		void ensure(size_t capacity)
+		{
+			const size_t pages = (capacity + PageSize - 1) / PageSize;
+			if(pages > m_pages.size())
+				m_pages.resize(pages, null_page());
+		}
+
+		// allocates the page of the key : only used to assign indices, lookups go through find()
+		uint32_t& operator[](uint32_t at)
+		{
+			this->ensure(at + 1);
+			uint32_t*& page = m_pages[at / PageSize];
+			if(page == null_page())
+				page = this->allocate();
+			return page[at % PageSize];
+		}
+
+		uint32_t find(uint32_t at) const
+		{
+			const size_t page = at / PageSize;
+			return page < m_pages.size() ? m_pages[page][at % PageSize] : UINT32_MAX;
+		}
 
 	private:
-		std::unordered_map<uint32_t, uint32_t> m_indices;
+		uint32_t* allocate()
+		{
+			m_storage.emplace_back(new uint32_t[PageSize]);
+			uint32_t* page = m_storage.back().get();
+			std::fill(page, page + PageSize, UINT32_MAX);
+			return page;
+		}
+
+		// never written to : operator[] swaps it for an allocated page first
+		static uint32_t* null_page()
+		{
+			struct NullPage { NullPage() { std::fill(m_indices, m_indices + PageSize, UINT32_MAX); } uint32_t m_indices[PageSize]; };
+			static NullPage page;
+			return page.m_indices;
+		}
+
+		std::vector<uint32_t*> m_pages;
+		std::vector<std::unique_ptr<uint32_t[]>> m_storage;
 	};
 
 	template <>
@@ -36,6 +81,8 @@ namespace mud
 
 		uint32_t& operator[](uint32_t at) { return m_indices[at]; }
 
+		uint32_t find(uint32_t at) const { return at < m_indices.size() ? m_indices[at] : UINT32_MAX; }
+
 	private:
 		std::vector<uint32_t> m_indices;
 	};
@@ -61,6 +108,12 @@ namespace mud
 			m_indices.ensure(capacity);
 		}
 
+		void Reserve(size_t size)
+		{
+			m_data.reserve(size);
+			m_keys.reserve(size);
+		}
+
 		void AddKey(uint32_t key, TData data)
 		{
 			const uint32_t index = m_data.size();
@@ -71,21 +124,21 @@ namespace mud
 
 		void RemoveKey(uint32_t key)
 		{
-			const uint32_t index = m_indices[key];
+			const uint32_t index = m_indices.find(key);
 
 			std::swap(m_data[index], m_data.back());
 			std::swap(m_keys[index], m_keys.back());
 			m_data.pop_back();
 			m_keys.pop_back();
 
-			const uint32_t moved = m_keys[index];
-			m_indices[moved] = index;
 			m_indices.erase(key);
+			if(index < m_keys.size())
+				m_indices[m_keys[index]] = index;
 		}
 
 		TData& At(uint32_t key)
 		{
-			return m_data[m_indices[key]];
+			return m_data[m_indices.find(key)];
 		}
 
 		void Swap(size_t first, size_t second)
@@ -96,7 +149,7 @@ namespace mud
 
 		void Move(uint32_t from, uint32_t to)
 		{
-			uint32_t replaced = m_indices[from];
+			uint32_t replaced = m_indices.find(from);
 			m_indices.erase(from);
 			m_indices[to] = replaced;
 			m_keys[replaced] = to;
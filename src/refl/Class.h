@@ -7,6 +7,7 @@
 #include <refl/Forward.h>
 #include <obj/Var.h>
 #include <infra/Strung.h>
+#include <infra/NameTable.h>
 #include <refl/Method.h>
 #include <refl/Member.h>
 
@@ -111,12 +112,21 @@ namespace mud
 
 		bool m_is_sequence = false;
 		bool m_is_iterable = false;
+
+	private:
+		// built once the members are final, in setup_class, or on the first lookup for classes which are never setup
+		void index_names();
+
+		bool m_indexed = false;
+		NameTable m_member_names;
+		NameTable m_method_names;
+		NameTable m_static_names;
 	};
 
 	inline Ref Member::cast(Ref object) const
 	{
 		Ref target = object;
-		if(object.m_type != m_object_type && g_class[type(object).m_id])
+		if(object.m_type != m_object_type && has_class(type(object)))
 			target = mud::cls(object).upcast(object, *m_object_type);
 		return target;
 	}
@@ -138,7 +148,7 @@ namespace mud
 		this->set(cast(object), value);
 	}
 
-	export_ inline bool is_root_type(Type& ty) { return !g_class[ty.m_id] || cls(ty).m_root == &ty; }
+	export_ inline bool is_root_type(Type& ty) { return !has_class(ty) || cls(ty).m_root == &ty; }
 
 	export_ template <class T>
 	T& upcast(Ref value) { Ref base = cls(value).upcast(value, type<T>()); return val<T>(base); }
@@ -20,7 +20,7 @@ namespace mud
 		, m_value(value)
 	{}
 
-	Member::Member(Type& object_type, Address address, Type& type, cstring name, Var default_value, Flags flags, MemberGet get)
+	Member::Member(Type& object_type, Address address, Type& type, cstring name, Var default_value, Flags flags, MemberGet get, MemberGetValue get_value, MemberSetValue set_value)
 		: m_index(0)
 		, m_object_type(&object_type)
 		, m_address(address)
@@ -29,6 +29,8 @@ namespace mud
 		, m_default_value(default_value)
 		, m_flags(flags)
 		, m_get(get)
+		, m_get_value(get_value)
+		, m_set_value(set_value)
 	{
 		m_offset = *reinterpret_cast<size_t*>(m_address.value);
 	}
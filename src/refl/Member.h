@@ -18,6 +18,8 @@
 namespace mud
 {
 	using MemberGet = Ref(*)(Ref);
+	using MemberGetValue = Var(*)(Ref);
+	using MemberSetValue = void(*)(Ref, Ref);
 
 	export_ class refl_ MUD_REFL_EXPORT Static
 	{
@@ -45,7 +47,7 @@ namespace mud
 		};
 
 	public:
-		Member(Type& object_type, Address address, Type& type, cstring name, Var default_value, Flags flags = Flags::None, MemberGet get = nullptr);
+		Member(Type& object_type, Address address, Type& type, cstring name, Var default_value, Flags flags = Flags::None, MemberGet get = nullptr, MemberGetValue get_value = nullptr, MemberSetValue set_value = nullptr);
 		~Member();
 
 		int m_index;
@@ -58,6 +60,10 @@ namespace mud
 		Flags m_flags;
 		MemberGet m_get;
 
+		// typed accessors generated for value fields, which skip the generic Var copy and assign
+		MemberGetValue m_get_value;
+		MemberSetValue m_set_value;
+
 		Meta& meta() { return mud::meta(*m_type); }
 		Class& cls() { return mud::cls(*m_type); }
 
@@ -82,6 +88,8 @@ namespace mud
 
 		inline Var get_value(Ref object) const
 		{
+			if(m_get_value)
+				return m_get_value(object);
 			Var result = m_default_value;
 			result.copy(this->get(object));
 			return result;
@@ -89,6 +97,8 @@ namespace mud
 
 		inline void set(Ref object, Ref value) const
 		{
+			if(m_set_value && value.m_type == m_type)
+				return m_set_value(object, value);
 			Ref ref = this->ref(object);
 			if(this->is_pointer())
 				*(void**)ref.m_value = value.m_value;
@@ -3,6 +3,10 @@
 //  This notice and the license may not be removed or altered from any source distribution.
 
 #include <infra/Cpp20.h>
+#ifndef MUD_CPP_20
+#include <atomic>
+#include <mutex>
+#endif
 
 #ifdef MUD_MODULES
 module mud.refl;
@@ -28,6 +32,32 @@ namespace mud
 	std::vector<Class*> g_class = std::vector<Class*>(c_max_types);
 	std::vector<Enum*> g_enu = std::vector<Enum*>(c_max_types);
 	std::vector<Convert*> g_convert = std::vector<Convert*>(c_max_types);
+	std::vector<ClassInit> g_class_init = std::vector<ClassInit>(c_max_types);
+	std::vector<std::atomic<Class*>> g_class_built = std::vector<std::atomic<Class*>>(c_max_types);
+
+	Class& build_class(Type& type, ClassInit init)
+	{
+		// building a class builds the classes of its bases and components, hence the recursive lock
+		static std::recursive_mutex lock;
+		static std::vector<bool> building(c_max_types);
+		std::lock_guard<std::recursive_mutex> guard(lock);
+
+		if(!init && !g_class[type.m_id])
+			init = g_class_init[type.m_id];
+
+		// while it is set up, the class is only found in g_class, by the thread building it
+		if(init)
+		{
+			building[type.m_id] = true;
+			init();
+			building[type.m_id] = false;
+		}
+
+		// classes constructed directly, like script classes, have nothing to set up
+		if(!building[type.m_id])
+			g_class_built[type.m_id].store(g_class[type.m_id], std::memory_order_release);
+		return *g_class[type.m_id];
+	}
 
 	template <>
 	void init_string<void>() {}
@@ -129,7 +159,7 @@ namespace mud
 	void Class::inherit(std::vector<Type*> types)
 	{
 		for(Type* type : types)
-			if(g_class[type->m_id])
+			if(has_class(*type))
 			{
 				vector_prepend(m_members, cls(*type).m_members);
 				vector_prepend(m_methods, cls(*type).m_methods);
@@ -165,7 +195,7 @@ namespace mud
 		}
 
 		for(Member* component : m_components)
-			if(g_class[component->m_type->m_id])
+			if(has_class(*component->m_type))
 			{
 				Class& c = cls(*component->m_type);
 				for(Member& member : c.m_members)
@@ -173,6 +203,28 @@ namespace mud
 				for(Method& method : c.m_methods)
 					m_deep_methods.push_back(&method);
 			}
+
+		this->index_names();
+	}
+
+	void Class::index_names()
+	{
+		m_member_names.clear();
+		m_member_names.reserve(m_members.size());
+		for(size_t i = 0; i < m_members.size(); ++i)
+			m_member_names.insert(m_members[i].m_name, uint32_t(i));
+
+		m_method_names.clear();
+		m_method_names.reserve(m_methods.size());
+		for(size_t i = 0; i < m_methods.size(); ++i)
+			m_method_names.insert(m_methods[i].m_name, uint32_t(i));
+
+		m_static_names.clear();
+		m_static_names.reserve(m_static_members.size());
+		for(size_t i = 0; i < m_static_members.size(); ++i)
+			m_static_names.insert(m_static_members[i].m_name, uint32_t(i));
+
+		m_indexed = true;
 	}
 
 	Ref Class::upcast(Ref object, Type& base)
@@ -200,26 +252,23 @@ namespace mud
 
 	Member& Class::member(cstring name)
 	{
-		for(Member& member : m_members)
-			if(strcmp(member.m_name, name) == 0)
-				return member;
-		return m_members[0];
+		if(!m_indexed) this->index_names();
+		const uint32_t index = m_member_names.find(name);
+		return m_members[index != NameTable::NotFound ? index : 0];
 	}
 
 	Method& Class::method(cstring name)
 	{
-		for(Method& method : m_methods)
-			if(strcmp(method.m_name, name) == 0)
-				return method;
-		return m_methods[0];
+		if(!m_indexed) this->index_names();
+		const uint32_t index = m_method_names.find(name);
+		return m_methods[index != NameTable::NotFound ? index : 0];
 	}
 
 	Static& Class::static_member(cstring name)
 	{
-		for(Static& member : m_static_members)
-			if(strcmp(member.m_name, name) == 0)
-				return member;
-		return m_static_members[0];
+		if(!m_indexed) this->index_names();
+		const uint32_t index = m_static_names.find(name);
+		return m_static_members[index != NameTable::NotFound ? index : 0];
 	}
 
 	Operator& Class::op(cstring name)
@@ -232,12 +281,14 @@ namespace mud
 
 	bool Class::has_member(cstring name)
 	{
-		return vector_has_pred(m_members, [&](const Member& member) { return strcmp(member.m_name, name) == 0; });
+		if(!m_indexed) this->index_names();
+		return m_member_names.find(name) != NameTable::NotFound;
 	}
 
 	bool Class::has_method(cstring name)
 	{
-		return vector_has_pred(m_methods, [&](const Method& method) { return strcmp(method.m_name, name) == 0; });
+		if(!m_indexed) this->index_names();
+		return m_method_names.find(name) != NameTable::NotFound;
 	}
 
 	Member& Class::member(Address address)
@@ -409,7 +460,7 @@ namespace mud
 			dest = source;
 		else if(type(value).is(output))
 			assign(source, dest, ref);
-		else if(g_class[type(source).m_id] && cls(source).is(output))
+		else if(has_class(type(source)) && cls(source).is(output))
 			dest = cls(source).as(source.m_ref, output);
 		else if(TypeConverter::me().check(value, output))
 			TypeConverter::me().convert(value, output, dest);
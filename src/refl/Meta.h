@@ -9,6 +9,7 @@
 #include <obj/Type.h>
 
 #ifndef MUD_CPP_20
+#include <atomic>
 #include <vector>
 #include <functional>
 #endif
@@ -64,8 +65,20 @@ namespace mud
 	export_ extern MUD_REFL_EXPORT std::vector<Enum*> g_enu;
 	export_ extern MUD_REFL_EXPORT std::vector<Convert*> g_convert;
 
+	// builds the Class of a type, registered with lazy_class : classes are only built the first time they're needed
+	export_ using ClassInit = void(*)();
+	export_ extern MUD_REFL_EXPORT std::vector<ClassInit> g_class_init;
+
+	// g_class holds the classes as soon as they are constructed, to be found while they are set up
+	// they are published in g_class_built only once set up, so that other threads never see a class half built
+	export_ extern MUD_REFL_EXPORT std::vector<std::atomic<Class*>> g_class_built;
+
+	// runs init, or the lazy init of the type when there is none, and publishes the class
+	export_ MUD_REFL_EXPORT Class& build_class(Type& type, ClassInit init = nullptr);
+
 	export_ inline Meta& meta(Type& type) { return *g_meta[type.m_id]; }
-	export_ inline Class& cls(Type& type) { return *g_class[type.m_id]; }
+	export_ inline Class& cls(Type& type) { Class* c = g_class_built[type.m_id].load(std::memory_order_acquire); return c ? *c : build_class(type); }
+	export_ inline bool has_class(Type& type) { return g_class_init[type.m_id] != nullptr || g_class[type.m_id] != nullptr; }
 	export_ inline Enum& enu(Type& type) { return *g_enu[type.m_id]; }
 	export_ inline Convert& convert(Type& type) { return *g_convert[type.m_id]; }
 
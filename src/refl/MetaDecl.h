@@ -31,6 +31,15 @@ namespace mud
 	export_ template <typename T_Value, typename T_Param, typename T>
 	inline auto member_setter(void(T::*func)(T_Param)) { return [func](Ref object, const Var& v) { (val<T>(object).*func)(val<T_Value>(v)); }; }
 
+	// assigns a value field from a Ref of exactly its type, for the typed setters generated for value members
+	export_ template <class T>
+	inline typename std::enable_if<std::is_copy_assignable<T>::value, void>::type
+		member_assign(T& member, Ref value) { member = val<T>(value); }
+
+	export_ template <class T>
+	inline typename std::enable_if<!std::is_copy_assignable<T>::value, void>::type
+		member_assign(T& member, Ref value) { assign(Ref(&member), value); }
+
 	export_ template <class T>
 	void init_store() {}
 		
@@ -104,13 +113,27 @@ namespace mud
 	}
 
 	export_ template <class T>
-	void meta_class()
+	void init_class()
 	{
-		meta_type<T>();
 		init_destructor<T>();
 		cls<T>().setup_class();
 	}
 
+	export_ template <class T>
+	void meta_class()
+	{
+		meta_type<T>();
+		build_class(type<T>(), [] { init_class<T>(); });
+	}
+
+	// the Class is built by init, the first time cls() is called for the type
+	export_ template <class T>
+	void lazy_class(ClassInit init)
+	{
+		meta_type<T>();
+		g_class_init[type<T>().m_id] = init;
+	}
+
 	export_ template <class T>
 	void meta_enum()
 	{
@@ -138,6 +138,17 @@ def member_getter(c, member):
     else:
         return 'nullptr'
 
+def is_value_field(member):
+    return member.cls.struct and not member.pointer and not member.function and not member.reference
+
+def member_value_accessors(c, member):
+    if not is_value_field(member):
+        return ''
+    field = 'val<' + c.id + '>(object).' + member.member
+    get = '[](Ref object) { return var(' + field + '); }'
+    set = '[](Ref object, Ref value) { member_assign(' + field + ', value); }' if not member.nonmutable else 'nullptr'
+    return ', ' + get + ', ' + set
+
 def member_setter_explicit(c, member):
     if member.setter:
         return '[](Ref object, const Var& v) { val<' + c.id + '>(object).set' + member.capname + '(val<' + member_type(member) + '>(v)); }'
@@ -214,9 +225,11 @@ namespace mud
 % for s in module.sequences :
     {
         static Meta meta = { ${ type_get(s) }, ${ namespace(s) }, "${ s.name }", sizeof(${ s.id }), TypeClass::Sequence };
-        static Class cls = { ${ type_get(s) } };
-        cls.m_content = ${ type_get_pt(s.contentcls) };
-        meta_sequence<${ s.id }, ${ s.content }>();
+        lazy_class<${ s.id }>([] {
+            static Class cls = { ${ type_get(s) } };
+            cls.m_content = ${ type_get_pt(s.contentcls) };
+            init_vector<${ s.id }, ${ s.content }>();
+        });
     }
     
 % endfor
@@ -229,49 +242,51 @@ namespace mud
     // ${ c.id }
     {
         static Meta meta = { ${ type_get(c) }, ${ namespace(c) }, "${ c.name }", sizeof(${ c.id }), ${ type_class(c) } };
-        static Class cls = { ${ type_get(c) },
-            // bases
-            { ${ ', '.join(map(type_get_pt, c.bases)) } },
-            { ${ ', '.join([base_offset_get(c, base) for base in c.bases]) } },
-            // constructors
-            {
-            % for constr in c.constructors :
-                { ${ type_get(c) }, [](Ref ref, array<Var> args) { ${ unused_args(constr) }new(&val<${ c.id }>(ref)) ${ c.id }( ${ get_args(constr.params) } ); }, ${ params_def(constr.expected_params) } }${ "," if not loop.last else "" }
-            % endfor
-            },
-            // copy constructor
-            {
-            % if c.struct:
-                { ${ type_get(c) }, [](Ref ref, Ref other) { new(&val<${ c.id }>(ref)) ${ c.id }(val<${ c.id }>(other)); } }
-            % endif
-            },
-            // members
-            {
-            % for m in c.members :
-                { ${ type_get(c) }, ${ member_identity(c, m) }, ${ type_get(m.cls) }, "${ m.name }", ${ member_default(c, m) }, ${ member_flags(c, m) }, ${ member_getter(c, m) } }${ "," if not loop.last else "" }
-            % endfor
-            },
-            // methods
-            {
-            % for m in c.methods :
-                { ${ type_get(c) }, "${ m.name }", ${ method_identity(c, m) }, ${ method_func(c, m) }, ${ params_def(m.params) }, ${ function_return_def(m) } }${ "," if not loop.last else "" }
-            % endfor
-            },
-            // static members
-            {
-            % for m in c.statics :
-                { ${ type_get(c) }, "${ m.name }", Ref(&${ c.id }::${ m.member }) }${ "," if not loop.last else "" }
-            % endfor
-            }
-        };
+        lazy_class<${ c.id }>([] {
+            static Class cls = { ${ type_get(c) },
+                // bases
+                { ${ ', '.join(map(type_get_pt, c.bases)) } },
+                { ${ ', '.join([base_offset_get(c, base) for base in c.bases]) } },
+                // constructors
+                {
+                % for constr in c.constructors :
+                    { ${ type_get(c) }, [](Ref ref, array<Var> args) { ${ unused_args(constr) }new(&val<${ c.id }>(ref)) ${ c.id }( ${ get_args(constr.params) } ); }, ${ params_def(constr.expected_params) } }${ "," if not loop.last else "" }
+                % endfor
+                },
+                // copy constructor
+                {
+                % if c.struct:
+                    { ${ type_get(c) }, [](Ref ref, Ref other) { new(&val<${ c.id }>(ref)) ${ c.id }(val<${ c.id }>(other)); } }
+                % endif
+                },
+                // members
+                {
+                % for m in c.members :
+                    { ${ type_get(c) }, ${ member_identity(c, m) }, ${ type_get(m.cls) }, "${ m.name }", ${ member_default(c, m) }, ${ member_flags(c, m) }, ${ member_getter(c, m) }${ member_value_accessors(c, m) } }${ "," if not loop.last else "" }
+                % endfor
+                },
+                // methods
+                {
+                % for m in c.methods :
+                    { ${ type_get(c) }, "${ m.name }", ${ method_identity(c, m) }, ${ method_func(c, m) }, ${ params_def(m.params) }, ${ function_return_def(m) } }${ "," if not loop.last else "" }
+                % endfor
+                },
+                // static members
+                {
+                % for m in c.statics :
+                    { ${ type_get(c) }, "${ m.name }", Ref(&${ c.id }::${ m.member }) }${ "," if not loop.last else "" }
+                % endfor
+                }
+            };
         
-        % if c.isProto :
-        cls.m_root = &${ type_get(c.stem) };
-        % endif
+            % if c.isProto :
+            cls.m_root = &${ type_get(c.stem) };
+            % endif
         
-        ${ 'init_pool<' + c.id + '>(); ' if c.constructors and not c.struct else '' }
-        ${ 'init_string<' + c.id + '>(); ' if c.array else ''}
-        meta_class<${ c.id }>();
+            ${ 'init_pool<' + c.id + '>(); ' if c.constructors and not c.struct else '' }
+            ${ 'init_string<' + c.id + '>(); ' if c.array else ''}
+            init_class<${ c.id }>();
+        });
     }
     
         % endif
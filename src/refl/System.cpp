@@ -164,6 +164,8 @@ namespace mud
 		for(Function* function : m.m_functions)
 			m_functions.push_back(function);
 
+		this->index_names();
+
 		for(Module* depend : m_modules)
 			depend->handle_load(m);
 	}
@@ -181,6 +183,8 @@ namespace mud
 		for(Function* function : m.m_functions)
 			vector_remove(m_functions, function);
 
+		this->index_names();
+
 		mud::unload_module(m);
 	}
 
@@ -193,28 +197,40 @@ namespace mud
 		return reloaded;
 	}
 
+	void System::index_names()
+	{
+		m_type_names.clear();
+		m_type_names.reserve(m_types.size());
+		for(size_t i = 0; i < m_types.size(); ++i)
+			m_type_names.insert(m_types[i]->m_name, uint32_t(i));
+
+		m_function_names.clear();
+		m_function_names.reserve(m_functions.size());
+		m_scoped_function_names.clear();
+		m_scoped_function_names.reserve(m_functions.size());
+		for(size_t i = 0; i < m_functions.size(); ++i)
+		{
+			m_function_names.insert(m_functions[i]->m_name, uint32_t(i));
+			m_scoped_function_names.insert(m_functions[i]->m_namespace->m_name, m_functions[i]->m_name, uint32_t(i));
+		}
+	}
+
 	Type* System::find_type(cstring name)
 	{
-		for(Type* type : m_types)
-			if(strcmp(type->m_name, name) == 0)
-				return type;
-		return nullptr;
+		const uint32_t index = m_type_names.find(name);
+		return index != NameTable::NotFound ? m_types[index] : nullptr;
 	}
 
 	Function* System::find_function(cstring name)
 	{
-		for(Function* function : m_functions)
-			if(strcmp(function->m_name, name) == 0)
-				return function;
-		return nullptr;
+		const uint32_t index = m_function_names.find(name);
+		return index != NameTable::NotFound ? m_functions[index] : nullptr;
 	}
 
 	Function* System::find_function(cstring nemespace, cstring name)
 	{
-		for(Function* function : m_functions)
-			if(function->m_namespace->m_name == string(nemespace) && function->m_name == string(name))
-				return function;
-		return nullptr;
+		const uint32_t index = m_scoped_function_names.find(nemespace, name);
+		return index != NameTable::NotFound ? m_functions[index] : nullptr;
 	}
 
 	Function& System::function(FunctionPointer identity)
@@ -250,7 +266,7 @@ namespace mud
 		{
 			printf("INFO: Meta type %s\n", type->m_name);
 
-			if(!g_class[type->m_id])
+			if(!has_class(*type))
 				continue;
 
 			for(Member& member : cls(*type).m_members)
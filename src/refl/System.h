@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <infra/NameTable.h>
 #include <refl/Forward.h>
 #include <refl/Namespace.h>
 
@@ -55,6 +56,14 @@ namespace mud
 		Function* find_function(cstring nemespace, cstring name);
 
 		static System& instance() { static System instance; return instance; }
+
+	private:
+		// rebuilt when a module is loaded or unloaded, so that finding by name doesn't compare against every name
+		void index_names();
+
+		NameTable m_type_names;
+		NameTable m_function_names;
+		NameTable m_scoped_function_names;
 	};
 
 	export_ func_ inline System& system() { return System::instance(); }
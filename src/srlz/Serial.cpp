@@ -171,7 +171,7 @@ namespace mud
 
 		// @note: we MUST take a Var& as parameter of this function for this specific case
 		// -> polymorphic objects must be created by value since we don't know in advance the actual type we are loading
-		if(g_class[type(value).m_id] && cls(value).m_type_member && !typed) // @kludge this parameter is only there to tell us we were called from the typed variant of this function, couldn't think of a better design at this time of the day
+		if(has_class(type(value)) && cls(value).m_type_member && !typed) // @kludge this parameter is only there to tell us we were called from the typed variant of this function, couldn't think of a better design at this time of the day
 		{
 			value = unpack_typed(unpacker, json_value);
 			return;
@@ -204,7 +204,7 @@ namespace mud
 
 		size_t size = json_value.is_array() ? json_value.array_items().size() : json_value.object_items().size();
 
-		if(!g_class[type(value).m_id])
+		if(!has_class(type(value)))
 		{
 			printf("WARNING: unpack - type %s is not a class\n", type(value).m_name);
 			return;
@@ -107,7 +107,7 @@ namespace mud
 		{
 			ui::label(types, m->m_name).enable_state(DISABLED);
 			for(Type* type : m->m_types)
-				if(g_class[type->m_id] && !cls(*type).m_constructors.empty()) //is_struct(*type) || is_base_type(*type))
+				if(has_class(*type) && !cls(*type).m_constructors.empty()) //is_struct(*type) || is_base_type(*type))
 					if(fits_filter(type->m_name, filter))
 						if(ui::multi_button(types, ui::dropdown_styles().choice, carray<cstring, 2>{ "(class)", type->m_name }).activated())
 						{
@@ -217,7 +217,7 @@ namespace mud
 		ui::item(row, meta_styles().type, type.m_name);
 		if(g_enu[type.m_id])
 			meta_enum(self, enu(type));
-		if (g_class[type.m_id])
+		if (has_class(type))
 			meta_class(self, cls(type));
 	}
 